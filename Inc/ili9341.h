@@ -42,15 +42,96 @@
     ((((uint16_t)r & 0xF8) << 8) | (((uint16_t)g & 0xFC) << 3) | (((uint16_t)b & 0xF8) >> 3))
 
 // Other constants
-#define ILI9341_FILL_RECT_BUFFER_SIZE 512   // pixels x 2 bytes per pixel = 1024 bytes
+// Stack buffer sizes, only used when no buffer pool is set with ILI9341_SetBufferPool
+#ifndef ILI9341_FILL_RECT_BUFFER_SIZE
+#define ILI9341_FILL_RECT_BUFFER_SIZE 512  // pixels x 2 bytes per pixel = 1024 bytes
+#endif
+#ifndef ILI9341_DRAW_IMAGE_BUFFER_SIZE
 #define ILI9341_DRAW_IMAGE_BUFFER_SIZE 512  // pixels x 2 bytes per pixel = 1024 bytes
+#endif
+#ifndef ILI9341_DRAW_GLYPH_BUFFER_SIZE
 #define ILI9341_DRAW_GLYPH_BUFFER_SIZE 512  // pixels x 2 bytes per pixel = 1024 bytes
+#endif
 #define FALLBACK_CODEPOINT 0x7F
+#define ILI9341_MAX_LINE_WIDTH 320  // pixels, the long side of the panel
+
+// Framebuffer mode
+#ifndef ILI9341_DIRTY_RECTS_MAX
+#define ILI9341_DIRTY_RECTS_MAX 8  // dirty rectangles tracked before they are forcibly merged
+#endif
+#ifndef ILI9341_DIRTY_MERGE_THRESHOLD
+#define ILI9341_DIRTY_MERGE_THRESHOLD 64  // pixels, merging is preferred if it adds less than this many clean pixels
+#endif
 
 /**
- * @brief ILI9341 handle structure
+ * @brief Rectangle with inclusive corners
+ */
+typedef struct {
+    int16_t x0;
+    int16_t y0;
+    int16_t x1;
+    int16_t y1;
+} ILI9341_RectTypeDef;
+
+/**
+ * @brief Transport used to send pixel data to the display
+ */
+typedef enum {
+    /** Pixel data is sent with HAL_SPI_Transmit, drawing functions return after the last byte is sent */
+    ILI9341_TRANSPORT_BLOCKING = 0,
+    /** Pixel data is sent with HAL_SPI_Transmit_DMA, drawing functions may return while the last transfer is still in
+     * progress */
+    ILI9341_TRANSPORT_DMA
+} ILI9341_TransportTypeDef;
+
+/**
+ * @brief Glyph cache entry, the key of a cached glyph and when it was last used
  */
 typedef struct {
+    /** Glyph data pointer, NULL if the entry is free. Glyphs can share data, so the size and encoding are part of the
+     * key as well */
+    const uint8_t* data;
+    int8_t bbW;
+    int8_t bbH;
+    uint8_t encoding;
+    uint16_t color;
+    uint16_t bg_color;
+    int_fast16_t scale;
+    uint32_t last_used;
+} ILI9341_GlyphCacheEntryTypeDef;
+
+/**
+ * @brief Glyph cache, keeps rendered opaque glyphs ready to be sent, see ILI9341_GlyphCache_Init
+ */
+typedef struct {
+    ILI9341_GlyphCacheEntryTypeDef* entries;
+    size_t entry_count;
+    uint16_t* pixels;
+    /** Size of the slot of each entry in pixels, larger glyphs are not cached */
+    size_t slot_size;
+    uint32_t clock;
+    /** Statistics, can be reset by the application */
+    uint32_t hits;
+    uint32_t misses;
+} ILI9341_GlyphCacheTypeDef;
+
+/**
+ * @brief Colors of the coverage values of anti-aliased glyphs for a color pair
+ */
+typedef struct {
+    /** Text and background colors, byte-swapped */
+    uint16_t color;
+    uint16_t bg_color;
+    /** Bits per pixel of the coverage values, 0 before the first anti-aliased glyph */
+    uint8_t bpp;
+    /** Blended colors, byte-swapped, indexed by coverage from the background to the text color */
+    uint16_t colors[16];
+} ILI9341_BlendRampTypeDef;
+
+/**
+ * @brief ILI9341 handle structure
+ */
+typedef struct __ILI9341_HandleTypeDef {
     SPI_HandleTypeDef* spi_handle;
     GPIO_TypeDef* cs_port;
     uint16_t cs_pin;
@@ -61,13 +142,61 @@ typedef struct {
     int_fast8_t rotation;
     int_fast16_t width;
     int_fast16_t height;
+
+    /** Transport settings, use ILI9341_SetTransport to change */
+    ILI9341_TransportTypeDef transport;
+    void (*transfer_complete_callback)(struct __ILI9341_HandleTypeDef* ili9341);
+
+    /** Buffer pool used to stage pixel data, use ILI9341_SetBufferPool to change */
+    uint16_t* buffer_pool;
+    size_t buffer_pool_size;
+
+    /** DMA transfer state, owned by the driver */
+    volatile bool transfer_busy;
+    volatile bool deselect_pending;
+    uint8_t* transfer_data;
+    size_t transfer_period;
+    size_t transfer_offset;
+    size_t transfer_remaining;
+
+    /** Last programmed address window and GRAM write pointer, owned by the driver */
+    bool window_valid;
+    bool window_pointer_valid;
+    uint16_t window_x0;
+    uint16_t window_y0;
+    uint16_t window_x1;
+    uint16_t window_y1;
+    uint16_t window_pointer_x;
+    uint16_t window_pointer_y;
+
+    /** Framebuffer settings, use ILI9341_SetFramebuffer to change */
+    uint16_t* framebuffer;
+    int_fast16_t framebuffer_y;
+    int_fast16_t framebuffer_height;
+    ILI9341_RectTypeDef dirty_rects[ILI9341_DIRTY_RECTS_MAX];
+    uint_fast8_t dirty_count;
+
+    /** Drawing is limited to this rectangle, use ILI9341_SetClipRect to change */
+    ILI9341_RectTypeDef clip_rect;
+
+    /** Hardware scrolling settings, use ILI9341_SetScrollArea and ILI9341_SetScrollOffset to change */
+    int_fast16_t scroll_top;
+    int_fast16_t scroll_bottom;
+    int_fast16_t scroll_offset;
+
+    /** Glyph cache, use ILI9341_SetGlyphCache to change */
+    ILI9341_GlyphCacheTypeDef* glyph_cache;
+
+    /** Blend ramp of the last color pair used for anti-aliased glyphs, owned by the driver */
+    ILI9341_BlendRampTypeDef blend_ramp;
 } ILI9341_HandleTypeDef;
 
 /**
  * @brief Deselect the ILI9341 display, call before using other SPI peripherals on the same bus
  * @param ili9341 Pointer to ILI9341 handle structure
+ * @note With the DMA transport the display is deselected once the current transfer is completed.
  */
-void ILI9341_Deselect(const ILI9341_HandleTypeDef* ili9341);
+void ILI9341_Deselect(ILI9341_HandleTypeDef* ili9341);
 
 /**
  * @brief Initialize the ILI9341 display
@@ -97,6 +226,156 @@ ILI9341_HandleTypeDef ILI9341_Init(
     int_fast16_t height
 );
 
+/**
+ * @brief Select the transport used to send pixel data
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param transport One of ILI9341_TRANSPORT_* values
+ * @param callback Function called (from the SPI interrupt when using DMA) every time a transfer is completed, can be
+ *                 NULL
+ * @note With ILI9341_TRANSPORT_DMA, ILI9341_SPI_TxCpltCallback must be called from HAL_SPI_TxCpltCallback. Without a
+ * buffer pool (see ILI9341_SetBufferPool), drawing functions that generate pixel data (fill, glyph, clipped image)
+ * wait for their transfers to finish before returning.
+ */
+void ILI9341_SetTransport(
+    ILI9341_HandleTypeDef* ili9341,
+    ILI9341_TransportTypeDef transport,
+    void (*callback)(ILI9341_HandleTypeDef* ili9341)
+);
+
+/**
+ * @brief Set the buffer pool used to stage pixel data, replacing the stack buffers of ILI9341_*_BUFFER_SIZE pixels
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param buffer Buffer pool, NULL to go back to the stack buffers. Must stay valid while it is set. For the DMA
+ *               transport it must be accessible by the DMA controller and, with D-cache enabled, be placed in a
+ *               non-cacheable memory region.
+ * @param bufferSize Size of the buffer pool in pixels
+ * @note With the DMA transport the pool is used as two ping-pong buffers of bufferSize / 2 pixels, the next chunk is
+ * prepared in one half while the other half is being sent.
+ */
+void ILI9341_SetBufferPool(ILI9341_HandleTypeDef* ili9341, uint16_t* buffer, size_t bufferSize);
+
+/**
+ * @brief Check if a DMA transfer to the display is still in progress
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @return true if a transfer is in progress, false otherwise
+ */
+bool ILI9341_IsBusy(const ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Block until the DMA transfer to the display (if any) is completed, call before modifying or freeing data
+ * passed to ILI9341_DrawImage or before using other SPI peripherals on the same bus
+ * @param ili9341 Pointer to ILI9341 handle structure
+ */
+void ILI9341_WaitForTransfer(const ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Transfer complete handler for the DMA transport, call from HAL_SPI_TxCpltCallback
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param hspi SPI handle passed to HAL_SPI_TxCpltCallback, the call is ignored if it is not the display's SPI handle
+ */
+void ILI9341_SPI_TxCpltCallback(ILI9341_HandleTypeDef* ili9341, SPI_HandleTypeDef* hspi);
+
+/**
+ * @brief Render into a RAM framebuffer instead of the display, see ILI9341_Flush
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param framebuffer Framebuffer of width * height pixels in RGB565 format with the 2 bytes swapped (same as
+ *                    ILI9341_DrawImage), NULL to draw directly to the display again. Must stay valid while it is set.
+ *                    With the DMA transport it must be accessible by the DMA controller and, with D-cache enabled,
+ *                    be placed in a non-cacheable memory region.
+ * @note All drawing functions render into the framebuffer and record the area they touched. Other functions (e.g.
+ * brightness, orientation) still talk to the display directly. Changing the orientation marks the whole framebuffer
+ * as dirty but does not rearrange its content.
+ */
+void ILI9341_SetFramebuffer(ILI9341_HandleTypeDef* ili9341, uint16_t* framebuffer);
+
+/**
+ * @brief Mark an area of the framebuffer as dirty, for when the framebuffer is modified directly
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the area
+ * @param y Y coordinate of the top-left corner of the area
+ * @param w Width of the area in pixels
+ * @param h Height of the area in pixels
+ */
+void ILI9341_MarkDirty(ILI9341_HandleTypeDef* ili9341, int_fast16_t x, int_fast16_t y, int_fast16_t w, int_fast16_t h);
+
+/**
+ * @brief Send the dirty areas of the framebuffer to the display, one address window per dirty rectangle
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @note Overlapping or nearby dirty areas are merged as they are recorded, at most ILI9341_DIRTY_RECTS_MAX windows
+ * are sent. With the DMA transport this returns while the last rows are still being sent.
+ */
+void ILI9341_Flush(ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Initialize a glyph cache
+ * @param entries Array of cache entries, one per cached glyph
+ * @param entryCount Number of entries
+ * @param pixels Memory for the rendered glyphs, split in one slot per entry. With the DMA transport it must be
+ *               accessible by the DMA controller and, with D-cache enabled, be placed in a non-cacheable memory region
+ * @param pixelsSize Size of the pixel memory in pixels (2 bytes each)
+ * @return Initialized ILI9341_GlyphCacheTypeDef structure
+ * @note Each slot holds glyphs of up to pixelsSize / entryCount pixels after scaling, e.g. 8 * 16 = 128 for
+ * Terminus 8x16 at scale 1.
+ */
+ILI9341_GlyphCacheTypeDef ILI9341_GlyphCache_Init(
+    ILI9341_GlyphCacheEntryTypeDef* entries,
+    size_t entryCount,
+    uint16_t* pixels,
+    size_t pixelsSize
+);
+
+/**
+ * @brief Use a glyph cache for opaque text, the least recently used glyph is replaced when the cache is full
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param cache Pointer to the glyph cache, NULL to disable caching. Must stay valid while it is set, and can be shared
+ *              between handles using the same transport
+ * @note Only glyphs that are not clipped are drawn from the cache. A hit is sent as is from the cache memory.
+ */
+void ILI9341_SetGlyphCache(ILI9341_HandleTypeDef* ili9341, ILI9341_GlyphCacheTypeDef* cache);
+
+/**
+ * @brief Limit drawing to a rectangle, pixels outside of it are left untouched
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the top-left corner of the rectangle
+ * @param y Y coordinate of the top-left corner of the rectangle
+ * @param w Width of the rectangle in pixels
+ * @param h Height of the rectangle in pixels
+ * @note The rectangle is clipped to the screen. It is reset to the whole screen when the orientation changes.
+ */
+void ILI9341_SetClipRect(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h
+);
+
+/**
+ * @brief Allow drawing on the whole screen again
+ * @param ili9341 Pointer to ILI9341 handle structure
+ */
+void ILI9341_ResetClipRect(ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Render a frame in horizontal bands through a small buffer, without a full screen framebuffer
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param buffer Band buffer in RGB565 format, with the DMA transport it is split in two bands so that one band is
+ *               rendered while the other one is being sent
+ * @param bufferSize Size of the band buffer in pixels, must hold at least one row (two rows with the DMA transport)
+ * @param draw Function drawing the frame, called once per band with the clip rectangle set to the band
+ * @param context Pointer passed to the draw function
+ * @note Only the area inside the current clip rectangle is rendered and sent. Every pixel is sent exactly once, so
+ * overlapping primitives do not flicker. The draw function must only use the drawing functions of this driver and
+ * draw the same frame every time it is called.
+ */
+void ILI9341_RenderBands(
+    ILI9341_HandleTypeDef* ili9341,
+    uint16_t* buffer,
+    size_t bufferSize,
+    void (*draw)(ILI9341_HandleTypeDef* ili9341, void* context),
+    void* context
+);
+
 /**
  * @brief Set display orientation
  * @param ili9341 Pointer to ILI9341 handle structure
@@ -104,19 +383,49 @@ ILI9341_HandleTypeDef ILI9341_Init(
  */
 void ILI9341_SetOrientation(ILI9341_HandleTypeDef* ili9341, int_fast8_t rotation);
 
+/**
+ * @brief Define the hardware scrolling area, between a fixed area at the top and one at the bottom
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param top Size of the fixed area at the top in pixels
+ * @param bottom Size of the fixed area at the bottom in pixels
+ * @note The panel scrolls along its long side: the Y axis in vertical orientations and the X axis in horizontal
+ * orientations, where top and bottom are the left and right sides. The scroll offset is reset to 0.
+ */
+void ILI9341_SetScrollArea(ILI9341_HandleTypeDef* ili9341, int_fast16_t top, int_fast16_t bottom);
+
+/**
+ * @brief Scroll the content of the scrolling area without redrawing it
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param offset Number of pixels the content is moved towards the top (or left), wraps around the scrolling area
+ * @note Content that leaves the top of the area appears again at the bottom, draw there with the coordinates returned
+ * by ILI9341_ScrollTranslate to replace it.
+ */
+void ILI9341_SetScrollOffset(ILI9341_HandleTypeDef* ili9341, int_fast16_t offset);
+
+/**
+ * @brief Translate a position on the screen to the coordinate to draw at, taking the scroll offset into account
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param position Position along the scrolling axis (Y in vertical orientations, X in horizontal ones)
+ * @return Coordinate to pass to the drawing functions for the pixels to appear at position, unchanged in the fixed
+ * areas
+ * @note Drawing functions do not translate by themselves, and a shape that crosses the end of the scrolling area
+ * has to be drawn in two parts.
+ */
+int_fast16_t ILI9341_ScrollTranslate(const ILI9341_HandleTypeDef* ili9341, int_fast16_t position);
+
 /**
  * @brief Set display brightness (only for displays with backlight control via ILI9341)
  * @param ili9341 Pointer to ILI9341 handle structure
  * @param brightness Brightness level from 0 (min) to 255 (max)
  */
-void ILI9341_SetBrightness(const ILI9341_HandleTypeDef* ili9341, uint_fast8_t brightness);
+void ILI9341_SetBrightness(ILI9341_HandleTypeDef* ili9341, uint_fast8_t brightness);
 
 /**
  * @brief Invert the display colors
  * @param ili9341 Pointer to ILI9341 handle structure
  * @param invert true to invert colors, false for normal colors
  */
-void ILI9341_InvertColors(const ILI9341_HandleTypeDef* ili9341, bool invert);
+void ILI9341_InvertColors(ILI9341_HandleTypeDef* ili9341, bool invert);
 
 /**
  * @brief Draw a single pixel at specified coordinates
@@ -125,7 +434,7 @@ void ILI9341_InvertColors(const ILI9341_HandleTypeDef* ili9341, bool invert);
  * @param y Y coordinate of the pixel
  * @param color 16-bit color of the pixel in RGB565 format
  */
-void ILI9341_DrawPixel(const ILI9341_HandleTypeDef* ili9341, int_fast16_t x, int_fast16_t y, uint16_t color);
+void ILI9341_DrawPixel(ILI9341_HandleTypeDef* ili9341, int_fast16_t x, int_fast16_t y, uint16_t color);
 
 /**
  * @brief Fill a rectangle with specified color
@@ -137,7 +446,7 @@ void ILI9341_DrawPixel(const ILI9341_HandleTypeDef* ili9341, int_fast16_t x, int
  * @param color 16-bit fill color in RGB565 format
  */
 void ILI9341_FillRectangle(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t w,
@@ -150,14 +459,40 @@ void ILI9341_FillRectangle(
  * @param ili9341 Pointer to ILI9341 handle structure
  * @param color 16-bit fill color in RGB565 format
  */
-void ILI9341_FillScreen(const ILI9341_HandleTypeDef* ili9341, uint16_t color);
+void ILI9341_FillScreen(ILI9341_HandleTypeDef* ili9341, uint16_t color);
+
+/**
+ * @brief Decode the next character of a UTF-8 string
+ * @param str Pointer to the string pointer, moved past the character
+ * @return Unicode codepoint of the character, 0 at the end of the string (the pointer is not moved)
+ * @note A byte that does not start a valid UTF-8 sequence is returned as is, so Latin-1 text still shows mostly right.
+ */
+uint32_t ILI9341_DecodeUTF8(const char** str);
+
+/**
+ * @brief Get the glyph of a character, in O(log n) of the number of codepoint ranges of the font
+ * @param font Font definition
+ * @param codepoint Unicode codepoint of the character
+ * @return Glyph of the character, the FALLBACK_CODEPOINT glyph (or else the first glyph) if the font does not cover it
+ */
+ILI9341_GlyphDef ILI9341_GetGlyph(ILI9341_FontDef font, uint32_t codepoint);
+
+/**
+ * @brief Get the kerning of a pair of characters, in O(log n) of the number of kerning pairs of the font
+ * @param font Font definition
+ * @param left Unicode codepoint of the left character
+ * @param right Unicode codepoint of the right character
+ * @return Adjustment of the advance of the left character in pixels before scaling, 0 if the pair is not kerned
+ * @note Fonts without kerning pairs return at once, so monospace fonts do not pay for kerning.
+ */
+int_fast8_t ILI9341_GetKerning(ILI9341_FontDef font, uint32_t left, uint32_t right);
 
 /**
  * @brief Write a string to the display with specified font and colors
  * @param ili9341 Pointer to ILI9341 handle structure
  * @param x X coordinate of the left of the string
  * @param y Y coordinate of the baseline of the string
- * @param str Null-terminated string to write
+ * @param str Null-terminated UTF-8 string to write
  * @param font Font definition to use for rendering the string
  * @param color 16-bit text color in RGB565 format
  * @param bgcolor 16-bit background color in RGB565 format
@@ -167,9 +502,12 @@ void ILI9341_FillScreen(const ILI9341_HandleTypeDef* ili9341, uint16_t color);
  *                 with ILI9341_WriteStringTransparent to avoid background overlap)
  * @param leading Additional space in pixels between lines when wrapping, can be negative (negative leading should only
  *                be used with ILI9341_WriteStringTransparent to avoid background overlap)
+ * @note Pairs of characters kerned by the font are moved by their kerning times the scale, tracking is added on top of
+ * it. As with negative tracking, a glyph kerned into its neighbour covers it with its background, prefer
+ * ILI9341_WriteStringLine for kerned fonts.
  */
 void ILI9341_WriteString(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     const char* str,
@@ -182,21 +520,80 @@ void ILI9341_WriteString(
     int_fast16_t leading
 );
 
+/**
+ * @brief Write a character filling a whole character cell, the area around the glyph is filled with the background
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the left of the cell
+ * @param y Y coordinate of the top of the cell, the baseline is font.ascent * scale pixels below
+ * @param w Width of the cell in pixels
+ * @param h Height of the cell in pixels
+ * @param codepoint Unicode codepoint of the character to write
+ * @param font Font definition to use for rendering the character
+ * @param color 16-bit text color in RGB565 format
+ * @param bgcolor 16-bit background color in RGB565 format
+ * @param scale Integer scaling factor for the font, must be >= 1
+ * @note The cell is sent as a single address window, parts of the glyph outside of the cell are not drawn.
+ */
+void ILI9341_DrawCharCell(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint32_t codepoint,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgcolor,
+    int_fast16_t scale
+);
+
+/**
+ * @brief Write a single line of text as one address window, the whole line box is filled with the background
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the left of the string
+ * @param y Y coordinate of the baseline of the string
+ * @param str UTF-8 string to write, stops at the first '\0', '\r' or '\n'
+ * @param length Maximum number of bytes of the string to write, SIZE_MAX for the whole line
+ * @param font Font definition to use for rendering the string
+ * @param color 16-bit text color in RGB565 format
+ * @param bgcolor 16-bit background color in RGB565 format
+ * @param scale Integer scaling factor for the font, must be >= 1
+ * @param tracking Additional space in pixels between characters, can be negative
+ * @note The line box spans from the ascent to the descent of the font, and from x to the end of the last character
+ * (or of any glyph sticking out). Overlapping glyphs are merged and gaps between them are background, so text can be
+ * redrawn in place without flicker. Parts of glyphs above the ascent or below the descent are not drawn. At most
+ * ILI9341_MAX_LINE_WIDTH glyphs inside the clip rectangle are drawn, later ones are left as background.
+ */
+void ILI9341_WriteStringLine(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    size_t length,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgcolor,
+    int_fast16_t scale,
+    int_fast16_t tracking
+);
+
 /**
  * @brief Write a scaled string to the display with specified font and color, background is not drawn (transparent)
  * @param ili9341 Pointer to ILI9341 handle structure
  * @param x X coordinate of the left corner of the string
  * @param y Y coordinate of the baseline corner of the string
- * @param str Null-terminated string to write
+ * @param str Null-terminated UTF-8 string to write
  * @param font Font definition to use for rendering the string
  * @param color 16-bit text color in RGB565 format
  * @param wrap Whether to wrap text to the next line if it exceeds display width
  * @param scale Integer scaling factor for the font, must be >= 1
  * @param tracking Additional space in pixels between characters, can be negative
  * @param leading Additional space in pixels between lines when wrapping, can be negative
+ * @note The display content cannot be blended with, so anti-aliased glyphs only draw the pixels with at least half
+ * coverage.
  */
 void ILI9341_WriteStringTransparent(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     const char* str,
@@ -217,9 +614,11 @@ void ILI9341_WriteStringTransparent(
  * @param h Height of the image in pixels
  * @param data Pointer to the image pixel data in RGB565 format with the 2 bytes swapped, must contain at least w*h
  * elements
+ * @note With the DMA transport an image that is not clipped is sent directly from data, which must stay valid until
+ * the transfer is completed (see ILI9341_WaitForTransfer).
  */
 void ILI9341_DrawImage(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t w,
@@ -237,7 +636,7 @@ void ILI9341_DrawImage(
  * @param color 16-bit line color in RGB565 format
  */
 void ILI9341_DrawLine(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x1,
     int_fast16_t y1,
     int_fast16_t x2,
@@ -257,7 +656,7 @@ void ILI9341_DrawLine(
  * @param cap true to draw rounded line caps, false for no caps
  */
 void ILI9341_DrawLineThick(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x1,
     int_fast16_t y1,
     int_fast16_t x2,
@@ -277,7 +676,7 @@ void ILI9341_DrawLineThick(
  * @param color 16-bit rectangle color in RGB565 format
  */
 void ILI9341_DrawRectangle(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t w,
@@ -296,7 +695,7 @@ void ILI9341_DrawRectangle(
  * @param thickness Line thickness in pixels, must be >= 1
  */
 void ILI9341_DrawRectangleThick(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t w,
@@ -314,7 +713,7 @@ void ILI9341_DrawRectangleThick(
  * @param color 16-bit circle color in RGB565 format
  */
 void ILI9341_DrawCircle(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t r,
@@ -331,7 +730,7 @@ void ILI9341_DrawCircle(
  * @param thickness Circle line thickness in pixels, must be >= 1 and <= r
  */
 void ILI9341_DrawCircleThick(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x0,
     int_fast16_t y0,
     int_fast16_t r,
@@ -348,7 +747,7 @@ void ILI9341_DrawCircleThick(
  * @param color 16-bit circle color in RGB565 format
  */
 void ILI9341_FillCircle(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t r,
@@ -365,7 +764,7 @@ void ILI9341_FillCircle(
  * @param color 16-bit ellipse color in RGB565 format
  */
 void ILI9341_DrawEllipse(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t xc,
     int_fast16_t yc,
     int_fast16_t rx,
@@ -384,7 +783,7 @@ void ILI9341_DrawEllipse(
  * @param thickness Ellipse line thickness in pixels, must be >= 1
  */
 void ILI9341_DrawEllipseThick(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t xc,
     int_fast16_t yc,
     int_fast16_t rx,
@@ -403,7 +802,7 @@ void ILI9341_DrawEllipseThick(
  * @param color 16-bit ellipse color in RGB565 format
  */
 void ILI9341_FillEllipse(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t xc,
     int_fast16_t yc,
     int_fast16_t rx,
@@ -420,7 +819,7 @@ void ILI9341_FillEllipse(
  * @param color 16-bit polygon color in RGB565 format
  * @note The polygon is automatically closed by connecting the last vertex to the first.
  */
-void ILI9341_DrawPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color);
+void ILI9341_DrawPolygon(ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color);
 
 /**
  * @brief Draw a thick polygon outline
@@ -434,7 +833,7 @@ void ILI9341_DrawPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16
  * @note The polygon is automatically closed by connecting the last vertex to the first.
  */
 void ILI9341_DrawPolygonThick(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int16_t* x,
     int16_t* y,
     size_t n,
@@ -453,6 +852,6 @@ void ILI9341_DrawPolygonThick(
  * @note The algorithm used is scanline algorithm, with support for concave and self-intersecting polygons. Max
  * intersections for scanline is 32.
  */
-void ILI9341_FillPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color);
+void ILI9341_FillPolygon(ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color);
 
 #endif  // __ILI9341_H__
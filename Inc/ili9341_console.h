@@ -0,0 +1,158 @@
+#ifndef __ILI9341_CONSOLE_H__
+#define __ILI9341_CONSOLE_H__
+
+#include "ili9341.h"
+#include "ili9341_fonts.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+#define ILI9341_CONSOLE_TAB_SIZE 8
+
+/**
+ * @brief Console cell, a character with its colors
+ */
+typedef struct {
+    /** Unicode codepoint of the character */
+    uint16_t ch;
+    /** Set when the cell has to be drawn again, owned by the console */
+    uint8_t dirty;
+    uint16_t color;
+    uint16_t bg_color;
+} ILI9341_Console_CellTypeDef;
+
+/**
+ * @brief Text console handle structure, a grid of character cells drawn with a monospace font
+ * @note Writing to the console only updates the cells, ILI9341_Console_Flush draws the cells that changed since the
+ * last flush. Rows are stored as a ring, so scrolling does not move any cell.
+ */
+typedef struct {
+    ILI9341_HandleTypeDef* ili9341;
+    ILI9341_FontDef font;
+    int_fast16_t scale;
+    int_fast16_t x;
+    int_fast16_t y;
+    int_fast16_t columns;
+    int_fast16_t rows;
+    int_fast16_t cell_width;
+    int_fast16_t cell_height;
+    ILI9341_Console_CellTypeDef* cells;
+
+    /** Index of the cell row shown at the top of the console */
+    int_fast16_t first_row;
+    int_fast16_t cursor_column;
+    int_fast16_t cursor_row;
+    uint16_t color;
+    uint16_t bg_color;
+
+    /** Bytes of a UTF-8 sequence that is not complete yet */
+    char utf8[5];
+    uint8_t utf8_length;
+
+    /** Hardware scrolling state, use ILI9341_Console_EnableHardwareScroll to change */
+    bool hardware_scroll;
+    int_fast16_t scroll_offset;
+} ILI9341_Console_HandleTypeDef;
+
+/**
+ * @brief Initialize a console, all cells are cleared and drawn on the next flush
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the left of the console
+ * @param y Y coordinate of the top of the console
+ * @param columns Number of characters per row
+ * @param rows Number of rows
+ * @param cells Storage for columns * rows cells, must stay valid while the console is used
+ * @param font Monospace font definition, the cell size is the average width by the ascent + descent of the font
+ * @param scale Integer scaling factor for the font, must be >= 1
+ * @param color Initial 16-bit text color in RGB565 format
+ * @param bgcolor Initial 16-bit background color in RGB565 format
+ * @return Initialized ILI9341_Console_HandleTypeDef structure
+ */
+ILI9341_Console_HandleTypeDef ILI9341_Console_Init(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t columns,
+    int_fast16_t rows,
+    ILI9341_Console_CellTypeDef* cells,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    uint16_t color,
+    uint16_t bgcolor
+);
+
+/**
+ * @brief Set the colors of the characters written from now on
+ * @param console Pointer to console handle structure
+ * @param color 16-bit text color in RGB565 format
+ * @param bgcolor 16-bit background color in RGB565 format
+ */
+void ILI9341_Console_SetColors(ILI9341_Console_HandleTypeDef* console, uint16_t color, uint16_t bgcolor);
+
+/**
+ * @brief Move the cursor
+ * @param console Pointer to console handle structure
+ * @param column Column of the cursor, clamped to the console
+ * @param row Row of the cursor, clamped to the console
+ */
+void ILI9341_Console_SetCursor(ILI9341_Console_HandleTypeDef* console, int_fast16_t column, int_fast16_t row);
+
+/**
+ * @brief Write a character at the cursor and advance it, scrolling the console when the cursor leaves the last row
+ * @param console Pointer to console handle structure
+ * @param ch Byte of a UTF-8 string to write, '\n', '\r', '\t' and '\b' move the cursor, other control characters are
+ * ignored
+ * @note A character encoded in several bytes is written once its last byte is received.
+ */
+void ILI9341_Console_PutChar(ILI9341_Console_HandleTypeDef* console, char ch);
+
+/**
+ * @brief Write a string at the cursor, see ILI9341_Console_PutChar
+ * @param console Pointer to console handle structure
+ * @param str Null-terminated UTF-8 string to write
+ */
+void ILI9341_Console_Write(ILI9341_Console_HandleTypeDef* console, const char* str);
+
+/**
+ * @brief Scroll the content of the console up, the rows at the bottom are cleared with the current colors
+ * @param console Pointer to console handle structure
+ * @param lines Number of rows to scroll by
+ */
+void ILI9341_Console_Scroll(ILI9341_Console_HandleTypeDef* console, int_fast16_t lines);
+
+/**
+ * @brief Clear from the cursor to the end of its row with the current colors, the cursor does not move
+ * @param console Pointer to console handle structure
+ */
+void ILI9341_Console_ClearToEndOfLine(ILI9341_Console_HandleTypeDef* console);
+
+/**
+ * @brief Clear the whole console with the current colors and move the cursor to the top-left cell
+ * @param console Pointer to console handle structure
+ */
+void ILI9341_Console_Clear(ILI9341_Console_HandleTypeDef* console);
+
+/**
+ * @brief Use the hardware scrolling of the display to scroll the console
+ * @param console Pointer to console handle structure
+ * @param enable Whether to use hardware scrolling
+ * @return true if hardware scrolling is used
+ * @note Only possible in vertical orientations, the whole width of the display between the top and the bottom of the
+ * console scrolls with it. Scrolling then only redraws the cleared row. The scroll area of the display is defined
+ * by the console. Enabling it keeps what is on the display, disabling it after the console scrolled marks all cells
+ * to be drawn again on the next flush.
+ */
+bool ILI9341_Console_EnableHardwareScroll(ILI9341_Console_HandleTypeDef* console, bool enable);
+
+/**
+ * @brief Mark all cells to be drawn again, e.g. after something else was drawn over the console
+ * @param console Pointer to console handle structure
+ */
+void ILI9341_Console_Invalidate(ILI9341_Console_HandleTypeDef* console);
+
+/**
+ * @brief Draw the cells that changed since the last flush
+ * @param console Pointer to console handle structure
+ */
+void ILI9341_Console_Flush(ILI9341_Console_HandleTypeDef* console);
+
+#endif  // __ILI9341_CONSOLE_H__
@@ -0,0 +1,307 @@
+#ifndef __ILI9341_DISPLAYLIST_H__
+#define __ILI9341_DISPLAYLIST_H__
+
+#include "ili9341.h"
+#include "ili9341_fonts.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+/**
+ * @brief Display list handle structure, a sequence of recorded drawing commands stored in a caller-provided arena
+ * @note Each command is stored with its opcode, the bounding box of the pixels it can touch and its arguments.
+ * Strings, polygon vertices and fonts are copied into the arena, image data is referenced by pointer.
+ */
+typedef struct {
+    uint8_t* buffer;
+    size_t size;
+    size_t used;
+    size_t last;
+    size_t count;
+    /** Set when a command did not fit in the arena, the list is incomplete until cleared */
+    bool overflow;
+} ILI9341_DisplayList_HandleTypeDef;
+
+/**
+ * @brief Initialize an empty display list
+ * @param buffer Arena to store the commands in, must be aligned to 4 bytes and stay valid while the list is used
+ * @param bufferSize Size of the arena in bytes
+ * @return Initialized ILI9341_DisplayList_HandleTypeDef structure
+ */
+ILI9341_DisplayList_HandleTypeDef ILI9341_DisplayList_Init(uint8_t* buffer, size_t bufferSize);
+
+/**
+ * @brief Remove all commands from the display list
+ * @param list Pointer to display list handle structure
+ */
+void ILI9341_DisplayList_Clear(ILI9341_DisplayList_HandleTypeDef* list);
+
+/**
+ * @brief Draw all commands of the display list, commands outside of the clip rectangle are skipped
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param list Pointer to display list handle structure
+ */
+void ILI9341_DisplayList_Replay(ILI9341_HandleTypeDef* ili9341, const ILI9341_DisplayList_HandleTypeDef* list);
+
+/**
+ * @brief Same as ILI9341_DisplayList_Replay, with the signature of the ILI9341_RenderBands draw function
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param list Pointer to display list handle structure
+ */
+void ILI9341_DisplayList_ReplayCallback(ILI9341_HandleTypeDef* ili9341, void* list);
+
+/**
+ * @brief Bring the display from the frame of one display list to the frame of another, only redrawing what changed
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param previous Pointer to the display list currently on the display, NULL to draw the whole next list
+ * @param next Pointer to the display list to display
+ * @param buffer Optional band buffer, see ILI9341_RenderBands. If set, the changed areas are rendered in bands so
+ *               that every pixel is sent once, otherwise they are drawn directly
+ * @param bufferSize Size of the band buffer in pixels
+ * @note The commands the two lists start and end with are compared, the bounding boxes of the commands in between
+ * are redrawn by replaying the next list clipped to them. The next list must paint every pixel of the changed areas
+ * (e.g. start with a background fill), and image data is compared by pointer only.
+ */
+void ILI9341_DisplayList_Update(
+    ILI9341_HandleTypeDef* ili9341,
+    const ILI9341_DisplayList_HandleTypeDef* previous,
+    const ILI9341_DisplayList_HandleTypeDef* next,
+    uint16_t* buffer,
+    size_t bufferSize
+);
+
+/**
+ * @brief Record ILI9341_DrawPixel, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_DrawPixel(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint16_t color
+);
+
+/**
+ * @brief Record ILI9341_FillRectangle, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_FillRectangle(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint16_t color
+);
+
+/**
+ * @brief Record ILI9341_FillScreen, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_FillScreen(ILI9341_DisplayList_HandleTypeDef* list, uint16_t color);
+
+/**
+ * @brief Record ILI9341_WriteString, see ili9341.h for the arguments
+ * @note The string is copied into the display list.
+ */
+void ILI9341_DisplayList_WriteString(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgcolor,
+    bool wrap,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading
+);
+
+/**
+ * @brief Record ILI9341_WriteStringTransparent, see ili9341.h for the arguments
+ * @note The string is copied into the display list.
+ */
+void ILI9341_DisplayList_WriteStringTransparent(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    ILI9341_FontDef font,
+    uint16_t color,
+    bool wrap,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading
+);
+
+/**
+ * @brief Record ILI9341_DrawImage, see ili9341.h for the arguments
+ * @note Only the pointer to the image data is recorded, it must stay valid while the display list is used.
+ */
+void ILI9341_DisplayList_DrawImage(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data
+);
+
+/**
+ * @brief Record ILI9341_DrawLine, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_DrawLine(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x1,
+    int_fast16_t y1,
+    int_fast16_t x2,
+    int_fast16_t y2,
+    uint16_t color
+);
+
+/**
+ * @brief Record ILI9341_DrawLineThick, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_DrawLineThick(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x1,
+    int_fast16_t y1,
+    int_fast16_t x2,
+    int_fast16_t y2,
+    uint16_t color,
+    int_fast16_t thickness,
+    bool cap
+);
+
+/**
+ * @brief Record ILI9341_DrawRectangle, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_DrawRectangle(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint16_t color
+);
+
+/**
+ * @brief Record ILI9341_DrawRectangleThick, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_DrawRectangleThick(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint16_t color,
+    int_fast16_t thickness
+);
+
+/**
+ * @brief Record ILI9341_DrawCircle, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_DrawCircle(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t r,
+    uint16_t color
+);
+
+/**
+ * @brief Record ILI9341_DrawCircleThick, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_DrawCircleThick(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t r,
+    uint16_t color,
+    int_fast16_t thickness
+);
+
+/**
+ * @brief Record ILI9341_FillCircle, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_FillCircle(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t r,
+    uint16_t color
+);
+
+/**
+ * @brief Record ILI9341_DrawEllipse, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_DrawEllipse(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t xc,
+    int_fast16_t yc,
+    int_fast16_t rx,
+    int_fast16_t ry,
+    uint16_t color
+);
+
+/**
+ * @brief Record ILI9341_DrawEllipseThick, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_DrawEllipseThick(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t xc,
+    int_fast16_t yc,
+    int_fast16_t rx,
+    int_fast16_t ry,
+    uint16_t color,
+    int_fast16_t thickness
+);
+
+/**
+ * @brief Record ILI9341_FillEllipse, see ili9341.h for the arguments
+ */
+void ILI9341_DisplayList_FillEllipse(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t xc,
+    int_fast16_t yc,
+    int_fast16_t rx,
+    int_fast16_t ry,
+    uint16_t color
+);
+
+/**
+ * @brief Record ILI9341_DrawPolygon, see ili9341.h for the arguments
+ * @note The vertices are copied into the display list.
+ */
+void ILI9341_DisplayList_DrawPolygon(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    const int16_t* x,
+    const int16_t* y,
+    size_t n,
+    uint16_t color
+);
+
+/**
+ * @brief Record ILI9341_DrawPolygonThick, see ili9341.h for the arguments
+ * @note The vertices are copied into the display list.
+ */
+void ILI9341_DisplayList_DrawPolygonThick(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    const int16_t* x,
+    const int16_t* y,
+    size_t n,
+    uint16_t color,
+    int_fast16_t thickness,
+    bool cap
+);
+
+/**
+ * @brief Record ILI9341_FillPolygon, see ili9341.h for the arguments
+ * @note The vertices are copied into the display list.
+ */
+void ILI9341_DisplayList_FillPolygon(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    const int16_t* x,
+    const int16_t* y,
+    size_t n,
+    uint16_t color
+);
+
+#endif  // __ILI9341_DISPLAYLIST_H__
@@ -0,0 +1,162 @@
+#ifndef __ILI9341_FONTBLOB_H__
+#define __ILI9341_FONTBLOB_H__
+
+#include "ili9341.h"
+#include "ili9341_fonts.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+#ifndef ILI9341_FONT_BLOB_MAX_RANGES
+#define ILI9341_FONT_BLOB_MAX_RANGES 16  // codepoint ranges of a font blob kept in RAM
+#endif
+
+#ifndef ILI9341_FONT_BLOB_MAX_SLOTS
+#define ILI9341_FONT_BLOB_MAX_SLOTS 16  // glyphs kept in RAM for a streamed font blob
+#endif
+
+/*
+ * Font blob format, made by export_font.py with BLOB enabled. All integers are little-endian, and all offsets are from
+ * the start of the blob so it can be placed anywhere.
+ *
+ * Header, 32 bytes:
+ *   0   "ILIF"
+ *   4   uint8   version, ILI9341_FONT_BLOB_VERSION
+ *   5   int8    ascent
+ *   6   int8    descent
+ *   7   uint8   reserved
+ *   8   int16   average width, in 10 pixels
+ *   10  uint16  number of ranges
+ *   12  uint16  number of glyphs
+ *   14  uint16  number of kerning pairs
+ *   16  uint16  size of the largest glyph data in bytes
+ *   18  uint16  reserved
+ *   20  uint32  offset of the ranges
+ *   24  uint32  offset of the glyphs
+ *   28  uint32  offset of the kerning pairs
+ * Range, 12 bytes, sorted by codepoint:
+ *   uint32 start codepoint, uint32 end codepoint, uint16 index of the glyph of the start codepoint, uint16 reserved
+ * Glyph, 12 bytes:
+ *   int8 bbX, int8 bbY, uint8 bbW, uint8 bbH, int8 advance, uint8 encoding, uint16 data size, uint32 data offset
+ * Kerning pair, 6 bytes, sorted by left then right codepoint:
+ *   uint16 left codepoint, uint16 right codepoint, int8 offset, uint8 reserved
+ * Glyph data, as in ILI9341_GlyphDef.
+ */
+#define ILI9341_FONT_BLOB_VERSION 1
+#define ILI9341_FONT_BLOB_HEADER_SIZE 32
+#define ILI9341_FONT_BLOB_RANGE_SIZE 12
+#define ILI9341_FONT_BLOB_GLYPH_SIZE 12
+#define ILI9341_FONT_BLOB_KERNING_PAIR_SIZE 6
+
+/**
+ * @brief Read function of a streamed font blob, e.g. reading a file on an SD card
+ * @param context Context pointer given to ILI9341_FontBlob_InitStream
+ * @param offset Offset in the blob to read from
+ * @param buffer Where to store the bytes
+ * @param length Number of bytes to read
+ * @return true if all bytes were read
+ */
+typedef bool (*ILI9341_FontBlob_ReadTypeDef)(void* context, uint32_t offset, void* buffer, size_t length);
+
+/**
+ * @brief Codepoint range of a font blob
+ */
+typedef struct {
+    uint32_t start_codepoint;
+    uint32_t end_codepoint;
+    uint16_t glyph_index;
+} ILI9341_FontBlob_RangeTypeDef;
+
+/**
+ * @brief Glyph of a streamed font blob kept in RAM
+ */
+typedef struct {
+    /** Index of the glyph, UINT16_MAX for an empty slot */
+    uint16_t index;
+    /** First bytes of the glyph entry in the blob, from bbX to encoding */
+    uint8_t metrics[6];
+    uint32_t last_used;
+} ILI9341_FontBlob_SlotTypeDef;
+
+/**
+ * @brief Font blob handle structure, a font read from a binary blob instead of compiled into the firmware
+ * @note A memory-mapped blob (e.g. QSPI flash in memory-mapped mode) is used in place, only the codepoint ranges are
+ * copied to RAM. A streamed blob is read in small pieces through a read function, and the glyphs are loaded into slots
+ * of a cache given by the application. Text drawn with a streamed font reads each glyph once as long as the cache
+ * holds as many glyphs as the text has different characters, and reads them again for every row with
+ * ILI9341_WriteStringLine otherwise.
+ */
+typedef struct {
+    /** Start of a memory-mapped blob, NULL for a streamed blob */
+    const uint8_t* mapped;
+    /** Size of a memory-mapped blob in bytes, nothing is read past it */
+    size_t mapped_size;
+    ILI9341_FontBlob_ReadTypeDef read;
+    void* read_context;
+    /** Set when the header of the blob was read and is valid */
+    bool valid;
+
+    /** Metrics of the header, the types of ILI9341_FontDef hold the int16 average width and the int8 ascent and descent
+     * of the blob without truncation */
+    int_fast16_t average_width;
+    int_fast8_t ascent;
+    int_fast8_t descent;
+    uint_fast16_t glyph_count;
+    uint_fast16_t kerning_count;
+    uint32_t glyphs_offset;
+    uint32_t kerning_offset;
+
+    ILI9341_FontBlob_RangeTypeDef ranges[ILI9341_FONT_BLOB_MAX_RANGES];
+    uint_fast16_t range_count;
+
+    /** Glyph cache of a streamed blob, slot_count slots of slot_size bytes */
+    uint8_t* cache;
+    size_t slot_size;
+    uint_fast16_t slot_count;
+    ILI9341_FontBlob_SlotTypeDef slots[ILI9341_FONT_BLOB_MAX_SLOTS];
+    uint32_t clock;
+    /** Statistics, can be reset by the application */
+    uint32_t hits;
+    uint32_t misses;
+
+    /** Loader of the font returned by ILI9341_FontBlob_GetFont */
+    ILI9341_FontLoaderDef loader;
+} ILI9341_FontBlob_HandleTypeDef;
+
+/**
+ * @brief Initialize a font blob that is mapped in the address space
+ * @param blob Start of the blob, must stay valid while the font is used
+ * @param blobSize Size of the blob in bytes, e.g. the size of the flash region or of the .bin file
+ * @return Initialized ILI9341_FontBlob_HandleTypeDef structure, valid is cleared if the blob is not a font blob, has
+ * more than ILI9341_FONT_BLOB_MAX_RANGES ranges, a range with codepoints past the last glyph or a table past blobSize
+ * @note The glyph data is used in place, the blob does not need any alignment. A glyph whose data is past blobSize or
+ * shorter than its bitmap is drawn empty with its advance.
+ */
+ILI9341_FontBlob_HandleTypeDef ILI9341_FontBlob_InitMapped(const void* blob, size_t blobSize);
+
+/**
+ * @brief Initialize a font blob that is read through a read function
+ * @param read Read function
+ * @param readContext Context pointer passed to the read function
+ * @param cache Storage for the glyphs kept in RAM, must stay valid while the font is used
+ * @param cacheSize Size of the storage in bytes, it is split into slots of the size of the largest glyph data of the
+ *                  font (up to ILI9341_FONT_BLOB_MAX_SLOTS). Glyphs are drawn empty if not even one slot fits
+ * @return Initialized ILI9341_FontBlob_HandleTypeDef structure, valid is cleared if the blob could not be read, is not
+ * a font blob, has more than ILI9341_FONT_BLOB_MAX_RANGES ranges or a range with codepoints past the last glyph
+ * @note The header and the codepoint ranges are read here, the glyphs when they are first used. Kerning pairs are read
+ * one at a time while searching them. A glyph that could not be read or is shorter than its bitmap is drawn empty.
+ */
+ILI9341_FontBlob_HandleTypeDef ILI9341_FontBlob_InitStream(
+    ILI9341_FontBlob_ReadTypeDef read,
+    void* readContext,
+    uint8_t* cache,
+    size_t cacheSize
+);
+
+/**
+ * @brief Get the font of a blob, to be used with all text functions
+ * @param blob Pointer to font blob handle structure, must stay valid while the font is used
+ * @return Font definition, without any glyph if the blob is not valid
+ */
+ILI9341_FontDef ILI9341_FontBlob_GetFont(ILI9341_FontBlob_HandleTypeDef* blob);
+
+#endif  // __ILI9341_FONTBLOB_H__
@@ -1,9 +1,26 @@
 #ifndef __ILI9341_FONTS_H__
 #define __ILI9341_FONTS_H__
 
+#include "stdbool.h"
 #include "stdint.h"
 #include "stdlib.h"
 
+/**
+ * @brief Encoding of the bitmap of a glyph
+ */
+typedef enum {
+    /** bbH rows of bbW bits from the top row down, without padding between the rows */
+    ILI9341_GLYPH_ENCODING_BITMAP,
+    /** bbH flag bits, one per row from the top, set when the row is the same as the row above it. They are followed by
+     * the rows that are not flagged, stored as in ILI9341_GLYPH_ENCODING_BITMAP */
+    ILI9341_GLYPH_ENCODING_ROW_REPEAT,
+    /** Anti-aliased, bbH rows of bbW 2-bit coverage values from the top row down, without padding between the rows.
+     * 0 is background and 3 is foreground, the values in between are blended */
+    ILI9341_GLYPH_ENCODING_COVERAGE_2BPP,
+    /** Anti-aliased, as ILI9341_GLYPH_ENCODING_COVERAGE_2BPP with 4-bit coverage values, 15 is foreground */
+    ILI9341_GLYPH_ENCODING_COVERAGE_4BPP
+} ILI9341_GlyphEncodingTypeDef;
+
 /**
  * @brief Glyph definition structure
  * @note The glyph location is based on the bottom-left corner of the glyph.
@@ -19,28 +36,79 @@ typedef struct {
     const int8_t bbH;
     /** Horizontal advance to the next character */
     const int8_t advance;
+    /** Encoding of the glyph data, see ILI9341_GlyphEncodingTypeDef */
+    const uint8_t encoding;
     /** Pointer to the actual glyph data, the data format is binary bitmap stored as uint8_t array.
-     * Order is left-to-right, bottom-to-top. 1 is foreground, 0 is background (or none for transparent mode) */
+     * Order is left-to-right, top-to-bottom. 1 is foreground, 0 is background (or none for transparent mode).
+     * Anti-aliased glyphs store coverage values instead, see ILI9341_GlyphEncodingTypeDef */
     const uint8_t* data;
 } ILI9341_GlyphDef;
 
 /**
- * @brief Font definition structure
- * @note The 0x7F (del) glyph will be used for out-of-range character
+ * @brief Range of consecutive Unicode codepoints covered by a font
  */
 typedef struct {
     /** Start codepoint (inclusive) */
-    const uint_fast8_t startCodepoint;
+    const uint32_t startCodepoint;
     /** End codepoint (inclusive) */
-    const uint_fast8_t endCodepoint;
+    const uint32_t endCodepoint;
+    /** Index of the glyph of the start codepoint in the glyphs array, the range uses consecutive glyphs */
+    const uint16_t glyphIndex;
+} ILI9341_FontRangeDef;
+
+/**
+ * @brief Kerning pair, an adjustment of the space between two characters
+ * @note Kerning only covers the Basic Multilingual Plane.
+ */
+typedef struct {
+    /** Unicode codepoint of the left character */
+    const uint16_t left;
+    /** Unicode codepoint of the right character */
+    const uint16_t right;
+    /** Adjustment of the advance of the left character, negative moves the right character closer */
+    const int8_t offset;
+} ILI9341_KerningPairDef;
+
+/**
+ * @brief Loader of a font that is not compiled into the firmware, e.g. a font blob (see ili9341_fontblob.h)
+ * @note The font then has no ranges, glyphs and kerning arrays, they are only reached through the loader.
+ */
+typedef struct {
+    /** Find the index of the glyph of a codepoint, return false if the font does not cover it */
+    bool (*find_glyph)(void* context, uint32_t codepoint, uint_fast16_t* index);
+    /** Get the glyph at an index, its data must stay valid at least until the next glyph is loaded */
+    ILI9341_GlyphDef (*load_glyph)(void* context, uint_fast16_t index);
+    /** Get the kerning of a pair of codepoints, 0 if the pair is not kerned */
+    int_fast8_t (*kerning)(void* context, uint32_t left, uint32_t right);
+    void* context;
+    /** Set when the glyph data is loaded into buffers that are reused for other glyphs, glyphs are then not kept in the
+     * glyph cache as their data pointers do not identify them */
+    bool reuses_data;
+} ILI9341_FontLoaderDef;
+
+/**
+ * @brief Font definition structure
+ * @note The 0x7F (del) glyph will be used for characters not covered by the font
+ */
+typedef struct {
+    /** Codepoint ranges, sorted by codepoint and not overlapping */
+    const ILI9341_FontRangeDef* ranges;
+    /** Number of codepoint ranges */
+    const uint_fast16_t rangeCount;
     /** Average char width of the font, in 10 pixels (eg. average width 80 -> 80 / 10 = 8 pixels) */
-    const int_fast8_t averageWidth;
+    const int_fast16_t averageWidth;
     /** Font ascent (how far up does the font extend from baseline) */
     const int_fast8_t ascent;
     /** Font descent (how far down does the font extend from baseline) */
     const int_fast8_t descent;
     /** Glyphs data */
     const ILI9341_GlyphDef* glyphs;
+    /** Kerning pairs sorted by left then right codepoint, NULL for fonts without kerning (eg. monospace fonts) */
+    const ILI9341_KerningPairDef* kerning;
+    /** Number of kerning pairs */
+    const uint_fast16_t kerningCount;
+    /** Loader of the glyphs, NULL for fonts compiled into the firmware */
+    const ILI9341_FontLoaderDef* loader;
 } ILI9341_FontDef;
 
 extern const ILI9341_FontDef ILI9341_Font_Terminus6x12b;
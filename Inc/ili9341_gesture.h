@@ -0,0 +1,184 @@
+#ifndef __ILI9341_GESTURE_H__
+#define __ILI9341_GESTURE_H__
+
+#include "ili9341_touch.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+#ifndef ILI9341_GESTURE_HISTORY_SIZE
+#define ILI9341_GESTURE_HISTORY_SIZE 8  // latest touch samples kept to measure the velocity of a drag
+#endif
+
+#ifndef ILI9341_GESTURE_EVENT_QUEUE_SIZE
+#define ILI9341_GESTURE_EVENT_QUEUE_SIZE 8  // gesture events kept until read by ILI9341_Gesture_GetEvent
+#endif
+
+/**
+ * @brief Gesture recognizer thresholds, see ILI9341_Gesture_SetConfig
+ */
+typedef struct {
+    /** Largest move in pixels of a tap or a long press, a touch that moves further becomes a drag */
+    uint_fast16_t tap_slop;
+    /** Longest time in milliseconds between the press and the release of a tap */
+    uint_fast16_t tap_time;
+    /** Longest time in milliseconds from the release of a tap to the press of the second tap of a double tap. 0 to
+     * disable double taps, taps are then reported on release instead of after this time */
+    uint_fast16_t double_tap_time;
+    /** Largest distance in pixels between the two taps of a double tap */
+    uint_fast16_t double_tap_slop;
+    /** Time in milliseconds a touch has to stay still to be a long press, 0 to disable */
+    uint_fast16_t long_press_time;
+    /** Time in milliseconds over which the velocity of a drag is measured */
+    uint_fast16_t velocity_time;
+    /** Shortest move in pixels of a swipe, along its direction */
+    uint_fast16_t swipe_distance;
+    /** Lowest velocity in pixels per second of a swipe when the touch is released, along its direction */
+    uint_fast16_t swipe_velocity;
+} ILI9341_Gesture_ConfigTypeDef;
+
+/**
+ * @brief Gesture event types
+ */
+typedef enum {
+    /** The screen was touched and released at the same place */
+    ILI9341_GESTURE_TAP = 0,
+    /** A second tap followed a tap at the same place, the first tap is not reported on its own */
+    ILI9341_GESTURE_DOUBLE_TAP,
+    /** The screen is touched at the same place for long_press_time, reported while it is still touched */
+    ILI9341_GESTURE_LONG_PRESS,
+    /** A touch moved further than tap_slop */
+    ILI9341_GESTURE_DRAG_START,
+    /** A drag moved, only the latest move is kept if the previous one was not read yet */
+    ILI9341_GESTURE_DRAG_MOVE,
+    /** A drag was released */
+    ILI9341_GESTURE_DRAG_END,
+    /** A drag was released while moving fast enough, reported after its ILI9341_GESTURE_DRAG_END */
+    ILI9341_GESTURE_SWIPE
+} ILI9341_Gesture_KindTypeDef;
+
+/**
+ * @brief Swipe directions, on the display in its current orientation
+ */
+typedef enum {
+    ILI9341_GESTURE_DIRECTION_NONE = 0,
+    ILI9341_GESTURE_DIRECTION_LEFT,
+    ILI9341_GESTURE_DIRECTION_RIGHT,
+    ILI9341_GESTURE_DIRECTION_UP,
+    ILI9341_GESTURE_DIRECTION_DOWN
+} ILI9341_Gesture_DirectionTypeDef;
+
+/**
+ * @brief Gesture event
+ */
+typedef struct {
+    ILI9341_Gesture_KindTypeDef kind;
+    /** Position of the touch, the last one for drags and swipes */
+    uint16_t x;
+    uint16_t y;
+    /** Position where the touch started, the first tap of a double tap */
+    uint16_t start_x;
+    uint16_t start_y;
+    /** Velocity in pixels per second of drags and swipes */
+    int16_t velocity_x;
+    int16_t velocity_y;
+    /** Direction of a swipe, ILI9341_GESTURE_DIRECTION_NONE for other events */
+    ILI9341_Gesture_DirectionTypeDef direction;
+    /** Timestamp of the touch event that completed the gesture, the time given to ILI9341_Gesture_Update for a long
+     * press */
+    uint32_t timestamp;
+} ILI9341_Gesture_EventTypeDef;
+
+/**
+ * @brief States of the gesture recognizer
+ */
+typedef enum {
+    /** The screen is not touched */
+    ILI9341_GESTURE_STATE_IDLE = 0,
+    /** The screen is touched and the touch did not move further than tap_slop yet */
+    ILI9341_GESTURE_STATE_PRESSED,
+    /** The touch was reported as a long press and did not move further than tap_slop yet */
+    ILI9341_GESTURE_STATE_LONG_PRESSED,
+    /** The touch is reported as a drag until it is released */
+    ILI9341_GESTURE_STATE_DRAGGING
+} ILI9341_Gesture_StateTypeDef;
+
+/**
+ * @brief Touch sample of the gesture recognizer
+ */
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint32_t timestamp;
+} ILI9341_Gesture_SampleTypeDef;
+
+/**
+ * @brief Gesture recognizer handle structure
+ * @note The recognizer is a state machine fed with touch events, e.g. the events of the background sampler read with
+ * ILI9341_Touch_GetEvent. All UI components can then read gestures from a single stream of samples instead of each
+ * reading the touch controller.
+ */
+typedef struct {
+    /** Thresholds, use ILI9341_Gesture_SetConfig to change */
+    ILI9341_Gesture_ConfigTypeDef config;
+
+    /** State of the touch in progress, owned by the recognizer */
+    ILI9341_Gesture_StateTypeDef state;
+    ILI9341_Gesture_SampleTypeDef start;
+    ILI9341_Gesture_SampleTypeDef history[ILI9341_GESTURE_HISTORY_SIZE];
+    uint_fast8_t history_count;
+    uint_fast8_t history_next;
+
+    /** Tap waiting to become the first tap of a double tap, owned by the recognizer */
+    bool tap_pending;
+    /** Set while the touch in progress can still be the second tap of a double tap */
+    bool second_tap;
+    ILI9341_Gesture_SampleTypeDef tap;
+
+    /** Event queue, read by ILI9341_Gesture_GetEvent */
+    ILI9341_Gesture_EventTypeDef events[ILI9341_GESTURE_EVENT_QUEUE_SIZE];
+    uint_fast8_t event_head;
+    uint_fast8_t event_count;
+    /** Events lost because the queue was full */
+    uint32_t dropped_events;
+} ILI9341_Gesture_HandleTypeDef;
+
+/**
+ * @brief Initialize a gesture recognizer with the default thresholds
+ * @return Initialized ILI9341_Gesture_HandleTypeDef structure
+ */
+ILI9341_Gesture_HandleTypeDef ILI9341_Gesture_Init(void);
+
+/**
+ * @brief Set the thresholds of a gesture recognizer
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param config Thresholds, the defaults are a tap_slop of 10 px, a tap_time of 300 ms, a double_tap_time of 300 ms,
+ *               a double_tap_slop of 30 px, a long_press_time of 600 ms, a velocity_time of 100 ms, a swipe_distance
+ *               of 40 px and a swipe_velocity of 300 px/s
+ */
+void ILI9341_Gesture_SetConfig(ILI9341_Gesture_HandleTypeDef* gesture, ILI9341_Gesture_ConfigTypeDef config);
+
+/**
+ * @brief Feed a touch event to a gesture recognizer
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param event Touch event, the events of a touch must be fed in order
+ */
+void ILI9341_Gesture_Process(ILI9341_Gesture_HandleTypeDef* gesture, const ILI9341_Touch_EventTypeDef* event);
+
+/**
+ * @brief Recognize the gestures that only depend on time, call regularly from the main loop
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param now Current time in milliseconds, e.g. HAL_GetTick
+ * @note The touch sampler queues no event while a touch stays still, so long presses, and taps that cannot become a
+ * double tap anymore, are usually reported here.
+ */
+void ILI9341_Gesture_Update(ILI9341_Gesture_HandleTypeDef* gesture, uint32_t now);
+
+/**
+ * @brief Get the oldest recognized gesture
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param event Where to store the event
+ * @return true if an event was read, false if the queue is empty
+ */
+bool ILI9341_Gesture_GetEvent(ILI9341_Gesture_HandleTypeDef* gesture, ILI9341_Gesture_EventTypeDef* event);
+
+#endif  // __ILI9341_GESTURE_H__
@@ -0,0 +1,257 @@
+#ifndef __ILI9341_TEXT_H__
+#define __ILI9341_TEXT_H__
+
+#include "ili9341.h"
+#include "ili9341_fonts.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+#ifndef ILI9341_TEXT_FIELD_MAX_LENGTH
+#define ILI9341_TEXT_FIELD_MAX_LENGTH 32  // characters kept by a text field
+#endif
+
+/**
+ * @brief Horizontal alignment of a line of text in a box
+ */
+typedef enum {
+    ILI9341_TEXT_ALIGN_LEFT,
+    ILI9341_TEXT_ALIGN_CENTER,
+    ILI9341_TEXT_ALIGN_RIGHT
+} ILI9341_Text_AlignTypeDef;
+
+/**
+ * @brief Vertical alignment of a block of text in a box
+ */
+typedef enum {
+    /** The Y coordinate of the box is the baseline of the first line */
+    ILI9341_TEXT_VALIGN_BASELINE,
+    ILI9341_TEXT_VALIGN_TOP,
+    ILI9341_TEXT_VALIGN_MIDDLE,
+    ILI9341_TEXT_VALIGN_BOTTOM
+} ILI9341_Text_VAlignTypeDef;
+
+/**
+ * @brief Line of a text layout
+ */
+typedef struct {
+    /** Offset of the first byte of the line in the string */
+    size_t start;
+    /** Number of bytes of the line, without the line break. A lone '\r' stays in the line */
+    size_t length;
+    /** Advance width of the line in pixels, from the pen start to the furthest pen end */
+    int_fast16_t width;
+    /** Horizontal extent of the glyphs relative to the pen start, ink_left > ink_right for an empty line */
+    int_fast16_t ink_left;
+    int_fast16_t ink_right;
+} ILI9341_Text_LineTypeDef;
+
+/**
+ * @brief Text layout, the lines of a string as ILI9341_WriteString would draw them, computed from the glyph metrics
+ * @note A layout only refers to its string, it can be kept and drawn again as long as the string does not change.
+ */
+typedef struct {
+    const char* str;
+    ILI9341_FontDef font;
+    int_fast16_t scale;
+    int_fast16_t tracking;
+    int_fast16_t leading;
+
+    ILI9341_Text_LineTypeDef* lines;
+    size_t max_lines;
+    size_t line_count;
+    /** Set when the string has more lines than max_lines, the extra lines are not in the layout */
+    bool truncated;
+
+    /** Advance width of the widest line in pixels */
+    int_fast16_t width;
+    /** Height of all lines in pixels, from the ascent of the first line to the descent of the last one */
+    int_fast16_t height;
+    /** Distance between the baselines of two lines in pixels */
+    int_fast16_t line_height;
+} ILI9341_Text_LayoutTypeDef;
+
+/**
+ * @brief Text field, a single line of text that only redraws the characters that changed since the last update
+ * @note The characters are compared with their positions, so a character that moved is drawn again. A glyph that
+ * sticks out of its cell is drawn again together with its neighbours.
+ */
+typedef struct {
+    ILI9341_HandleTypeDef* ili9341;
+    int_fast16_t x;
+    int_fast16_t y;
+    ILI9341_FontDef font;
+    int_fast16_t scale;
+    int_fast16_t tracking;
+    uint16_t color;
+    uint16_t bg_color;
+
+    /** Codepoints of the text currently on the display, terminated by 0 */
+    uint32_t text[ILI9341_TEXT_FIELD_MAX_LENGTH + 1];
+    /** Cleared when the whole text has to be drawn again */
+    bool valid;
+} ILI9341_Text_FieldTypeDef;
+
+/**
+ * @brief Get the advance width of the first line of a string, without drawing it
+ * @param str Null-terminated UTF-8 string to measure, stops at the first '\n' or "\r\n"
+ * @param font Font definition
+ * @param scale Integer scaling factor for the font, must be >= 1
+ * @param tracking Additional space in pixels between characters, can be negative
+ * @return Width in pixels, the same as the width of ILI9341_WriteStringLine for a line without '\r'. A lone '\r' moves
+ * the pen back to the start of the line as with ILI9341_WriteString, the width is then the furthest pen end
+ */
+int_fast16_t ILI9341_Text_GetWidth(const char* str, ILI9341_FontDef font, int_fast16_t scale, int_fast16_t tracking);
+
+/**
+ * @brief Get the bounding box of the pixels a string would touch, without drawing it
+ * @param x X coordinate of the left of the string
+ * @param y Y coordinate of the baseline of the string
+ * @param str Null-terminated UTF-8 string to measure
+ * @param font Font definition
+ * @param scale Integer scaling factor for the font, must be >= 1
+ * @param tracking Additional space in pixels between characters, can be negative
+ * @param leading Additional space in pixels between lines, can be negative
+ * @return Bounding box of the glyphs, x0 > x1 if nothing would be drawn
+ */
+ILI9341_RectTypeDef ILI9341_Text_GetBounds(
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading
+);
+
+/**
+ * @brief Break a string into lines, without drawing it
+ * @param str Null-terminated UTF-8 string, must stay valid while the layout is used
+ * @param font Font definition
+ * @param scale Integer scaling factor for the font, must be >= 1
+ * @param tracking Additional space in pixels between characters, can be negative
+ * @param leading Additional space in pixels between lines, can be negative
+ * @param maxWidth Width available for the lines in pixels, 0 to only break lines at line breaks. With
+ *                 maxWidth = ili9341->width - x, lines break where ILI9341_WriteString with wrap enabled breaks them
+ *                 when drawn at x
+ * @param lines Storage for the lines
+ * @param maxLines Number of lines that fit in the storage
+ * @return Initialized ILI9341_Text_LayoutTypeDef structure
+ * @note '\n' and "\r\n" break lines, a lone '\r' moves the pen back to the start of the same line as with
+ * ILI9341_WriteString. A line always holds at least one character, even if it is wider than maxWidth.
+ */
+ILI9341_Text_LayoutTypeDef ILI9341_Text_Layout(
+    const char* str,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading,
+    int_fast16_t maxWidth,
+    ILI9341_Text_LineTypeDef* lines,
+    size_t maxLines
+);
+
+/**
+ * @brief Get the X coordinate of the pen start of a line aligned in a box
+ * @param x X coordinate of the left of the box
+ * @param w Width of the box in pixels
+ * @param lineWidth Advance width of the line in pixels
+ * @param align Horizontal alignment
+ * @return X coordinate to draw the line at
+ */
+int_fast16_t ILI9341_Text_AlignX(
+    int_fast16_t x,
+    int_fast16_t w,
+    int_fast16_t lineWidth,
+    ILI9341_Text_AlignTypeDef align
+);
+
+/**
+ * @brief Get the baseline of the first line of a layout aligned in a box
+ * @param layout Pointer to text layout structure
+ * @param y Y coordinate of the top of the box, or of the baseline for ILI9341_TEXT_VALIGN_BASELINE
+ * @param h Height of the box in pixels
+ * @param valign Vertical alignment
+ * @return Y coordinate of the baseline of the first line
+ */
+int_fast16_t ILI9341_Text_AlignY(
+    const ILI9341_Text_LayoutTypeDef* layout,
+    int_fast16_t y,
+    int_fast16_t h,
+    ILI9341_Text_VAlignTypeDef valign
+);
+
+/**
+ * @brief Draw a layout in a box, each line with ILI9341_WriteStringLine, again from its start after each '\r'
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param layout Pointer to text layout structure
+ * @param x X coordinate of the left of the box
+ * @param y Y coordinate of the top of the box, or of the baseline for ILI9341_TEXT_VALIGN_BASELINE
+ * @param w Width of the box in pixels, only used to align the lines
+ * @param h Height of the box in pixels, only used to align the lines
+ * @param align Horizontal alignment of the lines
+ * @param valign Vertical alignment of the layout
+ * @param color 16-bit text color in RGB565 format
+ * @param bgcolor 16-bit background color in RGB565 format
+ * @note Only the line boxes are filled with the background, not the whole box.
+ */
+void ILI9341_Text_Draw(
+    ILI9341_HandleTypeDef* ili9341,
+    const ILI9341_Text_LayoutTypeDef* layout,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    ILI9341_Text_AlignTypeDef align,
+    ILI9341_Text_VAlignTypeDef valign,
+    uint16_t color,
+    uint16_t bgcolor
+);
+
+/**
+ * @brief Initialize an empty text field, nothing is drawn until the first update
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the left of the text
+ * @param y Y coordinate of the baseline of the text
+ * @param font Font definition
+ * @param scale Integer scaling factor for the font, must be >= 1
+ * @param tracking Additional space in pixels between characters, can be negative
+ * @param color 16-bit text color in RGB565 format
+ * @param bgcolor 16-bit background color in RGB565 format
+ * @return Initialized ILI9341_Text_FieldTypeDef structure
+ */
+ILI9341_Text_FieldTypeDef ILI9341_Text_FieldInit(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    uint16_t color,
+    uint16_t bgcolor
+);
+
+/**
+ * @brief Change the colors of a text field, the whole text is drawn again on the next update
+ * @param field Pointer to text field structure
+ * @param color 16-bit text color in RGB565 format
+ * @param bgcolor 16-bit background color in RGB565 format
+ */
+void ILI9341_Text_FieldSetColors(ILI9341_Text_FieldTypeDef* field, uint16_t color, uint16_t bgcolor);
+
+/**
+ * @brief Draw the whole text again on the next update, e.g. after something else was drawn over the field
+ * @param field Pointer to text field structure
+ */
+void ILI9341_Text_FieldInvalidate(ILI9341_Text_FieldTypeDef* field);
+
+/**
+ * @brief Show a new text in the field, only the characters that differ from the current text are drawn
+ * @param field Pointer to text field structure
+ * @param str Null-terminated UTF-8 string, stops at the first '\r' or '\n' and at ILI9341_TEXT_FIELD_MAX_LENGTH
+ * characters
+ * @note Each run of changed characters is sent as one address window. When the new text is shorter, the area the old
+ * text covered past its end is filled with the background.
+ */
+void ILI9341_Text_FieldUpdate(ILI9341_Text_FieldTypeDef* field, const char* str);
+
+#endif  // __ILI9341_TEXT_H__
@@ -6,13 +6,96 @@
 #include "stdint.h"
 #include "stm32f7xx_hal.h"
 
-// Raw touch values range, may require calibration
-// to calibrate uncomment UART_Printf line in ili9341_touch.c
+// Raw touch values range, used for the calibration until the touchscreen is calibrated with ILI9341_Touch_Calibrate
 #define ILI9341_TOUCH_MIN_RAW_X 2000
 #define ILI9341_TOUCH_MAX_RAW_X 30750
 #define ILI9341_TOUCH_MIN_RAW_Y 2000
 #define ILI9341_TOUCH_MAX_RAW_Y 31000
 
+#ifndef ILI9341_TOUCH_CALIBRATION_READINGS
+#define ILI9341_TOUCH_CALIBRATION_READINGS 16  // readings averaged for each target of ILI9341_Touch_Calibrate
+#endif
+
+#ifndef ILI9341_TOUCH_MAX_SAMPLES
+#define ILI9341_TOUCH_MAX_SAMPLES 8  // largest number of conversions per axis of the touch filter
+#endif
+
+#ifndef ILI9341_TOUCH_AUX_SETTLE
+#define ILI9341_TOUCH_AUX_SETTLE 4  // conversions discarded while the internal reference powers up for aux channels
+#endif
+
+#ifndef ILI9341_TOUCH_EVENT_QUEUE_SIZE
+#define ILI9341_TOUCH_EVENT_QUEUE_SIZE 16  // touch events kept until read by ILI9341_Touch_GetEvent, power of 2
+#endif
+
+/**
+ * @brief Touch calibration, an affine transform from raw touch values to display coordinates in 16.16 fixed point
+ * @note x = (a * rawX + b * rawY + c) / 65536 and y = (d * rawX + e * rawY + f) / 65536, rounded down. It covers any
+ * rotation, mirroring, skew and offset between the touchscreen and the display.
+ */
+typedef struct {
+    int32_t a;
+    int32_t b;
+    int32_t c;
+    int32_t d;
+    int32_t e;
+    int32_t f;
+} ILI9341_Touch_CalibrationTypeDef;
+
+/**
+ * @brief Touch filter settings, see ILI9341_Touch_SetFilter
+ */
+typedef struct {
+    /** Conversions left out at the start of each axis, while the touch plates settle after the channel changed */
+    uint_fast8_t settle;
+    /** Conversions per axis for one reading after the settling ones, settle + samples up to
+     * ILI9341_TOUCH_MAX_SAMPLES */
+    uint_fast8_t samples;
+    /** Lowest and highest conversions of each axis left out of the average, (samples - 1) / 2 for the median */
+    uint_fast8_t trim;
+    /** Largest difference between the conversions kept for the average (raw units), a noisier reading is rejected and
+     * the coordinates of the touch are kept. 0 to disable */
+    uint_fast16_t max_spread;
+    /** Largest move from the previous reading of the same touch (raw units), a larger jump is only accepted once the
+     * next reading confirms it. 0 to disable */
+    uint_fast16_t max_delta;
+    /** Readings of a still touch averaged together, 1 to disable */
+    uint_fast8_t smoothing;
+    /** Readings averaged into a new touch before it is reported, so that its first coordinates are as steady as the
+     * following ones. 0 to report the first reading */
+    uint_fast8_t debounce;
+    /** Largest move from the averaged coordinates (raw units) still taken for noise and averaged, a larger move starts
+     * a new average so a moving touch is followed without lag */
+    uint_fast16_t max_jitter;
+    /** Largest touch resistance X * (Z2 / Z1 - 1) of a touch, with the 12-bit X, Z1 and Z2 conversions (lower is a
+     * firmer touch). Lighter touches give unstable coordinates and are ignored. 0 to disable, which saves the Z1 and
+     * Z2 conversions */
+    uint_fast16_t max_resistance;
+} ILI9341_Touch_FilterTypeDef;
+
+/**
+ * @brief Touch event types
+ */
+typedef enum {
+    /** The screen was touched */
+    ILI9341_TOUCH_EVENT_PRESS = 0,
+    /** The touch moved while the screen is still touched */
+    ILI9341_TOUCH_EVENT_MOVE,
+    /** The screen is not touched anymore, the coordinates are the last ones of the touch */
+    ILI9341_TOUCH_EVENT_RELEASE
+} ILI9341_Touch_EventKindTypeDef;
+
+/**
+ * @brief Touch event, queued by the background sampler
+ */
+typedef struct {
+    ILI9341_Touch_EventKindTypeDef kind;
+    uint16_t x;
+    uint16_t y;
+    /** HAL_GetTick value when the touch was sampled */
+    uint32_t timestamp;
+} ILI9341_Touch_EventTypeDef;
+
 /**
  * @brief ILI9341 touch controller handle structure
  */
@@ -25,6 +108,45 @@ typedef struct {
     int_fast8_t rotation;
     int_fast16_t width;
     int_fast16_t height;
+
+    /** Calibration in the ILI9341_ROTATION_VERTICAL_1 orientation, use ILI9341_Touch_SetCalibration to change */
+    ILI9341_Touch_CalibrationTypeDef calibration;
+    /** Calibration turned to the current orientation, owned by the driver */
+    ILI9341_Touch_CalibrationTypeDef matrix;
+
+    /** Touch filter, use ILI9341_Touch_SetFilter to change */
+    ILI9341_Touch_FilterTypeDef filter;
+    /** Averaged raw coordinates of the touch, the number of readings in the average, the readings of the touch until
+     * debounce and the unconfirmed jump after them, owned by the driver */
+    bool filter_valid;
+    bool candidate_valid;
+    bool filter_moving;
+    uint_fast8_t filter_count;
+    uint_fast8_t filter_readings;
+    uint16_t filter_x;
+    uint16_t filter_y;
+    uint16_t candidate_x;
+    uint16_t candidate_y;
+    /** Touch resistance of the last reading, 0 if the pressure is not measured */
+    uint16_t resistance;
+
+    /** Display on the same SPI bus, use ILI9341_Touch_SetSharedDisplay or ILI9341_Touch_StartSampling to change */
+    const ILI9341_HandleTypeDef* shared_display;
+
+    /** Background sampling state, use ILI9341_Touch_StartSampling to change */
+    volatile bool sampling;
+    bool pressed;
+    /** The pen down was sampled from the IRQ pin, the touch is left to the timer until the pen is lifted */
+    bool pen_sampled;
+    uint16_t last_x;
+    uint16_t last_y;
+
+    /** Event queue, written by the sampler from interrupts and read by ILI9341_Touch_GetEvent */
+    ILI9341_Touch_EventTypeDef events[ILI9341_TOUCH_EVENT_QUEUE_SIZE];
+    volatile uint_fast16_t event_head;
+    volatile uint_fast16_t event_tail;
+    /** Events lost because the queue was full */
+    volatile uint32_t dropped_events;
 } ILI9341_Touch_HandleTypeDef;
 
 /**
@@ -63,19 +185,158 @@ ILI9341_Touch_HandleTypeDef ILI9341_Touch_Init(
  */
 void ILI9341_Touch_SetOrientation(ILI9341_Touch_HandleTypeDef* ili9341_touch, int_fast8_t rotation);
 
+/**
+ * @brief Set the touch calibration, e.g. one saved after ILI9341_Touch_Calibrate
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param calibration Calibration in the ILI9341_ROTATION_VERTICAL_1 orientation, as stored in the calibration field
+ */
+void ILI9341_Touch_SetCalibration(
+    ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    ILI9341_Touch_CalibrationTypeDef calibration
+);
+
+/**
+ * @brief Calibrate the touchscreen by drawing targets on the display and waiting for each one to be touched
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param ili9341 Pointer to ILI9341 handle structure of the display, in the same orientation as the touchscreen
+ * @param points Number of targets, 3 for an exact fit or 5 for a least squares fit that averages out the error of each
+ *               touch
+ * @param timeout Time to touch each target in milliseconds
+ * @return true if the touchscreen was calibrated, false on timeout, if points is not 3 or 5 or if the targets were
+ * touched at positions that do not make a calibration. The previous calibration is then kept
+ * @note The display is cleared to black before and after. Blocks until done, background sampling must be stopped.
+ * Save the calibration field to restore it with ILI9341_Touch_SetCalibration, instead of calibrating at every start.
+ */
+bool ILI9341_Touch_Calibrate(
+    ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    ILI9341_HandleTypeDef* ili9341,
+    uint_fast8_t points,
+    uint32_t timeout
+);
+
+/**
+ * @brief Set the filter applied to the conversions of ILI9341_Touch_GetCoordinates
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param filter Filter settings, settle + samples is limited to 1..ILI9341_TOUCH_MAX_SAMPLES, trim so that one
+ *               conversion is kept and smoothing to at least 1
+ * @note The default filter takes 3 conversions per axis, 6 per reading, and averages the last 2. A reading whose 2
+ * conversions spread more than 320 (40 12-bit counts) keeps the coordinates of the touch. Up to 8 readings of a still
+ * touch are averaged, a move of more than 128 (16 counts, about a pixel) is followed one reading later, max_delta is
+ * 4096 and the pressure is not measured. A new touch is reported after 4 readings, 24 conversions, as steady as the
+ * following ones. It jitters less than the 16 averaged conversions per axis used before, in 32 conversions per reading.
+ * A slow drag lags by up to max_jitter.
+ */
+void ILI9341_Touch_SetFilter(ILI9341_Touch_HandleTypeDef* ili9341_touch, ILI9341_Touch_FilterTypeDef filter);
+
 /**
  * @brief Check if the touchscreen is currently pressed
  * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
  */
 bool ILI9341_Touch_IsPressed(const ILI9341_Touch_HandleTypeDef* ili9341_touch);
 
+/**
+ * @brief Get the current raw touch values, filtered but not calibrated
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param rawX Pointer to store the raw X value
+ * @param rawY Pointer to store the raw Y value
+ * @return true if the values were successfully read, false if the screen is not touched, the touch is too light or
+ * not yet debounced (see ILI9341_Touch_SetFilter), or the SPI bus was busy. A reading rejected by the filter keeps
+ * the values of the touch
+ */
+bool ILI9341_Touch_GetRawCoordinates(ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t* rawX, uint16_t* rawY);
+
 /**
  * @brief Get the current touch coordinates
  * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
  * @param x Pointer to store the X coordinate
  * @param y Pointer to store the Y coordinate
- * @return true if coordinates were successfully read, false otherwise
+ * @return true if coordinates were successfully read, false if the screen is not touched, the touch is too light or
+ * not yet debounced (see ILI9341_Touch_SetFilter), or the SPI bus was busy. A reading rejected by the filter keeps the
+ * coordinates of the touch
+ * @note Do not call while background sampling is running, use the events instead.
+ */
+bool ILI9341_Touch_GetCoordinates(ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t* x, uint16_t* y);
+
+/**
+ * @brief Measure the battery voltage on the VBAT input of the touch controller
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param millivolts Pointer to store the battery voltage in millivolts, up to 10000
+ * @return true if the voltage was measured, false if the SPI bus was busy
+ * @note The internal 2.5 V reference is powered for the measurement only. Can be called while background sampling is
+ * running, a sample that comes during the measurement is skipped.
+ */
+bool ILI9341_Touch_ReadBattery(const ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t* millivolts);
+
+/**
+ * @brief Measure the die temperature of the touch controller
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param temperature Pointer to store the temperature in tenths of a degree Celsius
+ * @return true if the temperature was measured, false if the SPI bus was busy
+ * @note Uses the voltage difference between the two temperature inputs, which needs no calibration and is accurate to a
+ * few degrees. Can be called while background sampling is running, a sample that comes during the measurement is
+ * skipped.
+ */
+bool ILI9341_Touch_ReadTemperature(const ILI9341_Touch_HandleTypeDef* ili9341_touch, int16_t* temperature);
+
+/**
+ * @brief Set the display on the same SPI bus as the touch controller, the touch controller is then only selected once
+ * the DMA transfer of the display is completed
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param sharedDisplay Display on the same SPI bus, NULL if the bus is not shared
+ */
+void ILI9341_Touch_SetSharedDisplay(
+    ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    const ILI9341_HandleTypeDef* sharedDisplay
+);
+
+/**
+ * @brief Start sampling the touch controller in the background, touches are then read with ILI9341_Touch_GetEvent
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param sharedDisplay Display on the same SPI bus as the touch controller, NULL if the bus is not shared, as set by
+ *                      ILI9341_Touch_SetSharedDisplay. Samples are skipped while the display is selected, so an
+ *                      interrupt never cuts into a drawing function
+ * @note ILI9341_Touch_EXTI_Callback must be called from HAL_GPIO_EXTI_Callback (falling edge on the IRQ pin) and
+ * ILI9341_Touch_TimerCallback periodically from a timer interrupt, e.g. HAL_TIM_PeriodElapsedCallback every 10 ms.
+ * Both interrupts must have the same priority, and a lower priority than the SPI interrupt of the display when it uses
+ * the DMA transport.
+ */
+void ILI9341_Touch_StartSampling(
+    ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    const ILI9341_HandleTypeDef* sharedDisplay
+);
+
+/**
+ * @brief Stop sampling the touch controller in the background, events already queued can still be read
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ */
+void ILI9341_Touch_StopSampling(ILI9341_Touch_HandleTypeDef* ili9341_touch);
+
+/**
+ * @brief IRQ pin handler for background sampling, call from HAL_GPIO_EXTI_Callback
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param pin GPIO pin passed to HAL_GPIO_EXTI_Callback, the call is ignored if it is not the IRQ pin
+ * @note A touch is sampled as soon as the pen goes down, without waiting for the next timer tick. Only one reading
+ * per pen down is taken from this interrupt, the following ones at the timer ticks. The edge that the conversions
+ * cause on the IRQ pin is cleared, so the interrupt does not fire again at once.
+ */
+void ILI9341_Touch_EXTI_Callback(ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t pin);
+
+/**
+ * @brief Timer handler for background sampling, call periodically from a timer interrupt
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @note While the screen is not touched a tick only reads the IRQ pin. While it is touched every tick samples the
+ * coordinates, queues a move event if they changed and a release event once the pen is lifted.
+ */
+void ILI9341_Touch_TimerCallback(ILI9341_Touch_HandleTypeDef* ili9341_touch);
+
+/**
+ * @brief Get the oldest queued touch event, call from the main loop
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param event Where to store the event
+ * @return true if an event was read, false if the queue is empty
+ * @note The queue has a single producer (the sampling interrupts) and a single consumer (this function), so it needs
+ * no locking. When the queue is almost full move events are dropped first, so press and release events stay paired.
  */
-bool ILI9341_Touch_GetCoordinates(const ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t* x, uint16_t* y);
+bool ILI9341_Touch_GetEvent(ILI9341_Touch_HandleTypeDef* ili9341_touch, ILI9341_Touch_EventTypeDef* event);
 
 #endif  // __ILI9341_TOUCH_H__
@@ -1,24 +1,54 @@
 #include "ili9341.h"
 
 #include "stm32f7xx_hal.h"
+#include "string.h"
+
+/**
+ * @brief Block until the current DMA transfer (if any) is completed
+ * @param ili9341 Pointer to ILI9341 handle structure
+ */
+static void ILI9341_WaitForTransferFast(const ILI9341_HandleTypeDef* ili9341) {
+    while (ili9341->transfer_busy) {}
+}
 
 /**
  * @brief Select the ILI9341 display
  * @param ili9341 Pointer to ILI9341 handle structure
  */
-static void ILI9341_Select(const ILI9341_HandleTypeDef* ili9341) {
-    HAL_GPIO_WritePin(ili9341->cs_port, ili9341->cs_pin, GPIO_PIN_RESET);
+static void ILI9341_Select(ILI9341_HandleTypeDef* ili9341) {
+    // A deselect may still be pending from the previous call, cancel it so the chip stays selected and the caller can
+    // prepare its data while the transfer is running
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (ili9341->transfer_busy) {
+        ili9341->deselect_pending = false;
+    } else {
+        HAL_GPIO_WritePin(ili9341->cs_port, ili9341->cs_pin, GPIO_PIN_RESET);
+    }
+
+    __set_PRIMASK(primask);
 }
 
-void ILI9341_Deselect(const ILI9341_HandleTypeDef* ili9341) {
-    HAL_GPIO_WritePin(ili9341->cs_port, ili9341->cs_pin, GPIO_PIN_SET);
+void ILI9341_Deselect(ILI9341_HandleTypeDef* ili9341) {
+    // The transfer complete callback may run between the check and the assignment, so do both with IRQs masked
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (ili9341->transfer_busy) {
+        ili9341->deselect_pending = true;
+    } else {
+        HAL_GPIO_WritePin(ili9341->cs_port, ili9341->cs_pin, GPIO_PIN_SET);
+    }
+
+    __set_PRIMASK(primask);
 }
 
 /**
  * @brief Reset the ILI9341 display
  * @param ili9341 Pointer to ILI9341 handle structure
  */
-static void ILI9341_Reset(const ILI9341_HandleTypeDef* ili9341) {
+static void ILI9341_Reset(ILI9341_HandleTypeDef* ili9341) {
     HAL_GPIO_WritePin(ili9341->rst_port, ili9341->rst_pin, GPIO_PIN_RESET);
     HAL_Delay(5);
     HAL_GPIO_WritePin(ili9341->rst_port, ili9341->rst_pin, GPIO_PIN_SET);
@@ -29,18 +59,31 @@ static void ILI9341_Reset(const ILI9341_HandleTypeDef* ili9341) {
  * @param ili9341 Pointer to ILI9341 handle structure
  * @param cmd Command byte to write
  */
-static void ILI9341_WriteCommand(const ILI9341_HandleTypeDef* ili9341, uint8_t cmd) {
+static void ILI9341_WriteCommand(ILI9341_HandleTypeDef* ili9341, uint8_t cmd) {
+    ILI9341_WaitForTransferFast(ili9341);
+
+    if (cmd == 0x01 /* SWRESET */ || cmd == 0x36 /* MADCTL */) {
+        // The meaning (or the content) of the programmed address window changes
+        ili9341->window_valid = false;
+        ili9341->window_pointer_valid = false;
+    } else if (cmd != 0x2A /* CASET */ && cmd != 0x2B /* RASET */ && cmd != 0x2C /* RAMWR */ &&
+               cmd != 0x3C /* RAMWRC */) {
+        // Memory write can only be continued right after another memory write
+        ili9341->window_pointer_valid = false;
+    }
+
     HAL_GPIO_WritePin(ili9341->dc_port, ili9341->dc_pin, GPIO_PIN_RESET);
     HAL_SPI_Transmit(ili9341->spi_handle, &cmd, sizeof(cmd), HAL_MAX_DELAY);
 }
 
 /**
- * @brief Write data to the ILI9341 display
+ * @brief Write data to the ILI9341 display, always blocking regardless of the transport
  * @param ili9341 Pointer to ILI9341 handle structure
  * @param buff Pointer to the data buffer
  * @param bufferSize Size of the data buffer
  */
-static void ILI9341_WriteData(const ILI9341_HandleTypeDef* ili9341, uint8_t* buff, size_t bufferSize) {
+static void ILI9341_WriteData(ILI9341_HandleTypeDef* ili9341, uint8_t* buff, size_t bufferSize) {
+    ILI9341_WaitForTransferFast(ili9341);
     HAL_GPIO_WritePin(ili9341->dc_port, ili9341->dc_pin, GPIO_PIN_SET);
 
     // split data in small chunks because HAL can't send more then 64K at once
@@ -52,6 +95,552 @@ static void ILI9341_WriteData(const ILI9341_HandleTypeDef* ili9341, uint8_t* buf
     }
 }
 
+/**
+ * @brief Track the GRAM write pointer after pixels are written to the address window
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param pixels Number of pixels written
+ */
+static void ILI9341_AdvanceWindowPointer(ILI9341_HandleTypeDef* ili9341, size_t pixels) {
+    if (!ili9341->window_pointer_valid) return;
+
+    size_t windowWidth = ili9341->window_x1 - ili9341->window_x0 + 1;
+    size_t column = ili9341->window_pointer_x - ili9341->window_x0 + pixels;
+
+    if (column >= windowWidth) {
+        ili9341->window_pointer_y += column / windowWidth;
+        column %= windowWidth;
+    }
+    ili9341->window_pointer_x = ili9341->window_x0 + column;
+
+    // Once the whole window is written the pointer wraps around, a new RAMWR is as cheap as RAMWRC from there
+    if (ili9341->window_pointer_y > ili9341->window_y1) ili9341->window_pointer_valid = false;
+}
+
+/**
+ * @brief Add a rectangle to the dirty rectangles of the framebuffer, merging it with the existing ones when cheap
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x0 X coordinate of the top-left corner of the rectangle
+ * @param y0 Y coordinate of the top-left corner of the rectangle
+ * @param x1 X coordinate of the bottom-right corner of the rectangle
+ * @param y1 Y coordinate of the bottom-right corner of the rectangle
+ */
+static void ILI9341_MarkDirtyFast(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x0,
+    int_fast16_t y0,
+    int_fast16_t x1,
+    int_fast16_t y1
+) {
+    ILI9341_RectTypeDef* rects = ili9341->dirty_rects;
+
+    while (true) {
+        int_fast32_t area = (int_fast32_t)(x1 - x0 + 1) * (y1 - y0 + 1);
+        int_fast32_t bestGrowth = INT32_MAX;
+        uint_fast8_t best = 0;
+
+        for (uint_fast8_t i = 0; i < ili9341->dirty_count; i++) {
+            if (rects[i].x0 <= x0 && rects[i].y0 <= y0 && rects[i].x1 >= x1 && rects[i].y1 >= y1) return;
+
+            int_fast16_t ux0 = rects[i].x0 < x0 ? rects[i].x0 : x0;
+            int_fast16_t uy0 = rects[i].y0 < y0 ? rects[i].y0 : y0;
+            int_fast16_t ux1 = rects[i].x1 > x1 ? rects[i].x1 : x1;
+            int_fast16_t uy1 = rects[i].y1 > y1 ? rects[i].y1 : y1;
+
+            int_fast32_t unionArea = (int_fast32_t)(ux1 - ux0 + 1) * (uy1 - uy0 + 1);
+            int_fast32_t rectArea = (int_fast32_t)(rects[i].x1 - rects[i].x0 + 1) * (rects[i].y1 - rects[i].y0 + 1);
+            int_fast32_t growth = unionArea - rectArea - area;
+
+            if (growth < bestGrowth) {
+                bestGrowth = growth;
+                best = i;
+            }
+        }
+
+        // Merge if it costs less than sending another window, or if there is no room left
+        if (ili9341->dirty_count == 0 ||
+            (bestGrowth > ILI9341_DIRTY_MERGE_THRESHOLD && ili9341->dirty_count < ILI9341_DIRTY_RECTS_MAX)) {
+            break;
+        }
+
+        if (rects[best].x0 < x0) x0 = rects[best].x0;
+        if (rects[best].y0 < y0) y0 = rects[best].y0;
+        if (rects[best].x1 > x1) x1 = rects[best].x1;
+        if (rects[best].y1 > y1) y1 = rects[best].y1;
+
+        // The merged rectangle may now overlap others, take it out and try again
+        rects[best] = rects[--ili9341->dirty_count];
+    }
+
+    rects[ili9341->dirty_count++] = (ILI9341_RectTypeDef){x0, y0, x1, y1};
+}
+
+/**
+ * @brief Write pixel data to the framebuffer at the emulated GRAM write pointer
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param data Pointer to the pixel data
+ * @param period Number of pixels in data, data is repeated if count is larger than this
+ * @param count Number of pixels to write
+ */
+static void ILI9341_FramebufferWrite(
+    ILI9341_HandleTypeDef* ili9341,
+    const uint16_t* data,
+    size_t period,
+    size_t count
+) {
+    if (!ili9341->window_pointer_valid) return;
+
+    int_fast16_t x = ili9341->window_pointer_x;
+    int_fast16_t y = ili9341->window_pointer_y;
+    size_t dataIndex = 0;
+    size_t written = count;
+
+    while (count > 0 && y <= ili9341->window_y1) {
+        size_t run = ili9341->window_x1 - x + 1;
+        if (run > count) run = count;
+
+        if (y >= ili9341->framebuffer_y && y < ili9341->framebuffer_y + ili9341->framebuffer_height) {
+            uint16_t* dst = ili9341->framebuffer + (size_t)(y - ili9341->framebuffer_y) * ili9341->width + x;
+            size_t index = dataIndex;
+            for (size_t remaining = run; remaining > 0;) {
+                size_t piece = period - index;
+                if (piece > remaining) piece = remaining;
+                memcpy(dst, data + index, piece * sizeof(uint16_t));
+                dst += piece;
+                remaining -= piece;
+                index += piece;
+                if (index >= period) index = 0;
+            }
+        }
+
+        dataIndex = (dataIndex + run) % period;
+
+        count -= run;
+        x += run;
+        if (x > ili9341->window_x1) {
+            x = ili9341->window_x0;
+            y++;
+        }
+    }
+
+    ILI9341_AdvanceWindowPointer(ili9341, written);
+}
+
+/**
+ * @brief Start the next DMA chunk of the current transfer
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @return true if a chunk was started, false if the transfer is finished
+ */
+static bool ILI9341_StartTransferChunk(ILI9341_HandleTypeDef* ili9341) {
+    while (ili9341->transfer_remaining > 0) {
+        size_t chunkSize = ili9341->transfer_period - ili9341->transfer_offset;
+        if (chunkSize > ili9341->transfer_remaining) chunkSize = ili9341->transfer_remaining;
+        if (chunkSize > 32768) chunkSize = 32768;
+
+        uint8_t* chunk = ili9341->transfer_data + ili9341->transfer_offset;
+
+        ili9341->transfer_remaining -= chunkSize;
+        ili9341->transfer_offset += chunkSize;
+        if (ili9341->transfer_offset >= ili9341->transfer_period) ili9341->transfer_offset = 0;
+
+        if (HAL_SPI_Transmit_DMA(ili9341->spi_handle, chunk, chunkSize) == HAL_OK) return true;
+
+        // DMA could not be started, send this chunk the slow way so no data is lost
+        HAL_SPI_Transmit(ili9341->spi_handle, chunk, chunkSize, HAL_MAX_DELAY);
+    }
+
+    return false;
+}
+
+/**
+ * @brief Write pixel data to the ILI9341 display using the transport selected in the handle
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param buff Pointer to the data buffer, with the DMA transport it must stay valid until the transfer is completed
+ * @param bufferSize Size of the data buffer in bytes
+ * @param totalSize Number of bytes to send, the buffer is sent repeatedly if this is larger than bufferSize
+ */
+static void ILI9341_WriteDataAsync(ILI9341_HandleTypeDef* ili9341, uint8_t* buff, size_t bufferSize, size_t totalSize) {
+    if (bufferSize == 0 || totalSize == 0) return;
+
+    if (ili9341->framebuffer != NULL) {
+        ILI9341_FramebufferWrite(ili9341, (const uint16_t*)buff, bufferSize / 2, totalSize / 2);
+        return;
+    }
+
+    ILI9341_AdvanceWindowPointer(ili9341, totalSize / 2);
+
+    if (ili9341->transport != ILI9341_TRANSPORT_DMA) {
+        while (totalSize > 0) {
+            size_t chunkSize = totalSize > bufferSize ? bufferSize : totalSize;
+            ILI9341_WriteData(ili9341, buff, chunkSize);
+            totalSize -= chunkSize;
+        }
+        return;
+    }
+
+    ILI9341_WaitForTransferFast(ili9341);
+    HAL_GPIO_WritePin(ili9341->dc_port, ili9341->dc_pin, GPIO_PIN_SET);
+
+    ili9341->transfer_data = buff;
+    ili9341->transfer_period = bufferSize;
+    ili9341->transfer_offset = 0;
+    ili9341->transfer_remaining = totalSize;
+    ili9341->transfer_busy = true;
+
+    if (!ILI9341_StartTransferChunk(ili9341)) {
+        ili9341->transfer_busy = false;
+        if (ili9341->transfer_complete_callback) ili9341->transfer_complete_callback(ili9341);
+    }
+}
+
+/**
+ * @brief Get a buffer to stage pixel data in
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param stackBuffer Buffer on the caller's stack, used when no buffer pool is set
+ * @param stackBufferSize Size of the stack buffer in pixels
+ * @param bufferSize Pointer to store the size of the returned buffer in pixels
+ * @return Pointer to a buffer that is not used by any transfer in progress
+ * @note With the DMA transport the buffer is split in two halves and the half that was not submitted last is
+ * returned, so the next chunk can be prepared while the previous one is being sent. A stack buffer is only safe to be
+ * used with ILI9341_WriteDataAsync if ILI9341_WaitForTransferFast is called before it goes out of scope.
+ */
+static uint16_t* ILI9341_GetStagingBuffer(
+    ILI9341_HandleTypeDef* ili9341,
+    uint16_t* stackBuffer,
+    size_t stackBufferSize,
+    size_t* bufferSize
+) {
+    uint16_t* buffer = stackBuffer;
+    size_t size = stackBufferSize;
+
+    if (ili9341->buffer_pool != NULL && ili9341->buffer_pool_size > 0) {
+        buffer = ili9341->buffer_pool;
+        size = ili9341->buffer_pool_size;
+    }
+
+    if (ili9341->transport != ILI9341_TRANSPORT_DMA || size < 2) {
+        ILI9341_WaitForTransferFast(ili9341);
+        *bufferSize = size;
+        return buffer;
+    }
+
+    // Only the buffer submitted last can still be in flight, each submission waits for the previous one
+    size /= 2;
+    *bufferSize = size;
+    return (uint8_t*)buffer == ili9341->transfer_data ? buffer + size : buffer;
+}
+
+/**
+ * @brief Pixel writer state, streams generated pixel data to an address window through the staging buffers
+ */
+typedef struct {
+    uint16_t* stackBuffer;
+    size_t stackBufferSize;
+    uint16_t* buffer;
+    size_t bufferSize;
+    size_t count;
+    bool windowSet;
+    uint16_t x0;
+    uint16_t y0;
+    uint16_t x1;
+    uint16_t y1;
+} ILI9341_PixelWriter;
+
+static void ILI9341_SetAddressWindow(
+    ILI9341_HandleTypeDef* ili9341,
+    uint16_t x0,
+    uint16_t y0,
+    uint16_t x1,
+    uint16_t y1
+);
+
+/**
+ * @brief Start writing pixels to an address window
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param writer Pointer to the pixel writer state
+ * @param stackBuffer Buffer on the caller's stack, must stay in scope until ILI9341_PixelWriterEnd
+ * @param stackBufferSize Size of the stack buffer in pixels
+ * @param x0 X coordinate of the top-left corner of the window
+ * @param y0 Y coordinate of the top-left corner of the window
+ * @param x1 X coordinate of the bottom-right corner of the window
+ * @param y1 Y coordinate of the bottom-right corner of the window
+ * @note The address window is only set when the first chunk is submitted, so the first chunk can be prepared while
+ * the previous transfer is still in progress.
+ */
+static void ILI9341_PixelWriterBegin(
+    ILI9341_HandleTypeDef* ili9341,
+    ILI9341_PixelWriter* writer,
+    uint16_t* stackBuffer,
+    size_t stackBufferSize,
+    uint16_t x0,
+    uint16_t y0,
+    uint16_t x1,
+    uint16_t y1
+) {
+    writer->stackBuffer = stackBuffer;
+    writer->stackBufferSize = stackBufferSize;
+    writer->buffer = ILI9341_GetStagingBuffer(ili9341, stackBuffer, stackBufferSize, &writer->bufferSize);
+    writer->count = 0;
+    writer->windowSet = false;
+    writer->x0 = x0;
+    writer->y0 = y0;
+    writer->x1 = x1;
+    writer->y1 = y1;
+}
+
+/**
+ * @brief Submit the pixels staged so far and switch to the other staging buffer
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param writer Pointer to the pixel writer state
+ */
+static void ILI9341_PixelWriterFlush(ILI9341_HandleTypeDef* ili9341, ILI9341_PixelWriter* writer) {
+    if (writer->count == 0) return;
+
+    if (!writer->windowSet) {
+        ILI9341_SetAddressWindow(ili9341, writer->x0, writer->y0, writer->x1, writer->y1);
+        writer->windowSet = true;
+    }
+
+    ILI9341_WriteDataAsync(ili9341, (uint8_t*)writer->buffer, writer->count * 2, writer->count * 2);
+
+    writer->buffer =
+        ILI9341_GetStagingBuffer(ili9341, writer->stackBuffer, writer->stackBufferSize, &writer->bufferSize);
+    writer->count = 0;
+}
+
+/**
+ * @brief Submit the remaining pixels, waits for the transfer if it uses the stack buffer
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param writer Pointer to the pixel writer state
+ */
+static void ILI9341_PixelWriterEnd(ILI9341_HandleTypeDef* ili9341, ILI9341_PixelWriter* writer) {
+    ILI9341_PixelWriterFlush(ili9341, writer);
+
+    if (ili9341->buffer_pool == NULL || ili9341->buffer_pool_size == 0) ILI9341_WaitForTransferFast(ili9341);
+}
+
+void ILI9341_SetTransport(
+    ILI9341_HandleTypeDef* ili9341,
+    ILI9341_TransportTypeDef transport,
+    void (*callback)(ILI9341_HandleTypeDef* ili9341)
+) {
+    ILI9341_WaitForTransferFast(ili9341);
+
+    ili9341->transport = transport;
+    ili9341->transfer_complete_callback = callback;
+}
+
+void ILI9341_SetBufferPool(ILI9341_HandleTypeDef* ili9341, uint16_t* buffer, size_t bufferSize) {
+    ILI9341_WaitForTransferFast(ili9341);
+
+    ili9341->buffer_pool = buffer;
+    ili9341->buffer_pool_size = buffer != NULL ? bufferSize : 0;
+}
+
+bool ILI9341_IsBusy(const ILI9341_HandleTypeDef* ili9341) {
+    return ili9341->transfer_busy;
+}
+
+void ILI9341_WaitForTransfer(const ILI9341_HandleTypeDef* ili9341) {
+    ILI9341_WaitForTransferFast(ili9341);
+}
+
+void ILI9341_SPI_TxCpltCallback(ILI9341_HandleTypeDef* ili9341, SPI_HandleTypeDef* hspi) {
+    if (hspi != ili9341->spi_handle || !ili9341->transfer_busy) return;
+
+    if (ILI9341_StartTransferChunk(ili9341)) return;
+
+    ili9341->transfer_busy = false;
+
+    if (ili9341->deselect_pending) {
+        ili9341->deselect_pending = false;
+        HAL_GPIO_WritePin(ili9341->cs_port, ili9341->cs_pin, GPIO_PIN_SET);
+    }
+
+    if (ili9341->transfer_complete_callback) ili9341->transfer_complete_callback(ili9341);
+}
+
+void ILI9341_SetFramebuffer(ILI9341_HandleTypeDef* ili9341, uint16_t* framebuffer) {
+    ILI9341_WaitForTransferFast(ili9341);
+
+    ili9341->framebuffer = framebuffer;
+    ili9341->framebuffer_y = 0;
+    ili9341->framebuffer_height = ili9341->height;
+    ili9341->dirty_count = 0;
+
+    // The address window fields are shared between the panel and the framebuffer
+    ili9341->window_valid = false;
+    ili9341->window_pointer_valid = false;
+}
+
+void ILI9341_MarkDirty(ILI9341_HandleTypeDef* ili9341, int_fast16_t x, int_fast16_t y, int_fast16_t w, int_fast16_t h) {
+    if (ili9341->framebuffer == NULL || w <= 0 || h <= 0) return;
+
+    int_fast16_t x1 = x + w - 1;
+    int_fast16_t y1 = y + h - 1;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 >= ili9341->width) x1 = ili9341->width - 1;
+    if (y1 >= ili9341->height) y1 = ili9341->height - 1;
+    if (x > x1 || y > y1) return;
+
+    ILI9341_MarkDirtyFast(ili9341, x, y, x1, y1);
+}
+
+void ILI9341_Flush(ILI9341_HandleTypeDef* ili9341) {
+    uint16_t* framebuffer = ili9341->framebuffer;
+    if (framebuffer == NULL || ili9341->dirty_count == 0) return;
+
+    // Talk to the panel instead of the framebuffer while flushing
+    ili9341->framebuffer = NULL;
+    ili9341->window_valid = false;
+    ili9341->window_pointer_valid = false;
+
+    ILI9341_Select(ili9341);
+
+    for (uint_fast8_t i = 0; i < ili9341->dirty_count; i++) {
+        ILI9341_RectTypeDef rect = ili9341->dirty_rects[i];
+        size_t w = rect.x1 - rect.x0 + 1;
+        uint16_t* row = framebuffer + (size_t)rect.y0 * ili9341->width + rect.x0;
+
+        ILI9341_SetAddressWindow(ili9341, rect.x0, rect.y0, rect.x1, rect.y1);
+
+        if (w == (size_t)ili9341->width) {
+            // Full width rows are contiguous in the framebuffer
+            size_t size = w * (rect.y1 - rect.y0 + 1) * sizeof(uint16_t);
+            ILI9341_WriteDataAsync(ili9341, (uint8_t*)row, size, size);
+        } else {
+            for (int_fast16_t y = rect.y0; y <= rect.y1; y++) {
+                ILI9341_WriteDataAsync(ili9341, (uint8_t*)row, w * sizeof(uint16_t), w * sizeof(uint16_t));
+                row += ili9341->width;
+            }
+        }
+    }
+
+    ILI9341_Deselect(ili9341);
+
+    ili9341->dirty_count = 0;
+    ili9341->window_valid = false;
+    ili9341->window_pointer_valid = false;
+    ili9341->framebuffer = framebuffer;
+}
+
+ILI9341_GlyphCacheTypeDef ILI9341_GlyphCache_Init(
+    ILI9341_GlyphCacheEntryTypeDef* entries,
+    size_t entryCount,
+    uint16_t* pixels,
+    size_t pixelsSize
+) {
+    for (size_t i = 0; i < entryCount; i++) { entries[i] = (ILI9341_GlyphCacheEntryTypeDef){0}; }
+
+    const ILI9341_GlyphCacheTypeDef cache_instance = {
+        .entries = entries,
+        .entry_count = entryCount,
+        .pixels = pixels,
+        .slot_size = entryCount > 0 ? pixelsSize / entryCount : 0
+    };
+
+    return cache_instance;
+}
+
+void ILI9341_SetGlyphCache(ILI9341_HandleTypeDef* ili9341, ILI9341_GlyphCacheTypeDef* cache) {
+    ili9341->glyph_cache = cache;
+}
+
+void ILI9341_SetClipRect(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h
+) {
+    int_fast16_t x1 = x + w - 1;
+    int_fast16_t y1 = y + h - 1;
+    if (x < 0) x = 0;
+    if (y < 0) y = 0;
+    if (x1 >= ili9341->width) x1 = ili9341->width - 1;
+    if (y1 >= ili9341->height) y1 = ili9341->height - 1;
+
+    // An empty clip rectangle is represented with x0 > x1
+    if (w <= 0 || h <= 0 || x > x1 || y > y1) {
+        ili9341->clip_rect = (ILI9341_RectTypeDef){0, 0, -1, -1};
+        return;
+    }
+
+    ili9341->clip_rect = (ILI9341_RectTypeDef){x, y, x1, y1};
+}
+
+void ILI9341_ResetClipRect(ILI9341_HandleTypeDef* ili9341) {
+    ili9341->clip_rect = (ILI9341_RectTypeDef){0, 0, ili9341->width - 1, ili9341->height - 1};
+}
+
+void ILI9341_RenderBands(
+    ILI9341_HandleTypeDef* ili9341,
+    uint16_t* buffer,
+    size_t bufferSize,
+    void (*draw)(ILI9341_HandleTypeDef* ili9341, void* context),
+    void* context
+) {
+    // With DMA one half is sent while the next band is rendered into the other half
+    size_t halfSize = ili9341->transport == ILI9341_TRANSPORT_DMA ? bufferSize / 2 : bufferSize;
+    int_fast16_t bandHeight = halfSize / ili9341->width;
+    if (bandHeight < 1 || draw == NULL) return;
+
+    ILI9341_WaitForTransferFast(ili9341);
+
+    uint16_t* framebuffer = ili9341->framebuffer;
+    int_fast16_t framebufferY = ili9341->framebuffer_y;
+    int_fast16_t framebufferHeight = ili9341->framebuffer_height;
+    uint_fast8_t dirtyCount = ili9341->dirty_count;
+    ILI9341_RectTypeDef dirtyRects[ILI9341_DIRTY_RECTS_MAX];
+    memcpy(dirtyRects, ili9341->dirty_rects, sizeof(dirtyRects));
+    ILI9341_RectTypeDef clip = ili9341->clip_rect;
+
+    uint16_t* band = buffer;
+    for (int_fast16_t y = clip.y0; y <= clip.y1; y += bandHeight) {
+        int_fast16_t h = clip.y1 - y + 1 < bandHeight ? clip.y1 - y + 1 : bandHeight;
+
+        // Render the band
+        ili9341->framebuffer = band;
+        ili9341->framebuffer_y = y;
+        ili9341->framebuffer_height = h;
+        ili9341->window_valid = false;
+        ili9341->window_pointer_valid = false;
+        ili9341->clip_rect = (ILI9341_RectTypeDef){clip.x0, y, clip.x1, y + h - 1};
+        draw(ili9341, context);
+
+        // Send the band, it is the only window so the rows of the band are contiguous if the clip is full width
+        ili9341->framebuffer = NULL;
+        ili9341->window_valid = false;
+        ili9341->window_pointer_valid = false;
+
+        ILI9341_Select(ili9341);
+        ILI9341_SetAddressWindow(ili9341, clip.x0, y, clip.x1, y + h - 1);
+        size_t w = clip.x1 - clip.x0 + 1;
+        if (w == (size_t)ili9341->width) {
+            ILI9341_WriteDataAsync(ili9341, (uint8_t*)band, w * h * sizeof(uint16_t), w * h * sizeof(uint16_t));
+        } else {
+            for (int_fast16_t row = 0; row < h; row++) {
+                uint8_t* data = (uint8_t*)(band + row * ili9341->width + clip.x0);
+                ILI9341_WriteDataAsync(ili9341, data, w * sizeof(uint16_t), w * sizeof(uint16_t));
+            }
+        }
+        ILI9341_Deselect(ili9341);
+
+        if (halfSize != bufferSize) band = band == buffer ? buffer + halfSize : buffer;
+    }
+
+    ILI9341_WaitForTransferFast(ili9341);
+
+    ili9341->framebuffer = framebuffer;
+    ili9341->framebuffer_y = framebufferY;
+    ili9341->framebuffer_height = framebufferHeight;
+    ili9341->dirty_count = dirtyCount;
+    memcpy(ili9341->dirty_rects, dirtyRects, sizeof(dirtyRects));
+    ili9341->window_valid = false;
+    ili9341->window_pointer_valid = false;
+    ili9341->clip_rect = clip;
+}
+
 ILI9341_HandleTypeDef ILI9341_Init(
     SPI_HandleTypeDef* spi_handle,
     GPIO_TypeDef* cs_port,
@@ -67,7 +656,7 @@ ILI9341_HandleTypeDef ILI9341_Init(
     width = abs(width);
     height = abs(height);
 
-    const ILI9341_HandleTypeDef ili9341_instance = {
+    ILI9341_HandleTypeDef ili9341_instance = {
         .spi_handle = spi_handle,
         .cs_port = cs_port,
         .cs_pin = cs_pin,
@@ -77,10 +666,11 @@ ILI9341_HandleTypeDef ILI9341_Init(
         .rst_pin = rst_pin,
         .rotation = rotation,
         .width = width,
-        .height = height
+        .height = height,
+        .clip_rect = {0, 0, width - 1, height - 1}
     };
 
-    const ILI9341_HandleTypeDef* ili9341 = &ili9341_instance;
+    ILI9341_HandleTypeDef* ili9341 = &ili9341_instance;
 
     ILI9341_Select(ili9341);
     ILI9341_Reset(ili9341);
@@ -285,6 +875,66 @@ ILI9341_HandleTypeDef ILI9341_Init(
     return ili9341_instance;
 }
 
+/**
+ * @brief Get the size of the hardware scrolling area
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @return Number of GRAM rows between the top and bottom fixed areas
+ */
+static int_fast16_t ILI9341_GetScrollAreaSize(const ILI9341_HandleTypeDef* ili9341) {
+    int_fast16_t rows = ili9341->width > ili9341->height ? ili9341->width : ili9341->height;
+    return rows - ili9341->scroll_top - ili9341->scroll_bottom;
+}
+
+/**
+ * @brief Check whether GRAM rows run in the opposite direction of the scrolling axis in the current orientation
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @return true if MY is set
+ */
+static bool ILI9341_IsScrollMirrored(const ILI9341_HandleTypeDef* ili9341) {
+    return ili9341->rotation == ILI9341_ROTATION_HORIZONTAL_1 || ili9341->rotation == ILI9341_ROTATION_VERTICAL_2;
+}
+
+/**
+ * @brief Send the vertical scrolling start address for the current scroll offset
+ * @param ili9341 Pointer to ILI9341 handle structure
+ */
+static void ILI9341_WriteScrollStartFast(ILI9341_HandleTypeDef* ili9341) {
+    int_fast16_t area = ILI9341_GetScrollAreaSize(ili9341);
+
+    // With mirrored rows the first GRAM row of the area is at the bottom of the screen and content moves the other way
+    uint16_t start = ILI9341_IsScrollMirrored(ili9341) ? ili9341->scroll_bottom + (area - ili9341->scroll_offset) % area
+                                                        : ili9341->scroll_top + ili9341->scroll_offset;
+
+    // VSCRSADD
+    ILI9341_WriteCommand(ili9341, 0x37);
+    {
+        uint8_t data[] = {start >> 8, start & 0xFF};
+        ILI9341_WriteData(ili9341, data, sizeof(data));
+    }
+}
+
+/**
+ * @brief Send the vertical scrolling definition and start address
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @note The scrolling registers work on GRAM rows, which run along the screen Y axis in vertical orientations and
+ * along the X axis in horizontal orientations.
+ */
+static void ILI9341_WriteScrollRegistersFast(ILI9341_HandleTypeDef* ili9341) {
+    bool mirrored = ILI9341_IsScrollMirrored(ili9341);
+    uint16_t top = mirrored ? ili9341->scroll_bottom : ili9341->scroll_top;
+    uint16_t area = ILI9341_GetScrollAreaSize(ili9341);
+    uint16_t bottom = mirrored ? ili9341->scroll_top : ili9341->scroll_bottom;
+
+    // VSCRDEF
+    ILI9341_WriteCommand(ili9341, 0x33);
+    {
+        uint8_t data[] = {top >> 8, top & 0xFF, area >> 8, area & 0xFF, bottom >> 8, bottom & 0xFF};
+        ILI9341_WriteData(ili9341, data, sizeof(data));
+    }
+
+    ILI9341_WriteScrollStartFast(ili9341);
+}
+
 void ILI9341_SetOrientation(ILI9341_HandleTypeDef* ili9341, int_fast8_t rotation) {
     ILI9341_Select(ili9341);
 
@@ -333,11 +983,59 @@ void ILI9341_SetOrientation(ILI9341_HandleTypeDef* ili9341, int_fast8_t rotation
     }
 
     ili9341->rotation = rotation;
+    ili9341->clip_rect = (ILI9341_RectTypeDef){0, 0, ili9341->width - 1, ili9341->height - 1};
+
+    // The scrolling registers depend on the GRAM row order
+    if (ili9341->scroll_top > 0 || ili9341->scroll_bottom > 0 || ili9341->scroll_offset > 0)
+        ILI9341_WriteScrollRegistersFast(ili9341);
+
+    ILI9341_Deselect(ili9341);
+
+    if (ili9341->framebuffer != NULL) {
+        // The framebuffer layout no longer matches the panel, everything has to be sent again
+        ili9341->framebuffer_y = 0;
+        ili9341->framebuffer_height = ili9341->height;
+        ili9341->dirty_count = 0;
+        ILI9341_MarkDirtyFast(ili9341, 0, 0, ili9341->width - 1, ili9341->height - 1);
+    }
+}
+
+void ILI9341_SetScrollArea(ILI9341_HandleTypeDef* ili9341, int_fast16_t top, int_fast16_t bottom) {
+    int_fast16_t rows = ili9341->width > ili9341->height ? ili9341->width : ili9341->height;
+    if (top < 0) top = 0;
+    if (bottom < 0) bottom = 0;
+    if (top + bottom >= rows) return;
+
+    ili9341->scroll_top = top;
+    ili9341->scroll_bottom = bottom;
+    ili9341->scroll_offset = 0;
+
+    ILI9341_Select(ili9341);
+    ILI9341_WriteScrollRegistersFast(ili9341);
+    ILI9341_Deselect(ili9341);
+}
+
+void ILI9341_SetScrollOffset(ILI9341_HandleTypeDef* ili9341, int_fast16_t offset) {
+    int_fast16_t area = ILI9341_GetScrollAreaSize(ili9341);
+
+    offset %= area;
+    if (offset < 0) offset += area;
+    ili9341->scroll_offset = offset;
 
+    ILI9341_Select(ili9341);
+    ILI9341_WriteScrollStartFast(ili9341);
     ILI9341_Deselect(ili9341);
 }
 
-void ILI9341_SetBrightness(const ILI9341_HandleTypeDef* ili9341, uint_fast8_t brightness) {
+int_fast16_t ILI9341_ScrollTranslate(const ILI9341_HandleTypeDef* ili9341, int_fast16_t position) {
+    int_fast16_t area = ILI9341_GetScrollAreaSize(ili9341);
+
+    if (position < ili9341->scroll_top || position >= ili9341->scroll_top + area) return position;
+
+    return ili9341->scroll_top + (position - ili9341->scroll_top + ili9341->scroll_offset) % area;
+}
+
+void ILI9341_SetBrightness(ILI9341_HandleTypeDef* ili9341, uint_fast8_t brightness) {
     if (brightness > 0xFF) brightness = 0xFF;
 
     ILI9341_Select(ili9341);
@@ -351,7 +1049,7 @@ void ILI9341_SetBrightness(const ILI9341_HandleTypeDef* ili9341, uint_fast8_t br
     ILI9341_Deselect(ili9341);
 }
 
-void ILI9341_InvertColors(const ILI9341_HandleTypeDef* ili9341, bool invert) {
+void ILI9341_InvertColors(ILI9341_HandleTypeDef* ili9341, bool invert) {
     ILI9341_Select(ili9341);
     ILI9341_WriteCommand(ili9341, invert ? 0x21 /* INVON */ : 0x20 /* INVOFF */);
     ILI9341_Deselect(ili9341);
@@ -364,30 +1062,49 @@ void ILI9341_InvertColors(const ILI9341_HandleTypeDef* ili9341, bool invert) {
  * @param y0 Y coordinate of the top-left corner of the window
  * @param x1 X coordinate of the bottom-right corner of the window
  * @param y1 Y coordinate of the bottom-right corner of the window
+ * @note CASET and RASET are skipped when the column or row range is already programmed. In framebuffer mode the window
+ * is only recorded (and marked dirty) for the following pixel data.
  */
 static void ILI9341_SetAddressWindow(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     uint16_t x0,
     uint16_t y0,
     uint16_t x1,
     uint16_t y1
 ) {
-    // column address set
-    ILI9341_WriteCommand(ili9341, 0x2A);  // CASET
-    {
-        uint8_t data[] = {(x0 >> 8) & 0xFF, x0 & 0xFF, (x1 >> 8) & 0xFF, x1 & 0xFF};
-        ILI9341_WriteData(ili9341, data, sizeof(data));
-    }
+    if (ili9341->framebuffer != NULL) {
+        ILI9341_MarkDirtyFast(ili9341, x0, y0, x1, y1);
+    } else {
+        // column address set
+        if (!ili9341->window_valid || ili9341->window_x0 != x0 || ili9341->window_x1 != x1) {
+            ILI9341_WriteCommand(ili9341, 0x2A);  // CASET
+            {
+                uint8_t data[] = {(x0 >> 8) & 0xFF, x0 & 0xFF, (x1 >> 8) & 0xFF, x1 & 0xFF};
+                ILI9341_WriteData(ili9341, data, sizeof(data));
+            }
+        }
 
-    // row address set
-    ILI9341_WriteCommand(ili9341, 0x2B);  // RASET
-    {
-        uint8_t data[] = {(y0 >> 8) & 0xFF, y0 & 0xFF, (y1 >> 8) & 0xFF, y1 & 0xFF};
-        ILI9341_WriteData(ili9341, data, sizeof(data));
+        // row address set
+        if (!ili9341->window_valid || ili9341->window_y0 != y0 || ili9341->window_y1 != y1) {
+            ILI9341_WriteCommand(ili9341, 0x2B);  // RASET
+            {
+                uint8_t data[] = {(y0 >> 8) & 0xFF, y0 & 0xFF, (y1 >> 8) & 0xFF, y1 & 0xFF};
+                ILI9341_WriteData(ili9341, data, sizeof(data));
+            }
+        }
+
+        // write to RAM
+        ILI9341_WriteCommand(ili9341, 0x2C);  // RAMWR
     }
 
-    // write to RAM
-    ILI9341_WriteCommand(ili9341, 0x2C);  // RAMWR
+    ili9341->window_valid = true;
+    ili9341->window_x0 = x0;
+    ili9341->window_y0 = y0;
+    ili9341->window_x1 = x1;
+    ili9341->window_y1 = y1;
+    ili9341->window_pointer_valid = true;
+    ili9341->window_pointer_x = x0;
+    ili9341->window_pointer_y = y0;
 }
 
 /**
@@ -398,19 +1115,35 @@ static void ILI9341_SetAddressWindow(
  * @param color 16-bit pixel color in RGB565 format
  */
 static void ILI9341_DrawPixelFast(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     uint16_t color
 ) {
-    if (x < 0 || y < 0 || x >= ili9341->width || y >= ili9341->height) return;
+    if (x < ili9341->clip_rect.x0 || y < ili9341->clip_rect.y0 || x > ili9341->clip_rect.x1 ||
+        y > ili9341->clip_rect.y1)
+        return;
+
+    if (ili9341->framebuffer != NULL) {
+        ili9341->framebuffer[(size_t)(y - ili9341->framebuffer_y) * ili9341->width + x] = (color >> 8) | (color << 8);
+        ILI9341_MarkDirtyFast(ili9341, x, y, x, y);
+        return;
+    }
+
+    if (ili9341->window_pointer_valid && ili9341->window_pointer_x == x && ili9341->window_pointer_y == y) {
+        // The GRAM pointer is already there, e.g. the previous pixel was the one on the left
+        ILI9341_WriteCommand(ili9341, 0x3C);  // RAMWRC
+    } else {
+        // Open the window up to the right edge so the next pixel on the right can continue the memory write
+        ILI9341_SetAddressWindow(ili9341, x, y, ili9341->width - 1, y);
+    }
 
-    ILI9341_SetAddressWindow(ili9341, x, y, x + 1, y + 1);
     uint8_t data[] = {color >> 8, color & 0xFF};
     ILI9341_WriteData(ili9341, data, sizeof(data));
+    ILI9341_AdvanceWindowPointer(ili9341, 1);
 }
 
-void ILI9341_DrawPixel(const ILI9341_HandleTypeDef* ili9341, int_fast16_t x, int_fast16_t y, uint16_t color) {
+void ILI9341_DrawPixel(ILI9341_HandleTypeDef* ili9341, int_fast16_t x, int_fast16_t y, uint16_t color) {
     ILI9341_Select(ili9341);
     ILI9341_DrawPixelFast(ili9341, x, y, color);
     ILI9341_Deselect(ili9341);
@@ -426,7 +1159,7 @@ void ILI9341_DrawPixel(const ILI9341_HandleTypeDef* ili9341, int_fast16_t x, int
  * @param color 16-bit fill color in RGB565 format
  */
 static void ILI9341_FillRectangleFast(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t w,
@@ -443,56 +1176,387 @@ static void ILI9341_FillRectangleFast(
         y -= h - 1;
     }
 
-    if (x >= ili9341->width || y >= ili9341->height || w == 0 || h == 0) return;
+    const ILI9341_RectTypeDef clip = ili9341->clip_rect;
+
+    if (x > clip.x1 || y > clip.y1 || w == 0 || h == 0 || clip.x0 > clip.x1 || clip.y0 > clip.y1) return;
+
+    if (x < clip.x0) {
+        w -= clip.x0 - x;
+        x = clip.x0;
+        if (w <= 0) return;
+    }
+
+    if (y < clip.y0) {
+        h -= clip.y0 - y;
+        y = clip.y0;
+        if (h <= 0) return;
+    }
+
+    if ((x + w - 1) > clip.x1) w = clip.x1 - x + 1;
+    if ((y + h - 1) > clip.y1) h = clip.y1 - y + 1;
+
+    if (ili9341->framebuffer != NULL) {
+        uint16_t swapped = (color >> 8) | (color << 8);
+        uint16_t* row = ili9341->framebuffer + (size_t)(y - ili9341->framebuffer_y) * ili9341->width + x;
+        for (int_fast16_t i = 0; i < w; i++) { row[i] = swapped; }
+        for (int_fast16_t j = 1; j < h; j++) { memcpy(row + j * ili9341->width, row, w * sizeof(uint16_t)); }
+        ILI9341_MarkDirtyFast(ili9341, x, y, x + w - 1, y + h - 1);
+        return;
+    }
+
+    uint16_t stackBuffer[ILI9341_FILL_RECT_BUFFER_SIZE];
+    size_t bufferSize;
+    uint16_t* buffer = ILI9341_GetStagingBuffer(ili9341, stackBuffer, ILI9341_FILL_RECT_BUFFER_SIZE, &bufferSize);
+    size_t totalSize = w * h;
+    size_t chunkSize = totalSize > bufferSize ? bufferSize : totalSize;
+
+    color = (color >> 8) | (color << 8);
+    for (size_t i = 0; i < chunkSize; i++) { buffer[i] = color; }
+
+    ILI9341_SetAddressWindow(ili9341, x, y, x + w - 1, y + h - 1);
+    ILI9341_WriteDataAsync(ili9341, (uint8_t*)buffer, chunkSize * 2, totalSize * 2);
+
+    // The stack buffer goes out of scope on return, whichever half of it is being sent
+    if (ili9341->buffer_pool == NULL || ili9341->buffer_pool_size == 0) ILI9341_WaitForTransferFast(ili9341);
+}
+
+void ILI9341_FillRectangle(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint16_t color
+) {
+    ILI9341_Select(ili9341);
+    ILI9341_FillRectangleFast(ili9341, x, y, w, h, color);
+    ILI9341_Deselect(ili9341);
+}
+
+void ILI9341_FillScreen(ILI9341_HandleTypeDef* ili9341, uint16_t color) {
+    ILI9341_Select(ili9341);
+    ILI9341_FillRectangleFast(ili9341, 0, 0, ili9341->width, ili9341->height, color);
+    ILI9341_Deselect(ili9341);
+}
+
+/**
+ * @brief Get the number of bits per pixel of a glyph
+ * @param glyph Pointer to the glyph
+ * @return 1 for bitmaps, 2 or 4 for anti-aliased glyphs
+ */
+static int_fast8_t ILI9341_GlyphBitsPerPixel(const ILI9341_GlyphDef* glyph) {
+    switch (glyph->encoding) {
+        case ILI9341_GLYPH_ENCODING_COVERAGE_2BPP:
+            return 2;
+        case ILI9341_GLYPH_ENCODING_COVERAGE_4BPP:
+            return 4;
+        default:
+            return 1;
+    }
+}
+
+/**
+ * @brief Get the colors of the pixel values of a glyph, anti-aliased glyphs blend the two colors
+ * @param ili9341 Pointer to ILI9341 handle structure, keeps the blend ramp of the last color pair
+ * @param bpp Bits per pixel of the glyph
+ * @param colors Background and foreground colors, byte-swapped
+ * @return Colors indexed by pixel value, byte-swapped, valid until the next call
+ */
+static const uint16_t* ILI9341_GlyphColors(ILI9341_HandleTypeDef* ili9341, int_fast8_t bpp, const uint16_t colors[2]) {
+    ILI9341_BlendRampTypeDef* ramp = &ili9341->blend_ramp;
+
+    if (bpp == 1) return colors;
+    if (ramp->bpp == bpp && ramp->bg_color == colors[0] && ramp->color == colors[1]) return ramp->colors;
+
+    uint16_t bg = (colors[0] >> 8) | (colors[0] << 8);
+    uint16_t fg = (colors[1] >> 8) | (colors[1] << 8);
+    int_fast32_t max = (1 << bpp) - 1;
+
+    // Each RGB565 channel is interpolated on its own, rounded to the nearest value
+    for (int_fast32_t i = 0; i <= max; i++) {
+        uint16_t r = ((bg >> 11) * (max - i) + (fg >> 11) * i + max / 2) / max;
+        uint16_t g = (((bg >> 5) & 0x3F) * (max - i) + ((fg >> 5) & 0x3F) * i + max / 2) / max;
+        uint16_t b = ((bg & 0x1F) * (max - i) + (fg & 0x1F) * i + max / 2) / max;
+        uint16_t color = (r << 11) | (g << 5) | b;
+        ramp->colors[i] = (color >> 8) | (color << 8);
+    }
+
+    ramp->bg_color = colors[0];
+    ramp->color = colors[1];
+    ramp->bpp = bpp;
+    return ramp->colors;
+}
+
+/**
+ * @brief Check whether a row of a glyph is the same as the row above it and not stored again
+ * @param glyph Pointer to the glyph
+ * @param row Row of the glyph, from 1 to bbH - 1
+ * @return true if the row repeats the row above it
+ */
+static bool ILI9341_GlyphRowRepeats(const ILI9341_GlyphDef* glyph, int_fast16_t row) {
+    return glyph->encoding == ILI9341_GLYPH_ENCODING_ROW_REPEAT && (glyph->data[row / 8] & (0x80 >> (row % 8)));
+}
+
+/**
+ * @brief Get the index of the bit of the first pixel of a glyph row in the glyph data
+ * @param glyph Pointer to the glyph
+ * @param row Row of the glyph, from 0 to bbH - 1
+ * @return Bit index of the row, see ILI9341_GlyphNextRowIndex to walk the rows in order
+ */
+static uint_fast32_t ILI9341_GlyphRowIndex(const ILI9341_GlyphDef* glyph, int_fast16_t row) {
+    if (glyph->encoding != ILI9341_GLYPH_ENCODING_ROW_REPEAT) {
+        return (uint_fast32_t)row * glyph->bbW * ILI9341_GlyphBitsPerPixel(glyph);
+    }
+
+    // The stored rows start after the flags, a flagged row uses the one stored above it
+    uint_fast32_t index = glyph->bbH;
+    for (int_fast16_t i = 1; i <= row; i++) {
+        if (!ILI9341_GlyphRowRepeats(glyph, i)) index += glyph->bbW;
+    }
+    return index;
+}
+
+/**
+ * @brief Get the bit index of the row below a glyph row
+ * @param glyph Pointer to the glyph
+ * @param row Row of the glyph
+ * @param index Bit index of the row
+ * @return Bit index of row + 1
+ */
+static uint_fast32_t ILI9341_GlyphNextRowIndex(const ILI9341_GlyphDef* glyph, int_fast16_t row, uint_fast32_t index) {
+    if (row + 1 < glyph->bbH && ILI9341_GlyphRowRepeats(glyph, row + 1)) return index;
+    return index + glyph->bbW * ILI9341_GlyphBitsPerPixel(glyph);
+}
+
+/**
+ * @brief Expand scaled pixels of a glyph row from its packed bitmap
+ * @param data Glyph bitmap data
+ * @param bitIndex Index of the bit of the first pixel in the bitmap
+ * @param bpp Bits per pixel, 1, 2 or 4
+ * @param repeat Number of times the first pixel is repeated, from 1 to scale (less when the row starts mid-pixel)
+ * @param scale Integer scaling factor
+ * @param count Number of pixels to write
+ * @param colors Colors indexed by pixel value, byte-swapped, see ILI9341_GlyphColors
+ * @param out Destination of the pixels
+ * @note The bitmap is walked one pixel at a time without any division, whole bytes are expanded at once when unscaled
+ * 1-bpp. Anti-aliased pixels cost the same table lookup as the others.
+ */
+static void ILI9341_ExpandGlyphBits(
+    const uint8_t* data,
+    uint_fast32_t bitIndex,
+    int_fast8_t bpp,
+    int_fast16_t repeat,
+    int_fast16_t scale,
+    int_fast16_t count,
+    const uint16_t* colors,
+    uint16_t* out
+) {
+    const uint8_t* byte = data + bitIndex / 8;
+    uint8_t bits = 0;
+    uint_fast8_t left = 0;
+    uint_fast8_t shift = 8 - bpp;
+
+    if (bitIndex % 8) {
+        bits = *(byte++) << (bitIndex % 8);
+        left = 8 - bitIndex % 8;
+    }
+
+    while (count > 0) {
+        if (left == 0) {
+            if (bpp == 1 && scale == 1 && count >= 8) {
+                uint_fast8_t b = *(byte++);
+                out[0] = colors[(b >> 7) & 1];
+                out[1] = colors[(b >> 6) & 1];
+                out[2] = colors[(b >> 5) & 1];
+                out[3] = colors[(b >> 4) & 1];
+                out[4] = colors[(b >> 3) & 1];
+                out[5] = colors[(b >> 2) & 1];
+                out[6] = colors[(b >> 1) & 1];
+                out[7] = colors[b & 1];
+                out += 8;
+                count -= 8;
+                continue;
+            }
+
+            // Only load the next byte when a pixel needs it, the last byte of the bitmap may be the last in memory
+            bits = *(byte++);
+            left = 8;
+        }
+
+        uint16_t color = colors[bits >> shift];
+        int_fast16_t n = repeat < count ? repeat : count;
+        count -= n;
+        while (n-- > 0) { *(out++) = color; }
+
+        repeat = scale;
+        bits <<= bpp;
+        left -= bpp;
+    }
+}
+
+/**
+ * @brief Write pixels of a single color to a pixel writer
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param writer Pointer to the pixel writer state
+ * @param color 16-bit color, byte-swapped
+ * @param count Number of pixels to write
+ */
+static void ILI9341_PixelWriterFill(
+    ILI9341_HandleTypeDef* ili9341,
+    ILI9341_PixelWriter* writer,
+    uint16_t color,
+    int_fast16_t count
+) {
+    while (count > 0) {
+        writer->buffer[writer->count++] = color;
+        count--;
+        if (writer->count >= writer->bufferSize) ILI9341_PixelWriterFlush(ili9341, writer);
+    }
+}
+
+/**
+ * @brief Write rows of scaled glyph pixels to a pixel writer, the row is expanded once and copied for the other rows
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param writer Pointer to the pixel writer state
+ * @param data Glyph bitmap data
+ * @param bitIndex Index of the bit of the first pixel of the row in the bitmap
+ * @param bpp Bits per pixel, 1, 2 or 4
+ * @param repeat Number of times the first pixel is repeated, see ILI9341_ExpandGlyphBits
+ * @param scale Integer scaling factor
+ * @param width Number of pixels per row
+ * @param rows Number of identical rows to write
+ * @param colors Colors indexed by pixel value, byte-swapped, see ILI9341_GlyphColors
+ */
+static void ILI9341_PixelWriterGlyphRows(
+    ILI9341_HandleTypeDef* ili9341,
+    ILI9341_PixelWriter* writer,
+    const uint8_t* data,
+    uint_fast32_t bitIndex,
+    int_fast8_t bpp,
+    int_fast16_t repeat,
+    int_fast16_t scale,
+    int_fast16_t width,
+    int_fast16_t rows,
+    const uint16_t* colors
+) {
+    const uint16_t* previous = NULL;
+
+    for (; rows > 0; rows--) {
+        if ((size_t)width > writer->bufferSize) {
+            // Rows wider than the staging buffer are expanded in pieces, every row again
+            uint_fast32_t pieceIndex = bitIndex;
+            int_fast16_t pieceRepeat = repeat;
+
+            for (int_fast16_t done = 0; done < width;) {
+                int_fast16_t n = width - done;
+                if ((size_t)n > writer->bufferSize - writer->count) n = writer->bufferSize - writer->count;
+
+                uint16_t* out = writer->buffer + writer->count;
+                ILI9341_ExpandGlyphBits(data, pieceIndex, bpp, pieceRepeat, scale, n, colors, out);
+                writer->count += n;
+                done += n;
+                if (writer->count >= writer->bufferSize) ILI9341_PixelWriterFlush(ili9341, writer);
+
+                if (n < pieceRepeat) {
+                    pieceRepeat -= n;
+                } else {
+                    pieceIndex += (1 + (n - pieceRepeat) / scale) * bpp;
+                    pieceRepeat = scale - (n - pieceRepeat) % scale;
+                }
+            }
+            continue;
+        }
+
+        // Keep each row contiguous, the previous one is still intact in the other staging buffer half
+        if ((size_t)width > writer->bufferSize - writer->count) ILI9341_PixelWriterFlush(ili9341, writer);
+
+        uint16_t* out = writer->buffer + writer->count;
+        if (previous != NULL) {
+            memmove(out, previous, width * sizeof(uint16_t));
+        } else {
+            ILI9341_ExpandGlyphBits(data, bitIndex, bpp, repeat, scale, width, colors, out);
+        }
 
-    if (x < 0) {
-        w += x;
-        x = 0;
-        if (w <= 0) return;
+        previous = out;
+        writer->count += width;
+        if (writer->count >= writer->bufferSize) ILI9341_PixelWriterFlush(ili9341, writer);
     }
+}
 
-    if (y < 0) {
-        h += y;
-        y = 0;
-        if (h <= 0) return;
-    }
+/**
+ * @brief Get the rendered pixels of an opaque glyph from the glyph cache, rendering it on a miss
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param glyph Glyph to render
+ * @param color 16-bit text color, byte-swapped
+ * @param bgColor 16-bit background color, byte-swapped
+ * @param scale Integer scaling factor
+ * @return Pointer to the glyph pixels, bbW * scale by bbH * scale, or NULL if the glyph does not fit in a slot
+ */
+static const uint16_t* ILI9341_GlyphCacheGet(
+    ILI9341_HandleTypeDef* ili9341,
+    ILI9341_GlyphDef glyph,
+    uint16_t color,
+    uint16_t bgColor,
+    int_fast16_t scale
+) {
+    ILI9341_GlyphCacheTypeDef* cache = ili9341->glyph_cache;
+    int_fast16_t w = glyph.bbW * scale;
+    int_fast16_t h = glyph.bbH * scale;
+
+    if (cache->entry_count == 0 || (size_t)(w * h) > cache->slot_size) return NULL;
+
+    // Glyphs can share their data, e.g. identical const compound literals may share storage (C11 6.5.2.5p7) and a
+    // hand-built font can point several glyphs at one array, so the pixels are keyed by everything they are made of
+    size_t victim = 0;
+    for (size_t i = 0; i < cache->entry_count; i++) {
+        ILI9341_GlyphCacheEntryTypeDef* entry = &cache->entries[i];
+
+        if (entry->data == glyph.data && entry->bbW == glyph.bbW && entry->bbH == glyph.bbH &&
+            entry->encoding == glyph.encoding && entry->color == color && entry->bg_color == bgColor &&
+            entry->scale == scale) {
+            entry->last_used = ++cache->clock;
+            cache->hits++;
+            return cache->pixels + i * cache->slot_size;
+        }
 
-    if ((x + w - 1) >= ili9341->width) w = ili9341->width - x;
-    if ((y + h - 1) >= ili9341->height) h = ili9341->height - y;
+        if (entry->data == NULL) {
+            if (cache->entries[victim].data != NULL) victim = i;
+        } else if (cache->entries[victim].data != NULL && entry->last_used < cache->entries[victim].last_used) {
+            victim = i;
+        }
+    }
 
-    uint16_t buffer[ILI9341_FILL_RECT_BUFFER_SIZE];
-    size_t totalSize = w * h;
-    size_t chunkSize = totalSize > ILI9341_FILL_RECT_BUFFER_SIZE ? ILI9341_FILL_RECT_BUFFER_SIZE : totalSize;
+    cache->misses++;
 
-    color = (color >> 8) | (color << 8);
-    for (size_t i = 0; i < chunkSize; i++) { buffer[i] = color; }
+    uint16_t* pixels = cache->pixels + victim * cache->slot_size;
 
-    ILI9341_SetAddressWindow(ili9341, x, y, x + w - 1, y + h - 1);
+    // The slot being replaced may still be in flight from an earlier hit
+    if (ili9341->transfer_data == (uint8_t*)pixels) ILI9341_WaitForTransferFast(ili9341);
 
-    while (totalSize > 0) {
-        ILI9341_WriteData(ili9341, (uint8_t*)buffer, chunkSize * 2);
-        totalSize -= chunkSize;
-        chunkSize = totalSize > ILI9341_FILL_RECT_BUFFER_SIZE ? ILI9341_FILL_RECT_BUFFER_SIZE : totalSize;
+    const uint16_t colors[2] = {bgColor, color};
+    int_fast8_t bpp = ILI9341_GlyphBitsPerPixel(&glyph);
+    const uint16_t* glyphColors = ILI9341_GlyphColors(ili9341, bpp, colors);
+    uint16_t* pixel = pixels;
+    uint_fast32_t rowIndex = ILI9341_GlyphRowIndex(&glyph, 0);
+    for (int_fast16_t row = 0; row < glyph.bbH; row++) {
+        ILI9341_ExpandGlyphBits(glyph.data, rowIndex, bpp, scale, scale, w, glyphColors, pixel);
+        for (int_fast16_t i = 1; i < scale; i++) { memcpy(pixel + i * w, pixel, w * sizeof(uint16_t)); }
+        pixel += w * scale;
+        rowIndex = ILI9341_GlyphNextRowIndex(&glyph, row, rowIndex);
     }
-}
 
-void ILI9341_FillRectangle(
-    const ILI9341_HandleTypeDef* ili9341,
-    int_fast16_t x,
-    int_fast16_t y,
-    int_fast16_t w,
-    int_fast16_t h,
-    uint16_t color
-) {
-    ILI9341_Select(ili9341);
-    ILI9341_FillRectangleFast(ili9341, x, y, w, h, color);
-    ILI9341_Deselect(ili9341);
-}
+    cache->entries[victim] = (ILI9341_GlyphCacheEntryTypeDef){
+        .data = glyph.data,
+        .bbW = glyph.bbW,
+        .bbH = glyph.bbH,
+        .encoding = glyph.encoding,
+        .color = color,
+        .bg_color = bgColor,
+        .scale = scale,
+        .last_used = ++cache->clock
+    };
 
-void ILI9341_FillScreen(const ILI9341_HandleTypeDef* ili9341, uint16_t color) {
-    ILI9341_Select(ili9341);
-    ILI9341_FillRectangleFast(ili9341, 0, 0, ili9341->width, ili9341->height, color);
-    ILI9341_Deselect(ili9341);
+    return pixels;
 }
 
 /**
@@ -504,62 +1568,232 @@ void ILI9341_FillScreen(const ILI9341_HandleTypeDef* ili9341, uint16_t color) {
  * @param color 16-bit character color in RGB565 format
  * @param bgColor 16-bit background color in RGB565 format
  * @param scale Scaling factor (integer) to enlarge the character
+ * @param cacheable Whether the glyph can be kept in the glyph cache, see ILI9341_FontLoaderDef
  */
 static void ILI9341_DrawGlyphFast(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     ILI9341_GlyphDef glyph,
     uint16_t color,
     uint16_t bgColor,
-    int_fast16_t scale
+    int_fast16_t scale,
+    bool cacheable
 ) {
     int_fast16_t startX = x + glyph.bbX * scale;
     int_fast16_t startY = y - glyph.bbY * scale - glyph.bbH * scale + 1;
     int_fast16_t endX = startX + glyph.bbW * scale - 1;
     int_fast16_t endY = startY + glyph.bbH * scale - 1;
 
-    if (endX < 0 || endY < 0 || startX >= ili9341->width || startY >= ili9341->height ||
-        (glyph.bbW == 0 || glyph.bbH == 0))
+    const ILI9341_RectTypeDef clip = ili9341->clip_rect;
+
+    if (endX < clip.x0 || endY < clip.y0 || startX > clip.x1 || startY > clip.y1 || clip.x0 > clip.x1 ||
+        clip.y0 > clip.y1 || (glyph.bbW == 0 || glyph.bbH == 0))
         return;
 
-    int_fast16_t clipStartX = startX < 0 ? -startX : 0;
-    int_fast16_t clipStartY = startY < 0 ? -startY : 0;
-    int_fast16_t clipEndX = endX >= ili9341->width ? ili9341->width - startX - 1 : glyph.bbW * scale - 1;
-    int_fast16_t clipEndY = endY >= ili9341->height ? ili9341->height - startY - 1 : glyph.bbH * scale - 1;
+    int_fast16_t clipStartX = startX < clip.x0 ? clip.x0 - startX : 0;
+    int_fast16_t clipStartY = startY < clip.y0 ? clip.y0 - startY : 0;
+    int_fast16_t clipEndX = endX > clip.x1 ? clip.x1 - startX : glyph.bbW * scale - 1;
+    int_fast16_t clipEndY = endY > clip.y1 ? clip.y1 - startY : glyph.bbH * scale - 1;
 
     color = (color >> 8) | (color << 8);
     bgColor = (bgColor >> 8) | (bgColor << 8);
 
-    uint16_t buffer[ILI9341_DRAW_GLYPH_BUFFER_SIZE];
-    size_t bufferIndex = 0;
+    bool clipped =
+        clipStartX > 0 || clipStartY > 0 || clipEndX < glyph.bbW * scale - 1 || clipEndY < glyph.bbH * scale - 1;
+    if (ili9341->glyph_cache != NULL && cacheable && !clipped) {
+        const uint16_t* pixels = ILI9341_GlyphCacheGet(ili9341, glyph, color, bgColor, scale);
+        if (pixels != NULL) {
+            size_t size = (size_t)glyph.bbW * glyph.bbH * scale * scale * sizeof(uint16_t);
+            ILI9341_SetAddressWindow(ili9341, startX, startY, endX, endY);
+            ILI9341_WriteDataAsync(ili9341, (uint8_t*)pixels, size, size);
+            return;
+        }
+    }
 
-    ILI9341_SetAddressWindow(ili9341, startX + clipStartX, startY + clipStartY, startX + clipEndX, startY + clipEndY);
+    uint16_t stackBuffer[ILI9341_DRAW_GLYPH_BUFFER_SIZE];
+    ILI9341_PixelWriter writer;
+    ILI9341_PixelWriterBegin(
+        ili9341,
+        &writer,
+        stackBuffer,
+        ILI9341_DRAW_GLYPH_BUFFER_SIZE,
+        startX + clipStartX,
+        startY + clipStartY,
+        startX + clipEndX,
+        startY + clipEndY
+    );
+
+    // The clipped window may start in the middle of a scaled pixel, only the first row and column are shorter
+    const uint16_t colors[2] = {bgColor, color};
+    int_fast8_t bpp = ILI9341_GlyphBitsPerPixel(&glyph);
+    const uint16_t* glyphColors = ILI9341_GlyphColors(ili9341, bpp, colors);
+    int_fast16_t width = clipEndX - clipStartX + 1;
+    int_fast16_t colRepeat = scale - clipStartX % scale;
+    int_fast16_t rowRepeat = scale - clipStartY % scale;
+    int_fast16_t fontRow = clipStartY / scale;
+    uint_fast32_t rowIndex = ILI9341_GlyphRowIndex(&glyph, fontRow);
+
+    for (int_fast16_t row = clipStartY; row <= clipEndY;) {
+        // Rows stored once for several font rows are also expanded once
+        while (fontRow + 1 < glyph.bbH && ILI9341_GlyphRowRepeats(&glyph, fontRow + 1)) {
+            rowRepeat += scale;
+            fontRow++;
+        }
 
-    for (int_fast16_t row = clipStartY; row <= clipEndY; row++) {
-        for (int_fast16_t col = clipStartX; col <= clipEndX; col++) {
-            int_fast32_t bitIndex = row / scale * glyph.bbW + col / scale;
-            uint8_t mask = 0x80 >> (bitIndex % 8);
-            int_fast16_t index = bitIndex / 8;
+        int_fast16_t rows = rowRepeat < clipEndY - row + 1 ? rowRepeat : clipEndY - row + 1;
+        uint_fast32_t bitIndex = rowIndex + (uint_fast32_t)(clipStartX / scale) * bpp;
+        ILI9341_PixelWriterGlyphRows(
+            ili9341, &writer, glyph.data, bitIndex, bpp, colRepeat, scale, width, rows, glyphColors
+        );
 
-            if (glyph.data[index] & mask) {
-                buffer[bufferIndex++] = color;
-            } else {
-                buffer[bufferIndex++] = bgColor;
-            }
+        row += rows;
+        rowRepeat = scale;
+        rowIndex = ILI9341_GlyphNextRowIndex(&glyph, fontRow, rowIndex);
+        fontRow++;
+    }
 
-            if (bufferIndex >= ILI9341_DRAW_GLYPH_BUFFER_SIZE) {
-                ILI9341_WriteData(ili9341, (uint8_t*)buffer, bufferIndex * 2);
-                bufferIndex = 0;
-            }
+    ILI9341_PixelWriterEnd(ili9341, &writer);
+}
+
+uint32_t ILI9341_DecodeUTF8(const char** str) {
+    const uint8_t* s = (const uint8_t*)*str;
+    uint32_t codepoint;
+    int_fast8_t continuation;
+
+    if (s[0] < 0x80) {
+        if (s[0] != 0) (*str)++;
+        return s[0];
+    } else if (s[0] >= 0xC2 && s[0] <= 0xDF) {
+        codepoint = s[0] & 0x1F;
+        continuation = 1;
+    } else if (s[0] >= 0xE0 && s[0] <= 0xEF) {
+        codepoint = s[0] & 0x0F;
+        continuation = 2;
+    } else if (s[0] >= 0xF0 && s[0] <= 0xF4) {
+        codepoint = s[0] & 0x07;
+        continuation = 3;
+    } else {
+        continuation = 0;
+        codepoint = 0;
+    }
+
+    // A NUL is not a continuation byte, so a truncated sequence never reads past the end of the string
+    for (int_fast8_t i = 1; i <= continuation; i++) {
+        if ((s[i] & 0xC0) != 0x80) {
+            continuation = 0;
+            break;
+        }
+        codepoint = (codepoint << 6) | (s[i] & 0x3F);
+    }
+
+    // Overlong forms, surrogates and codepoints past U+10FFFF are invalid too
+    bool surrogate = codepoint >= 0xD800 && codepoint <= 0xDFFF;
+    if (continuation == 0 || (continuation == 2 && (codepoint < 0x800 || surrogate)) ||
+        (continuation == 3 && (codepoint < 0x10000 || codepoint > 0x10FFFF))) {
+        (*str)++;
+        return s[0];
+    }
+
+    *str += continuation + 1;
+    return codepoint;
+}
+
+/**
+ * @brief Find the glyph index of a codepoint with a binary search of the ranges of a font
+ * @param font Font definition
+ * @param codepoint Unicode codepoint
+ * @param index Where to store the index of the glyph
+ * @return true if the codepoint is covered by the font
+ */
+static bool ILI9341_FindGlyphIndex(ILI9341_FontDef font, uint32_t codepoint, uint_fast16_t* index) {
+    if (font.loader != NULL) return font.loader->find_glyph(font.loader->context, codepoint, index);
+
+    uint_fast16_t low = 0;
+    uint_fast16_t high = font.rangeCount;
+
+    while (low < high) {
+        uint_fast16_t middle = low + (high - low) / 2;
+        const ILI9341_FontRangeDef* range = &font.ranges[middle];
+
+        if (codepoint < range->startCodepoint) {
+            high = middle;
+        } else if (codepoint > range->endCodepoint) {
+            low = middle + 1;
+        } else {
+            *index = range->glyphIndex + (codepoint - range->startCodepoint);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+ILI9341_GlyphDef ILI9341_GetGlyph(ILI9341_FontDef font, uint32_t codepoint) {
+    uint_fast16_t index;
+    if (!ILI9341_FindGlyphIndex(font, codepoint, &index) && !ILI9341_FindGlyphIndex(font, FALLBACK_CODEPOINT, &index)) {
+        index = 0;
+    }
+    if (font.loader != NULL) return font.loader->load_glyph(font.loader->context, index);
+    return font.glyphs[index];
+}
+
+int_fast8_t ILI9341_GetKerning(ILI9341_FontDef font, uint32_t left, uint32_t right) {
+    if (font.kerningCount == 0 || left > 0xFFFF || right > 0xFFFF) return 0;
+    if (font.loader != NULL) return font.loader->kerning(font.loader->context, left, right);
+
+    uint_fast32_t key = (left << 16) | right;
+    uint_fast16_t low = 0;
+    uint_fast16_t high = font.kerningCount;
+
+    while (low < high) {
+        uint_fast16_t middle = low + (high - low) / 2;
+        const ILI9341_KerningPairDef* pair = &font.kerning[middle];
+        uint_fast32_t pairKey = ((uint_fast32_t)pair->left << 16) | pair->right;
+
+        if (key < pairKey) {
+            high = middle;
+        } else if (key > pairKey) {
+            low = middle + 1;
+        } else {
+            return pair->offset;
         }
     }
 
-    if (bufferIndex > 0) { ILI9341_WriteData(ili9341, (uint8_t*)buffer, bufferIndex * 2); }
+    return 0;
+}
+
+/**
+ * @brief Get the space added between a character and the next one of a string
+ * @param font Font definition
+ * @param codepoint Unicode codepoint of the character
+ * @param next Pointer to the next character
+ * @param scale Integer scaling factor
+ * @param tracking Additional space in pixels between characters
+ * @return Kerning and tracking in pixels, to add to the advance of the character
+ */
+static int_fast16_t ILI9341_PairSpacing(
+    ILI9341_FontDef font,
+    uint32_t codepoint,
+    const char* next,
+    int_fast16_t scale,
+    int_fast16_t tracking
+) {
+    // The next character is not even decoded when there is nothing to add, as with monospace fonts and no tracking
+    if (!tracking && font.kerningCount == 0) return 0;
+
+    uint32_t nextCodepoint = ILI9341_DecodeUTF8(&next);
+    if (nextCodepoint == 0 || nextCodepoint == '\r' || nextCodepoint == '\n') return 0;
+
+    int_fast16_t spacing = ILI9341_GetKerning(font, codepoint, nextCodepoint) * scale;
+
+    // Only apply tracking if next char is not zero-width, help diacritics stay aligned
+    if (tracking && ILI9341_GetGlyph(font, nextCodepoint).advance > 0) spacing += tracking;
+    return spacing;
 }
 
 void ILI9341_WriteString(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     const char* str,
@@ -574,10 +1808,11 @@ void ILI9341_WriteString(
     if (scale < 1 || y + font.descent * scale < 0 || y - font.ascent * scale >= ili9341->height) return;
 
     int_fast16_t originalX = x;
+    bool cacheable = font.loader == NULL || !font.loader->reuses_data;
 
     ILI9341_Select(ili9341);
 
-    for (unsigned char c; (c = *(str++));) {
+    for (uint32_t c; (c = ILI9341_DecodeUTF8(&str));) {
         if (c == '\r') {
             x = originalX;
             continue;
@@ -590,8 +1825,7 @@ void ILI9341_WriteString(
             continue;
         }
 
-        if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
-        ILI9341_GlyphDef glyph = font.glyphs[c - font.startCodepoint];
+        ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, c);
 
         // Only wrap if current char is not zero-width, help prevent newline on diacritics
         if (wrap && glyph.advance > 0 && x + (glyph.bbX + glyph.bbW) * scale + 1 >= ili9341->width) {
@@ -603,22 +1837,344 @@ void ILI9341_WriteString(
             }
         }
 
-        ILI9341_DrawGlyphFast(ili9341, x, y, glyph, color, bgColor, scale);
-        x += glyph.advance * scale;
+        ILI9341_DrawGlyphFast(ili9341, x, y, glyph, color, bgColor, scale, cacheable);
+        x += glyph.advance * scale + ILI9341_PairSpacing(font, c, str, scale, tracking);
+    }
+
+    ILI9341_Deselect(ili9341);
+}
+
+void ILI9341_DrawCharCell(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint32_t codepoint,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgColor,
+    int_fast16_t scale
+) {
+    const ILI9341_RectTypeDef clip = ili9341->clip_rect;
+
+    if (scale < 1 || w <= 0 || h <= 0 || x > clip.x1 || y > clip.y1 || x + w - 1 < clip.x0 || y + h - 1 < clip.y0 ||
+        clip.x0 > clip.x1 || clip.y0 > clip.y1)
+        return;
+
+    ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, codepoint);
+
+    int_fast16_t clipStartX = x < clip.x0 ? clip.x0 - x : 0;
+    int_fast16_t clipStartY = y < clip.y0 ? clip.y0 - y : 0;
+    int_fast16_t clipEndX = x + w - 1 > clip.x1 ? clip.x1 - x : w - 1;
+    int_fast16_t clipEndY = y + h - 1 > clip.y1 ? clip.y1 - y : h - 1;
+
+    // Glyph bounding box relative to the top-left corner of the cell
+    int_fast16_t glyphX0 = glyph.bbX * scale;
+    int_fast16_t glyphY0 = (font.ascent - glyph.bbY - glyph.bbH) * scale;
+    int_fast16_t glyphX1 = glyphX0 + glyph.bbW * scale - 1;
+    int_fast16_t glyphY1 = glyphY0 + glyph.bbH * scale - 1;
+
+    color = (color >> 8) | (color << 8);
+    bgColor = (bgColor >> 8) | (bgColor << 8);
+
+    ILI9341_Select(ili9341);
+
+    uint16_t stackBuffer[ILI9341_DRAW_GLYPH_BUFFER_SIZE];
+    ILI9341_PixelWriter writer;
+    ILI9341_PixelWriterBegin(
+        ili9341,
+        &writer,
+        stackBuffer,
+        ILI9341_DRAW_GLYPH_BUFFER_SIZE,
+        x + clipStartX,
+        y + clipStartY,
+        x + clipEndX,
+        y + clipEndY
+    );
+
+    // Columns of the glyph inside the clipped cell, the rest of each row is background
+    const uint16_t colors[2] = {bgColor, color};
+    int_fast8_t bpp = ILI9341_GlyphBitsPerPixel(&glyph);
+    const uint16_t* glyphColors = ILI9341_GlyphColors(ili9341, bpp, colors);
+    int_fast16_t glyphStartX = glyphX0 > clipStartX ? glyphX0 : clipStartX;
+    int_fast16_t glyphEndX = glyphX1 < clipEndX ? glyphX1 : clipEndX;
+    int_fast16_t colRepeat = scale - (glyphStartX - glyphX0) % scale;
+    uint_fast32_t colIndex = glyphStartX > glyphX0 ? (uint_fast32_t)((glyphStartX - glyphX0) / scale) * bpp : 0;
+
+    // Source row of the first glyph row inside the clipped cell
+    int_fast16_t skippedRows = clipStartY > glyphY0 ? clipStartY - glyphY0 : 0;
+    int_fast16_t fontRow = skippedRows / scale;
+    uint_fast32_t rowIndex = fontRow < glyph.bbH ? ILI9341_GlyphRowIndex(&glyph, fontRow) : 0;
+    int_fast16_t rowRepeat = scale - skippedRows % scale;
+
+    for (int_fast16_t row = clipStartY; row <= clipEndY; row++) {
+        if (row < glyphY0 || row > glyphY1 || glyphStartX > glyphEndX) {
+            ILI9341_PixelWriterFill(ili9341, &writer, bgColor, clipEndX - clipStartX + 1);
+            continue;
+        }
+
+        ILI9341_PixelWriterFill(ili9341, &writer, bgColor, glyphStartX - clipStartX);
+        ILI9341_PixelWriterGlyphRows(
+            ili9341,
+            &writer,
+            glyph.data,
+            rowIndex + colIndex,
+            bpp,
+            colRepeat,
+            scale,
+            glyphEndX - glyphStartX + 1,
+            1,
+            glyphColors
+        );
+        ILI9341_PixelWriterFill(ili9341, &writer, bgColor, clipEndX - glyphEndX);
+
+        if (--rowRepeat == 0) {
+            rowRepeat = scale;
+            rowIndex = ILI9341_GlyphNextRowIndex(&glyph, fontRow, rowIndex);
+            fontRow++;
+        }
+    }
+
+    ILI9341_PixelWriterEnd(ili9341, &writer);
+
+    ILI9341_Deselect(ili9341);
+}
+
+/**
+ * @brief Move the pen past a character of a line, see ILI9341_WriteString for the kerning and tracking rules
+ * @param font Font definition
+ * @param codepoint Unicode codepoint of the character
+ * @param glyph Glyph of the character
+ * @param next Pointer to the next character, looked at for kerning and tracking
+ * @param end End of the line
+ * @param scale Integer scaling factor
+ * @param tracking Additional space in pixels between characters
+ * @return Advance of the pen in pixels
+ */
+static int_fast16_t ILI9341_LineAdvance(
+    ILI9341_FontDef font,
+    uint32_t codepoint,
+    ILI9341_GlyphDef glyph,
+    const char* next,
+    const char* end,
+    int_fast16_t scale,
+    int_fast16_t tracking
+) {
+    int_fast16_t advance = glyph.advance * scale;
+
+    // Checked here as well, this runs for every glyph of a line
+    if (next < end && (tracking || font.kerningCount)) {
+        advance += ILI9341_PairSpacing(font, codepoint, next, scale, tracking);
+    }
+    return advance;
+}
+
+/**
+ * @brief Read the value of a pixel from packed glyph data
+ * @param data Glyph data
+ * @param bitIndex Index of the bit of the pixel
+ * @param bpp Bits per pixel, 1, 2 or 4
+ * @return Value of the pixel, from 0 to (1 << bpp) - 1
+ */
+static uint_fast8_t ILI9341_GlyphPixelValue(const uint8_t* data, uint_fast32_t bitIndex, int_fast8_t bpp) {
+    // Pixels never straddle a byte, 2-bpp and 4-bpp rows start on a multiple of their size
+    return (data[bitIndex / 8] >> (8 - bpp - bitIndex % 8)) & ((1 << bpp) - 1);
+}
+
+/**
+ * @brief Compose one font row of a line of text as a bitmap, lineBpp bits per pixel from the left of the window
+ * @param line Bitmap to compose into
+ * @param lineBpp Bits per pixel of the bitmap, at least the bits per pixel of every glyph of the line
+ * @param codepoints Codepoints of the glyphs of the line that reach into the window
+ * @param penX Pen X coordinate of each of these glyphs
+ * @param count Number of glyphs
+ * @param font Font definition
+ * @param scale Integer scaling factor
+ * @param fontRow Row of the font, 0 is the ascent
+ * @param windowX X coordinate of the left of the window
+ * @param width Width of the window in pixels
+ */
+static void ILI9341_ComposeLineRow(
+    uint8_t* line,
+    int_fast8_t lineBpp,
+    const uint32_t* codepoints,
+    const int16_t* penX,
+    uint_fast16_t count,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t fontRow,
+    int_fast16_t windowX,
+    int_fast16_t width
+) {
+    memset(line, 0, ((uint_fast32_t)width * lineBpp + 7) / 8);
+
+    uint_fast8_t lineMax = (1 << lineBpp) - 1;
+
+    for (uint_fast16_t i = 0; i < count; i++) {
+        ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, codepoints[i]);
+        int_fast16_t x = penX[i];
+        int_fast16_t glyphRow = fontRow - (font.ascent - glyph.bbY - glyph.bbH);
+        int_fast8_t bpp = ILI9341_GlyphBitsPerPixel(&glyph);
+
+        if (glyphRow >= 0 && glyphRow < glyph.bbH && lineBpp > 1) {
+            // Coverage is rescaled to the bits of the line, overlapping glyphs keep the highest coverage
+            uint_fast32_t bitIndex = ILI9341_GlyphRowIndex(&glyph, glyphRow);
+            uint_fast8_t valueMax = (1 << bpp) - 1;
+            int_fast16_t pixel = x + glyph.bbX * scale - windowX;
+
+            for (int_fast16_t col = 0; col < glyph.bbW; col++, pixel += scale, bitIndex += bpp) {
+                uint_fast8_t value = ILI9341_GlyphPixelValue(glyph.data, bitIndex, bpp) * lineMax / valueMax;
+                if (value == 0) continue;
+
+                for (int_fast16_t p = pixel; p < pixel + scale; p++) {
+                    if (p < 0 || p >= width) continue;
+                    uint_fast32_t lineIndex = (uint_fast32_t)p * lineBpp;
+                    uint_fast8_t shift = 8 - lineBpp - lineIndex % 8;
+                    if (value > ((line[lineIndex / 8] >> shift) & lineMax)) {
+                        line[lineIndex / 8] = (line[lineIndex / 8] & ~(lineMax << shift)) | (value << shift);
+                    }
+                }
+            }
+        } else if (glyphRow >= 0 && glyphRow < glyph.bbH) {
+            uint_fast32_t bitIndex = ILI9341_GlyphRowIndex(&glyph, glyphRow);
+            const uint8_t* byte = glyph.data + bitIndex / 8;
+            uint8_t mask = 0x80 >> (bitIndex % 8);
+            int_fast16_t pixel = x + glyph.bbX * scale - windowX;
+
+            for (int_fast16_t col = 0; col < glyph.bbW; col++, pixel += scale) {
+                if (*byte & mask) {
+                    for (int_fast16_t p = pixel; p < pixel + scale; p++) {
+                        if (p >= 0 && p < width) line[p / 8] |= 0x80 >> (p % 8);
+                    }
+                }
 
-        c = *str;
-        if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
+                mask >>= 1;
+                if (mask == 0) {
+                    byte++;
+                    mask = 0x80;
+                }
+            }
+        }
+    }
+}
 
-        // Only apply tracking if next char is not zero-width, help diacritics stay aligned
-        if (tracking) {
-            ILI9341_GlyphDef glyph = font.glyphs[c - font.startCodepoint];
-            x += glyph.advance > 0 ? tracking : 0;
+void ILI9341_WriteStringLine(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    size_t length,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgColor,
+    int_fast16_t scale,
+    int_fast16_t tracking
+) {
+    if (scale < 1) return;
+
+    const char* end = str;
+    while (length-- > 0 && *end && *end != '\r' && *end != '\n') { end++; }
+
+    // The line box goes from the pen start to the pen end, widened to the glyphs that stick out of it
+    int_fast16_t boxX0 = x;
+    int_fast16_t boxX1 = x - 1;
+    int_fast16_t boxY0 = y - font.ascent * scale + 1;
+    int_fast16_t boxY1 = y + font.descent * scale;
+    int_fast16_t pen = x;
+
+    const ILI9341_RectTypeDef clip = ili9341->clip_rect;
+
+    // The line is composed with the most bits per pixel of its glyphs, 1 unless the font is anti-aliased
+    int_fast8_t lineBpp = 1;
+
+    // The glyphs that reach into the clip rectangle are laid out once here instead of again for every font row
+    uint32_t codepoints[ILI9341_MAX_LINE_WIDTH];
+    int16_t penX[ILI9341_MAX_LINE_WIDTH];
+    uint_fast16_t count = 0;
+
+    for (const char* c = str; c < end;) {
+        uint32_t codepoint = ILI9341_DecodeUTF8(&c);
+        ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, codepoint);
+        int_fast8_t bpp = ILI9341_GlyphBitsPerPixel(&glyph);
+        if (bpp > lineBpp) lineBpp = bpp;
+
+        if (glyph.bbW > 0) {
+            int_fast16_t glyphX0 = pen + glyph.bbX * scale;
+            int_fast16_t glyphX1 = glyphX0 + glyph.bbW * scale - 1;
+            if (glyphX0 < boxX0) boxX0 = glyphX0;
+            if (glyphX1 > boxX1) boxX1 = glyphX1;
+
+            if (glyphX1 >= clip.x0 && glyphX0 <= clip.x1 && count < ILI9341_MAX_LINE_WIDTH) {
+                codepoints[count] = codepoint;
+                penX[count] = pen;
+                count++;
+            }
         }
+
+        pen += ILI9341_LineAdvance(font, codepoint, glyph, c, end, scale, tracking);
+        if (pen - 1 > boxX1) boxX1 = pen - 1;
+    }
+
+    int_fast16_t windowX0 = boxX0 > clip.x0 ? boxX0 : clip.x0;
+    int_fast16_t windowY0 = boxY0 > clip.y0 ? boxY0 : clip.y0;
+    int_fast16_t windowX1 = boxX1 < clip.x1 ? boxX1 : clip.x1;
+    int_fast16_t windowY1 = boxY1 < clip.y1 ? boxY1 : clip.y1;
+
+    if (windowX0 > windowX1 || windowY0 > windowY1) return;
+
+    int_fast16_t width = windowX1 - windowX0 + 1;
+    uint8_t line[(ILI9341_MAX_LINE_WIDTH * 4 + 7) / 8];
+    const uint16_t colors[2] = {(bgColor >> 8) | (bgColor << 8), (color >> 8) | (color << 8)};
+    const uint16_t* lineColors = ILI9341_GlyphColors(ili9341, lineBpp, colors);
+
+    ILI9341_Select(ili9341);
+
+    uint16_t stackBuffer[ILI9341_DRAW_GLYPH_BUFFER_SIZE];
+    ILI9341_PixelWriter writer;
+    ILI9341_PixelWriterBegin(
+        ili9341, &writer, stackBuffer, ILI9341_DRAW_GLYPH_BUFFER_SIZE, windowX0, windowY0, windowX1, windowY1
+    );
+
+    // Each font row is composed once at full width and expanded into as many display rows as the scale
+    int_fast16_t fontRow = (windowY0 - boxY0) / scale;
+    int_fast16_t rowRepeat = scale - (windowY0 - boxY0) % scale;
+
+    for (int_fast16_t row = windowY0; row <= windowY1;) {
+        int_fast16_t rows = rowRepeat < windowY1 - row + 1 ? rowRepeat : windowY1 - row + 1;
+
+        ILI9341_ComposeLineRow(line, lineBpp, codepoints, penX, count, font, scale, fontRow, windowX0, width);
+        ILI9341_PixelWriterGlyphRows(ili9341, &writer, line, 0, lineBpp, 1, 1, width, rows, lineColors);
+
+        row += rows;
+        rowRepeat = scale;
+        fontRow++;
     }
 
+    ILI9341_PixelWriterEnd(ili9341, &writer);
+
     ILI9341_Deselect(ili9341);
 }
 
+/**
+ * @brief Check whether two rows of a glyph bitmap are the same
+ * @param data Glyph bitmap data
+ * @param a Index of the bit of the first pixel of the first row
+ * @param b Index of the bit of the first pixel of the second row
+ * @param bits Number of bits per row
+ * @return true if both rows have the same pixels
+ */
+static bool ILI9341_GlyphRowsEqual(const uint8_t* data, uint_fast32_t a, uint_fast32_t b, int_fast16_t bits) {
+    if (a == b) return true;
+
+    for (int_fast16_t col = 0; col < bits; col++, a++, b++) {
+        bool setA = data[a / 8] & (0x80 >> (a % 8));
+        bool setB = data[b / 8] & (0x80 >> (b % 8));
+        if (setA != setB) return false;
+    }
+    return true;
+}
+
 /**
  * @brief Write a scaled character with transparent background at specified coordinates without selecting/deselecting
  * the display
@@ -631,7 +2187,7 @@ void ILI9341_WriteString(
  * @param scale Scaling factor (integer) to enlarge the character
  */
 static void ILI9341_DrawGlyphTransparentFast(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     ILI9341_GlyphDef glyph,
@@ -643,29 +2199,51 @@ static void ILI9341_DrawGlyphTransparentFast(
     int_fast16_t endX = startX + glyph.bbW * scale - 1;
     int_fast16_t endY = startY + glyph.bbH * scale - 1;
 
-    if (endX < 0 || endY < 0 || startX >= ili9341->width || startY >= ili9341->height ||
-        (glyph.bbW == 0 || glyph.bbH == 0))
+    const ILI9341_RectTypeDef clip = ili9341->clip_rect;
+
+    if (endX < clip.x0 || endY < clip.y0 || startX > clip.x1 || startY > clip.y1 || clip.x0 > clip.x1 ||
+        clip.y0 > clip.y1 || (glyph.bbW == 0 || glyph.bbH == 0))
         return;
 
-    int_fast16_t index = 0;
-    uint8_t mask = 0x80;
+    // Each horizontal run of set pixels is one rectangle, as tall as the identical rows that follow it. There is no
+    // background to blend with, so an anti-aliased pixel is set from half coverage.
+    int_fast8_t bpp = ILI9341_GlyphBitsPerPixel(&glyph);
+    uint_fast8_t threshold = 1 << (bpp - 1);
+    uint_fast32_t rowIndex = ILI9341_GlyphRowIndex(&glyph, 0);
+    for (int_fast16_t row = 0; row < glyph.bbH;) {
+        int_fast16_t rows = 1;
+        uint_fast32_t nextIndex = ILI9341_GlyphNextRowIndex(&glyph, row, rowIndex);
+        while (row + rows < glyph.bbH && ILI9341_GlyphRowsEqual(glyph.data, rowIndex, nextIndex, glyph.bbW * bpp)) {
+            nextIndex = ILI9341_GlyphNextRowIndex(&glyph, row + rows, nextIndex);
+            rows++;
+        }
 
-    for (int_fast16_t row = 0; row < glyph.bbH; row++) {
-        for (int_fast16_t col = 0; col < glyph.bbW; col++) {
-            if (glyph.data[index] & mask) {
-                ILI9341_FillRectangleFast(ili9341, startX + col * scale, startY + row * scale, scale, scale, color);
-            }
-            mask >>= 1;
-            if (mask == 0) {
-                index++;
-                mask = 0x80;
+        int_fast16_t runStart = -1;
+
+        for (int_fast16_t col = 0; col <= glyph.bbW; col++) {
+            bool set = col < glyph.bbW && ILI9341_GlyphPixelValue(glyph.data, rowIndex + col * bpp, bpp) >= threshold;
+
+            if (set && runStart < 0) runStart = col;
+            if (!set && runStart >= 0) {
+                ILI9341_FillRectangleFast(
+                    ili9341,
+                    startX + runStart * scale,
+                    startY + row * scale,
+                    (col - runStart) * scale,
+                    rows * scale,
+                    color
+                );
+                runStart = -1;
             }
         }
+
+        row += rows;
+        rowIndex = nextIndex;
     }
 }
 
 void ILI9341_WriteStringTransparent(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     const char* str,
@@ -682,7 +2260,7 @@ void ILI9341_WriteStringTransparent(
 
     ILI9341_Select(ili9341);
 
-    for (unsigned char c; (c = *(str++));) {
+    for (uint32_t c; (c = ILI9341_DecodeUTF8(&str));) {
         if (c == '\r') {
             x = originalX;
             continue;
@@ -695,8 +2273,7 @@ void ILI9341_WriteStringTransparent(
             continue;
         }
 
-        if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
-        ILI9341_GlyphDef glyph = font.glyphs[c - font.startCodepoint];
+        ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, c);
 
         // Only wrap if current char is not zero-width, help prevent newline on diacritics
         if (wrap && glyph.advance > 0 && x + (glyph.bbX + glyph.bbW) * scale + 1 >= ili9341->width) {
@@ -709,23 +2286,14 @@ void ILI9341_WriteStringTransparent(
         }
 
         ILI9341_DrawGlyphTransparentFast(ili9341, x, y, glyph, color, scale);
-        x += glyph.advance * scale;
-
-        c = *str;
-        if (c < font.startCodepoint || c > font.endCodepoint) { c = FALLBACK_CODEPOINT; }
-
-        // Only apply tracking if next char is not zero-width, help diacritics stay aligned
-        if (tracking) {
-            ILI9341_GlyphDef glyph = font.glyphs[c - font.startCodepoint];
-            x += glyph.advance > 0 ? tracking : 0;
-        }
+        x += glyph.advance * scale + ILI9341_PairSpacing(font, c, str, scale, tracking);
     }
 
     ILI9341_Deselect(ili9341);
 }
 
 void ILI9341_DrawImage(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t w,
@@ -741,36 +2309,44 @@ void ILI9341_DrawImage(
         h = -h;
         y -= h - 1;
     }
-    if (x >= ili9341->width || y >= ili9341->height || x + w < 0 || y + h < 0) return;
+    const ILI9341_RectTypeDef clip = ili9341->clip_rect;
 
-    ILI9341_Select(ili9341);
-
-    if (x < 0 || y < 0 || (x + w - 1) >= ili9341->width || (y + h - 1) >= ili9341->height) {
-        int_fast16_t clipStartX = x < 0 ? -x : 0;
-        int_fast16_t clipStartY = y < 0 ? -y : 0;
-        int_fast16_t clipEndX = x + w - 1 >= ili9341->width ? ili9341->width - x - 1 : w - 1;
-        int_fast16_t clipEndY = y + h - 1 >= ili9341->height ? ili9341->height - y - 1 : h - 1;
+    if (x > clip.x1 || y > clip.y1 || x + w <= clip.x0 || y + h <= clip.y0 || clip.x0 > clip.x1 || clip.y0 > clip.y1)
+        return;
 
-        uint16_t buffer[ILI9341_DRAW_IMAGE_BUFFER_SIZE];
-        size_t bufferIndex = 0;
+    ILI9341_Select(ili9341);
 
-        ILI9341_SetAddressWindow(ili9341, x + clipStartX, y + clipStartY, x + clipEndX, y + clipEndY);
+    if (x < clip.x0 || y < clip.y0 || (x + w - 1) > clip.x1 || (y + h - 1) > clip.y1) {
+        int_fast16_t clipStartX = x < clip.x0 ? clip.x0 - x : 0;
+        int_fast16_t clipStartY = y < clip.y0 ? clip.y0 - y : 0;
+        int_fast16_t clipEndX = x + w - 1 > clip.x1 ? clip.x1 - x : w - 1;
+        int_fast16_t clipEndY = y + h - 1 > clip.y1 ? clip.y1 - y : h - 1;
+
+        uint16_t stackBuffer[ILI9341_DRAW_IMAGE_BUFFER_SIZE];
+        ILI9341_PixelWriter writer;
+        ILI9341_PixelWriterBegin(
+            ili9341,
+            &writer,
+            stackBuffer,
+            ILI9341_DRAW_IMAGE_BUFFER_SIZE,
+            x + clipStartX,
+            y + clipStartY,
+            x + clipEndX,
+            y + clipEndY
+        );
 
         for (int_fast16_t row = clipStartY; row <= clipEndY; row++) {
             for (int_fast16_t col = clipStartX; col <= clipEndX; col++) {
-                buffer[bufferIndex++] = data[row * w + col];
+                writer.buffer[writer.count++] = data[row * w + col];
 
-                if (bufferIndex >= ILI9341_DRAW_IMAGE_BUFFER_SIZE) {
-                    ILI9341_WriteData(ili9341, (uint8_t*)buffer, bufferIndex * 2);
-                    bufferIndex = 0;
-                }
+                if (writer.count >= writer.bufferSize) ILI9341_PixelWriterFlush(ili9341, &writer);
             }
         }
 
-        if (bufferIndex > 0) { ILI9341_WriteData(ili9341, (uint8_t*)buffer, bufferIndex * 2); }
+        ILI9341_PixelWriterEnd(ili9341, &writer);
     } else {
         ILI9341_SetAddressWindow(ili9341, x, y, x + w - 1, y + h - 1);
-        ILI9341_WriteData(ili9341, (uint8_t*)data, sizeof(uint16_t) * w * h);
+        ILI9341_WriteDataAsync(ili9341, (uint8_t*)data, sizeof(uint16_t) * w * h, sizeof(uint16_t) * w * h);
     }
 
     ILI9341_Deselect(ili9341);
@@ -786,18 +2362,21 @@ void ILI9341_DrawImage(
  * @param color 16-bit line color in RGB565 format
  */
 static void ILI9341_DrawLineFast(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x1,
     int_fast16_t y1,
     int_fast16_t x2,
     int_fast16_t y2,
     uint16_t color
 ) {
-    if (x1 == x2) {
-        ILI9341_FillRectangleFast(ili9341, x1, y1, 1, y2 - y1 + 1, color);
+    if (x1 == x2 && y1 == y2) {
+        ILI9341_DrawPixelFast(ili9341, x1, y1, color);
+        return;
+    } else if (x1 == x2) {
+        ILI9341_FillRectangleFast(ili9341, x1, y1 < y2 ? y1 : y2, 1, abs(y2 - y1) + 1, color);
         return;
     } else if (y1 == y2) {
-        ILI9341_FillRectangleFast(ili9341, x1, y1, x2 - x1 + 1, 1, color);
+        ILI9341_FillRectangleFast(ili9341, x1 < x2 ? x1 : x2, y1, abs(x2 - x1) + 1, 1, color);
         return;
     }
 
@@ -805,9 +2384,16 @@ static void ILI9341_DrawLineFast(
     int_fast16_t dy = -abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
     int_fast16_t err = dx + dy, e2; /* error value e_xy */
 
+    // Consecutive pixels on the same row (shallow line) or column (steep line) are drawn as one span
+    bool shallow = dx >= -dy;
+    int_fast16_t spanX = x1, spanY = y1;
+
     while (true) {
-        ILI9341_DrawPixelFast(ili9341, x1, y1, color);
-        if (x1 == x2 && y1 == y2) break;
+        if (x1 == x2 && y1 == y2) {
+            ILI9341_DrawLineFast(ili9341, spanX, spanY, x1, y1, color);
+            break;
+        }
+        int_fast16_t prevX = x1, prevY = y1;
         e2 = 2 * err;
         if (e2 >= dy) { /* e_xy+e_x > 0 */
             err += dy;
@@ -817,11 +2403,16 @@ static void ILI9341_DrawLineFast(
             err += dx;
             y1 += sy;
         }
+        if (shallow ? y1 != prevY : x1 != prevX) {
+            ILI9341_DrawLineFast(ili9341, spanX, spanY, prevX, prevY, color);
+            spanX = x1;
+            spanY = y1;
+        }
     }
 }
 
 void ILI9341_DrawLine(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x1,
     int_fast16_t y1,
     int_fast16_t x2,
@@ -834,7 +2425,7 @@ void ILI9341_DrawLine(
 }
 
 void ILI9341_DrawLineThick(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x1,
     int_fast16_t y1,
     int_fast16_t x2,
@@ -885,7 +2476,7 @@ void ILI9341_DrawLineThick(
 }
 
 void ILI9341_DrawRectangle(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t w,
@@ -896,7 +2487,7 @@ void ILI9341_DrawRectangle(
 }
 
 void ILI9341_DrawRectangleThick(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t x,
     int_fast16_t y,
     int_fast16_t w,
@@ -917,7 +2508,7 @@ void ILI9341_DrawRectangleThick(
 }
 
 void ILI9341_DrawCircle(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t xc,
     int_fast16_t yc,
     int_fast16_t r,
@@ -932,38 +2523,49 @@ void ILI9341_DrawCircle(
     int_fast16_t x = r;
     int_fast16_t y = 0;
 
+    // Points sharing the same x form vertical spans near the left/right and horizontal spans near the top/bottom,
+    // the span starting at y = 0 also covers the 4 points on the axes
+    int_fast16_t spanStartY = 0;
+    int_fast16_t spanEndY = 0;
+
     ILI9341_Select(ili9341);
 
-    ILI9341_DrawPixelFast(ili9341, xc, yc + r, color);
-    ILI9341_DrawPixelFast(ili9341, xc, yc - r, color);
-    ILI9341_DrawPixelFast(ili9341, xc + r, yc, color);
-    ILI9341_DrawPixelFast(ili9341, xc - r, yc, color);
+    while (true) {
+        bool done = x < y;
+        int_fast16_t prevX = x;
+
+        if (!done) {
+            if (f >= 0) {
+                x--;
+                dfx += 2;
+                f += dfx;
+            }
+            y++;
+            dfy += 2;
+            f += dfy;
+        }
 
-    while (x >= y) {
-        if (f >= 0) {
-            x--;
-            dfx += 2;
-            f += dfx;
+        if (done || x != prevX) {
+            ILI9341_DrawLineFast(ili9341, xc + prevX, yc + spanStartY, xc + prevX, yc + spanEndY, color);
+            ILI9341_DrawLineFast(ili9341, xc - prevX, yc + spanStartY, xc - prevX, yc + spanEndY, color);
+            ILI9341_DrawLineFast(ili9341, xc + prevX, yc - spanStartY, xc + prevX, yc - spanEndY, color);
+            ILI9341_DrawLineFast(ili9341, xc - prevX, yc - spanStartY, xc - prevX, yc - spanEndY, color);
+            ILI9341_DrawLineFast(ili9341, xc + spanStartY, yc + prevX, xc + spanEndY, yc + prevX, color);
+            ILI9341_DrawLineFast(ili9341, xc - spanStartY, yc + prevX, xc - spanEndY, yc + prevX, color);
+            ILI9341_DrawLineFast(ili9341, xc + spanStartY, yc - prevX, xc + spanEndY, yc - prevX, color);
+            ILI9341_DrawLineFast(ili9341, xc - spanStartY, yc - prevX, xc - spanEndY, yc - prevX, color);
+            spanStartY = y;
         }
-        y++;
-        dfy += 2;
-        f += dfy;
 
-        ILI9341_DrawPixelFast(ili9341, xc + x, yc + y, color);
-        ILI9341_DrawPixelFast(ili9341, xc - x, yc + y, color);
-        ILI9341_DrawPixelFast(ili9341, xc + x, yc - y, color);
-        ILI9341_DrawPixelFast(ili9341, xc - x, yc - y, color);
-        ILI9341_DrawPixelFast(ili9341, xc + y, yc + x, color);
-        ILI9341_DrawPixelFast(ili9341, xc - y, yc + x, color);
-        ILI9341_DrawPixelFast(ili9341, xc + y, yc - x, color);
-        ILI9341_DrawPixelFast(ili9341, xc - y, yc - x, color);
+        if (done) break;
+        spanEndY = y;
     }
 
     ILI9341_Deselect(ili9341);
 }
 
 void ILI9341_DrawCircleThick(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t xc,
     int_fast16_t yc,
     int_fast16_t r,
@@ -995,7 +2597,7 @@ void ILI9341_DrawCircleThick(
 }
 
 void ILI9341_FillCircle(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t xc,
     int_fast16_t yc,
     int_fast16_t r,
@@ -1036,7 +2638,7 @@ void ILI9341_FillCircle(
 }
 
 void ILI9341_DrawEllipse(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t xc,
     int_fast16_t yc,
     int_fast16_t rx,
@@ -1058,52 +2660,76 @@ void ILI9341_DrawEllipse(
     int_fast32_t px = 0;
     int_fast32_t py = twoRx2 * y;
 
-    ILI9341_Select(ili9341);
+    // Region 1 steps x and forms horizontal spans, region 2 steps y and forms vertical spans
+    int_fast32_t spanStart = 0;
 
-    ILI9341_DrawPixelFast(ili9341, xc, yc + ry, color);
-    ILI9341_DrawPixelFast(ili9341, xc, yc - ry, color);
+    ILI9341_Select(ili9341);
 
     p = ry2 - (rx2 * ry) + (rx2 / 4);
-    while (px < py) {
-        x++;
-        px += twoRy2;
-        if (p < 0) {
-            p += ry2 + px;
-        } else {
-            y--;
-            py -= twoRx2;
-            p += ry2 + px - py;
+    while (true) {
+        bool done = px >= py;
+        int_fast32_t prevX = x;
+        int_fast32_t prevY = y;
+
+        if (!done) {
+            x++;
+            px += twoRy2;
+            if (p < 0) {
+                p += ry2 + px;
+            } else {
+                y--;
+                py -= twoRx2;
+                p += ry2 + px - py;
+            }
+        }
+
+        if (done || y != prevY) {
+            ILI9341_DrawLineFast(ili9341, xc + spanStart, yc + prevY, xc + prevX, yc + prevY, color);
+            ILI9341_DrawLineFast(ili9341, xc - prevX, yc + prevY, xc - spanStart, yc + prevY, color);
+            ILI9341_DrawLineFast(ili9341, xc + spanStart, yc - prevY, xc + prevX, yc - prevY, color);
+            ILI9341_DrawLineFast(ili9341, xc - prevX, yc - prevY, xc - spanStart, yc - prevY, color);
+            spanStart = x;
         }
 
-        ILI9341_DrawPixelFast(ili9341, xc + x, yc + y, color);
-        ILI9341_DrawPixelFast(ili9341, xc - x, yc + y, color);
-        ILI9341_DrawPixelFast(ili9341, xc + x, yc - y, color);
-        ILI9341_DrawPixelFast(ili9341, xc - x, yc - y, color);
+        if (done) break;
     }
 
     p = ry2 * (x + 1) * (x + 1) + rx2 * (y - 1) * (y - 1) - rx2 * ry2;
-    while (y > 0) {
-        y--;
-        py -= twoRx2;
-        if (p > 0) {
-            p += rx2 - py;
-        } else {
-            x++;
-            px += twoRy2;
-            p += rx2 - py + px;
+    spanStart = y - 1;
+    while (true) {
+        bool done = y <= 0;
+        int_fast32_t prevX = x;
+        int_fast32_t prevY = y;
+
+        if (!done) {
+            y--;
+            py -= twoRx2;
+            if (p > 0) {
+                p += rx2 - py;
+            } else {
+                x++;
+                px += twoRy2;
+                p += rx2 - py + px;
+            }
+        }
+
+        // The first point was already drawn by region 1, its span is empty
+        if ((done || x != prevX) && spanStart >= prevY) {
+            ILI9341_DrawLineFast(ili9341, xc + prevX, yc + prevY, xc + prevX, yc + spanStart, color);
+            ILI9341_DrawLineFast(ili9341, xc - prevX, yc + prevY, xc - prevX, yc + spanStart, color);
+            ILI9341_DrawLineFast(ili9341, xc + prevX, yc - spanStart, xc + prevX, yc - prevY, color);
+            ILI9341_DrawLineFast(ili9341, xc - prevX, yc - spanStart, xc - prevX, yc - prevY, color);
         }
+        if (done || x != prevX) spanStart = y;
 
-        ILI9341_DrawPixelFast(ili9341, xc + x, yc + y, color);
-        ILI9341_DrawPixelFast(ili9341, xc - x, yc + y, color);
-        ILI9341_DrawPixelFast(ili9341, xc + x, yc - y, color);
-        ILI9341_DrawPixelFast(ili9341, xc - x, yc - y, color);
+        if (done) break;
     }
 
     ILI9341_Deselect(ili9341);
 }
 
 void ILI9341_DrawEllipseThick(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t xc,
     int_fast16_t yc,
     int_fast16_t rx,
@@ -1141,7 +2767,7 @@ void ILI9341_DrawEllipseThick(
 }
 
 void ILI9341_FillEllipse(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int_fast16_t xc,
     int_fast16_t yc,
     int_fast16_t rx,
@@ -1204,7 +2830,7 @@ void ILI9341_FillEllipse(
     ILI9341_Deselect(ili9341);
 }
 
-void ILI9341_DrawPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color) {
+void ILI9341_DrawPolygon(ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color) {
     if (n < 2) return;
 
     ILI9341_Select(ili9341);
@@ -1216,7 +2842,7 @@ void ILI9341_DrawPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16
 }
 
 void ILI9341_DrawPolygonThick(
-    const ILI9341_HandleTypeDef* ili9341,
+    ILI9341_HandleTypeDef* ili9341,
     int16_t* x,
     int16_t* y,
     size_t n,
@@ -1232,7 +2858,7 @@ void ILI9341_DrawPolygonThick(
     ILI9341_DrawLineThick(ili9341, x[n - 1], y[n - 1], x[0], y[0], color, thickness, cap);
 }
 
-void ILI9341_FillPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color) {
+void ILI9341_FillPolygon(ILI9341_HandleTypeDef* ili9341, int16_t* x, int16_t* y, size_t n, uint16_t color) {
     if (n < 3) return;
 
     // find max and min Y
@@ -1242,10 +2868,10 @@ void ILI9341_FillPolygon(const ILI9341_HandleTypeDef* ili9341, int16_t* x, int16
         if (y[i] > maxY) maxY = y[i];
     }
 
-    if (minY >= ili9341->height) return;
-    if (maxY < 0) return;
-    if (minY < 0) minY = 0;
-    if (maxY >= ili9341->height) maxY = ili9341->height - 1;
+    if (minY > ili9341->clip_rect.y1) return;
+    if (maxY < ili9341->clip_rect.y0) return;
+    if (minY < ili9341->clip_rect.y0) minY = ili9341->clip_rect.y0;
+    if (maxY > ili9341->clip_rect.y1) maxY = ili9341->clip_rect.y1;
 
     int_fast16_t nodeX[32];  // max 32 intersections
 
@@ -0,0 +1,332 @@
+#include "ili9341_console.h"
+
+/**
+ * @brief Get a cell of the console
+ * @param console Pointer to console handle structure
+ * @param column Column of the cell
+ * @param row Row of the cell as shown on the display, 0 is the top row
+ * @return Pointer to the cell
+ */
+static ILI9341_Console_CellTypeDef* ILI9341_Console_GetCell(
+    ILI9341_Console_HandleTypeDef* console,
+    int_fast16_t column,
+    int_fast16_t row
+) {
+    int_fast16_t index = console->first_row + row;
+    if (index >= console->rows) index -= console->rows;
+    return &console->cells[index * console->columns + column];
+}
+
+/**
+ * @brief Check whether two cells look the same on the display
+ * @param a Pointer to the first cell
+ * @param b Pointer to the second cell
+ * @return true if the character and colors are the same
+ */
+static bool ILI9341_Console_CellsEqual(const ILI9341_Console_CellTypeDef* a, const ILI9341_Console_CellTypeDef* b) {
+    return a->ch == b->ch && a->color == b->color && a->bg_color == b->bg_color;
+}
+
+/**
+ * @brief Set the content of a cell, marking it dirty if it changed
+ * @param console Pointer to console handle structure
+ * @param cell Pointer to the cell
+ * @param ch Character of the cell
+ */
+static void ILI9341_Console_SetCell(
+    ILI9341_Console_HandleTypeDef* console,
+    ILI9341_Console_CellTypeDef* cell,
+    uint16_t ch
+) {
+    ILI9341_Console_CellTypeDef value = {.ch = ch, .color = console->color, .bg_color = console->bg_color};
+    if (ILI9341_Console_CellsEqual(cell, &value)) return;
+
+    cell->ch = value.ch;
+    cell->color = value.color;
+    cell->bg_color = value.bg_color;
+    cell->dirty = 1;
+}
+
+/**
+ * @brief Scroll the console up by one row
+ * @param console Pointer to console handle structure
+ */
+static void ILI9341_Console_ScrollOnce(ILI9341_Console_HandleTypeDef* console) {
+    ILI9341_Console_CellTypeDef blank = {.ch = ' ', .color = console->color, .bg_color = console->bg_color};
+    ILI9341_Console_CellTypeDef* recycled = ILI9341_Console_GetCell(console, 0, 0);
+
+    if (console->hardware_scroll) {
+        // The display moves every row up by itself, the top row comes back at the bottom with its old content
+        for (int_fast16_t column = 0; column < console->columns; column++) {
+            if (!ILI9341_Console_CellsEqual(&recycled[column], &blank)) {
+                recycled[column] = blank;
+                recycled[column].dirty = 1;
+            }
+        }
+
+        console->first_row = console->first_row + 1 < console->rows ? console->first_row + 1 : 0;
+        console->scroll_offset += console->cell_height;
+        ILI9341_SetScrollOffset(console->ili9341, console->scroll_offset);
+        console->scroll_offset = console->ili9341->scroll_offset;
+        return;
+    }
+
+    // Every position on the display now shows the row below it, only the cells that look different are drawn again.
+    // A cell that was not drawn yet leaves its position stale, so the dirty flag moves up with the content.
+    for (int_fast16_t column = 0; column < console->columns; column++) {
+        bool staleAbove = recycled[column].dirty;
+        ILI9341_Console_CellTypeDef above = recycled[column];
+
+        for (int_fast16_t row = 1; row < console->rows; row++) {
+            ILI9341_Console_CellTypeDef* cell = ILI9341_Console_GetCell(console, column, row);
+            bool stale = cell->dirty;
+            ILI9341_Console_CellTypeDef current = *cell;
+
+            cell->dirty = staleAbove || !ILI9341_Console_CellsEqual(cell, &above);
+
+            staleAbove = stale;
+            above = current;
+        }
+
+        bool changed = !ILI9341_Console_CellsEqual(&blank, &above);
+        recycled[column] = blank;
+        recycled[column].dirty = staleAbove || changed;
+    }
+
+    console->first_row = console->first_row + 1 < console->rows ? console->first_row + 1 : 0;
+}
+
+ILI9341_Console_HandleTypeDef ILI9341_Console_Init(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t columns,
+    int_fast16_t rows,
+    ILI9341_Console_CellTypeDef* cells,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    uint16_t color,
+    uint16_t bgColor
+) {
+    if (scale < 1) scale = 1;
+
+    ILI9341_Console_HandleTypeDef console_instance = {
+        .ili9341 = ili9341,
+        .font = font,
+        .scale = scale,
+        .x = x,
+        .y = y,
+        .columns = columns,
+        .rows = rows,
+        .cell_width = font.averageWidth * scale / 10,
+        .cell_height = (font.ascent + font.descent) * scale,
+        .cells = cells,
+        .color = color,
+        .bg_color = bgColor
+    };
+
+    for (int_fast32_t i = 0; i < (int_fast32_t)columns * rows; i++) {
+        cells[i] = (ILI9341_Console_CellTypeDef){.ch = ' ', .dirty = 1, .color = color, .bg_color = bgColor};
+    }
+
+    return console_instance;
+}
+
+void ILI9341_Console_SetColors(ILI9341_Console_HandleTypeDef* console, uint16_t color, uint16_t bgColor) {
+    console->color = color;
+    console->bg_color = bgColor;
+}
+
+void ILI9341_Console_SetCursor(ILI9341_Console_HandleTypeDef* console, int_fast16_t column, int_fast16_t row) {
+    if (column < 0) column = 0;
+    if (column >= console->columns) column = console->columns - 1;
+    if (row < 0) row = 0;
+    if (row >= console->rows) row = console->rows - 1;
+
+    console->cursor_column = column;
+    console->cursor_row = row;
+}
+
+/**
+ * @brief Write a decoded character at the cursor and advance it, see ILI9341_Console_PutChar
+ * @param console Pointer to console handle structure
+ * @param c Unicode codepoint of the character
+ */
+static void ILI9341_Console_PutCodepoint(ILI9341_Console_HandleTypeDef* console, uint32_t c) {
+    switch (c) {
+        case '\n':
+            console->cursor_column = 0;
+            console->cursor_row++;
+            break;
+        case '\r':
+            console->cursor_column = 0;
+            break;
+        case '\b':
+            if (console->cursor_column > 0) console->cursor_column--;
+            break;
+        case '\t':
+            console->cursor_column = (console->cursor_column / ILI9341_CONSOLE_TAB_SIZE + 1) * ILI9341_CONSOLE_TAB_SIZE;
+            if (console->cursor_column > console->columns) console->cursor_column = console->columns;
+            break;
+
+        default:
+            if (c < 0x20 || c == 0x7F) return;
+            // Cells only hold the Basic Multilingual Plane
+            if (c > 0xFFFF) c = FALLBACK_CODEPOINT;
+
+            // Wrap only when a character is written past the end, so a full line does not leave an empty one
+            if (console->cursor_column >= console->columns) {
+                console->cursor_column = 0;
+                console->cursor_row++;
+            }
+            if (console->cursor_row >= console->rows) {
+                ILI9341_Console_ScrollOnce(console);
+                console->cursor_row = console->rows - 1;
+            }
+
+            ILI9341_Console_SetCell(
+                console, ILI9341_Console_GetCell(console, console->cursor_column, console->cursor_row), c
+            );
+            console->cursor_column++;
+            return;
+    }
+
+    if (console->cursor_row >= console->rows) {
+        ILI9341_Console_ScrollOnce(console);
+        console->cursor_row = console->rows - 1;
+    }
+}
+
+/**
+ * @brief Get the length of a UTF-8 sequence from its first byte
+ * @param c First byte of the sequence
+ * @return Number of bytes of the sequence, 1 for a byte that does not start a multi-byte sequence
+ */
+static int_fast8_t ILI9341_Console_SequenceLength(unsigned char c) {
+    if (c >= 0xC2 && c <= 0xDF) return 2;
+    if (c >= 0xE0 && c <= 0xEF) return 3;
+    if (c >= 0xF0 && c <= 0xF4) return 4;
+    return 1;
+}
+
+/**
+ * @brief Write the pending bytes of a UTF-8 sequence, an incomplete or invalid sequence is written byte by byte
+ * @param console Pointer to console handle structure
+ */
+static void ILI9341_Console_FlushSequence(ILI9341_Console_HandleTypeDef* console) {
+    console->utf8[console->utf8_length] = '\0';
+    console->utf8_length = 0;
+
+    const char* str = console->utf8;
+    for (uint32_t c; (c = ILI9341_DecodeUTF8(&str));) { ILI9341_Console_PutCodepoint(console, c); }
+}
+
+void ILI9341_Console_PutChar(ILI9341_Console_HandleTypeDef* console, char ch) {
+    unsigned char c = ch;
+
+    if (console->utf8_length > 0) {
+        if ((c & 0xC0) == 0x80) {
+            console->utf8[console->utf8_length++] = ch;
+            if (console->utf8_length == ILI9341_Console_SequenceLength(console->utf8[0])) {
+                ILI9341_Console_FlushSequence(console);
+            }
+            return;
+        }
+        ILI9341_Console_FlushSequence(console);
+    }
+
+    if (ILI9341_Console_SequenceLength(c) > 1) {
+        console->utf8[0] = ch;
+        console->utf8_length = 1;
+        return;
+    }
+
+    ILI9341_Console_PutCodepoint(console, c);
+}
+
+void ILI9341_Console_Write(ILI9341_Console_HandleTypeDef* console, const char* str) {
+    while (*str) { ILI9341_Console_PutChar(console, *(str++)); }
+}
+
+void ILI9341_Console_Scroll(ILI9341_Console_HandleTypeDef* console, int_fast16_t lines) {
+    if (lines > console->rows) lines = console->rows;
+    for (int_fast16_t i = 0; i < lines; i++) { ILI9341_Console_ScrollOnce(console); }
+}
+
+void ILI9341_Console_ClearToEndOfLine(ILI9341_Console_HandleTypeDef* console) {
+    if (console->cursor_row >= console->rows) return;
+
+    for (int_fast16_t column = console->cursor_column; column < console->columns; column++) {
+        ILI9341_Console_SetCell(console, ILI9341_Console_GetCell(console, column, console->cursor_row), ' ');
+    }
+}
+
+void ILI9341_Console_Clear(ILI9341_Console_HandleTypeDef* console) {
+    for (int_fast16_t row = 0; row < console->rows; row++) {
+        for (int_fast16_t column = 0; column < console->columns; column++) {
+            ILI9341_Console_SetCell(console, ILI9341_Console_GetCell(console, column, row), ' ');
+        }
+    }
+
+    console->cursor_column = 0;
+    console->cursor_row = 0;
+}
+
+bool ILI9341_Console_EnableHardwareScroll(ILI9341_Console_HandleTypeDef* console, bool enable) {
+    ILI9341_HandleTypeDef* ili9341 = console->ili9341;
+
+    if (!enable) {
+        if (console->hardware_scroll) {
+            ILI9341_SetScrollArea(ili9341, 0, 0);
+            // The display shows the rows in memory order again
+            if (console->scroll_offset != 0) ILI9341_Console_Invalidate(console);
+        }
+        console->hardware_scroll = false;
+        console->scroll_offset = 0;
+        return false;
+    }
+
+    int_fast16_t bottom = ili9341->height - console->y - console->rows * console->cell_height;
+    if (ili9341->width > ili9341->height || console->y < 0 || bottom < 0) return false;
+
+    if (!console->hardware_scroll) {
+        // With a zero offset the display shows the same content as before
+        ILI9341_SetScrollArea(ili9341, console->y, bottom);
+        console->hardware_scroll = true;
+        console->scroll_offset = 0;
+    }
+
+    return true;
+}
+
+void ILI9341_Console_Invalidate(ILI9341_Console_HandleTypeDef* console) {
+    for (int_fast32_t i = 0; i < (int_fast32_t)console->columns * console->rows; i++) { console->cells[i].dirty = 1; }
+}
+
+void ILI9341_Console_Flush(ILI9341_Console_HandleTypeDef* console) {
+    for (int_fast16_t row = 0; row < console->rows; row++) {
+        int_fast16_t y = console->y + row * console->cell_height;
+
+        // The scroll offset is a multiple of the cell height, so a cell is never split by the end of the scroll area
+        if (console->hardware_scroll) y = ILI9341_ScrollTranslate(console->ili9341, y);
+
+        ILI9341_Console_CellTypeDef* cells = ILI9341_Console_GetCell(console, 0, row);
+        for (int_fast16_t column = 0; column < console->columns; column++) {
+            if (!cells[column].dirty) continue;
+
+            ILI9341_DrawCharCell(
+                console->ili9341,
+                console->x + column * console->cell_width,
+                y,
+                console->cell_width,
+                console->cell_height,
+                cells[column].ch,
+                console->font,
+                cells[column].color,
+                cells[column].bg_color,
+                console->scale
+            );
+            cells[column].dirty = 0;
+        }
+    }
+}
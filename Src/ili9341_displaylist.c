@@ -0,0 +1,837 @@
+#include "ili9341_displaylist.h"
+
+#include "string.h"
+
+typedef enum {
+    ILI9341_DISPLAY_LIST_DRAW_PIXEL = 0,
+    ILI9341_DISPLAY_LIST_FILL_RECTANGLE,
+    ILI9341_DISPLAY_LIST_FILL_SCREEN,
+    ILI9341_DISPLAY_LIST_WRITE_STRING,
+    ILI9341_DISPLAY_LIST_WRITE_STRING_TRANSPARENT,
+    ILI9341_DISPLAY_LIST_DRAW_IMAGE,
+    ILI9341_DISPLAY_LIST_DRAW_LINE,
+    ILI9341_DISPLAY_LIST_DRAW_LINE_THICK,
+    ILI9341_DISPLAY_LIST_DRAW_RECTANGLE,
+    ILI9341_DISPLAY_LIST_DRAW_RECTANGLE_THICK,
+    ILI9341_DISPLAY_LIST_DRAW_CIRCLE,
+    ILI9341_DISPLAY_LIST_DRAW_CIRCLE_THICK,
+    ILI9341_DISPLAY_LIST_FILL_CIRCLE,
+    ILI9341_DISPLAY_LIST_DRAW_ELLIPSE,
+    ILI9341_DISPLAY_LIST_DRAW_ELLIPSE_THICK,
+    ILI9341_DISPLAY_LIST_FILL_ELLIPSE,
+    ILI9341_DISPLAY_LIST_DRAW_POLYGON,
+    ILI9341_DISPLAY_LIST_DRAW_POLYGON_THICK,
+    ILI9341_DISPLAY_LIST_FILL_POLYGON
+} ILI9341_DisplayList_Opcode;
+
+/**
+ * @brief Command header, followed by argCount int16_t arguments and the extra data of the command
+ */
+typedef struct {
+    uint8_t opcode;
+    uint8_t flag;
+    uint8_t argCount;
+    uint8_t reserved;
+    /** Size of the command in bytes, including the header, always a multiple of 4 */
+    uint16_t size;
+    /** Size of the previous command in bytes, 0 for the first command, used to walk the list backwards */
+    uint16_t previousSize;
+    /** Pixels the command can touch, x0 > x1 if it draws nothing */
+    ILI9341_RectTypeDef bounds;
+} ILI9341_DisplayList_CommandHeader;
+
+#define ILI9341_DISPLAY_LIST_MAX_ARGS 8
+#define ILI9341_DISPLAY_LIST_UNBOUNDED INT16_MAX
+
+/**
+ * @brief Decoded command, pointing into the display list arena
+ */
+typedef struct {
+    ILI9341_DisplayList_CommandHeader header;
+    int16_t args[ILI9341_DISPLAY_LIST_MAX_ARGS];
+    const uint8_t* extra;
+} ILI9341_DisplayList_Command;
+
+/**
+ * @brief Clamp a coordinate to the int16_t range of the bounding boxes
+ * @param value Coordinate to clamp
+ * @return Clamped coordinate
+ */
+static int16_t ILI9341_DisplayList_Clamp(int_fast32_t value) {
+    if (value < INT16_MIN) return INT16_MIN;
+    if (value > INT16_MAX) return INT16_MAX;
+    return value;
+}
+
+/**
+ * @brief Build a bounding box from two corners in any order, grown by a margin on every side
+ * @param x0 X coordinate of the first corner
+ * @param y0 Y coordinate of the first corner
+ * @param x1 X coordinate of the second corner
+ * @param y1 Y coordinate of the second corner
+ * @param margin Number of pixels to grow the box by
+ * @return Bounding box
+ */
+static ILI9341_RectTypeDef ILI9341_DisplayList_Bounds(
+    int_fast32_t x0,
+    int_fast32_t y0,
+    int_fast32_t x1,
+    int_fast32_t y1,
+    int_fast32_t margin
+) {
+    if (x0 > x1) {
+        int_fast32_t temp = x0;
+        x0 = x1;
+        x1 = temp;
+    }
+
+    if (y0 > y1) {
+        int_fast32_t temp = y0;
+        y0 = y1;
+        y1 = temp;
+    }
+
+    margin = labs(margin);
+
+    return (ILI9341_RectTypeDef){
+        ILI9341_DisplayList_Clamp(x0 - margin),
+        ILI9341_DisplayList_Clamp(y0 - margin),
+        ILI9341_DisplayList_Clamp(x1 + margin),
+        ILI9341_DisplayList_Clamp(y1 + margin)
+    };
+}
+
+/**
+ * @brief Compute the bounding box of a string, following the layout of ILI9341_WriteString
+ * @param x X coordinate of the left of the string
+ * @param y Y coordinate of the baseline of the string
+ * @param str Null-terminated string
+ * @param font Font definition used for rendering the string
+ * @param wrap Whether the string wraps, the box then extends to the right and bottom of the display
+ * @param scale Integer scaling factor for the font
+ * @param tracking Additional space in pixels between characters
+ * @param leading Additional space in pixels between lines
+ * @return Bounding box of the glyphs of the string
+ */
+static ILI9341_RectTypeDef ILI9341_DisplayList_StringBounds(
+    int_fast32_t x,
+    int_fast32_t y,
+    const char* str,
+    const ILI9341_FontDef* font,
+    bool wrap,
+    int_fast32_t scale,
+    int_fast32_t tracking,
+    int_fast32_t leading
+) {
+    int_fast32_t originalX = x;
+    int_fast32_t x0 = INT32_MAX, y0 = INT32_MAX, x1 = INT32_MIN, y1 = INT32_MIN;
+
+    for (uint32_t c; (c = ILI9341_DecodeUTF8(&str));) {
+        if (c == '\r') {
+            x = originalX;
+            continue;
+        }
+
+        if (c == '\n') {
+            y += (font->ascent + font->descent) * scale + leading;
+            x = originalX;
+            continue;
+        }
+
+        ILI9341_GlyphDef glyph = ILI9341_GetGlyph(*font, c);
+
+        if (glyph.bbW > 0 && glyph.bbH > 0) {
+            int_fast32_t startX = x + glyph.bbX * scale;
+            int_fast32_t startY = y - (glyph.bbY + glyph.bbH) * scale + 1;
+            if (startX < x0) x0 = startX;
+            if (startY < y0) y0 = startY;
+            if (startX + glyph.bbW * scale - 1 > x1) x1 = startX + glyph.bbW * scale - 1;
+            if (startY + glyph.bbH * scale - 1 > y1) y1 = startY + glyph.bbH * scale - 1;
+        }
+
+        x += glyph.advance * scale;
+
+        const char* next = str;
+        uint32_t nextCodepoint = ILI9341_DecodeUTF8(&next);
+        x += ILI9341_GetKerning(*font, c, nextCodepoint) * scale;
+        if (tracking && ILI9341_GetGlyph(*font, nextCodepoint).advance > 0) x += tracking;
+    }
+
+    if (x0 > x1) return (ILI9341_RectTypeDef){0, 0, -1, -1};
+
+    if (wrap) {
+        x1 = ILI9341_DISPLAY_LIST_UNBOUNDED;
+        y1 = ILI9341_DISPLAY_LIST_UNBOUNDED;
+    }
+
+    return ILI9341_DisplayList_Bounds(x0, y0, x1, y1, 0);
+}
+
+/**
+ * @brief Append a command to the display list
+ * @param list Pointer to display list handle structure
+ * @param opcode Command opcode
+ * @param flag Boolean argument of the command
+ * @param bounds Pixels the command can touch
+ * @param args Integer arguments of the command
+ * @param argCount Number of integer arguments, at most ILI9341_DISPLAY_LIST_MAX_ARGS
+ * @param extra Extra data of the command, can be NULL
+ * @param extraSize Size of the extra data in bytes
+ * @param extra2 Second block of extra data, stored right after the first one, can be NULL
+ * @param extra2Size Size of the second block of extra data in bytes
+ */
+static void ILI9341_DisplayList_Append(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    ILI9341_DisplayList_Opcode opcode,
+    bool flag,
+    ILI9341_RectTypeDef bounds,
+    const int16_t* args,
+    uint_fast8_t argCount,
+    const void* extra,
+    size_t extraSize,
+    const void* extra2,
+    size_t extra2Size
+) {
+    if (list->overflow) return;
+
+    size_t argsSize = argCount * sizeof(int16_t);
+    size_t size = sizeof(ILI9341_DisplayList_CommandHeader) + argsSize + extraSize + extra2Size;
+    size = (size + 3) & ~(size_t)3;
+
+    if (size > UINT16_MAX || size > list->size - list->used) {
+        list->overflow = true;
+        return;
+    }
+
+    uint8_t* command = list->buffer + list->used;
+
+    // Padding is zeroed so that equal commands compare equal byte for byte
+    memset(command, 0, size);
+
+    ILI9341_DisplayList_CommandHeader header = {
+        .opcode = opcode,
+        .flag = flag,
+        .argCount = argCount,
+        .size = size,
+        .previousSize = list->count > 0 ? list->used - list->last : 0,
+        .bounds = bounds
+    };
+
+    memcpy(command, &header, sizeof(header));
+    command += sizeof(header);
+    memcpy(command, args, argsSize);
+    command += argsSize;
+    if (extra != NULL) memcpy(command, extra, extraSize);
+    command += extraSize;
+    if (extra2 != NULL) memcpy(command, extra2, extra2Size);
+
+    list->last = list->used;
+    list->used += size;
+    list->count++;
+}
+
+/**
+ * @brief Decode the command at an offset of the display list
+ * @param list Pointer to display list handle structure
+ * @param offset Offset of the command in the arena
+ * @param command Pointer to store the decoded command
+ */
+static void ILI9341_DisplayList_Decode(
+    const ILI9341_DisplayList_HandleTypeDef* list,
+    size_t offset,
+    ILI9341_DisplayList_Command* command
+) {
+    const uint8_t* data = list->buffer + offset;
+
+    memcpy(&command->header, data, sizeof(command->header));
+    data += sizeof(command->header);
+
+    memset(command->args, 0, sizeof(command->args));
+    memcpy(command->args, data, command->header.argCount * sizeof(int16_t));
+    command->extra = data + command->header.argCount * sizeof(int16_t);
+}
+
+/**
+ * @brief Compare two commands, ignoring their position in the display lists
+ * @param a Pointer to the first command
+ * @param b Pointer to the second command
+ * @return true if both commands draw the same pixels
+ */
+static bool ILI9341_DisplayList_CommandsEqual(const uint8_t* a, const uint8_t* b) {
+    ILI9341_DisplayList_CommandHeader headerA;
+    ILI9341_DisplayList_CommandHeader headerB;
+    memcpy(&headerA, a, sizeof(headerA));
+    memcpy(&headerB, b, sizeof(headerB));
+
+    headerA.previousSize = 0;
+    headerB.previousSize = 0;
+
+    return memcmp(&headerA, &headerB, sizeof(headerA)) == 0 &&
+           memcmp(a + sizeof(headerA), b + sizeof(headerB), headerA.size - sizeof(headerA)) == 0;
+}
+
+/**
+ * @brief Check whether a bounding box intersects the clip rectangle of the display
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param bounds Bounding box to check
+ * @return true if the bounding box intersects the clip rectangle
+ */
+static bool ILI9341_DisplayList_IsVisible(const ILI9341_HandleTypeDef* ili9341, ILI9341_RectTypeDef bounds) {
+    const ILI9341_RectTypeDef clip = ili9341->clip_rect;
+    return bounds.x0 <= bounds.x1 && bounds.y0 <= bounds.y1 && bounds.x0 <= clip.x1 && bounds.x1 >= clip.x0 &&
+           bounds.y0 <= clip.y1 && bounds.y1 >= clip.y0;
+}
+
+/**
+ * @brief Draw a decoded command
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param command Pointer to the decoded command
+ */
+static void ILI9341_DisplayList_Execute(ILI9341_HandleTypeDef* ili9341, const ILI9341_DisplayList_Command* command) {
+    const int16_t* args = command->args;
+    bool flag = command->header.flag;
+
+    switch (command->header.opcode) {
+        case ILI9341_DISPLAY_LIST_DRAW_PIXEL:
+            ILI9341_DrawPixel(ili9341, args[0], args[1], args[2]);
+            break;
+        case ILI9341_DISPLAY_LIST_FILL_RECTANGLE:
+            ILI9341_FillRectangle(ili9341, args[0], args[1], args[2], args[3], args[4]);
+            break;
+        case ILI9341_DISPLAY_LIST_FILL_SCREEN:
+            ILI9341_FillScreen(ili9341, args[0]);
+            break;
+        case ILI9341_DISPLAY_LIST_WRITE_STRING:
+        case ILI9341_DISPLAY_LIST_WRITE_STRING_TRANSPARENT: {
+            // The font is copied out of the arena, which is only guaranteed to be aligned to 4 bytes
+            union {
+                ILI9341_FontDef font;
+                uint8_t bytes[sizeof(ILI9341_FontDef)];
+            } font;
+            memcpy(font.bytes, command->extra, sizeof(font.bytes));
+            const char* str = (const char*)command->extra + sizeof(ILI9341_FontDef);
+
+            if (command->header.opcode == ILI9341_DISPLAY_LIST_WRITE_STRING) {
+                ILI9341_WriteString(
+                    ili9341, args[0], args[1], str, font.font, args[2], args[3], flag, args[4], args[5], args[6]
+                );
+            } else {
+                ILI9341_WriteStringTransparent(
+                    ili9341, args[0], args[1], str, font.font, args[2], flag, args[4], args[5], args[6]
+                );
+            }
+            break;
+        }
+        case ILI9341_DISPLAY_LIST_DRAW_IMAGE: {
+            const uint16_t* data;
+            memcpy(&data, command->extra, sizeof(data));
+            ILI9341_DrawImage(ili9341, args[0], args[1], args[2], args[3], data);
+            break;
+        }
+        case ILI9341_DISPLAY_LIST_DRAW_LINE:
+            ILI9341_DrawLine(ili9341, args[0], args[1], args[2], args[3], args[4]);
+            break;
+        case ILI9341_DISPLAY_LIST_DRAW_LINE_THICK:
+            ILI9341_DrawLineThick(ili9341, args[0], args[1], args[2], args[3], args[4], args[5], flag);
+            break;
+        case ILI9341_DISPLAY_LIST_DRAW_RECTANGLE:
+            ILI9341_DrawRectangle(ili9341, args[0], args[1], args[2], args[3], args[4]);
+            break;
+        case ILI9341_DISPLAY_LIST_DRAW_RECTANGLE_THICK:
+            ILI9341_DrawRectangleThick(ili9341, args[0], args[1], args[2], args[3], args[4], args[5]);
+            break;
+        case ILI9341_DISPLAY_LIST_DRAW_CIRCLE:
+            ILI9341_DrawCircle(ili9341, args[0], args[1], args[2], args[3]);
+            break;
+        case ILI9341_DISPLAY_LIST_DRAW_CIRCLE_THICK:
+            ILI9341_DrawCircleThick(ili9341, args[0], args[1], args[2], args[3], args[4]);
+            break;
+        case ILI9341_DISPLAY_LIST_FILL_CIRCLE:
+            ILI9341_FillCircle(ili9341, args[0], args[1], args[2], args[3]);
+            break;
+        case ILI9341_DISPLAY_LIST_DRAW_ELLIPSE:
+            ILI9341_DrawEllipse(ili9341, args[0], args[1], args[2], args[3], args[4]);
+            break;
+        case ILI9341_DISPLAY_LIST_DRAW_ELLIPSE_THICK:
+            ILI9341_DrawEllipseThick(ili9341, args[0], args[1], args[2], args[3], args[4], args[5]);
+            break;
+        case ILI9341_DISPLAY_LIST_FILL_ELLIPSE:
+            ILI9341_FillEllipse(ili9341, args[0], args[1], args[2], args[3], args[4]);
+            break;
+        case ILI9341_DISPLAY_LIST_DRAW_POLYGON:
+        case ILI9341_DISPLAY_LIST_DRAW_POLYGON_THICK:
+        case ILI9341_DISPLAY_LIST_FILL_POLYGON: {
+            // Arguments are 2 bytes each and commands are aligned to 4 bytes, so the vertices are aligned
+            size_t n = (uint16_t)args[0];
+            int16_t* x = (int16_t*)command->extra;
+            int16_t* y = x + n;
+
+            if (command->header.opcode == ILI9341_DISPLAY_LIST_DRAW_POLYGON) {
+                ILI9341_DrawPolygon(ili9341, x, y, n, args[1]);
+            } else if (command->header.opcode == ILI9341_DISPLAY_LIST_DRAW_POLYGON_THICK) {
+                ILI9341_DrawPolygonThick(ili9341, x, y, n, args[1], args[2], flag);
+            } else {
+                ILI9341_FillPolygon(ili9341, x, y, n, args[1]);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Add a rectangle to a list of damaged areas, merging it with the ones it overlaps or with the closest one
+ * when the list is full
+ * @param rects Damaged areas
+ * @param count Pointer to the number of damaged areas
+ * @param rect Rectangle to add
+ */
+static void ILI9341_DisplayList_AddDamage(ILI9341_RectTypeDef* rects, uint_fast8_t* count, ILI9341_RectTypeDef rect) {
+    if (rect.x0 > rect.x1 || rect.y0 > rect.y1) return;
+
+    while (true) {
+        uint_fast8_t best = 0;
+        int_fast32_t bestGrowth = INT32_MAX;
+
+        for (uint_fast8_t i = 0; i < *count; i++) {
+            ILI9341_RectTypeDef merged = {
+                rects[i].x0 < rect.x0 ? rects[i].x0 : rect.x0,
+                rects[i].y0 < rect.y0 ? rects[i].y0 : rect.y0,
+                rects[i].x1 > rect.x1 ? rects[i].x1 : rect.x1,
+                rects[i].y1 > rect.y1 ? rects[i].y1 : rect.y1
+            };
+
+            int_fast32_t growth = (int_fast32_t)(merged.x1 - merged.x0 + 1) * (merged.y1 - merged.y0 + 1) -
+                                  (int_fast32_t)(rects[i].x1 - rects[i].x0 + 1) * (rects[i].y1 - rects[i].y0 + 1) -
+                                  (int_fast32_t)(rect.x1 - rect.x0 + 1) * (rect.y1 - rect.y0 + 1);
+            if (growth < bestGrowth) {
+                bestGrowth = growth;
+                best = i;
+            }
+        }
+
+        // Overlapping areas would be redrawn twice, merge them as well as anything when there is no space left
+        if (*count == 0 || (bestGrowth > 0 && *count < ILI9341_DIRTY_RECTS_MAX)) {
+            rects[(*count)++] = rect;
+            return;
+        }
+
+        rect.x0 = rects[best].x0 < rect.x0 ? rects[best].x0 : rect.x0;
+        rect.y0 = rects[best].y0 < rect.y0 ? rects[best].y0 : rect.y0;
+        rect.x1 = rects[best].x1 > rect.x1 ? rects[best].x1 : rect.x1;
+        rect.y1 = rects[best].y1 > rect.y1 ? rects[best].y1 : rect.y1;
+        rects[best] = rects[--(*count)];
+    }
+}
+
+ILI9341_DisplayList_HandleTypeDef ILI9341_DisplayList_Init(uint8_t* buffer, size_t bufferSize) {
+    const ILI9341_DisplayList_HandleTypeDef list_instance = {.buffer = buffer, .size = bufferSize};
+    return list_instance;
+}
+
+void ILI9341_DisplayList_Clear(ILI9341_DisplayList_HandleTypeDef* list) {
+    list->used = 0;
+    list->last = 0;
+    list->count = 0;
+    list->overflow = false;
+}
+
+void ILI9341_DisplayList_Replay(ILI9341_HandleTypeDef* ili9341, const ILI9341_DisplayList_HandleTypeDef* list) {
+    ILI9341_DisplayList_Command command;
+
+    for (size_t offset = 0; offset < list->used; offset += command.header.size) {
+        ILI9341_DisplayList_Decode(list, offset, &command);
+        if (ILI9341_DisplayList_IsVisible(ili9341, command.header.bounds)) {
+            ILI9341_DisplayList_Execute(ili9341, &command);
+        }
+    }
+}
+
+void ILI9341_DisplayList_ReplayCallback(ILI9341_HandleTypeDef* ili9341, void* list) {
+    ILI9341_DisplayList_Replay(ili9341, (const ILI9341_DisplayList_HandleTypeDef*)list);
+}
+
+void ILI9341_DisplayList_Update(
+    ILI9341_HandleTypeDef* ili9341,
+    const ILI9341_DisplayList_HandleTypeDef* previous,
+    const ILI9341_DisplayList_HandleTypeDef* next,
+    uint16_t* buffer,
+    size_t bufferSize
+) {
+    ILI9341_RectTypeDef damage[ILI9341_DIRTY_RECTS_MAX];
+    uint_fast8_t damageCount = 0;
+
+    if (previous == NULL || previous->overflow || next->overflow) {
+        damage[damageCount++] = ili9341->clip_rect;
+    } else {
+        // Skip the commands both lists start with
+        size_t previousStart = 0, nextStart = 0;
+        while (previousStart < previous->used && nextStart < next->used &&
+               ILI9341_DisplayList_CommandsEqual(previous->buffer + previousStart, next->buffer + nextStart)) {
+            ILI9341_DisplayList_CommandHeader header;
+            memcpy(&header, previous->buffer + previousStart, sizeof(header));
+            previousStart += header.size;
+            nextStart += header.size;
+        }
+
+        // Skip the commands both lists end with, walking backwards until the common start
+        size_t previousEnd = previous->used, nextEnd = next->used;
+        size_t previousLast = previous->last, nextLast = next->last;
+        while (previousEnd > previousStart && nextEnd > nextStart &&
+               ILI9341_DisplayList_CommandsEqual(previous->buffer + previousLast, next->buffer + nextLast)) {
+            ILI9341_DisplayList_CommandHeader header;
+            previousEnd = previousLast;
+            nextEnd = nextLast;
+            memcpy(&header, previous->buffer + previousLast, sizeof(header));
+            previousLast -= header.previousSize;
+            memcpy(&header, next->buffer + nextLast, sizeof(header));
+            nextLast -= header.previousSize;
+        }
+
+        // Whatever any of the remaining commands touched can now look different
+        ILI9341_DisplayList_Command command;
+        for (size_t offset = previousStart; offset < previousEnd; offset += command.header.size) {
+            ILI9341_DisplayList_Decode(previous, offset, &command);
+            ILI9341_DisplayList_AddDamage(damage, &damageCount, command.header.bounds);
+        }
+        for (size_t offset = nextStart; offset < nextEnd; offset += command.header.size) {
+            ILI9341_DisplayList_Decode(next, offset, &command);
+            ILI9341_DisplayList_AddDamage(damage, &damageCount, command.header.bounds);
+        }
+    }
+
+    const ILI9341_RectTypeDef clip = ili9341->clip_rect;
+
+    for (uint_fast8_t i = 0; i < damageCount; i++) {
+        ILI9341_RectTypeDef rect = damage[i];
+        if (rect.x0 < clip.x0) rect.x0 = clip.x0;
+        if (rect.y0 < clip.y0) rect.y0 = clip.y0;
+        if (rect.x1 > clip.x1) rect.x1 = clip.x1;
+        if (rect.y1 > clip.y1) rect.y1 = clip.y1;
+        if (rect.x0 > rect.x1 || rect.y0 > rect.y1) continue;
+
+        ILI9341_SetClipRect(ili9341, rect.x0, rect.y0, rect.x1 - rect.x0 + 1, rect.y1 - rect.y0 + 1);
+        if (buffer != NULL) {
+            ILI9341_RenderBands(ili9341, buffer, bufferSize, ILI9341_DisplayList_ReplayCallback, (void*)next);
+        } else {
+            ILI9341_DisplayList_Replay(ili9341, next);
+        }
+    }
+
+    ili9341->clip_rect = clip;
+}
+
+void ILI9341_DisplayList_DrawPixel(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    uint16_t color
+) {
+    int16_t args[] = {x, y, color};
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(x, y, x, y, 0);
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_DRAW_PIXEL, false, bounds, args, 3, NULL, 0, NULL, 0);
+}
+
+void ILI9341_DisplayList_FillRectangle(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint16_t color
+) {
+    int16_t args[] = {x, y, w, h, color};
+    ILI9341_RectTypeDef bounds = w == 0 || h == 0 ? (ILI9341_RectTypeDef){0, 0, -1, -1}
+                                                  : ILI9341_DisplayList_Bounds(
+                                                        x, y, x + w + (w > 0 ? -1 : 1), y + h + (h > 0 ? -1 : 1), 0
+                                                    );
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_FILL_RECTANGLE, false, bounds, args, 5, NULL, 0, NULL, 0);
+}
+
+void ILI9341_DisplayList_FillScreen(ILI9341_DisplayList_HandleTypeDef* list, uint16_t color) {
+    int16_t args[] = {color};
+    ILI9341_RectTypeDef bounds = {0, 0, ILI9341_DISPLAY_LIST_UNBOUNDED, ILI9341_DISPLAY_LIST_UNBOUNDED};
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_FILL_SCREEN, false, bounds, args, 1, NULL, 0, NULL, 0);
+}
+
+void ILI9341_DisplayList_WriteString(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    ILI9341_FontDef font,
+    uint16_t color,
+    uint16_t bgcolor,
+    bool wrap,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading
+) {
+    int16_t args[] = {x, y, color, bgcolor, scale, tracking, leading};
+    ILI9341_RectTypeDef bounds =
+        scale < 1 ? (ILI9341_RectTypeDef){0, 0, -1, -1}
+                  : ILI9341_DisplayList_StringBounds(x, y, str, &font, wrap, scale, tracking, leading);
+    ILI9341_DisplayList_Append(
+        list, ILI9341_DISPLAY_LIST_WRITE_STRING, wrap, bounds, args, 7, &font, sizeof(font), str, strlen(str) + 1
+    );
+}
+
+void ILI9341_DisplayList_WriteStringTransparent(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    ILI9341_FontDef font,
+    uint16_t color,
+    bool wrap,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading
+) {
+    int16_t args[] = {x, y, color, 0, scale, tracking, leading};
+    ILI9341_RectTypeDef bounds =
+        scale < 1 ? (ILI9341_RectTypeDef){0, 0, -1, -1}
+                  : ILI9341_DisplayList_StringBounds(x, y, str, &font, wrap, scale, tracking, leading);
+    ILI9341_DisplayList_Append(
+        list,
+        ILI9341_DISPLAY_LIST_WRITE_STRING_TRANSPARENT,
+        wrap,
+        bounds,
+        args,
+        7,
+        &font,
+        sizeof(font),
+        str,
+        strlen(str) + 1
+    );
+}
+
+void ILI9341_DisplayList_DrawImage(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    const uint16_t* data
+) {
+    int16_t args[] = {x, y, w, h};
+    ILI9341_RectTypeDef bounds = w <= 0 || h <= 0 ? (ILI9341_RectTypeDef){0, 0, -1, -1}
+                                                  : ILI9341_DisplayList_Bounds(x, y, x + w - 1, y + h - 1, 0);
+    ILI9341_DisplayList_Append(
+        list, ILI9341_DISPLAY_LIST_DRAW_IMAGE, false, bounds, args, 4, &data, sizeof(data), NULL, 0
+    );
+}
+
+void ILI9341_DisplayList_DrawLine(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x1,
+    int_fast16_t y1,
+    int_fast16_t x2,
+    int_fast16_t y2,
+    uint16_t color
+) {
+    int16_t args[] = {x1, y1, x2, y2, color};
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(x1, y1, x2, y2, 0);
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_DRAW_LINE, false, bounds, args, 5, NULL, 0, NULL, 0);
+}
+
+void ILI9341_DisplayList_DrawLineThick(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x1,
+    int_fast16_t y1,
+    int_fast16_t x2,
+    int_fast16_t y2,
+    uint16_t color,
+    int_fast16_t thickness,
+    bool cap
+) {
+    int16_t args[] = {x1, y1, x2, y2, color, thickness};
+    // Half the thickness on each side plus rounding of the corners, the caps have the same radius
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(x1, y1, x2, y2, thickness / 2 + 1);
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_DRAW_LINE_THICK, cap, bounds, args, 6, NULL, 0, NULL, 0);
+}
+
+void ILI9341_DisplayList_DrawRectangle(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint16_t color
+) {
+    int16_t args[] = {x, y, w, h, color};
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(x, y, x + w, y + h, 1);
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_DRAW_RECTANGLE, false, bounds, args, 5, NULL, 0, NULL, 0);
+}
+
+void ILI9341_DisplayList_DrawRectangleThick(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    uint16_t color,
+    int_fast16_t thickness
+) {
+    int16_t args[] = {x, y, w, h, color, thickness};
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(x, y, x + w, y + h, thickness);
+    ILI9341_DisplayList_Append(
+        list, ILI9341_DISPLAY_LIST_DRAW_RECTANGLE_THICK, false, bounds, args, 6, NULL, 0, NULL, 0
+    );
+}
+
+void ILI9341_DisplayList_DrawCircle(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t r,
+    uint16_t color
+) {
+    int16_t args[] = {x, y, r, color};
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(x, y, x, y, r);
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_DRAW_CIRCLE, false, bounds, args, 4, NULL, 0, NULL, 0);
+}
+
+void ILI9341_DisplayList_DrawCircleThick(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t r,
+    uint16_t color,
+    int_fast16_t thickness
+) {
+    int16_t args[] = {x, y, r, color, thickness};
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(x, y, x, y, r);
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_DRAW_CIRCLE_THICK, false, bounds, args, 5, NULL, 0, NULL, 0);
+}
+
+void ILI9341_DisplayList_FillCircle(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t r,
+    uint16_t color
+) {
+    int16_t args[] = {x, y, r, color};
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(x, y, x, y, r);
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_FILL_CIRCLE, false, bounds, args, 4, NULL, 0, NULL, 0);
+}
+
+void ILI9341_DisplayList_DrawEllipse(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t xc,
+    int_fast16_t yc,
+    int_fast16_t rx,
+    int_fast16_t ry,
+    uint16_t color
+) {
+    int16_t args[] = {xc, yc, rx, ry, color};
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(xc - rx, yc - ry, xc + rx, yc + ry, 0);
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_DRAW_ELLIPSE, false, bounds, args, 5, NULL, 0, NULL, 0);
+}
+
+void ILI9341_DisplayList_DrawEllipseThick(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t xc,
+    int_fast16_t yc,
+    int_fast16_t rx,
+    int_fast16_t ry,
+    uint16_t color,
+    int_fast16_t thickness
+) {
+    int16_t args[] = {xc, yc, rx, ry, color, thickness};
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(xc - rx, yc - ry, xc + rx, yc + ry, 0);
+    ILI9341_DisplayList_Append(
+        list, ILI9341_DISPLAY_LIST_DRAW_ELLIPSE_THICK, false, bounds, args, 6, NULL, 0, NULL, 0
+    );
+}
+
+void ILI9341_DisplayList_FillEllipse(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    int_fast16_t xc,
+    int_fast16_t yc,
+    int_fast16_t rx,
+    int_fast16_t ry,
+    uint16_t color
+) {
+    int16_t args[] = {xc, yc, rx, ry, color};
+    ILI9341_RectTypeDef bounds = ILI9341_DisplayList_Bounds(xc - rx, yc - ry, xc + rx, yc + ry, 0);
+    ILI9341_DisplayList_Append(list, ILI9341_DISPLAY_LIST_FILL_ELLIPSE, false, bounds, args, 5, NULL, 0, NULL, 0);
+}
+
+/**
+ * @brief Record a polygon command
+ * @param list Pointer to display list handle structure
+ * @param opcode Command opcode
+ * @param x Array of X coordinates of the vertices
+ * @param y Array of Y coordinates of the vertices
+ * @param n Number of vertices
+ * @param color 16-bit color in RGB565 format
+ * @param thickness Line thickness, 0 for thin lines and fills
+ * @param cap Whether to draw round caps
+ */
+static void ILI9341_DisplayList_AppendPolygon(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    ILI9341_DisplayList_Opcode opcode,
+    const int16_t* x,
+    const int16_t* y,
+    size_t n,
+    uint16_t color,
+    int_fast16_t thickness,
+    bool cap
+) {
+    if (n > UINT16_MAX) {
+        list->overflow = true;
+        return;
+    }
+
+    int16_t args[] = {n, color, thickness};
+    ILI9341_RectTypeDef bounds = {0, 0, -1, -1};
+
+    if (n > 0) {
+        int_fast16_t minX = x[0], minY = y[0], maxX = x[0], maxY = y[0];
+        for (size_t i = 1; i < n; i++) {
+            if (x[i] < minX) minX = x[i];
+            if (x[i] > maxX) maxX = x[i];
+            if (y[i] < minY) minY = y[i];
+            if (y[i] > maxY) maxY = y[i];
+        }
+        bounds = ILI9341_DisplayList_Bounds(minX, minY, maxX, maxY, thickness > 0 ? thickness / 2 + 1 : 0);
+    }
+
+    ILI9341_DisplayList_Append(list, opcode, cap, bounds, args, 3, x, n * sizeof(int16_t), y, n * sizeof(int16_t));
+}
+
+void ILI9341_DisplayList_DrawPolygon(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    const int16_t* x,
+    const int16_t* y,
+    size_t n,
+    uint16_t color
+) {
+    ILI9341_DisplayList_AppendPolygon(list, ILI9341_DISPLAY_LIST_DRAW_POLYGON, x, y, n, color, 0, false);
+}
+
+void ILI9341_DisplayList_DrawPolygonThick(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    const int16_t* x,
+    const int16_t* y,
+    size_t n,
+    uint16_t color,
+    int_fast16_t thickness,
+    bool cap
+) {
+    ILI9341_DisplayList_AppendPolygon(list, ILI9341_DISPLAY_LIST_DRAW_POLYGON_THICK, x, y, n, color, thickness, cap);
+}
+
+void ILI9341_DisplayList_FillPolygon(
+    ILI9341_DisplayList_HandleTypeDef* list,
+    const int16_t* x,
+    const int16_t* y,
+    size_t n,
+    uint16_t color
+) {
+    ILI9341_DisplayList_AppendPolygon(list, ILI9341_DISPLAY_LIST_FILL_POLYGON, x, y, n, color, 0, false);
+}
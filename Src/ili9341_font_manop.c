@@ -7,673 +7,568 @@
 #include "ili9341_fonts.h"
 
 static const ILI9341_GlyphDef ILI9341_Font_Manop6x14_Glyphs[] = {
-    {  0,   0,  0,  0,  6, NULL}, /*   */
-    {  3,   0,  1,  7,  6, (const uint8_t[]){0xFA}}, /* ! */
-    {  2,   4,  3,  3,  6, (const uint8_t[]){0xB6, 0x80}}, /* " */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x52, 0xBE, 0xAF, 0xA9, 0x40}}, /* # */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x23, 0xA8, 0xE2, 0xB8, 0x80}}, /* $ */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x4D, 0x54, 0x45, 0x56, 0x40}}, /* % */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x45, 0x28, 0x8A, 0xC9, 0xA0}}, /* & */
-    {  2,   4,  3,  3,  6, (const uint8_t[]){0x6A, 0x00}}, /* ' */
-    {  2,   0,  3,  7,  6, (const uint8_t[]){0x2A, 0x48, 0x88}}, /* ( */
-    {  2,   0,  3,  7,  6, (const uint8_t[]){0x88, 0x92, 0xA0}}, /* ) */
-    {  1,   1,  5,  5,  6, (const uint8_t[]){0x8A, 0xBE, 0xA8, 0x80}}, /* * */
-    {  1,   1,  5,  5,  6, (const uint8_t[]){0x21, 0x3E, 0x42, 0x00}}, /* + */
-    {  2,  -1,  3,  3,  6, (const uint8_t[]){0x6A, 0x00}}, /* , */
-    {  1,   3,  5,  1,  6, (const uint8_t[]){0xF8}}, /* - */
-    {  2,  -1,  3,  3,  6, (const uint8_t[]){0x5D, 0x00}}, /* . */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x08, 0x44, 0x44, 0x42, 0x00}}, /* / */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x22, 0xA3, 0x18, 0xA8, 0x80}}, /* 0 */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x23, 0x28, 0x42, 0x13, 0xE0}}, /* 1 */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x74, 0x42, 0x64, 0x43, 0xE0}}, /* 2 */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xF8, 0x44, 0x60, 0xC5, 0xC0}}, /* 3 */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x11, 0x95, 0x2F, 0x88, 0x40}}, /* 4 */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xFC, 0x2D, 0x90, 0xC5, 0xC0}}, /* 5 */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x32, 0x21, 0x6C, 0xC5, 0xC0}}, /* 6 */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xF8, 0x44, 0x22, 0x21, 0x00}}, /* 7 */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x74, 0x62, 0xE8, 0xC5, 0xC0}}, /* 8 */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x74, 0x66, 0xD0, 0x89, 0x80}}, /* 9 */
-    {  2,  -1,  3,  7,  6, (const uint8_t[]){0x5D, 0x05, 0xD0}}, /* : */
-    {  2,  -1,  3,  7,  6, (const uint8_t[]){0x5D, 0x06, 0xA0}}, /* ; */
-    {  2,   0,  4,  7,  6, (const uint8_t[]){0x12, 0x48, 0x42, 0x10}}, /* < */
-    {  1,   2,  5,  3,  6, (const uint8_t[]){0xF8, 0x3E}}, /* = */
-    {  1,   0,  4,  7,  6, (const uint8_t[]){0x84, 0x21, 0x24, 0x80}}, /* > */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x74, 0x44, 0x42, 0x00, 0x80}}, /* ? */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x74, 0x67, 0x5B, 0x41, 0xC0}}, /* @ */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x22, 0xA3, 0x1F, 0xC6, 0x20}}, /* A */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xF2, 0x52, 0xE4, 0xA7, 0xC0}}, /* B */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x74, 0x61, 0x08, 0x45, 0xC0}}, /* C */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xF2, 0x52, 0x94, 0xA7, 0xC0}}, /* D */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xFC, 0x21, 0xE8, 0x43, 0xE0}}, /* E */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xFC, 0x21, 0xE8, 0x42, 0x00}}, /* F */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x74, 0x61, 0x09, 0xC5, 0xC0}}, /* G */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x8C, 0x63, 0xF8, 0xC6, 0x20}}, /* H */
-    {  2,   0,  3,  7,  6, (const uint8_t[]){0xE9, 0x24, 0xB8}}, /* I */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x38, 0x42, 0x10, 0xC5, 0xC0}}, /* J */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x8C, 0xA9, 0x8A, 0x4A, 0x20}}, /* K */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x84, 0x21, 0x08, 0x43, 0xE0}}, /* L */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x8C, 0x77, 0x58, 0xC6, 0x20}}, /* M */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x8C, 0x73, 0x59, 0xC6, 0x20}}, /* N */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x74, 0x63, 0x18, 0xC5, 0xC0}}, /* O */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xF4, 0x63, 0xE8, 0x42, 0x00}}, /* P */
-    {  1,  -1,  5,  8,  6, (const uint8_t[]){0x74, 0x63, 0x18, 0xD5, 0xC1}}, /* Q */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xF4, 0x63, 0xEA, 0x4A, 0x20}}, /* R */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x74, 0x60, 0xE0, 0xC5, 0xC0}}, /* S */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xF9, 0x08, 0x42, 0x10, 0x80}}, /* T */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x8C, 0x63, 0x18, 0xC5, 0xC0}}, /* U */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x8C, 0x62, 0xA5, 0x28, 0x80}}, /* V */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x8C, 0x63, 0x5A, 0xEE, 0x20}}, /* W */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x8C, 0x54, 0x45, 0x46, 0x20}}, /* X */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x8C, 0x54, 0x42, 0x10, 0x80}}, /* Y */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0xF8, 0x44, 0x44, 0x43, 0xE0}}, /* Z */
-    {  2,   0,  3,  7,  6, (const uint8_t[]){0xF2, 0x49, 0x38}}, /* [ */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x84, 0x10, 0x41, 0x04, 0x20}}, /* \ */
-    {  2,   0,  3,  7,  6, (const uint8_t[]){0xE4, 0x92, 0x78}}, /* ] */
-    {  1,   4,  5,  3,  6, (const uint8_t[]){0x22, 0xA2}}, /* ^ */
-    {  1,  -1,  5,  1,  6, (const uint8_t[]){0xF8}}, /* _ */
-    {  2,   4,  3,  3,  6, (const uint8_t[]){0xC8, 0x80}}, /* ` */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x70, 0x5F, 0x17, 0x80}}, /* a */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x84, 0x2D, 0x98, 0xE6, 0xC0}}, /* b */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x74, 0x61, 0x17, 0x00}}, /* c */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x08, 0x5B, 0x38, 0xCD, 0xA0}}, /* d */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x74, 0x7F, 0x07, 0x00}}, /* e */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x32, 0x51, 0xE4, 0x21, 0x00}}, /* f */
-    {  1,  -2,  5,  7,  6, (const uint8_t[]){0x6C, 0x99, 0x07, 0x45, 0xC0}}, /* g */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x84, 0x2D, 0x98, 0xC6, 0x20}}, /* h */
-    {  2,   0,  3,  7,  6, (const uint8_t[]){0x43, 0x24, 0xB8}}, /* i */
-    {  1,  -2,  4,  9,  6, (const uint8_t[]){0x10, 0x31, 0x11, 0x99, 0x60}}, /* j */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x84, 0x23, 0x2E, 0x4A, 0x20}}, /* k */
-    {  2,   0,  3,  7,  6, (const uint8_t[]){0xC9, 0x24, 0xB8}}, /* l */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0xD5, 0x6B, 0x58, 0x80}}, /* m */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0xB6, 0x63, 0x18, 0x80}}, /* n */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x74, 0x63, 0x17, 0x00}}, /* o */
-    {  1,  -2,  5,  7,  6, (const uint8_t[]){0xB6, 0x73, 0x68, 0x42, 0x00}}, /* p */
-    {  1,  -2,  5,  7,  6, (const uint8_t[]){0x6C, 0xE6, 0xD0, 0x84, 0x20}}, /* q */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0xB6, 0x61, 0x08, 0x00}}, /* r */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x74, 0x1C, 0x1F, 0x00}}, /* s */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x42, 0x3C, 0x84, 0x24, 0xC0}}, /* t */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x8C, 0x63, 0x36, 0x80}}, /* u */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x8C, 0x54, 0xA2, 0x00}}, /* v */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x8C, 0x6B, 0x55, 0x00}}, /* w */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x8A, 0x88, 0xA8, 0x80}}, /* x */
-    {  1,  -2,  5,  7,  6, (const uint8_t[]){0x8C, 0x66, 0xD0, 0xC5, 0xC0}}, /* y */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0xF8, 0x88, 0x8F, 0x80}}, /* z */
-    {  2,   0,  4,  7,  6, (const uint8_t[]){0x34, 0x2C, 0x24, 0x30}}, /* { */
-    {  3,   0,  1,  7,  6, (const uint8_t[]){0xFE}}, /* | */
-    {  1,   0,  4,  7,  6, (const uint8_t[]){0xC2, 0x43, 0x42, 0xC0}}, /* } */
-    {  1,   4,  5,  3,  6, (const uint8_t[]){0x4D, 0x64}}, /* ~ */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /*   */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x72, 0x94, 0xA4}}, /* ก */
-    {  1,   0,  4,  6,  6, (const uint8_t[]){0xDD, 0x59, 0x96}}, /* ข */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xAF, 0x4A, 0x94, 0x98}}, /* ฃ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x7B, 0xDC, 0xA4}}, /* ค */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x55, 0x7B, 0xDC, 0xA4}}, /* ฅ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xAF, 0x4A, 0x9E, 0xE8}}, /* ฆ */
-    {  1,   0,  4,  6,  6, (const uint8_t[]){0x33, 0x19, 0x53}}, /* ง */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x5A, 0xD2, 0x98}}, /* จ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xE0, 0xB5, 0xA7, 0xAC}}, /* ฉ */
-    {  1,   0,  4,  7,  6, (const uint8_t[]){0x1D, 0xE5, 0x99, 0x60}}, /* ช */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x0D, 0x7C, 0x54, 0xA4, 0xC0}}, /* ซ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x6D, 0x5B, 0x5F, 0xF4}}, /* ฌ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x6D, 0x5B, 0x7E, 0x7C}}, /* ญ */
-    {  1,  -2,  5,  8,  6, (const uint8_t[]){0x74, 0x52, 0x9C, 0xEC, 0xE9}}, /* ฎ */
-    {  1,  -2,  5,  8,  6, (const uint8_t[]){0x74, 0x52, 0x9C, 0xEE, 0xAA}}, /* ฏ */
-    {  1,  -2,  5,  8,  6, (const uint8_t[]){0x7C, 0x1C, 0xD6, 0x8E, 0xAB}}, /* ฐ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xAF, 0xCA, 0x94, 0xA4}}, /* ฑ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xAF, 0x6B, 0x5F, 0xF4}}, /* ฒ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x6D, 0x5B, 0x6B, 0xFC}}, /* ณ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x7B, 0xDA, 0xA4}}, /* ด */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x55, 0x7B, 0xDA, 0xA4}}, /* ต */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x72, 0x96, 0xB4}}, /* ถ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xD7, 0x52, 0x94, 0xA4}}, /* ท */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x7C, 0x3C, 0x94, 0x98}}, /* ธ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xD6, 0x95, 0x2B, 0xAC}}, /* น */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xCE, 0x52, 0x94, 0x98}}, /* บ */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0x08, 0x73, 0x94, 0xA5, 0x26}}, /* ป */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xCE, 0x63, 0x5A, 0xA8}}, /* ผ */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0x08, 0x73, 0x98, 0xD6, 0xAA}}, /* ฝ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xCE, 0x53, 0x5A, 0xA8}}, /* พ */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0x08, 0x73, 0x94, 0xD6, 0xAA}}, /* ฟ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x72, 0x9C, 0xE4}}, /* ภ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xCE, 0x52, 0x9E, 0xE8}}, /* ม */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xCE, 0x62, 0xD8, 0xB8}}, /* ย */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x78, 0x23, 0x18}}, /* ร */
-    {  1,  -2,  5,  8,  6, (const uint8_t[]){0x74, 0x72, 0x96, 0xB4, 0x21}}, /* ฤ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x5B, 0x3C, 0xE4}}, /* ล */
-    {  1,  -2,  5,  8,  6, (const uint8_t[]){0x74, 0x72, 0x9C, 0xE4, 0x21}}, /* ฦ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x42, 0x11, 0x8C}}, /* ว */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0x08, 0x5D, 0x1E, 0xF7, 0x29}}, /* ศ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xD6, 0x9D, 0x79, 0x38}}, /* ษ */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0x08, 0x5D, 0x16, 0xCF, 0x39}}, /* ส */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xDE, 0xD4, 0xD4, 0xA4}}, /* ห */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0x08, 0x75, 0x94, 0xD6, 0xAA}}, /* ฬ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xF0, 0x73, 0x98, 0xB8}}, /* อ */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0x08, 0x7C, 0x1C, 0xE6, 0x2E}}, /* ฮ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xDF, 0x42, 0x10, 0x88}}, /* ฯ */
-    {  1,   0,  4,  5,  6, (const uint8_t[]){0xDE, 0x0D, 0xE0}}, /* ะ */
-    { -4,   7,  4,  2,  0, (const uint8_t[]){0x8F}}, /* ั */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x42, 0x10, 0x84}}, /* า */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0xC6, 0x0C, 0x90, 0x84, 0x21}}, /* ำ */
-    { -4,   7,  4,  1,  0, (const uint8_t[]){0xF0}}, /* ิ */
-    { -4,   7,  4,  2,  0, (const uint8_t[]){0x1F}}, /* ี */
-    { -4,   7,  4,  2,  0, (const uint8_t[]){0x3F}}, /* ึ */
-    { -4,   7,  4,  2,  0, (const uint8_t[]){0x5F}}, /* ื */
-    { -2,  -2,  2,  2,  0, (const uint8_t[]){0xD0}}, /* ุ */
-    { -3,  -2,  3,  2,  0, (const uint8_t[]){0xEC}}, /* ู */
-    { -2,  -2,  2,  2,  0, (const uint8_t[]){0xF0}}, /* ฺ */
-    { -4,   7,  4,  4,  0, (const uint8_t[]){0xD6, 0x8F}}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
-    {  1,  -1,  5,  9,  6, (const uint8_t[]){0x27, 0xAB, 0x5F, 0x56, 0xBE, 0x20}}, /* ฿ */
-    {  2,   0,  2,  6,  6, (const uint8_t[]){0xAA, 0xF0}}, /* เ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x94, 0xA5, 0x2D, 0xEC}}, /* แ */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0x7C, 0x3C, 0x21, 0x08, 0x63}}, /* โ */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0x74, 0xAC, 0xE1, 0x08, 0x63}}, /* ใ */
-    {  1,   0,  5,  8,  6, (const uint8_t[]){0xB2, 0x84, 0x21, 0x08, 0x63}}, /* ไ */
-    {  1,  -2,  5,  8,  6, (const uint8_t[]){0x74, 0x42, 0x10, 0x84, 0x21}}, /* ๅ */
-    {  1,  -2,  5,  8,  6, (const uint8_t[]){0xEE, 0xC2, 0x10, 0x84, 0x44}}, /* ๆ */
-    { -4,   7,  4,  3,  0, (const uint8_t[]){0xFC, 0xB0}}, /* ็ */
-    { -1,   9,  1,  2,  0, (const uint8_t[]){0xC0}}, /* ่ */
-    { -4,   9,  4,  2,  0, (const uint8_t[]){0xD6}}, /* ้ */
-    { -4,   9,  5,  2,  0, (const uint8_t[]){0xAF, 0x80}}, /* ๊ */
-    { -3,   8,  3,  3,  0, (const uint8_t[]){0x5D, 0x00}}, /* ๋ */
-    { -2,   9,  2,  2,  0, (const uint8_t[]){0xE0}}, /* ์ */
-    { -2,   9,  2,  2,  0, (const uint8_t[]){0xF0}}, /* ํ */
-    { -3,   7,  3,  3,  0, (const uint8_t[]){0x7F, 0x00}}, /* ๎ */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x74, 0x6B, 0x17, 0x00}}, /* ๏ */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x74, 0x63, 0x17, 0x00}}, /* ๐ */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x75, 0x7A, 0x17, 0x00}}, /* ๑ */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x84, 0x2B, 0x7B, 0xC5, 0xC0}}, /* ๒ */
-    {  1,   0,  5,  5,  6, (const uint8_t[]){0x55, 0x63, 0x9C, 0x80}}, /* ๓ */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x08, 0x5D, 0x0B, 0x59, 0xE0}}, /* ๔ */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x0B, 0x5D, 0x0B, 0x59, 0xE0}}, /* ๕ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x82, 0x8A, 0x16, 0xB8}}, /* ๖ */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x08, 0x6B, 0xDA, 0xD7, 0x40}}, /* ๗ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0x0B, 0xA1, 0x3A, 0xEC}}, /* ๘ */
-    {  1,   0,  5,  7,  6, (const uint8_t[]){0x08, 0x4C, 0xCA, 0x6B, 0x20}}, /* ๙ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xAF, 0x4A, 0x52, 0xA8}}, /* ๚ */
-    {  1,   0,  5,  6,  6, (const uint8_t[]){0xC6, 0x2B, 0x6A, 0x20}}, /* ๛ */
+    {  0,   0,  0,  0,  6, 0, NULL}, /*   */
+    {  3,   0,  1,  7,  6, 0, (const uint8_t[]){0xFA}}, /* ! */
+    {  2,   4,  3,  3,  6, 1, (const uint8_t[]){0x74}}, /* " */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x42, 0xAF, 0xAB, 0xEA}}, /* # */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x23, 0xA8, 0xE2, 0xB8, 0x80}}, /* $ */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x4D, 0x54, 0x45, 0x56, 0x40}}, /* % */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x45, 0x28, 0x8A, 0xC9, 0xA0}}, /* & */
+    {  2,   4,  3,  3,  6, 0, (const uint8_t[]){0x6A, 0x00}}, /* ' */
+    {  2,   0,  3,  7,  6, 0, (const uint8_t[]){0x2A, 0x48, 0x88}}, /* ( */
+    {  2,   0,  3,  7,  6, 0, (const uint8_t[]){0x88, 0x92, 0xA0}}, /* ) */
+    {  1,   1,  5,  5,  6, 0, (const uint8_t[]){0x8A, 0xBE, 0xA8, 0x80}}, /* * */
+    {  1,   1,  5,  5,  6, 1, (const uint8_t[]){0x49, 0x3E, 0x40}}, /* + */
+    {  2,  -1,  3,  3,  6, 0, (const uint8_t[]){0x6A, 0x00}}, /* , */
+    {  1,   3,  5,  1,  6, 0, (const uint8_t[]){0xF8}}, /* - */
+    {  2,  -1,  3,  3,  6, 0, (const uint8_t[]){0x5D, 0x00}}, /* . */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x42, 0x11, 0x11, 0x10}}, /* / */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x18, 0x45, 0x45, 0x44}}, /* 0 */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x0C, 0x46, 0x50, 0x9F}}, /* 1 */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x74, 0x42, 0x64, 0x43, 0xE0}}, /* 2 */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0xF8, 0x44, 0x60, 0xC5, 0xC0}}, /* 3 */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x11, 0x95, 0x2F, 0x88, 0x40}}, /* 4 */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0xFC, 0x2D, 0x90, 0xC5, 0xC0}}, /* 5 */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x32, 0x21, 0x6C, 0xC5, 0xC0}}, /* 6 */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x13, 0xF0, 0x88, 0x88}}, /* 7 */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x24, 0xE8, 0xBA, 0x2E}}, /* 8 */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x74, 0x66, 0xD0, 0x89, 0x80}}, /* 9 */
+    {  2,  -1,  3,  7,  6, 0, (const uint8_t[]){0x5D, 0x05, 0xD0}}, /* : */
+    {  2,  -1,  3,  7,  6, 0, (const uint8_t[]){0x5D, 0x06, 0xA0}}, /* ; */
+    {  2,   0,  4,  7,  6, 0, (const uint8_t[]){0x12, 0x48, 0x42, 0x10}}, /* < */
+    {  1,   2,  5,  3,  6, 0, (const uint8_t[]){0xF8, 0x3E}}, /* = */
+    {  1,   0,  4,  7,  6, 0, (const uint8_t[]){0x84, 0x21, 0x24, 0x80}}, /* > */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x74, 0x44, 0x42, 0x00, 0x80}}, /* ? */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x74, 0x67, 0x5B, 0x41, 0xC0}}, /* @ */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x12, 0x45, 0x47, 0xF1}}, /* A */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x25, 0xE4, 0xB9, 0x3E}}, /* B */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x18, 0xE8, 0xC2, 0x2E}}, /* C */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x3D, 0xE4, 0xF8}}, /* D */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x25, 0xF8, 0x7A, 0x1F}}, /* E */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x27, 0xF8, 0x7A, 0x00}}, /* F */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x74, 0x61, 0x09, 0xC5, 0xC0}}, /* G */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x67, 0x1F, 0xC4}}, /* H */
+    {  2,   0,  3,  7,  6, 1, (const uint8_t[]){0x3D, 0xD7}}, /* I */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x38, 0x70, 0xC5, 0xC0}}, /* J */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x8C, 0xA9, 0x8A, 0x4A, 0x20}}, /* K */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x7D, 0x0F, 0x80}}, /* L */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x47, 0x1D, 0xD6, 0x20}}, /* M */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x43, 0x1C, 0xD6, 0x71}}, /* N */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x3C, 0xE8, 0xB8}}, /* O */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x27, 0xE8, 0xFA, 0x00}}, /* P */
+    {  1,  -1,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x63, 0x18, 0xD5, 0xC1}}, /* Q */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0xF4, 0x63, 0xEA, 0x4A, 0x20}}, /* R */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x74, 0x60, 0xE0, 0xC5, 0xC0}}, /* S */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x3F, 0xF2, 0x00}}, /* T */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x7D, 0x17, 0x00}}, /* U */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x6D, 0x15, 0x10}}, /* V */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x69, 0x1A, 0xEE, 0x20}}, /* W */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x43, 0x15, 0x11, 0x51}}, /* X */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x4F, 0x15, 0x10}}, /* Y */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0xF8, 0x44, 0x44, 0x43, 0xE0}}, /* Z */
+    {  2,   0,  3,  7,  6, 1, (const uint8_t[]){0x3D, 0xE7}}, /* [ */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x43, 0x04, 0x10, 0x41}}, /* \ */
+    {  2,   0,  3,  7,  6, 1, (const uint8_t[]){0x3D, 0xCF}}, /* ] */
+    {  1,   4,  5,  3,  6, 0, (const uint8_t[]){0x22, 0xA2}}, /* ^ */
+    {  1,  -1,  5,  1,  6, 0, (const uint8_t[]){0xF8}}, /* _ */
+    {  2,   4,  3,  3,  6, 0, (const uint8_t[]){0xC8, 0x80}}, /* ` */
+    {  1,   0,  5,  5,  6, 0, (const uint8_t[]){0x70, 0x5F, 0x17, 0x80}}, /* a */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x84, 0x2D, 0x98, 0xE6, 0xC0}}, /* b */
+    {  1,   0,  5,  5,  6, 0, (const uint8_t[]){0x74, 0x61, 0x17, 0x00}}, /* c */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x08, 0x5B, 0x38, 0xCD, 0xA0}}, /* d */
+    {  1,   0,  5,  5,  6, 0, (const uint8_t[]){0x74, 0x7F, 0x07, 0x00}}, /* e */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x06, 0x64, 0xA3, 0xC8}}, /* f */
+    {  1,  -2,  5,  7,  6, 0, (const uint8_t[]){0x6C, 0x99, 0x07, 0x45, 0xC0}}, /* g */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x47, 0x0B, 0x66, 0x20}}, /* h */
+    {  2,   0,  3,  7,  6, 0, (const uint8_t[]){0x43, 0x24, 0xB8}}, /* i */
+    {  1,  -2,  4,  9,  6, 0, (const uint8_t[]){0x10, 0x31, 0x11, 0x99, 0x60}}, /* j */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x84, 0x23, 0x2E, 0x4A, 0x20}}, /* k */
+    {  2,   0,  3,  7,  6, 1, (const uint8_t[]){0x3D, 0x97}}, /* l */
+    {  1,   0,  5,  5,  6, 1, (const uint8_t[]){0x36, 0xAB, 0x10}}, /* m */
+    {  1,   0,  5,  5,  6, 1, (const uint8_t[]){0x1D, 0xB3, 0x10}}, /* n */
+    {  1,   0,  5,  5,  6, 1, (const uint8_t[]){0x33, 0xA2, 0xE0}}, /* o */
+    {  1,  -2,  5,  7,  6, 1, (const uint8_t[]){0x27, 0x6C, 0xDA, 0x00}}, /* p */
+    {  1,  -2,  5,  7,  6, 1, (const uint8_t[]){0x26, 0xD9, 0xB4, 0x20}}, /* q */
+    {  1,   0,  5,  5,  6, 1, (const uint8_t[]){0x1D, 0xB3, 0x00}}, /* r */
+    {  1,   0,  5,  5,  6, 0, (const uint8_t[]){0x74, 0x1C, 0x1F, 0x00}}, /* s */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x48, 0x8F, 0x21, 0x26}}, /* t */
+    {  1,   0,  5,  5,  6, 1, (const uint8_t[]){0x64, 0x66, 0xD0}}, /* u */
+    {  1,   0,  5,  5,  6, 1, (const uint8_t[]){0x54, 0x54, 0x40}}, /* v */
+    {  1,   0,  5,  5,  6, 1, (const uint8_t[]){0x54, 0x6A, 0xA0}}, /* w */
+    {  1,   0,  5,  5,  6, 0, (const uint8_t[]){0x8A, 0x88, 0xA8, 0x80}}, /* x */
+    {  1,  -2,  5,  7,  6, 0, (const uint8_t[]){0x8C, 0x66, 0xD0, 0xC5, 0xC0}}, /* y */
+    {  1,   0,  5,  5,  6, 0, (const uint8_t[]){0xF8, 0x88, 0x8F, 0x80}}, /* z */
+    {  2,   0,  4,  7,  6, 0, (const uint8_t[]){0x34, 0x2C, 0x24, 0x30}}, /* { */
+    {  3,   0,  1,  7,  6, 0, (const uint8_t[]){0xFE}}, /* | */
+    {  1,   0,  4,  7,  6, 0, (const uint8_t[]){0xC2, 0x43, 0x42, 0xC0}}, /* } */
+    {  1,   4,  5,  3,  6, 0, (const uint8_t[]){0x4D, 0x64}}, /* ~ */
+    {  0,   0,  0,  0,  6, 0, NULL}, /* � */
+    {  0,   0,  0,  0,  6, 0, NULL}, /*   */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x74, 0x72, 0x94, 0xA4}}, /* ก */
+    {  1,   0,  4,  6,  6, 0, (const uint8_t[]){0xDD, 0x59, 0x96}}, /* ข */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xAF, 0x4A, 0x94, 0x98}}, /* ฃ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x74, 0x7B, 0xDC, 0xA4}}, /* ค */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x55, 0x7B, 0xDC, 0xA4}}, /* ฅ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xAF, 0x4A, 0x9E, 0xE8}}, /* ฆ */
+    {  1,   0,  4,  6,  6, 0, (const uint8_t[]){0x33, 0x19, 0x53}}, /* ง */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x74, 0x5A, 0xD2, 0x98}}, /* จ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xE0, 0xB5, 0xA7, 0xAC}}, /* ฉ */
+    {  1,   0,  4,  7,  6, 0, (const uint8_t[]){0x1D, 0xE5, 0x99, 0x60}}, /* ช */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x0D, 0x7C, 0x54, 0xA4, 0xC0}}, /* ซ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x6D, 0x5B, 0x5F, 0xF4}}, /* ฌ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x6D, 0x5B, 0x7E, 0x7C}}, /* ญ */
+    {  1,  -2,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x52, 0x9C, 0xEC, 0xE9}}, /* ฎ */
+    {  1,  -2,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x52, 0x9C, 0xEE, 0xAA}}, /* ฏ */
+    {  1,  -2,  5,  8,  6, 0, (const uint8_t[]){0x7C, 0x1C, 0xD6, 0x8E, 0xAB}}, /* ฐ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xAF, 0xCA, 0x94, 0xA4}}, /* ฑ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xAF, 0x6B, 0x5F, 0xF4}}, /* ฒ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x6D, 0x5B, 0x6B, 0xFC}}, /* ณ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x74, 0x7B, 0xDA, 0xA4}}, /* ด */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x55, 0x7B, 0xDA, 0xA4}}, /* ต */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x74, 0x72, 0x96, 0xB4}}, /* ถ */
+    {  1,   0,  5,  6,  6, 1, (const uint8_t[]){0x1F, 0x5D, 0x48}}, /* ท */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x7C, 0x3C, 0x94, 0x98}}, /* ธ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xD6, 0x95, 0x2B, 0xAC}}, /* น */
+    {  1,   0,  5,  6,  6, 1, (const uint8_t[]){0x5B, 0x29, 0x30}}, /* บ */
+    {  1,   0,  5,  8,  6, 1, (const uint8_t[]){0x56, 0x0E, 0x52, 0x60}}, /* ป */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xCE, 0x63, 0x5A, 0xA8}}, /* ผ */
+    {  1,   0,  5,  8,  6, 0, (const uint8_t[]){0x08, 0x73, 0x98, 0xD6, 0xAA}}, /* ฝ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xCE, 0x53, 0x5A, 0xA8}}, /* พ */
+    {  1,   0,  5,  8,  6, 0, (const uint8_t[]){0x08, 0x73, 0x94, 0xD6, 0xAA}}, /* ฟ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x74, 0x72, 0x9C, 0xE4}}, /* ภ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xCE, 0x52, 0x9E, 0xE8}}, /* ม */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xCE, 0x62, 0xD8, 0xB8}}, /* ย */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x74, 0x78, 0x23, 0x18}}, /* ร */
+    {  1,  -2,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x72, 0x96, 0xB4, 0x21}}, /* ฤ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x74, 0x5B, 0x3C, 0xE4}}, /* ล */
+    {  1,  -2,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x72, 0x9C, 0xE4, 0x21}}, /* ฦ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x74, 0x42, 0x11, 0x8C}}, /* ว */
+    {  1,   0,  5,  8,  6, 0, (const uint8_t[]){0x08, 0x5D, 0x1E, 0xF7, 0x29}}, /* ศ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xD6, 0x9D, 0x79, 0x38}}, /* ษ */
+    {  1,   0,  5,  8,  6, 0, (const uint8_t[]){0x08, 0x5D, 0x16, 0xCF, 0x39}}, /* ส */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xDE, 0xD4, 0xD4, 0xA4}}, /* ห */
+    {  1,   0,  5,  8,  6, 0, (const uint8_t[]){0x08, 0x75, 0x94, 0xD6, 0xAA}}, /* ฬ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xF0, 0x73, 0x98, 0xB8}}, /* อ */
+    {  1,   0,  5,  8,  6, 0, (const uint8_t[]){0x08, 0x7C, 0x1C, 0xE6, 0x2E}}, /* ฮ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xDF, 0x42, 0x10, 0x88}}, /* ฯ */
+    {  1,   0,  4,  5,  6, 0, (const uint8_t[]){0xDE, 0x0D, 0xE0}}, /* ะ */
+    { -4,   7,  4,  2,  0, 0, (const uint8_t[]){0x8F}}, /* ั */
+    {  1,   0,  5,  6,  6, 1, (const uint8_t[]){0x1D, 0xD1, 0x08}}, /* า */
+    {  1,   0,  5,  8,  6, 1, (const uint8_t[]){0x47, 0xC1, 0x92, 0x10}}, /* ำ */
+    { -4,   7,  4,  1,  0, 0, (const uint8_t[]){0xF0}}, /* ิ */
+    { -4,   7,  4,  2,  0, 0, (const uint8_t[]){0x1F}}, /* ี */
+    { -4,   7,  4,  2,  0, 0, (const uint8_t[]){0x3F}}, /* ึ */
+    { -4,   7,  4,  2,  0, 0, (const uint8_t[]){0x5F}}, /* ื */
+    { -2,  -2,  2,  2,  0, 0, (const uint8_t[]){0xD0}}, /* ุ */
+    { -3,  -2,  3,  2,  0, 0, (const uint8_t[]){0xEC}}, /* ู */
+    { -2,  -2,  2,  2,  0, 0, (const uint8_t[]){0xF0}}, /* ฺ */
+    {  1,  -1,  5,  9,  6, 0, (const uint8_t[]){0x27, 0xAB, 0x5F, 0x56, 0xBE, 0x20}}, /* ฿ */
+    {  2,   0,  2,  6,  6, 0, (const uint8_t[]){0xAA, 0xF0}}, /* เ */
+    {  1,   0,  5,  6,  6, 1, (const uint8_t[]){0x76, 0x5B}}, /* แ */
+    {  1,   0,  5,  8,  6, 0, (const uint8_t[]){0x7C, 0x3C, 0x21, 0x08, 0x63}}, /* โ */
+    {  1,   0,  5,  8,  6, 0, (const uint8_t[]){0x74, 0xAC, 0xE1, 0x08, 0x63}}, /* ใ */
+    {  1,   0,  5,  8,  6, 1, (const uint8_t[]){0x1D, 0xB2, 0x84, 0x30}}, /* ไ */
+    {  1,  -2,  5,  8,  6, 1, (const uint8_t[]){0x1F, 0x74, 0x42}}, /* ๅ */
+    {  1,  -2,  5,  8,  6, 0, (const uint8_t[]){0xEE, 0xC2, 0x10, 0x84, 0x44}}, /* ๆ */
+    { -4,   7,  4,  3,  0, 0, (const uint8_t[]){0xFC, 0xB0}}, /* ็ */
+    { -1,   9,  1,  2,  0, 0, (const uint8_t[]){0xC0}}, /* ่ */
+    { -4,   9,  4,  2,  0, 0, (const uint8_t[]){0xD6}}, /* ้ */
+    { -4,   9,  5,  2,  0, 0, (const uint8_t[]){0xAF, 0x80}}, /* ๊ */
+    { -3,   8,  3,  3,  0, 0, (const uint8_t[]){0x5D, 0x00}}, /* ๋ */
+    { -2,   9,  2,  2,  0, 0, (const uint8_t[]){0xE0}}, /* ์ */
+    { -2,   9,  2,  2,  0, 0, (const uint8_t[]){0xF0}}, /* ํ */
+    { -3,   7,  3,  3,  0, 0, (const uint8_t[]){0x7F, 0x00}}, /* ๎ */
+    {  1,   0,  5,  5,  6, 0, (const uint8_t[]){0x74, 0x6B, 0x17, 0x00}}, /* ๏ */
+    {  1,   0,  5,  5,  6, 1, (const uint8_t[]){0x33, 0xA2, 0xE0}}, /* ๐ */
+    {  1,   0,  5,  5,  6, 0, (const uint8_t[]){0x75, 0x7A, 0x17, 0x00}}, /* ๑ */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x49, 0x0A, 0xDE, 0x2E}}, /* ๒ */
+    {  1,   0,  5,  5,  6, 0, (const uint8_t[]){0x55, 0x63, 0x9C, 0x80}}, /* ๓ */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x44, 0x17, 0x42, 0xCF}}, /* ๔ */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x0B, 0x5D, 0x0B, 0x59, 0xE0}}, /* ๕ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x82, 0x8A, 0x16, 0xB8}}, /* ๖ */
+    {  1,   0,  5,  7,  6, 1, (const uint8_t[]){0x44, 0x1A, 0xF6, 0xBA}}, /* ๗ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0x0B, 0xA1, 0x3A, 0xEC}}, /* ๘ */
+    {  1,   0,  5,  7,  6, 0, (const uint8_t[]){0x08, 0x4C, 0xCA, 0x6B, 0x20}}, /* ๙ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xAF, 0x4A, 0x52, 0xA8}}, /* ๚ */
+    {  1,   0,  5,  6,  6, 0, (const uint8_t[]){0xC6, 0x2B, 0x6A, 0x20}}, /* ๛ */
 };
-const ILI9341_FontDef ILI9341_Font_Manop6x14 = { 0x20, 0xFB, 60, 12, 2, ILI9341_Font_Manop6x14_Glyphs };
+static const ILI9341_FontRangeDef ILI9341_Font_Manop6x14_Ranges[] = {{0x20, 0x7F, 0x00}, {0xA0, 0xA0, 0x60}, {0x0E01, 0x0E3A, 0x61}, {0x0E3F, 0x0E5B, 0x9B}};
+const ILI9341_FontDef ILI9341_Font_Manop6x14 = { ILI9341_Font_Manop6x14_Ranges, 4, 60, 12, 2, ILI9341_Font_Manop6x14_Glyphs, NULL, 0, NULL };
 
 static const ILI9341_GlyphDef ILI9341_Font_Manop7x18_Glyphs[] = {
-    {  0,   0,  0,  0,  7, NULL}, /*   */
-    {  2,   0,  3,  9,  7, (const uint8_t[]){0x49, 0x24, 0x87, 0x40}}, /* ! */
-    {  1,   6,  5,  4,  7, (const uint8_t[]){0xDA, 0x53, 0x20}}, /* " */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x24, 0x9F, 0xD2, 0x49, 0x2F, 0xE4, 0x90}}, /* # */
-    {  1,  -1,  6, 10,  7, (const uint8_t[]){0x11, 0xE9, 0x64, 0x50, 0xE9, 0x65, 0x78, 0x40}}, /* $ */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x66, 0x59, 0x9C, 0x20, 0xE6, 0x69, 0x98}}, /* % */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x31, 0x24, 0x8C, 0x66, 0x58, 0xA6, 0x64}}, /* & */
-    {  2,   6,  2,  4,  7, (const uint8_t[]){0xD6}}, /* ' */
-    {  3,  -1,  3, 11,  7, (const uint8_t[]){0x29, 0x49, 0x24, 0x48, 0x80}}, /* ( */
-    {  1,  -1,  3, 11,  7, (const uint8_t[]){0x89, 0x12, 0x49, 0x4A, 0x00}}, /* ) */
-    {  1,   1,  5,  7,  7, (const uint8_t[]){0x25, 0x5C, 0x47, 0x54, 0x80}}, /* * */
-    {  1,   1,  5,  7,  7, (const uint8_t[]){0x21, 0x09, 0xF2, 0x10, 0x80}}, /* + */
-    {  3,  -2,  2,  4,  7, (const uint8_t[]){0xD6}}, /* , */
-    {  1,   4,  5,  1,  7, (const uint8_t[]){0xF8}}, /* - */
-    {  3,   0,  2,  2,  7, (const uint8_t[]){0xF0}}, /* . */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x08, 0x44, 0x22, 0x21, 0x10, 0x80}}, /* / */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x31, 0x28, 0x61, 0x86, 0x18, 0x52, 0x30}}, /* 0 */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x23, 0x28, 0x42, 0x10, 0x84, 0xF8}}, /* 1 */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x7A, 0x18, 0x41, 0x18, 0x84, 0x20, 0xFC}}, /* 2 */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x7A, 0x18, 0x41, 0x38, 0x18, 0x61, 0x78}}, /* 3 */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x08, 0x62, 0x8A, 0x4A, 0x2F, 0xC2, 0x08}}, /* 4 */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0xFE, 0x08, 0x3E, 0x04, 0x10, 0x61, 0x78}}, /* 5 */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x7A, 0x18, 0x20, 0xFA, 0x18, 0x61, 0x78}}, /* 6 */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0xFC, 0x10, 0x82, 0x10, 0x42, 0x08, 0x20}}, /* 7 */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x7A, 0x18, 0x61, 0x7A, 0x18, 0x61, 0x78}}, /* 8 */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x7A, 0x18, 0x61, 0x7C, 0x18, 0x61, 0x78}}, /* 9 */
-    {  3,   0,  2,  7,  7, (const uint8_t[]){0xF0, 0x3C}}, /* : */
-    {  3,  -2,  2,  9,  7, (const uint8_t[]){0xF0, 0x35, 0x80}}, /* ; */
-    {  2,   0,  4,  7,  7, (const uint8_t[]){0x12, 0x48, 0x42, 0x10}}, /* < */
-    {  1,   2,  5,  4,  7, (const uint8_t[]){0xF8, 0x01, 0xF0}}, /* = */
-    {  2,   0,  4,  7,  7, (const uint8_t[]){0x84, 0x21, 0x24, 0x80}}, /* > */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x7A, 0x18, 0x42, 0x10, 0x40, 0x04, 0x10}}, /* ? */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x39, 0x19, 0xE9, 0xA6, 0x99, 0xD0, 0x3C}}, /* @ */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x31, 0x28, 0x61, 0xFE, 0x18, 0x61, 0x84}}, /* A */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0xF9, 0x14, 0x51, 0x79, 0x14, 0x51, 0xF8}}, /* B */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x7A, 0x18, 0x60, 0x82, 0x08, 0x61, 0x78}}, /* C */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0xF9, 0x14, 0x51, 0x45, 0x14, 0x51, 0xF8}}, /* D */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0xFE, 0x08, 0x20, 0xFA, 0x08, 0x20, 0xFC}}, /* E */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0xFE, 0x08, 0x20, 0xFA, 0x08, 0x20, 0x80}}, /* F */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x7A, 0x18, 0x20, 0x9E, 0x18, 0x63, 0x74}}, /* G */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x86, 0x18, 0x61, 0xFE, 0x18, 0x61, 0x84}}, /* H */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0xF9, 0x08, 0x42, 0x10, 0x84, 0xF8}}, /* I */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x1C, 0x20, 0x82, 0x08, 0x28, 0xA2, 0x70}}, /* J */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x86, 0x29, 0x28, 0xC2, 0x89, 0x22, 0x84}}, /* K */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0xFC}}, /* L */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x87, 0x3C, 0xED, 0xB6, 0x18, 0x61, 0x84}}, /* M */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0xC7, 0x1A, 0x69, 0x96, 0x58, 0xE3, 0x84}}, /* N */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x7A, 0x18, 0x61, 0x86, 0x18, 0x61, 0x78}}, /* O */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0xFA, 0x18, 0x61, 0xFA, 0x08, 0x20, 0x80}}, /* P */
-    {  1,  -2,  6, 11,  7, (const uint8_t[]){0x7A, 0x18, 0x61, 0x87, 0x99, 0x63, 0x78, 0x20, 0x40}}, /* Q */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0xFA, 0x18, 0x61, 0xFA, 0x48, 0xA1, 0x84}}, /* R */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x7A, 0x18, 0x18, 0x18, 0x18, 0x61, 0x78}}, /* S */
-    {  0,   0,  7,  9,  7, (const uint8_t[]){0xFE, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10}}, /* T */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x78}}, /* U */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x86, 0x18, 0x52, 0x49, 0x23, 0x0C, 0x30}}, /* V */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x86, 0x18, 0x61, 0xB6, 0xDC, 0xF3, 0x84}}, /* W */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x86, 0x14, 0x92, 0x31, 0x24, 0xA1, 0x84}}, /* X */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x8C, 0x63, 0x15, 0x10, 0x84, 0x20}}, /* Y */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0xFC, 0x10, 0x84, 0x21, 0x08, 0x20, 0xFC}}, /* Z */
-    {  3,  -1,  3, 11,  7, (const uint8_t[]){0xF2, 0x49, 0x24, 0x93, 0x80}}, /* [ */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x84, 0x10, 0x82, 0x08, 0x41, 0x08}}, /* \ */
-    {  1,  -1,  3, 11,  7, (const uint8_t[]){0xE4, 0x92, 0x49, 0x27, 0x80}}, /* ] */
-    {  1,   8,  6,  3,  7, (const uint8_t[]){0x31, 0x28, 0x40}}, /* ^ */
-    {  0,  -1,  7,  1,  7, (const uint8_t[]){0xFE}}, /* _ */
-    {  3,   6,  2,  4,  7, (const uint8_t[]){0xE9}}, /* ` */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x7A, 0x11, 0xD9, 0x86, 0x37, 0x40}}, /* a */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x82, 0x0B, 0xB1, 0x86, 0x18, 0x71, 0xB8}}, /* b */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x7A, 0x18, 0x20, 0x82, 0x17, 0x80}}, /* c */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x04, 0x17, 0x63, 0x86, 0x18, 0x63, 0x74}}, /* d */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x7A, 0x18, 0x7F, 0x82, 0x17, 0x80}}, /* e */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x19, 0x09, 0xF2, 0x10, 0x84, 0x20}}, /* f */
-    {  1,  -2,  6,  9,  7, (const uint8_t[]){0x76, 0x28, 0xA2, 0x71, 0x0B, 0xA1, 0x78}}, /* g */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x82, 0x0B, 0xB1, 0x86, 0x18, 0x61, 0x84}}, /* h */
-    {  1,   0,  5, 10,  7, (const uint8_t[]){0x21, 0x00, 0xC2, 0x10, 0x84, 0x27, 0xC0}}, /* i */
-    {  1,  -2,  5, 12,  7, (const uint8_t[]){0x08, 0x40, 0x30, 0x84, 0x21, 0x0C, 0x62, 0xE0}}, /* j */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x84, 0x23, 0x2A, 0x62, 0x92, 0x88}}, /* k */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x61, 0x08, 0x42, 0x10, 0x84, 0xF8}}, /* l */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xD5, 0x6B, 0x5A, 0xD6, 0x20}}, /* m */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0xBB, 0x18, 0x61, 0x86, 0x18, 0x40}}, /* n */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x7A, 0x18, 0x61, 0x86, 0x17, 0x80}}, /* o */
-    {  1,  -2,  6,  9,  7, (const uint8_t[]){0xBB, 0x18, 0x61, 0x87, 0x1B, 0xA0, 0x80}}, /* p */
-    {  1,  -2,  6,  9,  7, (const uint8_t[]){0x76, 0x38, 0x61, 0x86, 0x37, 0x41, 0x04}}, /* q */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0xBB, 0x18, 0x60, 0x82, 0x08, 0x00}}, /* r */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x7A, 0x18, 0x1E, 0x06, 0x17, 0x80}}, /* s */
-    {  1,   0,  6,  9,  7, (const uint8_t[]){0x20, 0x8F, 0x88, 0x20, 0x82, 0x09, 0x18}}, /* t */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x86, 0x18, 0x61, 0x86, 0x37, 0x40}}, /* u */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x8C, 0x62, 0xA5, 0x10, 0x80}}, /* v */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x8D, 0x6B, 0x5A, 0xD5, 0x40}}, /* w */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x8C, 0x54, 0x45, 0x46, 0x20}}, /* x */
-    {  1,  -2,  6,  9,  7, (const uint8_t[]){0x86, 0x18, 0x61, 0x8D, 0xD0, 0x41, 0x78}}, /* y */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0xFC, 0x21, 0x08, 0x42, 0x0F, 0xC0}}, /* z */
-    {  3,  -1,  3, 11,  7, (const uint8_t[]){0x72, 0x25, 0x12, 0x91, 0x80}}, /* { */
-    {  3,  -2,  1, 13,  7, (const uint8_t[]){0xFF, 0xF8}}, /* | */
-    {  1,  -1,  3, 11,  7, (const uint8_t[]){0xC4, 0xA4, 0x52, 0x27, 0x00}}, /* } */
-    {  1,   7,  6,  2,  7, (const uint8_t[]){0x66, 0x60}}, /* ~ */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /*   */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x74, 0x72, 0x94, 0xA5, 0x20}}, /* ก */
-    {  2,   0,  4,  7,  7, (const uint8_t[]){0xDD, 0x59, 0x99, 0x60}}, /* ข */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xAF, 0x4A, 0x94, 0xA4, 0xC0}}, /* ฃ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x74, 0x63, 0xDE, 0xE5, 0x20}}, /* ค */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x55, 0x63, 0xDE, 0xE5, 0x20}}, /* ฅ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xAF, 0x4A, 0x94, 0xF7, 0x40}}, /* ฆ */
-    {  1,   0,  4,  7,  7, (const uint8_t[]){0x33, 0x11, 0x95, 0x30}}, /* ง */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x74, 0x42, 0xD6, 0x94, 0xC0}}, /* จ */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x72, 0x20, 0xB2, 0xC9, 0x76, 0xC0}}, /* ฉ */
-    {  1,   0,  4,  9,  7, (const uint8_t[]){0x11, 0xDE, 0x59, 0x99, 0x60}}, /* ช */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x08, 0x6B, 0xE2, 0xA5, 0x29, 0x30}}, /* ซ */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x66, 0x55, 0x65, 0x97, 0xFD, 0x40}}, /* ฌ */
-    {  1,  -1,  6,  8,  7, (const uint8_t[]){0x66, 0x55, 0x65, 0x97, 0x7D, 0x07}}, /* ญ */
-    {  1,  -2,  5,  9,  7, (const uint8_t[]){0x74, 0x52, 0x94, 0xE7, 0x67, 0x48}}, /* ฎ */
-    {  1,  -2,  5,  9,  7, (const uint8_t[]){0x74, 0x52, 0x94, 0xE7, 0x75, 0x50}}, /* ฏ */
-    {  1,  -2,  5,  9,  7, (const uint8_t[]){0x7C, 0x1C, 0x16, 0xB4, 0x75, 0x58}}, /* ฐ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xAF, 0xCA, 0x94, 0xA5, 0x20}}, /* ฑ */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x56, 0xD9, 0x75, 0xD6, 0xFB, 0x40}}, /* ฒ */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x6A, 0xA6, 0xAA, 0xAA, 0xFE, 0xC0}}, /* ณ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x74, 0x63, 0xDE, 0xD5, 0x20}}, /* ด */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x55, 0x63, 0xDE, 0xD5, 0x20}}, /* ต */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x74, 0x72, 0x94, 0xB5, 0xA0}}, /* ถ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xD7, 0x52, 0x94, 0xA5, 0x20}}, /* ท */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x7C, 0x3C, 0x94, 0xA4, 0xC0}}, /* ธ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xD6, 0x95, 0x29, 0x5D, 0x60}}, /* น */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xCE, 0x52, 0x94, 0xA4, 0xC0}}, /* บ */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x08, 0x73, 0x94, 0xA5, 0x29, 0x30}}, /* ป */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xCE, 0x63, 0x5A, 0xD5, 0x40}}, /* ผ */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x08, 0x73, 0x98, 0xD6, 0xB5, 0x50}}, /* ฝ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xCE, 0x53, 0x5A, 0xD5, 0x60}}, /* พ */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x08, 0x73, 0x94, 0xD6, 0xB5, 0x50}}, /* ฟ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x74, 0x72, 0x94, 0xE7, 0x20}}, /* ภ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xCE, 0x52, 0x94, 0xF7, 0x40}}, /* ม */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xCE, 0x62, 0xD8, 0xC5, 0xC0}}, /* ย */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x7C, 0x3C, 0x10, 0x8C, 0x60}}, /* ร */
-    {  1,  -2,  5,  9,  7, (const uint8_t[]){0x74, 0x72, 0x94, 0xB5, 0xA1, 0x08}}, /* ฤ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x74, 0x42, 0xD9, 0xE7, 0x20}}, /* ล */
-    {  1,  -2,  5,  9,  7, (const uint8_t[]){0x74, 0x72, 0x94, 0xE7, 0x21, 0x08}}, /* ฦ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x74, 0x42, 0x10, 0x8C, 0x60}}, /* ว */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x08, 0x5D, 0x18, 0xF7, 0xB9, 0x48}}, /* ศ */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0xCB, 0x25, 0x97, 0x49, 0x23, 0x00}}, /* ษ */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x08, 0x5D, 0x10, 0xB6, 0x79, 0xC8}}, /* ส */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xDE, 0xD4, 0xD4, 0xA5, 0x20}}, /* ห */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x08, 0x75, 0x94, 0xD6, 0xB5, 0x50}}, /* ฬ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x74, 0x43, 0x9C, 0xC5, 0xC0}}, /* อ */
-    {  1,   0,  5,  9,  7, (const uint8_t[]){0x08, 0x5D, 0xD0, 0xE7, 0x31, 0x70}}, /* ฮ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0xDF, 0x42, 0x10, 0x84, 0x40}}, /* ฯ */
-    {  2,   1,  4,  5,  7, (const uint8_t[]){0xDE, 0x0D, 0xE0}}, /* ะ */
-    { -5,   8,  5,  2,  0, (const uint8_t[]){0xCF, 0x80}}, /* ั */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x74, 0x42, 0x10, 0x84, 0x20}}, /* า */
-    {  0,   0,  6,  9,  7, (const uint8_t[]){0xC3, 0x01, 0x89, 0x04, 0x10, 0x41, 0x04}}, /* ำ */
-    { -6,   8,  5,  1,  0, (const uint8_t[]){0xF8}}, /* ิ */
-    { -6,   8,  5,  2,  0, (const uint8_t[]){0x0F, 0xC0}}, /* ี */
-    { -6,   8,  5,  2,  0, (const uint8_t[]){0x1F, 0xC0}}, /* ึ */
-    { -6,   8,  5,  2,  0, (const uint8_t[]){0x2F, 0xC0}}, /* ื */
-    { -3,  -3,  2,  2,  0, (const uint8_t[]){0xD0}}, /* ุ */
-    { -4,  -3,  3,  2,  0, (const uint8_t[]){0xEC}}, /* ู */
-    { -3,  -3,  2,  2,  0, (const uint8_t[]){0xF0}}, /* ฺ */
-    { -5,   8,  5,  6,  0, (const uint8_t[]){0xC2, 0x7C, 0x0C, 0xF8}}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  0,   0,  0,  0,  7, NULL}, /* � */
-    {  1,  -1,  6,  9,  7, (const uint8_t[]){0x33, 0xEB, 0x6D, 0xFA, 0xDB, 0x7E, 0x30}}, /* ฿ */
-    {  3,   0,  2,  7,  7, (const uint8_t[]){0xAA, 0xBC}}, /* เ */
-    {  1,   0,  5,  7,  7, (const uint8_t[]){0x94, 0xA5, 0x29, 0x6F, 0x60}}, /* แ */
-    {  1,   0,  5, 10,  7, (const uint8_t[]){0x7C, 0x3C, 0x21, 0x08, 0x42, 0x18, 0xC0}}, /* โ */
-    {  1,   0,  5, 10,  7, (const uint8_t[]){0x74, 0xAC, 0xE1, 0x08, 0x42, 0x18, 0xC0}}, /* ใ */
-    {  1,   0,  5, 10,  7, (const uint8_t[]){0xB2, 0x84, 0x21, 0x08, 0x42, 0x18, 0xC0}}, /* ไ */
-    {  1,  -2,  5,  9,  7, (const uint8_t[]){0x74, 0x42, 0x10, 0x84, 0x21, 0x08}}, /* ๅ */
-    {  1,  -2,  5,  9,  7, (const uint8_t[]){0xEE, 0xC2, 0x10, 0x84, 0x22, 0x20}}, /* ๆ */
-    { -6,   8,  6,  3,  0, (const uint8_t[]){0x7E, 0xA5, 0x80}}, /* ็ */
-    { -2,  11,  1,  3,  0, (const uint8_t[]){0xE0}}, /* ่ */
-    { -5,  11,  5,  3,  0, (const uint8_t[]){0xC2, 0x7C}}, /* ้ */
-    { -6,  11,  6,  3,  0, (const uint8_t[]){0x52, 0xDD, 0x80}}, /* ๊ */
-    { -3,  11,  3,  3,  0, (const uint8_t[]){0x5D, 0x00}}, /* ๋ */
-    { -3,  11,  3,  3,  0, (const uint8_t[]){0x73, 0x00}}, /* ์ */
-    { -3,  11,  2,  2,  0, (const uint8_t[]){0xF0}}, /* ํ */
-    { -4,   8,  4,  3,  0, (const uint8_t[]){0x7E, 0xC0}}, /* ๎ */
-    {  1,   0,  6,  6,  7, (const uint8_t[]){0x7A, 0x1B, 0x6D, 0x85, 0xE0}}, /* ๏ */
-    {  1,   0,  6,  6,  7, (const uint8_t[]){0x7A, 0x18, 0x61, 0x85, 0xE0}}, /* ๐ */
-    {  1,   0,  6,  6,  7, (const uint8_t[]){0x7A, 0x1B, 0x5D, 0x05, 0xE0}}, /* ๑ */
-    {  1,   0,  6,  8,  7, (const uint8_t[]){0x82, 0x09, 0x6B, 0xB6, 0xD8, 0x5F}}, /* ๒ */
-    {  1,   0,  6,  6,  7, (const uint8_t[]){0x6A, 0x59, 0x65, 0xC7, 0x10}}, /* ๓ */
-    {  1,   0,  6,  8,  7, (const uint8_t[]){0x04, 0x17, 0xA0, 0x9A, 0x69, 0x1F}}, /* ๔ */
-    {  1,   0,  6,  8,  7, (const uint8_t[]){0x04, 0xD7, 0xA0, 0x9A, 0x69, 0x1F}}, /* ๕ */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x81, 0x62, 0x41, 0x65, 0x97, 0x80}}, /* ๖ */
-    {  1,   0,  6,  8,  7, (const uint8_t[]){0x04, 0x15, 0x6D, 0x96, 0x5D, 0x76}}, /* ๗ */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0x0D, 0xC8, 0x20, 0x9A, 0xAD, 0x80}}, /* ๘ */
-    {  1,   0,  6,  8,  7, (const uint8_t[]){0x04, 0x13, 0x5A, 0xA2, 0x4D, 0x32}}, /* ๙ */
-    {  1,   0,  6,  8,  7, (const uint8_t[]){0xD7, 0xD1, 0x45, 0x14, 0x51, 0x4A}}, /* ๚ */
-    {  1,   0,  6,  7,  7, (const uint8_t[]){0xC3, 0x0A, 0x2B, 0xB2, 0x84, 0x00}}, /* ๛ */
+    {  0,   0,  0,  0,  7, 0, NULL}, /*   */
+    {  2,   0,  3,  9,  7, 1, (const uint8_t[]){0x7C, 0x21, 0xD0}}, /* ! */
+    {  1,   6,  5,  4,  7, 0, (const uint8_t[]){0xDA, 0x53, 0x20}}, /* " */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x4C, 0x93, 0xFA, 0x5F, 0xC8}}, /* # */
+    {  1,  -1,  6, 10,  7, 0, (const uint8_t[]){0x11, 0xE9, 0x64, 0x50, 0xE9, 0x65, 0x78, 0x40}}, /* $ */
+    {  1,   0,  6,  9,  7, 0, (const uint8_t[]){0x66, 0x59, 0x9C, 0x20, 0xE6, 0x69, 0x98}}, /* % */
+    {  1,   0,  6,  9,  7, 0, (const uint8_t[]){0x31, 0x24, 0x8C, 0x66, 0x58, 0xA6, 0x64}}, /* & */
+    {  2,   6,  2,  4,  7, 0, (const uint8_t[]){0xD6}}, /* ' */
+    {  3,  -1,  3, 11,  7, 1, (const uint8_t[]){0x2F, 0x45, 0x44, 0x40}}, /* ( */
+    {  1,  -1,  3, 11,  7, 1, (const uint8_t[]){0x2F, 0x51, 0x15, 0x00}}, /* ) */
+    {  1,   1,  5,  7,  7, 0, (const uint8_t[]){0x25, 0x5C, 0x47, 0x54, 0x80}}, /* * */
+    {  1,   1,  5,  7,  7, 1, (const uint8_t[]){0x66, 0x4F, 0x90}}, /* + */
+    {  3,  -2,  2,  4,  7, 0, (const uint8_t[]){0xD6}}, /* , */
+    {  1,   4,  5,  1,  7, 0, (const uint8_t[]){0xF8}}, /* - */
+    {  3,   0,  2,  2,  7, 0, (const uint8_t[]){0xF0}}, /* . */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x52, 0x84, 0x44, 0x44, 0x00}}, /* / */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x1E, 0x18, 0x94, 0x29, 0x18}}, /* 0 */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x0F, 0x11, 0x94, 0x27, 0xC0}}, /* 1 */
+    {  1,   0,  6,  9,  7, 0, (const uint8_t[]){0x7A, 0x18, 0x41, 0x18, 0x84, 0x20, 0xFC}}, /* 2 */
+    {  1,   0,  6,  9,  7, 0, (const uint8_t[]){0x7A, 0x18, 0x41, 0x38, 0x18, 0x61, 0x78}}, /* 3 */
+    {  1,   0,  6,  9,  7, 0, (const uint8_t[]){0x08, 0x62, 0x8A, 0x4A, 0x2F, 0xC2, 0x08}}, /* 4 */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x26, 0x7F, 0x07, 0xC0, 0xC2, 0xF0}}, /* 5 */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x13, 0x3D, 0x0C, 0x1F, 0x42, 0xF0}}, /* 6 */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x15, 0xFE, 0x08, 0x42, 0x10}}, /* 7 */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x33, 0x3D, 0x0B, 0xD0, 0xBC}}, /* 8 */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x31, 0x3D, 0x0B, 0xE0, 0xC2, 0xF0}}, /* 9 */
+    {  3,   0,  2,  7,  7, 0, (const uint8_t[]){0xF0, 0x3C}}, /* : */
+    {  3,  -2,  2,  9,  7, 0, (const uint8_t[]){0xF0, 0x35, 0x80}}, /* ; */
+    {  2,   0,  4,  7,  7, 0, (const uint8_t[]){0x12, 0x48, 0x42, 0x10}}, /* < */
+    {  1,   2,  5,  4,  7, 0, (const uint8_t[]){0xF8, 0x01, 0xF0}}, /* = */
+    {  2,   0,  4,  7,  7, 0, (const uint8_t[]){0x84, 0x21, 0x24, 0x80}}, /* > */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x24, 0xBD, 0x08, 0x42, 0x00, 0x20}}, /* ? */
+    {  1,   0,  6,  9,  7, 0, (const uint8_t[]){0x39, 0x19, 0xE9, 0xA6, 0x99, 0xD0, 0x3C}}, /* @ */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x13, 0x98, 0x94, 0x3F, 0xC2}}, /* A */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x33, 0x7C, 0x8B, 0xC8, 0xFC}}, /* B */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x2D, 0x3D, 0x0C, 0x10, 0xBC}}, /* C */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x3F, 0x7C, 0x8F, 0xC0}}, /* D */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x33, 0x7F, 0x07, 0xD0, 0x7E}}, /* E */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x33, 0xFF, 0x07, 0xD0, 0x00}}, /* F */
+    {  1,   0,  6,  9,  7, 0, (const uint8_t[]){0x7A, 0x18, 0x20, 0x9E, 0x18, 0x63, 0x74}}, /* G */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x73, 0xC3, 0xFC, 0x20}}, /* H */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x3F, 0x7C, 0x9F}}, /* I */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x3D, 0x0E, 0x14, 0x4E, 0x00}}, /* J */
+    {  1,   0,  6,  9,  7, 0, (const uint8_t[]){0x86, 0x29, 0x28, 0xC2, 0x89, 0x22, 0x84}}, /* K */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x7F, 0x41, 0xF8}}, /* L */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x2B, 0xC3, 0x9D, 0xB0, 0x80}}, /* M */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x55, 0x63, 0x4C, 0xB1, 0xC2}}, /* N */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x3F, 0x3D, 0x0B, 0xC0}}, /* O */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x33, 0xFD, 0x0F, 0xD0, 0x00}}, /* P */
+    {  1,  -2,  6, 11,  7, 1, (const uint8_t[]){0x38, 0x0F, 0x43, 0xCC, 0xB1, 0xBC, 0x10, 0x20}}, /* Q */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x30, 0xFD, 0x0F, 0xD2, 0x45, 0x08}}, /* R */
+    {  1,   0,  6,  9,  7, 0, (const uint8_t[]){0x7A, 0x18, 0x18, 0x18, 0x18, 0x61, 0x78}}, /* S */
+    {  0,   0,  7,  9,  7, 1, (const uint8_t[]){0x3F, 0xFF, 0x10}}, /* T */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x7F, 0x42, 0xF0}}, /* U */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x6D, 0xC2, 0x91, 0x80}}, /* V */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x75, 0x43, 0x6E, 0x70, 0x80}}, /* W */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x52, 0xC2, 0x91, 0x89, 0x42}}, /* X */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x73, 0xC5, 0x44}}, /* Y */
+    {  1,   0,  6,  9,  7, 0, (const uint8_t[]){0xFC, 0x10, 0x84, 0x21, 0x08, 0x20, 0xFC}}, /* Z */
+    {  3,  -1,  3, 11,  7, 1, (const uint8_t[]){0x3F, 0xDE, 0x70}}, /* [ */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x52, 0xC1, 0x04, 0x10, 0x40}}, /* \ */
+    {  1,  -1,  3, 11,  7, 1, (const uint8_t[]){0x3F, 0xDC, 0xF0}}, /* ] */
+    {  1,   8,  6,  3,  7, 0, (const uint8_t[]){0x31, 0x28, 0x40}}, /* ^ */
+    {  0,  -1,  7,  1,  7, 0, (const uint8_t[]){0xFE}}, /* _ */
+    {  3,   6,  2,  4,  7, 0, (const uint8_t[]){0xE9}}, /* ` */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0x7A, 0x11, 0xD9, 0x86, 0x37, 0x40}}, /* a */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x46, 0x41, 0x76, 0x30, 0xE3, 0x70}}, /* b */
+    {  1,   0,  6,  7,  7, 1, (const uint8_t[]){0x18, 0xF4, 0x30, 0x42, 0xF0}}, /* c */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x46, 0x02, 0xEC, 0x70, 0xC6, 0xE8}}, /* d */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0x7A, 0x18, 0x7F, 0x82, 0x17, 0x80}}, /* e */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x27, 0x8C, 0x9F, 0x20}}, /* f */
+    {  1,  -2,  6,  9,  7, 0, (const uint8_t[]){0x76, 0x28, 0xA2, 0x71, 0x0B, 0xA1, 0x78}}, /* g */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x47, 0xC1, 0x76, 0x30, 0x80}}, /* h */
+    {  1,   0,  5, 10,  7, 1, (const uint8_t[]){0x47, 0x88, 0x06, 0x13, 0xE0}}, /* i */
+    {  1,  -2,  5, 12,  7, 1, (const uint8_t[]){0x47, 0xA0, 0x80, 0x61, 0x8B, 0x80}}, /* j */
+    {  1,   0,  5,  9,  7, 0, (const uint8_t[]){0x84, 0x23, 0x2A, 0x62, 0x92, 0x88}}, /* k */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x3F, 0x30, 0x9F}}, /* l */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x3D, 0xAA, 0xC4}}, /* m */
+    {  1,   0,  6,  7,  7, 1, (const uint8_t[]){0x1F, 0x76, 0x30, 0x80}}, /* n */
+    {  1,   0,  6,  7,  7, 1, (const uint8_t[]){0x3C, 0xF4, 0x2F, 0x00}}, /* o */
+    {  1,  -2,  6,  9,  7, 1, (const uint8_t[]){0x18, 0xDD, 0x8C, 0x38, 0xDD, 0x00}}, /* p */
+    {  1,  -2,  6,  9,  7, 1, (const uint8_t[]){0x18, 0xBB, 0x1C, 0x31, 0xBA, 0x08}}, /* q */
+    {  1,   0,  6,  7,  7, 1, (const uint8_t[]){0x0F, 0x76, 0x30, 0xC0}}, /* r */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0x7A, 0x18, 0x1E, 0x06, 0x17, 0x80}}, /* s */
+    {  1,   0,  6,  9,  7, 1, (const uint8_t[]){0x4E, 0x11, 0xF1, 0x04, 0x8C}}, /* t */
+    {  1,   0,  6,  7,  7, 1, (const uint8_t[]){0x79, 0x0C, 0x6E, 0x80}}, /* u */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x6B, 0x15, 0x10}}, /* v */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x3D, 0x1A, 0xA8}}, /* w */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x43, 0x15, 0x11, 0x51}}, /* x */
+    {  1,  -2,  6,  9,  7, 1, (const uint8_t[]){0x71, 0x43, 0x1B, 0xA0, 0xBC}}, /* y */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0xFC, 0x21, 0x08, 0x42, 0x0F, 0xC0}}, /* z */
+    {  3,  -1,  3, 11,  7, 1, (const uint8_t[]){0x29, 0x4E, 0x28, 0xA3}}, /* { */
+    {  3,  -2,  1, 13,  7, 0, (const uint8_t[]){0xFF, 0xF8}}, /* | */
+    {  1,  -1,  3, 11,  7, 1, (const uint8_t[]){0x29, 0x58, 0xA2, 0x8E}}, /* } */
+    {  1,   7,  6,  2,  7, 0, (const uint8_t[]){0x66, 0x60}}, /* ~ */
+    {  0,   0,  0,  0,  7, 0, NULL}, /* � */
+    {  0,   0,  0,  0,  7, 0, NULL}, /*   */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x0E, 0xE8, 0xE5, 0x20}}, /* ก */
+    {  2,   0,  4,  7,  7, 1, (const uint8_t[]){0x4D, 0xAB, 0x2C}}, /* ข */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x0D, 0x5E, 0x95, 0x26}}, /* ฃ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x28, 0xE8, 0xF7, 0x29}}, /* ค */
+    {  1,   0,  5,  7,  7, 0, (const uint8_t[]){0x55, 0x63, 0xDE, 0xE5, 0x20}}, /* ฅ */
+    {  1,   0,  5,  7,  7, 0, (const uint8_t[]){0xAF, 0x4A, 0x94, 0xF7, 0x40}}, /* ฆ */
+    {  1,   0,  4,  7,  7, 0, (const uint8_t[]){0x33, 0x11, 0x95, 0x30}}, /* ง */
+    {  1,   0,  5,  7,  7, 0, (const uint8_t[]){0x74, 0x42, 0xD6, 0x94, 0xC0}}, /* จ */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0x72, 0x20, 0xB2, 0xC9, 0x76, 0xC0}}, /* ฉ */
+    {  1,   0,  4,  9,  7, 0, (const uint8_t[]){0x11, 0xDE, 0x59, 0x99, 0x60}}, /* ช */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x43, 0x06, 0xBE, 0x2A, 0x4C}}, /* ซ */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0x66, 0x55, 0x65, 0x97, 0xFD, 0x40}}, /* ฌ */
+    {  1,  -1,  6,  8,  7, 0, (const uint8_t[]){0x66, 0x55, 0x65, 0x97, 0x7D, 0x07}}, /* ญ */
+    {  1,  -2,  5,  9,  7, 0, (const uint8_t[]){0x74, 0x52, 0x94, 0xE7, 0x67, 0x48}}, /* ฎ */
+    {  1,  -2,  5,  9,  7, 0, (const uint8_t[]){0x74, 0x52, 0x94, 0xE7, 0x75, 0x50}}, /* ฏ */
+    {  1,  -2,  5,  9,  7, 0, (const uint8_t[]){0x7C, 0x1C, 0x16, 0xB4, 0x75, 0x58}}, /* ฐ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x0F, 0x5F, 0x95, 0x20}}, /* ฑ */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0x56, 0xD9, 0x75, 0xD6, 0xFB, 0x40}}, /* ฒ */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0x6A, 0xA6, 0xAA, 0xAA, 0xFE, 0xC0}}, /* ณ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x28, 0xE8, 0xF6, 0xA9}}, /* ด */
+    {  1,   0,  5,  7,  7, 0, (const uint8_t[]){0x55, 0x63, 0xDE, 0xD5, 0x20}}, /* ต */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x0A, 0xE8, 0xE5, 0x2D}}, /* ถ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x1F, 0xAE, 0xA4}}, /* ท */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x0C, 0xF8, 0x79, 0x26}}, /* ธ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x49, 0xA5, 0x4A, 0xEB}}, /* น */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x5D, 0x94, 0x98}}, /* บ */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x57, 0x07, 0x29, 0x30}}, /* ป */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x4D, 0x98, 0xD5, 0x40}}, /* ผ */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x53, 0x07, 0x31, 0xAA, 0x80}}, /* ฝ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x4D, 0x94, 0xD5, 0x60}}, /* พ */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x53, 0x07, 0x29, 0xAA, 0x80}}, /* ฟ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x0A, 0xE8, 0xE5, 0x39}}, /* ภ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x59, 0x94, 0xF7, 0x40}}, /* ม */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x45, 0x98, 0xB6, 0x2E}}, /* ย */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x0A, 0xF8, 0x78, 0x23}}, /* ร */
+    {  1,  -2,  5,  9,  7, 1, (const uint8_t[]){0x0A, 0xBA, 0x39, 0x4B, 0x42}}, /* ฤ */
+    {  1,   0,  5,  7,  7, 0, (const uint8_t[]){0x74, 0x42, 0xD9, 0xE7, 0x20}}, /* ล */
+    {  1,  -2,  5,  9,  7, 1, (const uint8_t[]){0x0A, 0xBA, 0x39, 0x4E, 0x42}}, /* ฦ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x1A, 0xE8, 0x84, 0x60}}, /* ว */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x4A, 0x05, 0xD1, 0xEE, 0x52}}, /* ศ */
+    {  1,   0,  6,  7,  7, 1, (const uint8_t[]){0x45, 0x92, 0xCB, 0xA4, 0x60}}, /* ษ */
+    {  1,   0,  5,  9,  7, 0, (const uint8_t[]){0x08, 0x5D, 0x10, 0xB6, 0x79, 0xC8}}, /* ส */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x47, 0xB5, 0x35, 0x20}}, /* ห */
+    {  1,   0,  5,  9,  7, 1, (const uint8_t[]){0x43, 0x07, 0x59, 0x4D, 0x54}}, /* ฬ */
+    {  1,   0,  5,  7,  7, 0, (const uint8_t[]){0x74, 0x43, 0x9C, 0xC5, 0xC0}}, /* อ */
+    {  1,   0,  5,  9,  7, 0, (const uint8_t[]){0x08, 0x5D, 0xD0, 0xE7, 0x31, 0x70}}, /* ฮ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x1D, 0xBE, 0x84, 0x40}}, /* ฯ */
+    {  2,   1,  4,  5,  7, 0, (const uint8_t[]){0xDE, 0x0D, 0xE0}}, /* ะ */
+    { -5,   8,  5,  2,  0, 0, (const uint8_t[]){0xCF, 0x80}}, /* ั */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x1E, 0xE8, 0x84}}, /* า */
+    {  0,   0,  6,  9,  7, 1, (const uint8_t[]){0x47, 0xE0, 0x31, 0x20, 0x80}}, /* ำ */
+    { -6,   8,  5,  1,  0, 0, (const uint8_t[]){0xF8}}, /* ิ */
+    { -6,   8,  5,  2,  0, 0, (const uint8_t[]){0x0F, 0xC0}}, /* ี */
+    { -6,   8,  5,  2,  0, 0, (const uint8_t[]){0x1F, 0xC0}}, /* ึ */
+    { -6,   8,  5,  2,  0, 0, (const uint8_t[]){0x2F, 0xC0}}, /* ื */
+    { -3,  -3,  2,  2,  0, 0, (const uint8_t[]){0xD0}}, /* ุ */
+    { -4,  -3,  3,  2,  0, 0, (const uint8_t[]){0xEC}}, /* ู */
+    { -3,  -3,  2,  2,  0, 0, (const uint8_t[]){0xF0}}, /* ฺ */
+    {  1,  -1,  6,  9,  7, 0, (const uint8_t[]){0x33, 0xEB, 0x6D, 0xFA, 0xDB, 0x7E, 0x30}}, /* ฿ */
+    {  3,   0,  2,  7,  7, 0, (const uint8_t[]){0xAA, 0xBC}}, /* เ */
+    {  1,   0,  5,  7,  7, 1, (const uint8_t[]){0x7B, 0x2D, 0x80}}, /* แ */
+    {  1,   0,  5, 10,  7, 1, (const uint8_t[]){0x0F, 0x5F, 0x0F, 0x08, 0x60}}, /* โ */
+    {  1,   0,  5, 10,  7, 1, (const uint8_t[]){0x07, 0x5D, 0x2B, 0x38, 0x43}}, /* ใ */
+    {  1,   0,  5, 10,  7, 1, (const uint8_t[]){0x1F, 0x6C, 0xA1, 0x0C}}, /* ไ */
+    {  1,  -2,  5,  9,  7, 1, (const uint8_t[]){0x1F, 0xBA, 0x21}}, /* ๅ */
+    {  1,  -2,  5,  9,  7, 1, (const uint8_t[]){0x1E, 0x77, 0x61, 0x11, 0x00}}, /* ๆ */
+    { -6,   8,  6,  3,  0, 0, (const uint8_t[]){0x7E, 0xA5, 0x80}}, /* ็ */
+    { -2,  11,  1,  3,  0, 0, (const uint8_t[]){0xE0}}, /* ่ */
+    { -5,  11,  5,  3,  0, 0, (const uint8_t[]){0xC2, 0x7C}}, /* ้ */
+    { -6,  11,  6,  3,  0, 0, (const uint8_t[]){0x52, 0xDD, 0x80}}, /* ๊ */
+    { -3,  11,  3,  3,  0, 0, (const uint8_t[]){0x5D, 0x00}}, /* ๋ */
+    { -3,  11,  3,  3,  0, 0, (const uint8_t[]){0x73, 0x00}}, /* ์ */
+    { -3,  11,  2,  2,  0, 0, (const uint8_t[]){0xF0}}, /* ํ */
+    { -4,   8,  4,  3,  0, 0, (const uint8_t[]){0x7E, 0xC0}}, /* ๎ */
+    {  1,   0,  6,  6,  7, 0, (const uint8_t[]){0x7A, 0x1B, 0x6D, 0x85, 0xE0}}, /* ๏ */
+    {  1,   0,  6,  6,  7, 1, (const uint8_t[]){0x39, 0xE8, 0x5E}}, /* ๐ */
+    {  1,   0,  6,  6,  7, 0, (const uint8_t[]){0x7A, 0x1B, 0x5D, 0x05, 0xE0}}, /* ๑ */
+    {  1,   0,  6,  8,  7, 0, (const uint8_t[]){0x82, 0x09, 0x6B, 0xB6, 0xD8, 0x5F}}, /* ๒ */
+    {  1,   0,  6,  6,  7, 1, (const uint8_t[]){0x35, 0xA9, 0x71}}, /* ๓ */
+    {  1,   0,  6,  8,  7, 0, (const uint8_t[]){0x04, 0x17, 0xA0, 0x9A, 0x69, 0x1F}}, /* ๔ */
+    {  1,   0,  6,  8,  7, 0, (const uint8_t[]){0x04, 0xD7, 0xA0, 0x9A, 0x69, 0x1F}}, /* ๕ */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0x81, 0x62, 0x41, 0x65, 0x97, 0x80}}, /* ๖ */
+    {  1,   0,  6,  8,  7, 0, (const uint8_t[]){0x04, 0x15, 0x6D, 0x96, 0x5D, 0x76}}, /* ๗ */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0x0D, 0xC8, 0x20, 0x9A, 0xAD, 0x80}}, /* ๘ */
+    {  1,   0,  6,  8,  7, 0, (const uint8_t[]){0x04, 0x13, 0x5A, 0xA2, 0x4D, 0x32}}, /* ๙ */
+    {  1,   0,  6,  8,  7, 1, (const uint8_t[]){0x1E, 0xD7, 0xD1, 0x4A}}, /* ๚ */
+    {  1,   0,  6,  7,  7, 0, (const uint8_t[]){0xC3, 0x0A, 0x2B, 0xB2, 0x84, 0x00}}, /* ๛ */
 };
-const ILI9341_FontDef ILI9341_Font_Manop7x18 = { 0x20, 0xFB, 70, 15, 3, ILI9341_Font_Manop7x18_Glyphs };
+static const ILI9341_FontRangeDef ILI9341_Font_Manop7x18_Ranges[] = {{0x20, 0x7F, 0x00}, {0xA0, 0xA0, 0x60}, {0x0E01, 0x0E3A, 0x61}, {0x0E3F, 0x0E5B, 0x9B}};
+const ILI9341_FontDef ILI9341_Font_Manop7x18 = { ILI9341_Font_Manop7x18_Ranges, 4, 70, 15, 3, ILI9341_Font_Manop7x18_Glyphs, NULL, 0, NULL };
 
 static const ILI9341_GlyphDef ILI9341_Font_Manop8x20_Glyphs[] = {
-    {  0,   0,  0,  0,  8, NULL}, /*   */
-    {  4,   0,  1, 10,  8, (const uint8_t[]){0xFE, 0xC0}}, /* ! */
-    {  1,   8,  6,  4,  8, (const uint8_t[]){0xCD, 0x14, 0x62}}, /* " */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x24, 0x92, 0x7F, 0x49, 0x2F, 0xE4, 0x92, 0x40}}, /* # */
-    {  1,   0,  7, 10,  8, (const uint8_t[]){0x10, 0xFA, 0x4C, 0x87, 0x03, 0x84, 0xC9, 0x7C, 0x20}}, /* $ */
-    {  1,   0,  7, 10,  8, (const uint8_t[]){0x63, 0x2A, 0x53, 0x41, 0x02, 0x0B, 0x29, 0x53, 0x18}}, /* % */
-    {  1,   0,  7, 10,  8, (const uint8_t[]){0x38, 0x89, 0x12, 0x23, 0x8E, 0x62, 0xC2, 0x8C, 0xE4}}, /* & */
-    {  3,   8,  2,  4,  8, (const uint8_t[]){0xD6}}, /* ' */
-    {  3,  -1,  3, 12,  8, (const uint8_t[]){0x29, 0x49, 0x24, 0x89, 0x10}}, /* ( */
-    {  2,  -1,  3, 12,  8, (const uint8_t[]){0x89, 0x12, 0x49, 0x29, 0x40}}, /* ) */
-    {  1,   1,  7,  7,  8, (const uint8_t[]){0x11, 0x25, 0x51, 0xC5, 0x52, 0x44, 0x00}}, /* * */
-    {  1,   1,  7,  7,  8, (const uint8_t[]){0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00}}, /* + */
-    {  3,  -2,  2,  4,  8, (const uint8_t[]){0xD6}}, /* , */
-    {  1,   4,  6,  1,  8, (const uint8_t[]){0xFC}}, /* - */
-    {  3,   0,  2,  2,  8, (const uint8_t[]){0xF0}}, /* . */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x04, 0x10, 0x84, 0x10, 0x82, 0x10, 0x82, 0x00}}, /* / */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x31, 0x28, 0x61, 0x86, 0x18, 0x61, 0x48, 0xC0}}, /* 0 */
-    {  2,   0,  5, 10,  8, (const uint8_t[]){0x23, 0x28, 0x42, 0x10, 0x84, 0x27, 0xC0}}, /* 1 */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x7A, 0x18, 0x41, 0x18, 0x84, 0x20, 0x83, 0xF0}}, /* 2 */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x7A, 0x18, 0x41, 0x38, 0x10, 0x61, 0x85, 0xE0}}, /* 3 */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x08, 0x62, 0x92, 0x8A, 0x2F, 0xC2, 0x08, 0x20}}, /* 4 */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xFE, 0x08, 0x20, 0xF8, 0x10, 0x41, 0x85, 0xE0}}, /* 5 */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x39, 0x08, 0x20, 0xFA, 0x18, 0x61, 0x85, 0xE0}}, /* 6 */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xFC, 0x10, 0x42, 0x08, 0x21, 0x04, 0x10, 0x40}}, /* 7 */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x7A, 0x18, 0x61, 0x7A, 0x18, 0x61, 0x85, 0xE0}}, /* 8 */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x7A, 0x18, 0x61, 0x7C, 0x10, 0x41, 0x09, 0xC0}}, /* 9 */
-    {  3,   1,  2,  7,  8, (const uint8_t[]){0xF0, 0x3C}}, /* : */
-    {  3,  -1,  2,  9,  8, (const uint8_t[]){0xF0, 0x35, 0x80}}, /* ; */
-    {  2,   0,  5,  9,  8, (const uint8_t[]){0x08, 0x88, 0x88, 0x20, 0x82, 0x08}}, /* < */
-    {  1,   2,  6,  5,  8, (const uint8_t[]){0xFC, 0x00, 0x00, 0xFC}}, /* = */
-    {  1,   0,  5,  9,  8, (const uint8_t[]){0x82, 0x08, 0x20, 0x88, 0x88, 0x80}}, /* > */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x7A, 0x18, 0x41, 0x08, 0x41, 0x00, 0x10, 0x40}}, /* ? */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x39, 0x19, 0x6B, 0xA6, 0x9A, 0x67, 0x40, 0xF0}}, /* @ */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x31, 0x24, 0xA1, 0x87, 0xF8, 0x61, 0x86, 0x10}}, /* A */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xFA, 0x18, 0x61, 0xFA, 0x18, 0x61, 0x87, 0xE0}}, /* B */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x7A, 0x18, 0x60, 0x82, 0x08, 0x21, 0x85, 0xE0}}, /* C */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xF2, 0x28, 0x61, 0x86, 0x18, 0x61, 0x8B, 0xC0}}, /* D */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xFE, 0x08, 0x20, 0xFA, 0x08, 0x20, 0x83, 0xF0}}, /* E */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xFE, 0x08, 0x20, 0xFA, 0x08, 0x20, 0x82, 0x00}}, /* F */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x7A, 0x18, 0x60, 0x82, 0x78, 0x61, 0x8D, 0xD0}}, /* G */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x86, 0x18, 0x61, 0xFE, 0x18, 0x61, 0x86, 0x10}}, /* H */
-    {  2,   0,  5, 10,  8, (const uint8_t[]){0xF9, 0x08, 0x42, 0x10, 0x84, 0x27, 0xC0}}, /* I */
-    {  1,   0,  7, 10,  8, (const uint8_t[]){0x3E, 0x10, 0x20, 0x40, 0x81, 0x02, 0x44, 0x88, 0xE0}}, /* J */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x86, 0x29, 0x28, 0xC3, 0x0A, 0x24, 0x8A, 0x10}}, /* K */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x83, 0xF0}}, /* L */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x86, 0x1C, 0xF3, 0xB6, 0xD8, 0x61, 0x86, 0x10}}, /* M */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x87, 0x1C, 0x69, 0xA6, 0x59, 0x63, 0x8E, 0x10}}, /* N */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x7A, 0x18, 0x61, 0x86, 0x18, 0x61, 0x85, 0xE0}}, /* O */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xFA, 0x18, 0x61, 0xFA, 0x08, 0x20, 0x82, 0x00}}, /* P */
-    {  1,  -1,  7, 11,  8, (const uint8_t[]){0x79, 0x0A, 0x14, 0x28, 0x50, 0xA1, 0x5A, 0xCC, 0xF0, 0x18}}, /* Q */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xFA, 0x18, 0x61, 0xFA, 0x48, 0xA2, 0x86, 0x10}}, /* R */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x7A, 0x18, 0x60, 0x60, 0x60, 0x61, 0x85, 0xE0}}, /* S */
-    {  1,   0,  7, 10,  8, (const uint8_t[]){0xFE, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x10, 0x20}}, /* T */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x85, 0xE0}}, /* U */
-    {  1,   0,  7, 10,  8, (const uint8_t[]){0x83, 0x06, 0x0A, 0x24, 0x48, 0x8A, 0x14, 0x10, 0x20}}, /* V */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x86, 0x18, 0x61, 0xB6, 0xDC, 0xF3, 0x86, 0x10}}, /* W */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x86, 0x14, 0x92, 0x30, 0xC4, 0x92, 0x86, 0x10}}, /* X */
-    {  1,   0,  7, 10,  8, (const uint8_t[]){0x83, 0x05, 0x12, 0x22, 0x82, 0x04, 0x08, 0x10, 0x20}}, /* Y */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xFC, 0x10, 0x42, 0x10, 0x84, 0x20, 0x83, 0xF0}}, /* Z */
-    {  4,  -1,  3, 12,  8, (const uint8_t[]){0xF2, 0x49, 0x24, 0x92, 0x70}}, /* [ */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x82, 0x04, 0x08, 0x20, 0x41, 0x02, 0x04, 0x10}}, /* \ */
-    {  1,  -1,  3, 12,  8, (const uint8_t[]){0xE4, 0x92, 0x49, 0x24, 0xF0}}, /* ] */
-    {  1,   9,  6,  3,  8, (const uint8_t[]){0x31, 0x28, 0x40}}, /* ^ */
-    {  1,  -1,  7,  1,  8, (const uint8_t[]){0xFE}}, /* _ */
-    {  3,   8,  2,  4,  8, (const uint8_t[]){0xE9}}, /* ` */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x10, 0x5F, 0x86, 0x18, 0xDD}}, /* a */
-    {  1,   0,  6, 11,  8, (const uint8_t[]){0x82, 0x08, 0x2E, 0xC6, 0x18, 0x61, 0x87, 0x1B, 0x80}}, /* b */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x18, 0x20, 0x82, 0x08, 0x5E}}, /* c */
-    {  1,   0,  6, 11,  8, (const uint8_t[]){0x04, 0x10, 0x5D, 0x8E, 0x18, 0x61, 0x86, 0x37, 0x40}}, /* d */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x18, 0x7F, 0x82, 0x08, 0x5E}}, /* e */
-    {  1,   0,  5, 11,  8, (const uint8_t[]){0x19, 0x08, 0x4F, 0x90, 0x84, 0x21, 0x08}}, /* f */
-    {  1,  -2,  6, 11,  8, (const uint8_t[]){0x05, 0xD8, 0xA2, 0x89, 0xC4, 0x1E, 0x86, 0x17, 0x80}}, /* g */
-    {  1,   0,  6, 11,  8, (const uint8_t[]){0x82, 0x08, 0x2E, 0xC6, 0x18, 0x61, 0x86, 0x18, 0x40}}, /* h */
-    {  2,   0,  5, 11,  8, (const uint8_t[]){0x21, 0x00, 0xC2, 0x10, 0x84, 0x21, 0x3E}}, /* i */
-    {  1,  -2,  5, 13,  8, (const uint8_t[]){0x08, 0x40, 0x30, 0x84, 0x21, 0x08, 0x43, 0x26, 0x00}}, /* j */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x82, 0x08, 0xA4, 0xA3, 0x0A, 0x24, 0x8A, 0x10}}, /* k */
-    {  2,   0,  5, 10,  8, (const uint8_t[]){0x61, 0x08, 0x42, 0x10, 0x84, 0x27, 0xC0}}, /* l */
-    {  1,   0,  7,  8,  8, (const uint8_t[]){0xED, 0x26, 0x4C, 0x99, 0x32, 0x64, 0xC9}}, /* m */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xBB, 0x18, 0x61, 0x86, 0x18, 0x61}}, /* n */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x18, 0x61, 0x86, 0x18, 0x5E}}, /* o */
-    {  1,  -2,  6, 10,  8, (const uint8_t[]){0xBB, 0x18, 0x61, 0x86, 0x1C, 0x6E, 0x82, 0x00}}, /* p */
-    {  1,  -2,  6, 10,  8, (const uint8_t[]){0x76, 0x38, 0x61, 0x86, 0x18, 0xDD, 0x04, 0x10}}, /* q */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xBB, 0x18, 0x60, 0x82, 0x08, 0x20}}, /* r */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x18, 0x18, 0x18, 0x18, 0x5E}}, /* s */
-    {  1,   0,  5, 10,  8, (const uint8_t[]){0x21, 0x3E, 0x42, 0x10, 0x84, 0x20, 0xC0}}, /* t */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x86, 0x18, 0x61, 0x86, 0x18, 0xDD}}, /* u */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x86, 0x18, 0x52, 0x49, 0x23, 0x0C}}, /* v */
-    {  1,   0,  7,  8,  8, (const uint8_t[]){0x83, 0x26, 0x4C, 0x99, 0x32, 0x64, 0xB6}}, /* w */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x86, 0x14, 0x8C, 0x31, 0x28, 0x61}}, /* x */
-    {  1,  -2,  6, 10,  8, (const uint8_t[]){0x86, 0x18, 0x61, 0x85, 0x33, 0x41, 0x05, 0xE0}}, /* y */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xFC, 0x10, 0x84, 0x21, 0x08, 0x3F}}, /* z */
-    {  3,  -1,  3, 12,  8, (const uint8_t[]){0x72, 0x25, 0x22, 0x52, 0x30}}, /* { */
-    {  4,  -2,  1, 14,  8, (const uint8_t[]){0xFF, 0xFC}}, /* | */
-    {  2,  -1,  3, 12,  8, (const uint8_t[]){0xC4, 0xA4, 0x4A, 0x44, 0xE0}}, /* } */
-    {  1,   8,  7,  3,  8, (const uint8_t[]){0x63, 0x26, 0x30}}, /* ~ */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /*   */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x1C, 0x51, 0x45, 0x14, 0x51}}, /* ก */
-    {  1,   0,  5,  8,  8, (const uint8_t[]){0xCE, 0x53, 0x18, 0xC6, 0x2E}}, /* ข */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xA7, 0x92, 0x51, 0x45, 0x14, 0x4E}}, /* ฃ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x18, 0x6D, 0xB6, 0x9A, 0x51}}, /* ค */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x6A, 0x58, 0x6D, 0xB6, 0x9A, 0x51}}, /* ฅ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xA7, 0x92, 0x51, 0x45, 0x1E, 0x76}}, /* ฆ */
-    {  1,   0,  5,  8,  8, (const uint8_t[]){0x18, 0xC2, 0x18, 0xA4, 0xA3}}, /* ง */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x10, 0x4D, 0x34, 0x51, 0x46}}, /* จ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x72, 0x20, 0xB2, 0xC9, 0x25, 0xDB}}, /* ฉ */
-    {  1,   0,  5, 10,  8, (const uint8_t[]){0x08, 0x73, 0xA4, 0xC6, 0x31, 0x8B, 0x80}}, /* ช */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x04, 0x1A, 0x7A, 0x25, 0x14, 0x51, 0x44, 0xE0}}, /* ซ */
-    {  1,   0,  7,  8,  8, (const uint8_t[]){0x73, 0x15, 0x2C, 0x58, 0xB1, 0x77, 0xED}}, /* ฌ */
-    {  1,  -1,  6,  9,  8, (const uint8_t[]){0x66, 0x55, 0x65, 0x96, 0x5D, 0xF4, 0x1C}}, /* ญ */
-    {  1,  -2,  6, 10,  8, (const uint8_t[]){0x7A, 0x1C, 0x51, 0x45, 0x1C, 0x75, 0x25, 0x60}}, /* ฎ */
-    {  1,  -2,  6, 10,  8, (const uint8_t[]){0x7A, 0x1C, 0x51, 0x45, 0x1C, 0x75, 0x3D, 0x50}}, /* ฏ */
-    {  1,  -2,  5, 10,  8, (const uint8_t[]){0x7C, 0x1C, 0x16, 0xB4, 0x61, 0xAA, 0xC0}}, /* ฐ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xAB, 0xD2, 0x51, 0x45, 0x14, 0x51}}, /* ฑ */
-    {  1,   0,  7,  8,  8, (const uint8_t[]){0x53, 0x56, 0x2F, 0x5E, 0xB5, 0x77, 0xCD}}, /* ฒ */
-    {  1,   0,  7,  8,  8, (const uint8_t[]){0x65, 0x29, 0x54, 0xA9, 0x52, 0xB7, 0xEB}}, /* ณ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x18, 0x6D, 0xB6, 0x5A, 0x51}}, /* ด */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x6A, 0x58, 0x6D, 0xB6, 0x5A, 0x51}}, /* ต */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x1C, 0x51, 0x45, 0x16, 0x59}}, /* ถ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xCB, 0x56, 0x51, 0x45, 0x14, 0x51}}, /* ท */
-    {  1,   0,  5,  8,  8, (const uint8_t[]){0x7C, 0x3C, 0x94, 0xA5, 0x26}}, /* ธ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xCB, 0x24, 0xA2, 0x8A, 0x29, 0xDB}}, /* น */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xC7, 0x14, 0x51, 0x45, 0x14, 0x4E}}, /* บ */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x04, 0x1C, 0x71, 0x45, 0x14, 0x51, 0x44, 0xE0}}, /* ป */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xC7, 0x18, 0x65, 0x96, 0x59, 0x5A}}, /* ผ */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x04, 0x1C, 0x71, 0x86, 0x59, 0x65, 0x95, 0xA0}}, /* ฝ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xD7, 0x55, 0x55, 0x55, 0x55, 0x4A}}, /* พ */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x04, 0x1D, 0x75, 0x55, 0x55, 0x55, 0x54, 0xA0}}, /* ฟ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x1C, 0x51, 0x45, 0x1C, 0x71}}, /* ภ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xC7, 0x14, 0x51, 0x45, 0x1E, 0x76}}, /* ม */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xC7, 0x18, 0x59, 0x86, 0x18, 0x5E}}, /* ย */
-    {  1,   0,  5,  8,  8, (const uint8_t[]){0x7C, 0x3C, 0x10, 0x84, 0x63}}, /* ร */
-    {  1,  -2,  6, 10,  8, (const uint8_t[]){0x7A, 0x1C, 0x51, 0x45, 0x16, 0x59, 0x04, 0x10}}, /* ฤ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x10, 0x4D, 0x4D, 0x16, 0x59}}, /* ล */
-    {  1,  -2,  6, 10,  8, (const uint8_t[]){0x7A, 0x1C, 0x51, 0x45, 0x1C, 0x71, 0x04, 0x10}}, /* ฦ */
-    {  1,   0,  5,  8,  8, (const uint8_t[]){0x74, 0x42, 0x10, 0x84, 0x63}}, /* ว */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x04, 0x17, 0xA1, 0x86, 0xDB, 0x69, 0xA5, 0x10}}, /* ศ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xC7, 0x14, 0x55, 0x5D, 0x14, 0x4E}}, /* ษ */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x04, 0x17, 0xA1, 0x04, 0xD4, 0xD1, 0x65, 0x90}}, /* ส */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xCF, 0x34, 0x95, 0x65, 0x14, 0x51}}, /* ห */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x04, 0x1D, 0xB1, 0x55, 0x55, 0x55, 0x54, 0xA0}}, /* ฬ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x7A, 0x10, 0x59, 0x65, 0x14, 0x4E}}, /* อ */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x04, 0x17, 0xBD, 0x05, 0x96, 0x51, 0x44, 0xE0}}, /* ฮ */
-    {  1,   0,  5,  8,  8, (const uint8_t[]){0xDF, 0x42, 0x10, 0x84, 0x22}}, /* ฯ */
-    {  2,   2,  4,  5,  8, (const uint8_t[]){0xDE, 0x0D, 0xE0}}, /* ะ */
-    { -6,  10,  6,  2,  0, (const uint8_t[]){0xC7, 0xE0}}, /* ั */
-    {  1,   0,  5,  8,  8, (const uint8_t[]){0x74, 0x42, 0x10, 0x84, 0x21}}, /* า */
-    {  1,   0,  6, 11,  8, (const uint8_t[]){0xC3, 0x00, 0x0E, 0x44, 0x10, 0x41, 0x04, 0x10, 0x40}}, /* ำ */
-    { -7,  10,  6,  1,  0, (const uint8_t[]){0xFC}}, /* ิ */
-    { -7,  10,  6,  2,  0, (const uint8_t[]){0x07, 0xF0}}, /* ี */
-    { -7,  10,  6,  2,  0, (const uint8_t[]){0x0F, 0xF0}}, /* ึ */
-    { -7,  10,  6,  2,  0, (const uint8_t[]){0x17, 0xF0}}, /* ื */
-    { -3,  -3,  2,  2,  0, (const uint8_t[]){0xD0}}, /* ุ */
-    { -5,  -3,  4,  2,  0, (const uint8_t[]){0xD7}}, /* ู */
-    { -4,  -3,  2,  2,  0, (const uint8_t[]){0xF0}}, /* ฺ */
-    { -6,  10,  6,  6,  0, (const uint8_t[]){0x60, 0x97, 0x80, 0xC7, 0xE0}}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
-    {  1,  -1,  6, 11,  8, (const uint8_t[]){0x33, 0xEB, 0x6D, 0xB7, 0xEB, 0x6D, 0xB7, 0xE3, 0x00}}, /* ฿ */
-    {  3,   0,  2,  8,  8, (const uint8_t[]){0xAA, 0xAF}}, /* เ */
-    {  2,   0,  5,  8,  8, (const uint8_t[]){0x94, 0xA5, 0x29, 0x4B, 0x7B}}, /* แ */
-    {  1,   0,  6, 11,  8, (const uint8_t[]){0x7E, 0x0F, 0x82, 0x08, 0x20, 0x82, 0x08, 0x30, 0xC0}}, /* โ */
-    {  1,   0,  6, 11,  8, (const uint8_t[]){0x72, 0x2A, 0x9A, 0x08, 0x20, 0x82, 0x08, 0x30, 0xC0}}, /* ใ */
-    {  1,   0,  6, 11,  8, (const uint8_t[]){0xD8, 0xA0, 0x82, 0x08, 0x20, 0x82, 0x08, 0x30, 0xC0}}, /* ไ */
-    {  1,  -2,  5, 10,  8, (const uint8_t[]){0x74, 0x42, 0x10, 0x84, 0x21, 0x08, 0x40}}, /* ๅ */
-    {  1,  -2,  6, 10,  8, (const uint8_t[]){0xEB, 0x50, 0x41, 0x04, 0x10, 0x41, 0x08, 0x40}}, /* ๆ */
-    { -7,  10,  6,  4,  0, (const uint8_t[]){0x05, 0xEA, 0x96}}, /* ็ */
-    { -2,  13,  1,  3,  0, (const uint8_t[]){0xE0}}, /* ่ */
-    { -5,  13,  5,  3,  0, (const uint8_t[]){0xC2, 0x7C}}, /* ้ */
-    { -7,  13,  7,  3,  0, (const uint8_t[]){0x51, 0x57, 0x30}}, /* ๊ */
-    { -3,  13,  3,  3,  0, (const uint8_t[]){0x5D, 0x00}}, /* ๋ */
-    { -3,  13,  3,  3,  0, (const uint8_t[]){0x73, 0x00}}, /* ์ */
-    { -3,  13,  2,  2,  0, (const uint8_t[]){0xF0}}, /* ํ */
-    { -4,   9,  4,  4,  0, (const uint8_t[]){0x74, 0xAC}}, /* ๎ */
-    {  1,   0,  6,  6,  8, (const uint8_t[]){0x7A, 0x1B, 0x6D, 0x85, 0xE0}}, /* ๏ */
-    {  1,   0,  6,  7,  8, (const uint8_t[]){0x7A, 0x18, 0x61, 0x86, 0x17, 0x80}}, /* ๐ */
-    {  1,   0,  6,  7,  8, (const uint8_t[]){0x7A, 0x18, 0x6D, 0x74, 0x17, 0x80}}, /* ๑ */
-    {  1,   0,  6,  9,  8, (const uint8_t[]){0x82, 0x09, 0x6B, 0xA6, 0xDB, 0x61, 0x78}}, /* ๒ */
-    {  1,   0,  6,  7,  8, (const uint8_t[]){0x6A, 0x59, 0x65, 0x97, 0x1C, 0x40}}, /* ๓ */
-    {  1,   0,  6,  9,  8, (const uint8_t[]){0x04, 0x17, 0xA0, 0x82, 0x69, 0xA4, 0x7C}}, /* ๔ */
-    {  1,   0,  6,  9,  8, (const uint8_t[]){0x04, 0xD7, 0xA0, 0x82, 0x69, 0xA4, 0x7C}}, /* ๕ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0x81, 0x62, 0x41, 0x05, 0x96, 0x5E}}, /* ๖ */
-    {  1,   0,  6,  9,  8, (const uint8_t[]){0x04, 0x15, 0x6D, 0x96, 0x59, 0x75, 0xD8}}, /* ๗ */
-    {  1,   0,  7,  8,  8, (const uint8_t[]){0x06, 0xF2, 0x04, 0x08, 0xD5, 0xA9, 0x6E}}, /* ๘ */
-    {  1,   0,  6,  9,  8, (const uint8_t[]){0x04, 0x13, 0x5A, 0xA2, 0x49, 0x32, 0xC8}}, /* ๙ */
-    {  1,   0,  6,  8,  8, (const uint8_t[]){0xD7, 0xD1, 0x45, 0x14, 0x51, 0x4A}}, /* ๚ */
-    {  1,   0,  7,  8,  8, (const uint8_t[]){0xC1, 0x82, 0x85, 0x4A, 0xF6, 0x28, 0x20}}, /* ๛ */
+    {  0,   0,  0,  0,  8, 0, NULL}, /*   */
+    {  4,   0,  1, 10,  8, 0, (const uint8_t[]){0xFE, 0xC0}}, /* ! */
+    {  1,   8,  6,  4,  8, 0, (const uint8_t[]){0xCD, 0x14, 0x62}}, /* " */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x64, 0xC9, 0xFD, 0x2F, 0xE4}}, /* # */
+    {  1,   0,  7, 10,  8, 0, (const uint8_t[]){0x10, 0xFA, 0x4C, 0x87, 0x03, 0x84, 0xC9, 0x7C, 0x20}}, /* $ */
+    {  1,   0,  7, 10,  8, 1, (const uint8_t[]){0x24, 0x98, 0xCA, 0x68, 0x20, 0xB2, 0x98, 0xC0}}, /* % */
+    {  1,   0,  7, 10,  8, 0, (const uint8_t[]){0x38, 0x89, 0x12, 0x23, 0x8E, 0x62, 0xC2, 0x8C, 0xE4}}, /* & */
+    {  3,   8,  2,  4,  8, 0, (const uint8_t[]){0xD6}}, /* ' */
+    {  3,  -1,  3, 12,  8, 1, (const uint8_t[]){0x2F, 0xA2, 0xA2, 0x20}}, /* ( */
+    {  2,  -1,  3, 12,  8, 1, (const uint8_t[]){0x2F, 0xA8, 0x8A, 0x80}}, /* ) */
+    {  1,   1,  7,  7,  8, 0, (const uint8_t[]){0x11, 0x25, 0x51, 0xC5, 0x52, 0x44, 0x00}}, /* * */
+    {  1,   1,  7,  7,  8, 1, (const uint8_t[]){0x66, 0x23, 0xF8, 0x80}}, /* + */
+    {  3,  -2,  2,  4,  8, 0, (const uint8_t[]){0xD6}}, /* , */
+    {  1,   4,  6,  1,  8, 0, (const uint8_t[]){0xFC}}, /* - */
+    {  3,   0,  2,  2,  8, 0, (const uint8_t[]){0xF0}}, /* . */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x4A, 0x41, 0x08, 0x42, 0x10, 0x80}}, /* / */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x1F, 0x0C, 0x4A, 0x14, 0x8C}}, /* 0 */
+    {  2,   0,  5, 10,  8, 1, (const uint8_t[]){0x0F, 0x88, 0xCA, 0x13, 0xE0}}, /* 1 */
+    {  1,   0,  6, 10,  8, 0, (const uint8_t[]){0x7A, 0x18, 0x41, 0x18, 0x84, 0x20, 0x83, 0xF0}}, /* 2 */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x22, 0x9E, 0x84, 0x13, 0x81, 0x85, 0xE0}}, /* 3 */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x04, 0xC2, 0x18, 0xA4, 0xA2, 0xFC, 0x20}}, /* 4 */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x33, 0x3F, 0x83, 0xE0, 0x61, 0x78}}, /* 5 */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x13, 0x8E, 0x42, 0x0F, 0xA1, 0x78}}, /* 6 */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x2D, 0xFF, 0x04, 0x21, 0x00}}, /* 7 */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x33, 0x9E, 0x85, 0xE8, 0x5E}}, /* 8 */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x33, 0x1E, 0x85, 0xF0, 0x42, 0x70}}, /* 9 */
+    {  3,   1,  2,  7,  8, 0, (const uint8_t[]){0xF0, 0x3C}}, /* : */
+    {  3,  -1,  2,  9,  8, 0, (const uint8_t[]){0xF0, 0x35, 0x80}}, /* ; */
+    {  2,   0,  5,  9,  8, 0, (const uint8_t[]){0x08, 0x88, 0x88, 0x20, 0x82, 0x08}}, /* < */
+    {  1,   2,  6,  5,  8, 1, (const uint8_t[]){0x37, 0xE0, 0x7E}}, /* = */
+    {  1,   0,  5,  9,  8, 0, (const uint8_t[]){0x82, 0x08, 0x20, 0x88, 0x88, 0x80}}, /* > */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x22, 0x5E, 0x84, 0x10, 0x84, 0x00, 0x40}}, /* ? */
+    {  1,   0,  6, 10,  8, 0, (const uint8_t[]){0x39, 0x19, 0x6B, 0xA6, 0x9A, 0x67, 0x40, 0xF0}}, /* @ */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x29, 0xCC, 0x4A, 0x1F, 0xE1}}, /* A */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x33, 0xBE, 0x87, 0xE8, 0x7E}}, /* B */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x2E, 0x9E, 0x86, 0x08, 0x5E}}, /* C */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x1F, 0x3C, 0x8A, 0x18, 0xBC}}, /* D */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x33, 0xBF, 0x83, 0xE8, 0x3F}}, /* E */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x33, 0xFF, 0x83, 0xE8, 0x00}}, /* F */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x29, 0x1E, 0x86, 0x09, 0xE1, 0x8D, 0xD0}}, /* G */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x73, 0xE1, 0xFE, 0x10}}, /* H */
+    {  2,   0,  5, 10,  8, 1, (const uint8_t[]){0x3F, 0xBE, 0x4F, 0x80}}, /* I */
+    {  1,   0,  7, 10,  8, 1, (const uint8_t[]){0x3E, 0x8F, 0x84, 0x88, 0xE0}}, /* J */
+    {  1,   0,  6, 10,  8, 0, (const uint8_t[]){0x86, 0x29, 0x28, 0xC3, 0x0A, 0x24, 0x8A, 0x10}}, /* K */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x7F, 0xA0, 0xFC}}, /* L */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x55, 0xE1, 0xCE, 0xD8, 0x40}}, /* M */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x2A, 0xA1, 0xC6, 0x99, 0x63, 0x84}}, /* N */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x3F, 0x9E, 0x85, 0xE0}}, /* O */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x33, 0xFE, 0x87, 0xE8, 0x00}}, /* P */
+    {  1,  -1,  7, 11,  8, 1, (const uint8_t[]){0x3E, 0x0F, 0x21, 0x5A, 0xCC, 0xF0, 0x18}}, /* Q */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x31, 0x7E, 0x87, 0xE9, 0x22, 0x84}}, /* R */
+    {  1,   0,  6, 10,  8, 0, (const uint8_t[]){0x7A, 0x18, 0x60, 0x60, 0x60, 0x61, 0x85, 0xE0}}, /* S */
+    {  1,   0,  7, 10,  8, 1, (const uint8_t[]){0x3F, 0xFF, 0x88}}, /* T */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x7F, 0xA1, 0x78}}, /* U */
+    {  1,   0,  7, 10,  8, 1, (const uint8_t[]){0x6D, 0x60, 0xA2, 0x28, 0x20}}, /* V */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x75, 0x61, 0xB7, 0x38, 0x40}}, /* W */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x55, 0x61, 0x48, 0xC4, 0xA1}}, /* X */
+    {  1,   0,  7, 10,  8, 1, (const uint8_t[]){0x53, 0xE0, 0xA2, 0x28, 0x20}}, /* Y */
+    {  1,   0,  6, 10,  8, 0, (const uint8_t[]){0xFC, 0x10, 0x42, 0x10, 0x84, 0x20, 0x83, 0xF0}}, /* Z */
+    {  4,  -1,  3, 12,  8, 1, (const uint8_t[]){0x3F, 0xEF, 0x38}}, /* [ */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x4A, 0x60, 0x40, 0x81, 0x02, 0x04}}, /* \ */
+    {  1,  -1,  3, 12,  8, 1, (const uint8_t[]){0x3F, 0xEE, 0x78}}, /* ] */
+    {  1,   9,  6,  3,  8, 0, (const uint8_t[]){0x31, 0x28, 0x40}}, /* ^ */
+    {  1,  -1,  7,  1,  8, 0, (const uint8_t[]){0xFE}}, /* _ */
+    {  3,   8,  2,  4,  8, 0, (const uint8_t[]){0xE9}}, /* ` */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x7A, 0x10, 0x5F, 0x86, 0x18, 0xDD}}, /* a */
+    {  1,   0,  6, 11,  8, 1, (const uint8_t[]){0x63, 0x90, 0x5D, 0x8C, 0x38, 0xDC}}, /* b */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x1C, 0x7A, 0x18, 0x21, 0x78}}, /* c */
+    {  1,   0,  6, 11,  8, 1, (const uint8_t[]){0x63, 0x80, 0xBB, 0x1C, 0x31, 0xBA}}, /* d */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x7A, 0x18, 0x7F, 0x82, 0x08, 0x5E}}, /* e */
+    {  1,   0,  5, 11,  8, 1, (const uint8_t[]){0x33, 0xE3, 0x27, 0xC8}}, /* f */
+    {  1,  -2,  6, 11,  8, 1, (const uint8_t[]){0x18, 0x40, 0xBB, 0x13, 0x88, 0x3D, 0x0B, 0xC0}}, /* g */
+    {  1,   0,  6, 11,  8, 1, (const uint8_t[]){0x63, 0xF0, 0x5D, 0x8C, 0x20}}, /* h */
+    {  2,   0,  5, 11,  8, 1, (const uint8_t[]){0x47, 0xC4, 0x03, 0x09, 0xF0}}, /* i */
+    {  1,  -2,  5, 13,  8, 1, (const uint8_t[]){0x47, 0xE0, 0x40, 0x30, 0xC9, 0x80}}, /* j */
+    {  1,   0,  6, 10,  8, 0, (const uint8_t[]){0x82, 0x08, 0xA4, 0xA3, 0x0A, 0x24, 0x8A, 0x10}}, /* k */
+    {  2,   0,  5, 10,  8, 1, (const uint8_t[]){0x3F, 0x98, 0x4F, 0x80}}, /* l */
+    {  1,   0,  7,  8,  8, 1, (const uint8_t[]){0x3F, 0xED, 0x24}}, /* m */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x1F, 0xBB, 0x18, 0x40}}, /* n */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x3E, 0x7A, 0x17, 0x80}}, /* o */
+    {  1,  -2,  6, 10,  8, 1, (const uint8_t[]){0x1C, 0x6E, 0xC6, 0x1C, 0x6E, 0x80}}, /* p */
+    {  1,  -2,  6, 10,  8, 1, (const uint8_t[]){0x1C, 0x5D, 0x8E, 0x18, 0xDD, 0x04}}, /* q */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x0F, 0xBB, 0x18, 0x60}}, /* r */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x7A, 0x18, 0x18, 0x18, 0x18, 0x5E}}, /* s */
+    {  1,   0,  5, 10,  8, 1, (const uint8_t[]){0x4F, 0x89, 0xF2, 0x0C}}, /* t */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x7C, 0x86, 0x37, 0x40}}, /* u */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x6D, 0x85, 0x23, 0x00}}, /* v */
+    {  1,   0,  7,  8,  8, 1, (const uint8_t[]){0x3E, 0x83, 0x25, 0xB0}}, /* w */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x49, 0x85, 0x23, 0x12, 0x84}}, /* x */
+    {  1,  -2,  6, 10,  8, 1, (const uint8_t[]){0x78, 0xA1, 0x4C, 0xD0, 0x5E}}, /* y */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0xFC, 0x10, 0x84, 0x21, 0x08, 0x3F}}, /* z */
+    {  3,  -1,  3, 12,  8, 0, (const uint8_t[]){0x72, 0x25, 0x22, 0x52, 0x30}}, /* { */
+    {  4,  -2,  1, 14,  8, 0, (const uint8_t[]){0xFF, 0xFC}}, /* | */
+    {  2,  -1,  3, 12,  8, 0, (const uint8_t[]){0xC4, 0xA4, 0x4A, 0x44, 0xE0}}, /* } */
+    {  1,   8,  7,  3,  8, 0, (const uint8_t[]){0x63, 0x26, 0x30}}, /* ~ */
+    {  0,   0,  0,  0,  8, 0, NULL}, /* � */
+    {  0,   0,  0,  0,  8, 0, NULL}, /*   */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x0F, 0x7A, 0x1C, 0x51}}, /* ก */
+    {  1,   0,  5,  8,  8, 1, (const uint8_t[]){0x4E, 0xCA, 0x62, 0xE0}}, /* ข */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x0E, 0xA7, 0x92, 0x51, 0x38}}, /* ฃ */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x2A, 0x7A, 0x1B, 0x69, 0x44}}, /* ค */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x6A, 0x58, 0x6D, 0xB6, 0x9A, 0x51}}, /* ฅ */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0xA7, 0x92, 0x51, 0x45, 0x1E, 0x76}}, /* ฆ */
+    {  1,   0,  5,  8,  8, 0, (const uint8_t[]){0x18, 0xC2, 0x18, 0xA4, 0xA3}}, /* ง */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x7A, 0x10, 0x4D, 0x34, 0x51, 0x46}}, /* จ */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x72, 0x20, 0xB2, 0xC9, 0x25, 0xDB}}, /* ฉ */
+    {  1,   0,  5, 10,  8, 1, (const uint8_t[]){0x43, 0x83, 0x9D, 0x26, 0x2E}}, /* ช */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x43, 0x81, 0xA7, 0xA2, 0x51, 0x38}}, /* ซ */
+    {  1,   0,  7,  8,  8, 0, (const uint8_t[]){0x73, 0x15, 0x2C, 0x58, 0xB1, 0x77, 0xED}}, /* ฌ */
+    {  1,  -1,  6,  9,  8, 0, (const uint8_t[]){0x66, 0x55, 0x65, 0x96, 0x5D, 0xF4, 0x1C}}, /* ญ */
+    {  1,  -2,  6, 10,  8, 0, (const uint8_t[]){0x7A, 0x1C, 0x51, 0x45, 0x1C, 0x75, 0x25, 0x60}}, /* ฎ */
+    {  1,  -2,  6, 10,  8, 0, (const uint8_t[]){0x7A, 0x1C, 0x51, 0x45, 0x1C, 0x75, 0x3D, 0x50}}, /* ฏ */
+    {  1,  -2,  5, 10,  8, 0, (const uint8_t[]){0x7C, 0x1C, 0x16, 0xB4, 0x61, 0xAA, 0xC0}}, /* ฐ */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x0F, 0xAB, 0xD2, 0x51}}, /* ฑ */
+    {  1,   0,  7,  8,  8, 0, (const uint8_t[]){0x53, 0x56, 0x2F, 0x5E, 0xB5, 0x77, 0xCD}}, /* ฒ */
+    {  1,   0,  7,  8,  8, 0, (const uint8_t[]){0x65, 0x29, 0x54, 0xA9, 0x52, 0xB7, 0xEB}}, /* ณ */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x7A, 0x18, 0x6D, 0xB6, 0x5A, 0x51}}, /* ด */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x6A, 0x58, 0x6D, 0xB6, 0x5A, 0x51}}, /* ต */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x0D, 0x7A, 0x1C, 0x51, 0x64}}, /* ถ */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x0F, 0xCB, 0x56, 0x51}}, /* ท */
+    {  1,   0,  5,  8,  8, 0, (const uint8_t[]){0x7C, 0x3C, 0x94, 0xA5, 0x26}}, /* ธ */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x4C, 0xC9, 0x28, 0xA7, 0x6C}}, /* น */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x5E, 0xC5, 0x13, 0x80}}, /* บ */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x57, 0x81, 0xC5, 0x13, 0x80}}, /* ป */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x4E, 0xC6, 0x19, 0x5A}}, /* ผ */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x53, 0x81, 0xC6, 0x19, 0x5A}}, /* ฝ */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x5E, 0xD5, 0x52, 0x80}}, /* พ */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x57, 0x81, 0xD5, 0x52, 0x80}}, /* ฟ */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x0D, 0x7A, 0x1C, 0x51, 0xC4}}, /* ภ */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x5C, 0xC5, 0x1E, 0x76}}, /* ม */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x46, 0xC6, 0x16, 0x61, 0x78}}, /* ย */
+    {  1,   0,  5,  8,  8, 0, (const uint8_t[]){0x7C, 0x3C, 0x10, 0x84, 0x63}}, /* ร */
+    {  1,  -2,  6, 10,  8, 1, (const uint8_t[]){0x0D, 0x5E, 0x87, 0x14, 0x59, 0x04}}, /* ฤ */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x7A, 0x10, 0x4D, 0x4D, 0x16, 0x59}}, /* ล */
+    {  1,  -2,  6, 10,  8, 1, (const uint8_t[]){0x0D, 0x5E, 0x87, 0x14, 0x71, 0x04}}, /* ฦ */
+    {  1,   0,  5,  8,  8, 1, (const uint8_t[]){0x1D, 0x74, 0x42, 0x30}}, /* ว */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x4A, 0x81, 0x7A, 0x1B, 0x69, 0x44}}, /* ศ */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0xC7, 0x14, 0x55, 0x5D, 0x14, 0x4E}}, /* ษ */
+    {  1,   0,  6, 10,  8, 0, (const uint8_t[]){0x04, 0x17, 0xA1, 0x04, 0xD4, 0xD1, 0x65, 0x90}}, /* ส */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x43, 0xCD, 0x25, 0x59, 0x44}}, /* ห */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x47, 0x81, 0xDB, 0x15, 0x4A}}, /* ฬ */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x7A, 0x10, 0x59, 0x65, 0x14, 0x4E}}, /* อ */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x42, 0x81, 0x7B, 0xD0, 0x59, 0x44, 0xE0}}, /* ฮ */
+    {  1,   0,  5,  8,  8, 1, (const uint8_t[]){0x1E, 0xDF, 0x42, 0x20}}, /* ฯ */
+    {  2,   2,  4,  5,  8, 0, (const uint8_t[]){0xDE, 0x0D, 0xE0}}, /* ะ */
+    { -6,  10,  6,  2,  0, 0, (const uint8_t[]){0xC7, 0xE0}}, /* ั */
+    {  1,   0,  5,  8,  8, 1, (const uint8_t[]){0x1F, 0x74, 0x42}}, /* า */
+    {  1,   0,  6, 11,  8, 1, (const uint8_t[]){0x43, 0xF8, 0x00, 0x72, 0x20, 0x80}}, /* ำ */
+    { -7,  10,  6,  1,  0, 0, (const uint8_t[]){0xFC}}, /* ิ */
+    { -7,  10,  6,  2,  0, 0, (const uint8_t[]){0x07, 0xF0}}, /* ี */
+    { -7,  10,  6,  2,  0, 0, (const uint8_t[]){0x0F, 0xF0}}, /* ึ */
+    { -7,  10,  6,  2,  0, 0, (const uint8_t[]){0x17, 0xF0}}, /* ื */
+    { -3,  -3,  2,  2,  0, 0, (const uint8_t[]){0xD0}}, /* ุ */
+    { -5,  -3,  4,  2,  0, 0, (const uint8_t[]){0xD7}}, /* ู */
+    { -4,  -3,  2,  2,  0, 0, (const uint8_t[]){0xF0}}, /* ฺ */
+    {  1,  -1,  6, 11,  8, 1, (const uint8_t[]){0x19, 0x86, 0x7D, 0x6F, 0xD6, 0xFC, 0x60}}, /* ฿ */
+    {  3,   0,  2,  8,  8, 0, (const uint8_t[]){0xAA, 0xAF}}, /* เ */
+    {  2,   0,  5,  8,  8, 1, (const uint8_t[]){0x7D, 0x96, 0xC0}}, /* แ */
+    {  1,   0,  6, 11,  8, 1, (const uint8_t[]){0x0F, 0xAF, 0xC1, 0xF0, 0x41, 0x80}}, /* โ */
+    {  1,   0,  6, 11,  8, 1, (const uint8_t[]){0x07, 0xAE, 0x45, 0x53, 0x41, 0x06}}, /* ใ */
+    {  1,   0,  6, 11,  8, 1, (const uint8_t[]){0x1F, 0xBB, 0x14, 0x10, 0x60}}, /* ไ */
+    {  1,  -2,  5, 10,  8, 1, (const uint8_t[]){0x1F, 0xDD, 0x10, 0x80}}, /* ๅ */
+    {  1,  -2,  6, 10,  8, 1, (const uint8_t[]){0x1F, 0x3A, 0xD4, 0x10, 0x84}}, /* ๆ */
+    { -7,  10,  6,  4,  0, 0, (const uint8_t[]){0x05, 0xEA, 0x96}}, /* ็ */
+    { -2,  13,  1,  3,  0, 0, (const uint8_t[]){0xE0}}, /* ่ */
+    { -5,  13,  5,  3,  0, 0, (const uint8_t[]){0xC2, 0x7C}}, /* ้ */
+    { -7,  13,  7,  3,  0, 0, (const uint8_t[]){0x51, 0x57, 0x30}}, /* ๊ */
+    { -3,  13,  3,  3,  0, 0, (const uint8_t[]){0x5D, 0x00}}, /* ๋ */
+    { -3,  13,  3,  3,  0, 0, (const uint8_t[]){0x73, 0x00}}, /* ์ */
+    { -3,  13,  2,  2,  0, 0, (const uint8_t[]){0xF0}}, /* ํ */
+    { -4,   9,  4,  4,  0, 0, (const uint8_t[]){0x74, 0xAC}}, /* ๎ */
+    {  1,   0,  6,  6,  8, 0, (const uint8_t[]){0x7A, 0x1B, 0x6D, 0x85, 0xE0}}, /* ๏ */
+    {  1,   0,  6,  7,  8, 1, (const uint8_t[]){0x3C, 0xF4, 0x2F, 0x00}}, /* ๐ */
+    {  1,   0,  6,  7,  8, 0, (const uint8_t[]){0x7A, 0x18, 0x6D, 0x74, 0x17, 0x80}}, /* ๑ */
+    {  1,   0,  6,  9,  8, 0, (const uint8_t[]){0x82, 0x09, 0x6B, 0xA6, 0xDB, 0x61, 0x78}}, /* ๒ */
+    {  1,   0,  6,  7,  8, 1, (const uint8_t[]){0x3A, 0xD4, 0xB8, 0x80}}, /* ๓ */
+    {  1,   0,  6,  9,  8, 1, (const uint8_t[]){0x4A, 0x02, 0xF4, 0x13, 0x48, 0xF8}}, /* ๔ */
+    {  1,   0,  6,  9,  8, 0, (const uint8_t[]){0x04, 0xD7, 0xA0, 0x82, 0x69, 0xA4, 0x7C}}, /* ๕ */
+    {  1,   0,  6,  8,  8, 0, (const uint8_t[]){0x81, 0x62, 0x41, 0x05, 0x96, 0x5E}}, /* ๖ */
+    {  1,   0,  6,  9,  8, 1, (const uint8_t[]){0x46, 0x02, 0xAD, 0xB2, 0xEB, 0xB0}}, /* ๗ */
+    {  1,   0,  7,  8,  8, 0, (const uint8_t[]){0x06, 0xF2, 0x04, 0x08, 0xD5, 0xA9, 0x6E}}, /* ๘ */
+    {  1,   0,  6,  9,  8, 1, (const uint8_t[]){0x42, 0x82, 0x6B, 0x54, 0x49, 0x90}}, /* ๙ */
+    {  1,   0,  6,  8,  8, 1, (const uint8_t[]){0x1E, 0xD7, 0xD1, 0x4A}}, /* ๚ */
+    {  1,   0,  7,  8,  8, 0, (const uint8_t[]){0xC1, 0x82, 0x85, 0x4A, 0xF6, 0x28, 0x20}}, /* ๛ */
 };
-const ILI9341_FontDef ILI9341_Font_Manop8x20 = { 0x20, 0xFB, 80, 17, 3, ILI9341_Font_Manop8x20_Glyphs };
+static const ILI9341_FontRangeDef ILI9341_Font_Manop8x20_Ranges[] = {{0x20, 0x7F, 0x00}, {0xA0, 0xA0, 0x60}, {0x0E01, 0x0E3A, 0x61}, {0x0E3F, 0x0E5B, 0x9B}};
+const ILI9341_FontDef ILI9341_Font_Manop8x20 = { ILI9341_Font_Manop8x20_Ranges, 4, 80, 17, 3, ILI9341_Font_Manop8x20_Glyphs, NULL, 0, NULL };
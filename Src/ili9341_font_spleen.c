@@ -31,601 +31,607 @@
 #include "ili9341_fonts.h"
 
 static const ILI9341_GlyphDef ILI9341_Font_Spleen5x8_Glyphs[] = {
-    {  0,   0,  0,  0,  5, NULL}, /*   */
-    {  2,   0,  1,  7,  5, (const uint8_t[]){0xFA}}, /* ! */
-    {  1,   4,  3,  3,  5, (const uint8_t[]){0xB6, 0x80}}, /* " */
-    {  0,   0,  5,  6,  5, (const uint8_t[]){0x57, 0xD4, 0xAF, 0xA8}}, /* # */
-    {  0,  -1,  4,  8,  5, (const uint8_t[]){0x27, 0xA6, 0x33, 0xE2}}, /* $ */
-    {  0,  -1,  4,  8,  5, (const uint8_t[]){0x19, 0xA2, 0x45, 0x98}}, /* % */
-    {  0,   0,  5,  7,  5, (const uint8_t[]){0x22, 0x94, 0xCA, 0xC9, 0xA0}}, /* & */
-    {  2,   4,  1,  3,  5, (const uint8_t[]){0xE0}}, /* ' */
-    {  1,  -1,  3,  8,  5, (const uint8_t[]){0x2A, 0x49, 0x11}}, /* ( */
-    {  1,  -1,  3,  8,  5, (const uint8_t[]){0x88, 0x92, 0x54}}, /* ) */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x96, 0xF6, 0x90}}, /* * */
-    {  0,   0,  5,  5,  5, (const uint8_t[]){0x21, 0x3E, 0x42, 0x00}}, /* + */
-    {  1,  -1,  2,  3,  5, (const uint8_t[]){0x58}}, /* , */
-    {  0,   2,  4,  1,  5, (const uint8_t[]){0xF0}}, /* - */
-    {  2,   0,  1,  1,  5, (const uint8_t[]){0x80}}, /* . */
-    {  0,  -1,  4,  8,  5, (const uint8_t[]){0x11, 0x22, 0x44, 0x88}}, /* / */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x69, 0xBD, 0x96}}, /* 0 */
-    {  1,   0,  3,  6,  5, (const uint8_t[]){0x59, 0x25, 0xC0}}, /* 1 */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x69, 0x16, 0x8F}}, /* 2 */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x69, 0x21, 0x96}}, /* 3 */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x8A, 0xAF, 0x22}}, /* 4 */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0xF8, 0xE1, 0x1E}}, /* 5 */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x68, 0xE9, 0x96}}, /* 6 */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0xF9, 0x12, 0x44}}, /* 7 */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x69, 0x69, 0x96}}, /* 8 */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x69, 0x97, 0x16}}, /* 9 */
-    {  2,   0,  1,  4,  5, (const uint8_t[]){0x90}}, /* : */
-    {  1,  -1,  2,  5,  5, (const uint8_t[]){0x45, 0x80}}, /* ; */
-    {  1,   0,  3,  6,  5, (const uint8_t[]){0x2A, 0x44, 0x40}}, /* < */
-    {  0,   1,  4,  3,  5, (const uint8_t[]){0xF0, 0xF0}}, /* = */
-    {  1,   0,  3,  6,  5, (const uint8_t[]){0x88, 0x95, 0x00}}, /* > */
-    {  0,   0,  4,  7,  5, (const uint8_t[]){0x69, 0x12, 0x40, 0x40}}, /* ? */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x69, 0xBB, 0x87}}, /* @ */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x69, 0x9F, 0x99}}, /* A */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0xE9, 0xE9, 0x9E}}, /* B */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x78, 0x88, 0x87}}, /* C */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0xE9, 0x99, 0x9E}}, /* D */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x78, 0xE8, 0x87}}, /* E */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x78, 0x8E, 0x88}}, /* F */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x78, 0xB9, 0x97}}, /* G */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x99, 0xF9, 0x99}}, /* H */
-    {  1,   0,  3,  6,  5, (const uint8_t[]){0xE9, 0x25, 0xC0}}, /* I */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x72, 0x22, 0x2C}}, /* J */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x99, 0xE9, 0x99}}, /* K */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x88, 0x88, 0x87}}, /* L */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x9F, 0xF9, 0x99}}, /* M */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x9D, 0xDB, 0xB9}}, /* N */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x69, 0x99, 0x96}}, /* O */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0xE9, 0x9E, 0x88}}, /* P */
-    {  0,  -1,  4,  7,  5, (const uint8_t[]){0x69, 0x99, 0x96, 0x30}}, /* Q */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0xE9, 0x9E, 0x99}}, /* R */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x78, 0x61, 0x1E}}, /* S */
-    {  0,   0,  5,  6,  5, (const uint8_t[]){0xF9, 0x08, 0x42, 0x10}}, /* T */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x99, 0x99, 0x97}}, /* U */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x99, 0x99, 0x66}}, /* V */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x99, 0x9F, 0xF9}}, /* W */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x99, 0x66, 0x99}}, /* X */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0x99, 0x97, 0x1E}}, /* Y */
-    {  0,   0,  4,  6,  5, (const uint8_t[]){0xF1, 0x24, 0x8F}}, /* Z */
-    {  1,  -1,  3,  8,  5, (const uint8_t[]){0xF2, 0x49, 0x27}}, /* [ */
-    {  0,  -1,  4,  8,  5, (const uint8_t[]){0x88, 0x44, 0x22, 0x11}}, /* \ */
-    {  1,  -1,  3,  8,  5, (const uint8_t[]){0xE4, 0x92, 0x4F}}, /* ] */
-    {  0,   3,  5,  3,  5, (const uint8_t[]){0x22, 0xA2}}, /* ^ */
-    {  0,  -1,  4,  1,  5, (const uint8_t[]){0xF0}}, /* _ */
-    {  1,   5,  2,  2,  5, (const uint8_t[]){0x90}}, /* ` */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x61, 0x79, 0x70}}, /* a */
-    {  0,   0,  4,  7,  5, (const uint8_t[]){0x88, 0xE9, 0x99, 0xE0}}, /* b */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x78, 0x88, 0x70}}, /* c */
-    {  0,   0,  4,  7,  5, (const uint8_t[]){0x11, 0x79, 0x99, 0x70}}, /* d */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x79, 0xF8, 0x70}}, /* e */
-    {  0,   0,  4,  7,  5, (const uint8_t[]){0x34, 0x4E, 0x44, 0x40}}, /* f */
-    {  0,  -1,  4,  6,  5, (const uint8_t[]){0x79, 0x96, 0x1E}}, /* g */
-    {  0,   0,  4,  7,  5, (const uint8_t[]){0x88, 0xE9, 0x99, 0x90}}, /* h */
-    {  1,   0,  3,  6,  5, (const uint8_t[]){0x43, 0x24, 0xC0}}, /* i */
-    {  0,  -1,  3,  7,  5, (const uint8_t[]){0x20, 0x92, 0x70}}, /* j */
-    {  0,   0,  4,  7,  5, (const uint8_t[]){0x88, 0x9A, 0xCA, 0x90}}, /* k */
-    {  1,   0,  3,  7,  5, (const uint8_t[]){0x92, 0x49, 0x18}}, /* l */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x9F, 0xF9, 0x90}}, /* m */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0xE9, 0x99, 0x90}}, /* n */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x69, 0x99, 0x60}}, /* o */
-    {  0,  -1,  4,  6,  5, (const uint8_t[]){0xE9, 0x9E, 0x88}}, /* p */
-    {  0,  -1,  4,  6,  5, (const uint8_t[]){0x79, 0x97, 0x11}}, /* q */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x79, 0x88, 0x80}}, /* r */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x78, 0x61, 0xE0}}, /* s */
-    {  0,   0,  4,  7,  5, (const uint8_t[]){0x44, 0xE4, 0x44, 0x30}}, /* t */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x99, 0x99, 0x70}}, /* u */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x99, 0x96, 0x60}}, /* v */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x99, 0xFF, 0x90}}, /* w */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0x96, 0x69, 0x90}}, /* x */
-    {  0,  -1,  4,  6,  5, (const uint8_t[]){0x99, 0x97, 0x1E}}, /* y */
-    {  0,   0,  4,  5,  5, (const uint8_t[]){0xF1, 0x24, 0xF0}}, /* z */
-    {  0,  -1,  4,  8,  5, (const uint8_t[]){0x34, 0x4C, 0xC4, 0x43}}, /* { */
-    {  2,  -1,  1,  8,  5, (const uint8_t[]){0xFF}}, /* | */
-    {  0,  -1,  4,  8,  5, (const uint8_t[]){0xC2, 0x23, 0x32, 0x2C}}, /* } */
-    {  0,   2,  5,  2,  5, (const uint8_t[]){0x4D, 0x80}}, /* ~ */
-    {  0,   0,  0,  0,  5, NULL}, /* � */
+    {  0,   0,  0,  0,  5, 0, NULL}, /*   */
+    {  2,   0,  1,  7,  5, 0, (const uint8_t[]){0xFA}}, /* ! */
+    {  1,   4,  3,  3,  5, 1, (const uint8_t[]){0x74}}, /* " */
+    {  0,   0,  5,  6,  5, 0, (const uint8_t[]){0x57, 0xD4, 0xAF, 0xA8}}, /* # */
+    {  0,  -1,  4,  8,  5, 0, (const uint8_t[]){0x27, 0xA6, 0x33, 0xE2}}, /* $ */
+    {  0,  -1,  4,  8,  5, 0, (const uint8_t[]){0x19, 0xA2, 0x45, 0x98}}, /* % */
+    {  0,   0,  5,  7,  5, 0, (const uint8_t[]){0x22, 0x94, 0xCA, 0xC9, 0xA0}}, /* & */
+    {  2,   4,  1,  3,  5, 0, (const uint8_t[]){0xE0}}, /* ' */
+    {  1,  -1,  3,  8,  5, 0, (const uint8_t[]){0x2A, 0x49, 0x11}}, /* ( */
+    {  1,  -1,  3,  8,  5, 0, (const uint8_t[]){0x88, 0x92, 0x54}}, /* ) */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0x96, 0xF6, 0x90}}, /* * */
+    {  0,   0,  5,  5,  5, 1, (const uint8_t[]){0x49, 0x3E, 0x40}}, /* + */
+    {  1,  -1,  2,  3,  5, 0, (const uint8_t[]){0x58}}, /* , */
+    {  0,   2,  4,  1,  5, 0, (const uint8_t[]){0xF0}}, /* - */
+    {  2,   0,  1,  1,  5, 0, (const uint8_t[]){0x80}}, /* . */
+    {  0,  -1,  4,  8,  5, 1, (const uint8_t[]){0x55, 0x12, 0x48}}, /* / */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x69, 0xBD, 0x96}}, /* 0 */
+    {  1,   0,  3,  6,  5, 0, (const uint8_t[]){0x59, 0x25, 0xC0}}, /* 1 */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x69, 0x16, 0x8F}}, /* 2 */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x69, 0x21, 0x96}}, /* 3 */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x8A, 0xAF, 0x22}}, /* 4 */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0xF8, 0xE1, 0x1E}}, /* 5 */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x68, 0xE9, 0x96}}, /* 6 */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0xF9, 0x12, 0x44}}, /* 7 */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x69, 0x69, 0x96}}, /* 8 */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x69, 0x97, 0x16}}, /* 9 */
+    {  2,   0,  1,  4,  5, 0, (const uint8_t[]){0x90}}, /* : */
+    {  1,  -1,  2,  5,  5, 0, (const uint8_t[]){0x45, 0x80}}, /* ; */
+    {  1,   0,  3,  6,  5, 0, (const uint8_t[]){0x2A, 0x44, 0x40}}, /* < */
+    {  0,   1,  4,  3,  5, 0, (const uint8_t[]){0xF0, 0xF0}}, /* = */
+    {  1,   0,  3,  6,  5, 0, (const uint8_t[]){0x88, 0x95, 0x00}}, /* > */
+    {  0,   0,  4,  7,  5, 0, (const uint8_t[]){0x69, 0x12, 0x40, 0x40}}, /* ? */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x69, 0xBB, 0x87}}, /* @ */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x69, 0x9F, 0x99}}, /* A */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0xE9, 0xE9, 0x9E}}, /* B */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x78, 0x88, 0x87}}, /* C */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0xE9, 0x99, 0x9E}}, /* D */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x78, 0xE8, 0x87}}, /* E */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x78, 0x8E, 0x88}}, /* F */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x78, 0xB9, 0x97}}, /* G */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x99, 0xF9, 0x99}}, /* H */
+    {  1,   0,  3,  6,  5, 1, (const uint8_t[]){0x3B, 0xAE}}, /* I */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x72, 0x22, 0x2C}}, /* J */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x99, 0xE9, 0x99}}, /* K */
+    {  0,   0,  4,  6,  5, 1, (const uint8_t[]){0x7A, 0x1C}}, /* L */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x9F, 0xF9, 0x99}}, /* M */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x9D, 0xDB, 0xB9}}, /* N */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x69, 0x99, 0x96}}, /* O */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0xE9, 0x9E, 0x88}}, /* P */
+    {  0,  -1,  4,  7,  5, 1, (const uint8_t[]){0x38, 0xD2, 0xC6}}, /* Q */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0xE9, 0x9E, 0x99}}, /* R */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x78, 0x61, 0x1E}}, /* S */
+    {  0,   0,  5,  6,  5, 1, (const uint8_t[]){0x3F, 0xE4}}, /* T */
+    {  0,   0,  4,  6,  5, 1, (const uint8_t[]){0x7A, 0x5C}}, /* U */
+    {  0,   0,  4,  6,  5, 1, (const uint8_t[]){0x76, 0x58}}, /* V */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x99, 0x9F, 0xF9}}, /* W */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x99, 0x66, 0x99}}, /* X */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0x99, 0x97, 0x1E}}, /* Y */
+    {  0,   0,  4,  6,  5, 0, (const uint8_t[]){0xF1, 0x24, 0x8F}}, /* Z */
+    {  1,  -1,  3,  8,  5, 0, (const uint8_t[]){0xF2, 0x49, 0x27}}, /* [ */
+    {  0,  -1,  4,  8,  5, 1, (const uint8_t[]){0x55, 0x84, 0x21}}, /* \ */
+    {  1,  -1,  3,  8,  5, 0, (const uint8_t[]){0xE4, 0x92, 0x4F}}, /* ] */
+    {  0,   3,  5,  3,  5, 0, (const uint8_t[]){0x22, 0xA2}}, /* ^ */
+    {  0,  -1,  4,  1,  5, 0, (const uint8_t[]){0xF0}}, /* _ */
+    {  1,   5,  2,  2,  5, 0, (const uint8_t[]){0x90}}, /* ` */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0x61, 0x79, 0x70}}, /* a */
+    {  0,   0,  4,  7,  5, 1, (const uint8_t[]){0x4D, 0x1D, 0x3C}}, /* b */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0x78, 0x88, 0x70}}, /* c */
+    {  0,   0,  4,  7,  5, 1, (const uint8_t[]){0x4C, 0x2F, 0x2E}}, /* d */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0x79, 0xF8, 0x70}}, /* e */
+    {  0,   0,  4,  7,  5, 1, (const uint8_t[]){0x26, 0x69, 0xC8}}, /* f */
+    {  0,  -1,  4,  6,  5, 0, (const uint8_t[]){0x79, 0x96, 0x1E}}, /* g */
+    {  0,   0,  4,  7,  5, 1, (const uint8_t[]){0x4F, 0x1D, 0x20}}, /* h */
+    {  1,   0,  3,  6,  5, 0, (const uint8_t[]){0x43, 0x24, 0xC0}}, /* i */
+    {  0,  -1,  3,  7,  5, 0, (const uint8_t[]){0x20, 0x92, 0x70}}, /* j */
+    {  0,   0,  4,  7,  5, 0, (const uint8_t[]){0x88, 0x9A, 0xCA, 0x90}}, /* k */
+    {  1,   0,  3,  7,  5, 1, (const uint8_t[]){0x7D, 0x18}}, /* l */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0x9F, 0xF9, 0x90}}, /* m */
+    {  0,   0,  4,  5,  5, 1, (const uint8_t[]){0x3F, 0x48}}, /* n */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0x69, 0x99, 0x60}}, /* o */
+    {  0,  -1,  4,  6,  5, 0, (const uint8_t[]){0xE9, 0x9E, 0x88}}, /* p */
+    {  0,  -1,  4,  6,  5, 0, (const uint8_t[]){0x79, 0x97, 0x11}}, /* q */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0x79, 0x88, 0x80}}, /* r */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0x78, 0x61, 0xE0}}, /* s */
+    {  0,   0,  4,  7,  5, 1, (const uint8_t[]){0x4C, 0x9C, 0x86}}, /* t */
+    {  0,   0,  4,  5,  5, 1, (const uint8_t[]){0x74, 0xB8}}, /* u */
+    {  0,   0,  4,  5,  5, 1, (const uint8_t[]){0x6C, 0xB0}}, /* v */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0x99, 0xFF, 0x90}}, /* w */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0x96, 0x69, 0x90}}, /* x */
+    {  0,  -1,  4,  6,  5, 0, (const uint8_t[]){0x99, 0x97, 0x1E}}, /* y */
+    {  0,   0,  4,  5,  5, 0, (const uint8_t[]){0xF1, 0x24, 0xF0}}, /* z */
+    {  0,  -1,  4,  8,  5, 0, (const uint8_t[]){0x34, 0x4C, 0xC4, 0x43}}, /* { */
+    {  2,  -1,  1,  8,  5, 0, (const uint8_t[]){0xFF}}, /* | */
+    {  0,  -1,  4,  8,  5, 0, (const uint8_t[]){0xC2, 0x23, 0x32, 0x2C}}, /* } */
+    {  0,   2,  5,  2,  5, 0, (const uint8_t[]){0x4D, 0x80}}, /* ~ */
+    {  0,   0,  0,  0,  5, 0, NULL}, /* � */
 };
-const ILI9341_FontDef ILI9341_Font_Spleen5x8 = { 0x20, 0x7F, 50, 7, 1, ILI9341_Font_Spleen5x8_Glyphs };
+static const ILI9341_FontRangeDef ILI9341_Font_Spleen5x8_Ranges[] = {{0x20, 0x7F, 0x00}};
+const ILI9341_FontDef ILI9341_Font_Spleen5x8 = { ILI9341_Font_Spleen5x8_Ranges, 1, 50, 7, 1, ILI9341_Font_Spleen5x8_Glyphs, NULL, 0, NULL };
 
 static const ILI9341_GlyphDef ILI9341_Font_Spleen6x12_Glyphs[] = {
-    {  0,   0,  0,  0,  6, NULL}, /*   */
-    {  2,   0,  1,  8,  6, (const uint8_t[]){0xFD}}, /* ! */
-    {  1,   5,  3,  3,  6, (const uint8_t[]){0xB6, 0x80}}, /* " */
-    {  0,   0,  5,  7,  6, (const uint8_t[]){0x57, 0xD4, 0xA5, 0x7D, 0x40}}, /* # */
-    {  0,  -1,  5, 10,  6, (const uint8_t[]){0x23, 0xE9, 0x47, 0x14, 0xA5, 0xF1, 0x00}}, /* $ */
-    {  1,   0,  4,  8,  6, (const uint8_t[]){0x19, 0xA2, 0x45, 0x98}}, /* % */
-    {  0,   0,  6,  8,  6, (const uint8_t[]){0x31, 0x24, 0x8C, 0x62, 0x58, 0x9D}}, /* & */
-    {  2,   5,  1,  3,  6, (const uint8_t[]){0xE0}}, /* ' */
-    {  1,  -1,  4, 10,  6, (const uint8_t[]){0x34, 0x88, 0x88, 0x88, 0x43}}, /* ( */
-    {  1,  -1,  4, 10,  6, (const uint8_t[]){0xC2, 0x11, 0x11, 0x11, 0x2C}}, /* ) */
-    {  0,   1,  6,  5,  6, (const uint8_t[]){0x48, 0xCF, 0xCC, 0x48}}, /* * */
-    {  0,   1,  5,  5,  6, (const uint8_t[]){0x21, 0x3E, 0x42, 0x00}}, /* + */
-    {  1,  -1,  2,  3,  6, (const uint8_t[]){0x58}}, /* , */
-    {  0,   3,  5,  1,  6, (const uint8_t[]){0xF8}}, /* - */
-    {  2,   0,  1,  1,  6, (const uint8_t[]){0x80}}, /* . */
-    {  0,  -1,  5, 10,  6, (const uint8_t[]){0x08, 0x44, 0x22, 0x11, 0x08, 0x84, 0x00}}, /* / */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x74, 0x67, 0x5C, 0xC6, 0x2E}}, /* 0 */
-    {  1,   0,  3,  8,  6, (const uint8_t[]){0x59, 0x24, 0x97}}, /* 1 */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x74, 0x42, 0x17, 0x42, 0x1F}}, /* 2 */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x74, 0x42, 0x60, 0x86, 0x2E}}, /* 3 */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x84, 0x25, 0x29, 0x7C, 0x42}}, /* 4 */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0xFC, 0x21, 0xE0, 0x84, 0x3E}}, /* 5 */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x74, 0x21, 0xE8, 0xC6, 0x2E}}, /* 6 */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0xFC, 0x42, 0x22, 0x10, 0x84}}, /* 7 */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x74, 0x62, 0xE8, 0xC6, 0x2E}}, /* 8 */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x74, 0x63, 0x17, 0x84, 0x2E}}, /* 9 */
-    {  2,   0,  1,  5,  6, (const uint8_t[]){0x88}}, /* : */
-    {  1,  -1,  2,  6,  6, (const uint8_t[]){0x41, 0x60}}, /* ; */
-    {  1,   0,  4,  8,  6, (const uint8_t[]){0x12, 0x48, 0x84, 0x21}}, /* < */
-    {  0,   2,  5,  3,  6, (const uint8_t[]){0xF8, 0x3E}}, /* = */
-    {  1,   0,  4,  8,  6, (const uint8_t[]){0x84, 0x21, 0x12, 0x48}}, /* > */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x74, 0x42, 0x22, 0x10, 0x04}}, /* ? */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x74, 0x63, 0x7B, 0xDE, 0x0F}}, /* @ */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x74, 0x63, 0x1F, 0xC6, 0x31}}, /* A */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0xF4, 0x63, 0xE8, 0xC6, 0x3E}}, /* B */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x7C, 0x21, 0x08, 0x42, 0x0F}}, /* C */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0xF4, 0x63, 0x18, 0xC6, 0x3E}}, /* D */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x7C, 0x21, 0xE8, 0x42, 0x0F}}, /* E */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x7C, 0x21, 0xE8, 0x42, 0x10}}, /* F */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x7C, 0x21, 0x78, 0xC6, 0x2F}}, /* G */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x8C, 0x63, 0xF8, 0xC6, 0x31}}, /* H */
-    {  1,   0,  3,  8,  6, (const uint8_t[]){0xE9, 0x24, 0x97}}, /* I */
-    {  0,   0,  4,  8,  6, (const uint8_t[]){0x72, 0x22, 0x22, 0x2C}}, /* J */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x8C, 0x65, 0xC9, 0x46, 0x31}}, /* K */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x84, 0x21, 0x08, 0x42, 0x0F}}, /* L */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x8E, 0xFF, 0x58, 0xC6, 0x31}}, /* M */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x8E, 0x73, 0x5A, 0xCE, 0x71}}, /* N */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x74, 0x63, 0x18, 0xC6, 0x2E}}, /* O */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0xF4, 0x63, 0x1F, 0x42, 0x10}}, /* P */
-    {  0,  -1,  5,  9,  6, (const uint8_t[]){0x74, 0x63, 0x18, 0xC6, 0x2E, 0x18}}, /* Q */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0xF4, 0x63, 0x1F, 0x46, 0x31}}, /* R */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x7C, 0x20, 0xE0, 0x84, 0x3E}}, /* S */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0xF9, 0x08, 0x42, 0x10, 0x84}}, /* T */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x8C, 0x63, 0x18, 0xC6, 0x2F}}, /* U */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x8C, 0x63, 0x18, 0xC5, 0xCE}}, /* V */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x8C, 0x63, 0x1A, 0xFF, 0x71}}, /* W */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x8C, 0x54, 0x45, 0x46, 0x31}}, /* X */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x8C, 0x63, 0x17, 0x84, 0x3E}}, /* Y */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0xF8, 0x44, 0x44, 0x42, 0x1F}}, /* Z */
-    {  1,  -1,  4, 10,  6, (const uint8_t[]){0xF8, 0x88, 0x88, 0x88, 0x8F}}, /* [ */
-    {  0,  -1,  5, 10,  6, (const uint8_t[]){0x84, 0x10, 0x82, 0x10, 0x42, 0x08, 0x40}}, /* \ */
-    {  1,  -1,  4, 10,  6, (const uint8_t[]){0xF1, 0x11, 0x11, 0x11, 0x1F}}, /* ] */
-    {  0,   5,  5,  3,  6, (const uint8_t[]){0x22, 0xA2}}, /* ^ */
-    {  0,  -1,  5,  1,  6, (const uint8_t[]){0xF8}}, /* _ */
-    {  1,   5,  3,  3,  6, (const uint8_t[]){0x88, 0x80}}, /* ` */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0x70, 0x5F, 0x18, 0xBC}}, /* a */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x84, 0x3D, 0x18, 0xC6, 0x3E}}, /* b */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0x7C, 0x21, 0x08, 0x3C}}, /* c */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x08, 0x5F, 0x18, 0xC6, 0x2F}}, /* d */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0x7C, 0x63, 0xF8, 0x3C}}, /* e */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x3A, 0x11, 0xE4, 0x21, 0x08}}, /* f */
-    {  0,  -2,  5,  8,  6, (const uint8_t[]){0x7C, 0x63, 0x18, 0xB8, 0x3E}}, /* g */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x84, 0x3D, 0x18, 0xC6, 0x31}}, /* h */
-    {  1,   0,  3,  8,  6, (const uint8_t[]){0x43, 0x24, 0x93}}, /* i */
-    {  1,  -1,  3,  9,  6, (const uint8_t[]){0x20, 0x92, 0x49, 0xC0}}, /* j */
-    {  0,   0,  5,  8,  6, (const uint8_t[]){0x84, 0x25, 0x4C, 0x52, 0x51}}, /* k */
-    {  1,   0,  3,  8,  6, (const uint8_t[]){0x92, 0x49, 0x23}}, /* l */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0xF5, 0x6B, 0x58, 0xC4}}, /* m */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0xF4, 0x63, 0x18, 0xC4}}, /* n */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0x74, 0x63, 0x18, 0xB8}}, /* o */
-    {  0,  -3,  5,  9,  6, (const uint8_t[]){0xF4, 0x63, 0x18, 0xFA, 0x10, 0x80}}, /* p */
-    {  0,  -3,  5,  9,  6, (const uint8_t[]){0x7C, 0x63, 0x18, 0xBC, 0x21, 0x08}}, /* q */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0x7C, 0x61, 0x08, 0x40}}, /* r */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0x7C, 0x1C, 0x10, 0xF8}}, /* s */
-    {  0,   0,  4,  8,  6, (const uint8_t[]){0x44, 0xE4, 0x44, 0x43}}, /* t */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0x8C, 0x63, 0x18, 0xBC}}, /* u */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0x8C, 0x63, 0x15, 0x10}}, /* v */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0x8C, 0x6B, 0xFD, 0xC4}}, /* w */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0x8C, 0x5C, 0xE8, 0xC4}}, /* x */
-    {  0,  -3,  5,  9,  6, (const uint8_t[]){0x8C, 0x63, 0x18, 0xBC, 0x21, 0xF0}}, /* y */
-    {  0,   0,  5,  6,  6, (const uint8_t[]){0xF8, 0x44, 0x44, 0x7C}}, /* z */
-    {  0,  -1,  5, 10,  6, (const uint8_t[]){0x19, 0x08, 0x4C, 0x60, 0x84, 0x20, 0xC0}}, /* { */
-    {  2,  -1,  1, 10,  6, (const uint8_t[]){0xFF, 0xC0}}, /* | */
-    {  1,  -1,  5, 10,  6, (const uint8_t[]){0xC1, 0x08, 0x41, 0x8C, 0x84, 0x26, 0x00}}, /* } */
-    {  0,   2,  5,  2,  6, (const uint8_t[]){0x4D, 0x80}}, /* ~ */
-    {  0,   0,  0,  0,  6, NULL}, /* � */
+    {  0,   0,  0,  0,  6, 0, NULL}, /*   */
+    {  2,   0,  1,  8,  6, 0, (const uint8_t[]){0xFD}}, /* ! */
+    {  1,   5,  3,  3,  6, 1, (const uint8_t[]){0x74}}, /* " */
+    {  0,   0,  5,  7,  6, 1, (const uint8_t[]){0x18, 0xAF, 0xAB, 0xEA}}, /* # */
+    {  0,  -1,  5, 10,  6, 1, (const uint8_t[]){0x13, 0x08, 0xFA, 0x38, 0xBE, 0x20}}, /* $ */
+    {  1,   0,  4,  8,  6, 0, (const uint8_t[]){0x19, 0xA2, 0x45, 0x98}}, /* % */
+    {  0,   0,  6,  8,  6, 0, (const uint8_t[]){0x31, 0x24, 0x8C, 0x62, 0x58, 0x9D}}, /* & */
+    {  2,   5,  1,  3,  6, 0, (const uint8_t[]){0xE0}}, /* ' */
+    {  1,  -1,  4, 10,  6, 1, (const uint8_t[]){0x1F, 0x0D, 0x21, 0x0C}}, /* ( */
+    {  1,  -1,  4, 10,  6, 1, (const uint8_t[]){0x1F, 0x30, 0x84, 0xB0}}, /* ) */
+    {  0,   1,  6,  5,  6, 0, (const uint8_t[]){0x48, 0xCF, 0xCC, 0x48}}, /* * */
+    {  0,   1,  5,  5,  6, 1, (const uint8_t[]){0x49, 0x3E, 0x40}}, /* + */
+    {  1,  -1,  2,  3,  6, 0, (const uint8_t[]){0x58}}, /* , */
+    {  0,   3,  5,  1,  6, 0, (const uint8_t[]){0xF8}}, /* - */
+    {  2,   0,  1,  1,  6, 0, (const uint8_t[]){0x80}}, /* . */
+    {  0,  -1,  5, 10,  6, 1, (const uint8_t[]){0x55, 0x42, 0x22, 0x22, 0x00}}, /* / */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x67, 0x5C, 0xC6, 0x2E}}, /* 0 */
+    {  1,   0,  3,  8,  6, 0, (const uint8_t[]){0x59, 0x24, 0x97}}, /* 1 */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x42, 0x17, 0x42, 0x1F}}, /* 2 */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x42, 0x60, 0x86, 0x2E}}, /* 3 */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x59, 0x84, 0xBE, 0x20}}, /* 4 */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0xFC, 0x21, 0xE0, 0x84, 0x3E}}, /* 5 */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x21, 0xE8, 0xC6, 0x2E}}, /* 6 */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0xFC, 0x42, 0x22, 0x10, 0x84}}, /* 7 */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x62, 0xE8, 0xC6, 0x2E}}, /* 8 */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x63, 0x17, 0x84, 0x2E}}, /* 9 */
+    {  2,   0,  1,  5,  6, 0, (const uint8_t[]){0x88}}, /* : */
+    {  1,  -1,  2,  6,  6, 0, (const uint8_t[]){0x41, 0x60}}, /* ; */
+    {  1,   0,  4,  8,  6, 0, (const uint8_t[]){0x12, 0x48, 0x84, 0x21}}, /* < */
+    {  0,   2,  5,  3,  6, 0, (const uint8_t[]){0xF8, 0x3E}}, /* = */
+    {  1,   0,  4,  8,  6, 0, (const uint8_t[]){0x84, 0x21, 0x12, 0x48}}, /* > */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x42, 0x22, 0x10, 0x04}}, /* ? */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x74, 0x63, 0x7B, 0xDE, 0x0F}}, /* @ */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x33, 0x74, 0x7F, 0x10}}, /* A */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0xF4, 0x63, 0xE8, 0xC6, 0x3E}}, /* B */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x3E, 0x7C, 0x1E}}, /* C */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x3E, 0xF4, 0x7C}}, /* D */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x7C, 0x21, 0xE8, 0x42, 0x0F}}, /* E */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x27, 0x7C, 0x3D, 0x00}}, /* F */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x7C, 0x21, 0x78, 0xC6, 0x2F}}, /* G */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x67, 0x8F, 0xE2}}, /* H */
+    {  1,   0,  3,  8,  6, 0, (const uint8_t[]){0xE9, 0x24, 0x97}}, /* I */
+    {  0,   0,  4,  8,  6, 1, (const uint8_t[]){0x3E, 0x72, 0xC0}}, /* J */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x8C, 0x65, 0xC9, 0x46, 0x31}}, /* K */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x7E, 0x83, 0xC0}}, /* L */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x8E, 0xFF, 0x58, 0xC6, 0x31}}, /* M */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x8E, 0x73, 0x5A, 0xCE, 0x71}}, /* N */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x3E, 0x74, 0x5C}}, /* O */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x33, 0xF4, 0x7D, 0x00}}, /* P */
+    {  0,  -1,  5,  9,  6, 1, (const uint8_t[]){0x3E, 0x3A, 0x2E, 0x18}}, /* Q */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x33, 0xF4, 0x7D, 0x10}}, /* R */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x7C, 0x20, 0xE0, 0x84, 0x3E}}, /* S */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x3F, 0xF9, 0x00}}, /* T */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x7E, 0x8B, 0xC0}}, /* U */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x7D, 0x8B, 0x80}}, /* V */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x8C, 0x63, 0x1A, 0xFF, 0x71}}, /* W */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x8C, 0x54, 0x45, 0x46, 0x31}}, /* X */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x72, 0x8B, 0xC3, 0xE0}}, /* Y */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0xF8, 0x44, 0x44, 0x42, 0x1F}}, /* Z */
+    {  1,  -1,  4, 10,  6, 1, (const uint8_t[]){0x3F, 0xBE, 0x3C}}, /* [ */
+    {  0,  -1,  5, 10,  6, 1, (const uint8_t[]){0x55, 0x60, 0x82, 0x08, 0x20}}, /* \ */
+    {  1,  -1,  4, 10,  6, 1, (const uint8_t[]){0x3F, 0xBC, 0x7C}}, /* ] */
+    {  0,   5,  5,  3,  6, 0, (const uint8_t[]){0x22, 0xA2}}, /* ^ */
+    {  0,  -1,  5,  1,  6, 0, (const uint8_t[]){0xF8}}, /* _ */
+    {  1,   5,  3,  3,  6, 0, (const uint8_t[]){0x88, 0x80}}, /* ` */
+    {  0,   0,  5,  6,  6, 0, (const uint8_t[]){0x70, 0x5F, 0x18, 0xBC}}, /* a */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x4E, 0x87, 0xA3, 0xE0}}, /* b */
+    {  0,   0,  5,  6,  6, 1, (const uint8_t[]){0x39, 0xF0, 0x78}}, /* c */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x4E, 0x0B, 0xE2, 0xF0}}, /* d */
+    {  0,   0,  5,  6,  6, 0, (const uint8_t[]){0x7C, 0x63, 0xF8, 0x3C}}, /* e */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x27, 0x3A, 0x3C, 0x80}}, /* f */
+    {  0,  -2,  5,  8,  6, 0, (const uint8_t[]){0x7C, 0x63, 0x18, 0xB8, 0x3E}}, /* g */
+    {  0,   0,  5,  8,  6, 1, (const uint8_t[]){0x4F, 0x87, 0xA2}}, /* h */
+    {  1,   0,  3,  8,  6, 0, (const uint8_t[]){0x43, 0x24, 0x93}}, /* i */
+    {  1,  -1,  3,  9,  6, 1, (const uint8_t[]){0x1F, 0x10, 0x70}}, /* j */
+    {  0,   0,  5,  8,  6, 0, (const uint8_t[]){0x84, 0x25, 0x4C, 0x52, 0x51}}, /* k */
+    {  1,   0,  3,  8,  6, 1, (const uint8_t[]){0x7E, 0x8C}}, /* l */
+    {  0,   0,  5,  6,  6, 1, (const uint8_t[]){0x37, 0xD5, 0x88}}, /* m */
+    {  0,   0,  5,  6,  6, 1, (const uint8_t[]){0x3F, 0xD1}}, /* n */
+    {  0,   0,  5,  6,  6, 1, (const uint8_t[]){0x39, 0xD1, 0x70}}, /* o */
+    {  0,  -3,  5,  9,  6, 1, (const uint8_t[]){0x39, 0xFA, 0x3E, 0x80}}, /* p */
+    {  0,  -3,  5,  9,  6, 1, (const uint8_t[]){0x39, 0xBE, 0x2F, 0x08}}, /* q */
+    {  0,   0,  5,  6,  6, 1, (const uint8_t[]){0x1D, 0xF1, 0x80}}, /* r */
+    {  0,   0,  5,  6,  6, 0, (const uint8_t[]){0x7C, 0x1C, 0x10, 0xF8}}, /* s */
+    {  0,   0,  4,  8,  6, 1, (const uint8_t[]){0x4E, 0x4E, 0x43}}, /* t */
+    {  0,   0,  5,  6,  6, 1, (const uint8_t[]){0x7A, 0x2F}}, /* u */
+    {  0,   0,  5,  6,  6, 1, (const uint8_t[]){0x72, 0x2A, 0x20}}, /* v */
+    {  0,   0,  5,  6,  6, 0, (const uint8_t[]){0x8C, 0x6B, 0xFD, 0xC4}}, /* w */
+    {  0,   0,  5,  6,  6, 1, (const uint8_t[]){0x56, 0x2E, 0x88}}, /* x */
+    {  0,  -3,  5,  9,  6, 1, (const uint8_t[]){0x79, 0x45, 0xE1, 0xF0}}, /* y */
+    {  0,   0,  5,  6,  6, 0, (const uint8_t[]){0xF8, 0x44, 0x44, 0x7C}}, /* z */
+    {  0,  -1,  5, 10,  6, 1, (const uint8_t[]){0x35, 0x86, 0x4C, 0x10, 0x60}}, /* { */
+    {  2,  -1,  1, 10,  6, 0, (const uint8_t[]){0xFF, 0xC0}}, /* | */
+    {  1,  -1,  5, 10,  6, 1, (const uint8_t[]){0x35, 0xB0, 0x41, 0x93, 0x00}}, /* } */
+    {  0,   2,  5,  2,  6, 0, (const uint8_t[]){0x4D, 0x80}}, /* ~ */
+    {  0,   0,  0,  0,  6, 0, NULL}, /* � */
 };
-const ILI9341_FontDef ILI9341_Font_Spleen6x12 = { 0x20, 0x7F, 60, 9, 3, ILI9341_Font_Spleen6x12_Glyphs };
+static const ILI9341_FontRangeDef ILI9341_Font_Spleen6x12_Ranges[] = {{0x20, 0x7F, 0x00}};
+const ILI9341_FontDef ILI9341_Font_Spleen6x12 = { ILI9341_Font_Spleen6x12_Ranges, 1, 60, 9, 3, ILI9341_Font_Spleen6x12_Glyphs, NULL, 0, NULL };
 
 static const ILI9341_GlyphDef ILI9341_Font_Spleen8x16_Glyphs[] = {
-    {  0,   0,  0,  0,  8, NULL}, /*   */
-    {  3,   0,  2, 10,  8, (const uint8_t[]){0xFF, 0xFC, 0xF0}}, /* ! */
-    {  1,   7,  6,  4,  8, (const uint8_t[]){0xCF, 0x3C, 0xF3}}, /* " */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x6C, 0xDB, 0xFB, 0x66, 0xCD, 0x9B, 0x7F, 0x6C, 0xD8}}, /* # */
-    {  0,  -1,  7, 12,  8, (const uint8_t[]){0x10, 0xFF, 0x46, 0x8D, 0x0F, 0x85, 0x8B, 0x16, 0x2F, 0xF0, 0x80}}, /* $ */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x0F, 0x3D, 0x86, 0x30, 0xC6, 0x1B, 0xCF, 0x00}}, /* % */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x38, 0xD9, 0xB3, 0x63, 0x8E, 0x36, 0xE6, 0xCC, 0xF4}}, /* & */
-    {  3,   7,  2,  4,  8, (const uint8_t[]){0xFF}}, /* ' */
-    {  1,  -1,  6, 12,  8, (const uint8_t[]){0x1C, 0xC6, 0x18, 0xC3, 0x0C, 0x30, 0x61, 0x83, 0x07}}, /* ( */
-    {  1,  -1,  6, 12,  8, (const uint8_t[]){0xE0, 0xC1, 0x86, 0x0C, 0x30, 0xC3, 0x18, 0x63, 0x38}}, /* ) */
-    {  0,   1,  8,  7,  8, (const uint8_t[]){0x66, 0x3C, 0x18, 0xFF, 0x18, 0x3C, 0x66}}, /* * */
-    {  1,   2,  6,  5,  8, (const uint8_t[]){0x30, 0xCF, 0xCC, 0x30}}, /* + */
-    {  2,  -1,  3,  3,  8, (const uint8_t[]){0x6F, 0x00}}, /* , */
-    {  1,   4,  6,  1,  8, (const uint8_t[]){0xFC}}, /* - */
-    {  3,   0,  2,  2,  8, (const uint8_t[]){0xF0}}, /* . */
-    {  0,  -1,  7, 12,  8, (const uint8_t[]){0x06, 0x0C, 0x30, 0x61, 0x83, 0x0C, 0x18, 0x60, 0xC3, 0x06, 0x00}}, /* / */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7D, 0x8F, 0x1E, 0x7D, 0xFE, 0xF9, 0xE3, 0xC6, 0xF8}}, /* 0 */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x31, 0xCF, 0x2C, 0x30, 0xC3, 0x0C, 0x33, 0xF0}}, /* 1 */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7D, 0x8C, 0x18, 0x30, 0xC3, 0x0C, 0x30, 0xC7, 0xFC}}, /* 2 */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7D, 0x8C, 0x18, 0x33, 0xC0, 0xC1, 0x83, 0xC6, 0xF8}}, /* 3 */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC1, 0x83, 0x36, 0x6C, 0xD9, 0xBF, 0x86, 0x0C, 0x18}}, /* 4 */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xFF, 0x8F, 0x06, 0x0F, 0xC0, 0xC1, 0x83, 0xC6, 0xF8}}, /* 5 */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7D, 0x8F, 0x06, 0x0F, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8}}, /* 6 */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xFF, 0x8C, 0x18, 0x30, 0xC3, 0x0C, 0x18, 0x30, 0x60}}, /* 7 */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8}}, /* 8 */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7D, 0x8F, 0x1E, 0x3C, 0x6F, 0xC1, 0x83, 0xC6, 0xF8}}, /* 9 */
-    {  3,   0,  2,  7,  8, (const uint8_t[]){0xF0, 0x3C}}, /* : */
-    {  2,  -1,  3,  8,  8, (const uint8_t[]){0x6C, 0x00, 0xDE}}, /* ; */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x0C, 0x63, 0x18, 0xC3, 0x06, 0x0C, 0x18, 0x30}}, /* < */
-    {  1,   3,  6,  4,  8, (const uint8_t[]){0xFC, 0x00, 0x3F}}, /* = */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xC1, 0x83, 0x06, 0x0C, 0x31, 0x8C, 0x63, 0x00}}, /* > */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7D, 0x8C, 0x18, 0x61, 0x86, 0x0C, 0x00, 0x30, 0x60}}, /* ? */
-    {  0,   0,  7,  9,  8, (const uint8_t[]){0x7D, 0x87, 0x6E, 0xDD, 0xBB, 0x77, 0xE0, 0x7C}}, /* @ */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7D, 0x8F, 0x1E, 0x3F, 0xF8, 0xF1, 0xE3, 0xC7, 0x8C}}, /* A */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xFD, 0x8F, 0x1E, 0x3F, 0xD8, 0xF1, 0xE3, 0xC7, 0xF8}}, /* B */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7F, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFC}}, /* C */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xFD, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC7, 0xF8}}, /* D */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7F, 0x83, 0x06, 0x0F, 0x98, 0x30, 0x60, 0xC0, 0xFC}}, /* E */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7F, 0x83, 0x06, 0x0F, 0x98, 0x30, 0x60, 0xC1, 0x80}}, /* F */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7F, 0x83, 0x06, 0x0D, 0xF8, 0xF1, 0xE3, 0xC6, 0xFC}}, /* G */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC7, 0x8F, 0x1E, 0x3F, 0xF8, 0xF1, 0xE3, 0xC7, 0x8C}}, /* H */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0xFC, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x33, 0xF0}}, /* I */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7E, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x19, 0xE0}}, /* J */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC7, 0x8F, 0x1E, 0x6F, 0x99, 0xB1, 0xE3, 0xC7, 0x8C}}, /* K */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFC}}, /* L */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC7, 0xDF, 0xFE, 0xBC, 0x78, 0xF1, 0xE3, 0xC7, 0x8C}}, /* M */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC7, 0x8F, 0x9F, 0x3D, 0x7A, 0xF3, 0xE7, 0xC7, 0x8C}}, /* N */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7D, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC6, 0xF8}}, /* O */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xFD, 0x8F, 0x1E, 0x3F, 0xD8, 0x30, 0x60, 0xC1, 0x80}}, /* P */
-    {  0,  -2,  7, 12,  8, (const uint8_t[]){0x7D, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xEB, 0xD6, 0xF8, 0x60, 0x60}}, /* Q */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xFD, 0x8F, 0x1E, 0x3F, 0xD8, 0xF1, 0xE3, 0xC7, 0x8C}}, /* R */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x7F, 0x83, 0x06, 0x07, 0xC0, 0xC1, 0x83, 0x07, 0xF8}}, /* S */
-    {  0,   0,  8, 10,  8, (const uint8_t[]){0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18}}, /* T */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0xC6, 0xFC}}, /* U */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0xB6, 0x38, 0x20}}, /* V */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xF5, 0xFF, 0xEF, 0x8C}}, /* W */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC7, 0x8F, 0x1B, 0x63, 0x8D, 0xB1, 0xE3, 0xC7, 0x8C}}, /* X */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC7, 0x8F, 0x1E, 0x37, 0xE0, 0xC1, 0x83, 0x07, 0xF8}}, /* Y */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xFE, 0x0C, 0x18, 0x61, 0x86, 0x18, 0x60, 0xC1, 0xFC}}, /* Z */
-    {  2,  -1,  5, 12,  8, (const uint8_t[]){0xFE, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0xF0}}, /* [ */
-    {  0,  -1,  7, 12,  8, (const uint8_t[]){0xC1, 0x81, 0x83, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30}}, /* \ */
-    {  1,  -1,  5, 12,  8, (const uint8_t[]){0xF8, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC7, 0xF0}}, /* ] */
-    {  0,   7,  7,  4,  8, (const uint8_t[]){0x10, 0x71, 0xB6, 0x30}}, /* ^ */
-    {  0,  -3,  7,  1,  8, (const uint8_t[]){0xFE}}, /* _ */
-    {  2,   8,  4,  3,  8, (const uint8_t[]){0xC6, 0x30}}, /* ` */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0x7C, 0x0D, 0xFE, 0x3C, 0x78, 0xDF, 0x80}}, /* a */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC1, 0x83, 0x07, 0xEC, 0x78, 0xF1, 0xE3, 0xC7, 0xF8}}, /* b */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0x7F, 0x83, 0x06, 0x0C, 0x18, 0x1F, 0x80}}, /* c */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0x06, 0x0C, 0x1B, 0xFC, 0x78, 0xF1, 0xE3, 0xC6, 0xFC}}, /* d */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0x7F, 0x8F, 0x1F, 0xFC, 0x18, 0x1F, 0x80}}, /* e */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x3D, 0x86, 0x18, 0xF9, 0x86, 0x18, 0x61, 0x80}}, /* f */
-    {  0,  -3,  7, 10,  8, (const uint8_t[]){0x7F, 0x8F, 0x1E, 0x3C, 0x78, 0xDF, 0x03, 0x07, 0xF8}}, /* g */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC1, 0x83, 0x07, 0xEC, 0x78, 0xF1, 0xE3, 0xC7, 0x8C}}, /* h */
-    {  2,   0,  4, 10,  8, (const uint8_t[]){0x66, 0x0E, 0x66, 0x66, 0x67}}, /* i */
-    {  1,  -3,  4, 13,  8, (const uint8_t[]){0x33, 0x03, 0x33, 0x33, 0x33, 0x33, 0xE0}}, /* j */
-    {  0,   0,  7, 10,  8, (const uint8_t[]){0xC1, 0x83, 0x06, 0x6D, 0x9E, 0x3C, 0x6C, 0xCD, 0x8C}}, /* k */
-    {  2,   0,  4, 10,  8, (const uint8_t[]){0xCC, 0xCC, 0xCC, 0xCC, 0xC7}}, /* l */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0xED, 0xAF, 0x5E, 0xBD, 0x78, 0xF1, 0x80}}, /* m */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0xFD, 0x8F, 0x1E, 0x3C, 0x78, 0xF1, 0x80}}, /* n */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0x7D, 0x8F, 0x1E, 0x3C, 0x78, 0xDF, 0x00}}, /* o */
-    {  0,  -3,  7, 10,  8, (const uint8_t[]){0xFD, 0x8F, 0x1E, 0x3C, 0x78, 0xFF, 0x60, 0xC1, 0x80}}, /* p */
-    {  0,  -3,  7, 10,  8, (const uint8_t[]){0x7F, 0x8F, 0x1E, 0x3C, 0x78, 0xDF, 0x83, 0x06, 0x0C}}, /* q */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0x7F, 0x8F, 0x06, 0x0C, 0x18, 0x30, 0x00}}, /* r */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0x7F, 0x83, 0x03, 0xE0, 0x60, 0xFF, 0x00}}, /* s */
-    {  1,   0,  6, 10,  8, (const uint8_t[]){0x61, 0x86, 0x3E, 0x61, 0x86, 0x18, 0x60, 0xF0}}, /* t */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xDF, 0x80}}, /* u */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0xC7, 0x8F, 0x1E, 0x36, 0xC7, 0x04, 0x00}}, /* v */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0xC7, 0x8F, 0x5E, 0xBD, 0x7A, 0xDB, 0x80}}, /* w */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0xC6, 0xD8, 0xE1, 0xC6, 0xD8, 0xF1, 0x80}}, /* x */
-    {  0,  -3,  7, 10,  8, (const uint8_t[]){0xC7, 0x8F, 0x1E, 0x3C, 0x78, 0xDF, 0x83, 0x07, 0xF8}}, /* y */
-    {  0,   0,  7,  7,  8, (const uint8_t[]){0xFE, 0x0C, 0x30, 0xC3, 0x0C, 0x3F, 0x80}}, /* z */
-    {  1,  -1,  6, 12,  8, (const uint8_t[]){0x1C, 0xC3, 0x0C, 0x33, 0x8E, 0x0C, 0x30, 0xC3, 0x07}}, /* { */
-    {  3,  -1,  2, 12,  8, (const uint8_t[]){0xFF, 0xFF, 0xFF}}, /* | */
-    {  1,  -1,  6, 12,  8, (const uint8_t[]){0xE0, 0xC3, 0x0C, 0x30, 0x71, 0xCC, 0x30, 0xC3, 0x38}}, /* } */
-    {  1,   3,  6,  3,  8, (const uint8_t[]){0x67, 0xF9, 0x80}}, /* ~ */
-    {  0,   0,  0,  0,  8, NULL}, /* � */
+    {  0,   0,  0,  0,  8, 0, NULL}, /*   */
+    {  3,   0,  2, 10,  8, 1, (const uint8_t[]){0x7E, 0x73}}, /* ! */
+    {  1,   7,  6,  4,  8, 1, (const uint8_t[]){0x7C, 0xC0}}, /* " */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x4E, 0x5B, 0x7F, 0x6D, 0xFD, 0xB0}}, /* # */
+    {  0,  -1,  7, 12,  8, 1, (const uint8_t[]){0x19, 0xC1, 0x0F, 0xF4, 0x3E, 0x17, 0xF8, 0x40}}, /* $ */
+    {  1,   0,  6, 10,  8, 0, (const uint8_t[]){0x0F, 0x3D, 0x86, 0x30, 0xC6, 0x1B, 0xCF, 0x00}}, /* % */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x30, 0x8E, 0x36, 0x38, 0xE3, 0x6E, 0x67, 0xA0}}, /* & */
+    {  3,   7,  2,  4,  8, 0, (const uint8_t[]){0xFF}}, /* ' */
+    {  1,  -1,  6, 12,  8, 1, (const uint8_t[]){0x17, 0x41, 0xCC, 0x63, 0x06, 0x0C, 0x1C}}, /* ( */
+    {  1,  -1,  6, 12,  8, 1, (const uint8_t[]){0x17, 0x4E, 0x0C, 0x18, 0x31, 0x8C, 0xE0}}, /* ) */
+    {  0,   1,  8,  7,  8, 0, (const uint8_t[]){0x66, 0x3C, 0x18, 0xFF, 0x18, 0x3C, 0x66}}, /* * */
+    {  1,   2,  6,  5,  8, 1, (const uint8_t[]){0x49, 0x9F, 0x98}}, /* + */
+    {  2,  -1,  3,  3,  8, 0, (const uint8_t[]){0x6F, 0x00}}, /* , */
+    {  1,   4,  6,  1,  8, 0, (const uint8_t[]){0xFC}}, /* - */
+    {  3,   0,  2,  2,  8, 0, (const uint8_t[]){0xF0}}, /* . */
+    {  0,  -1,  7, 12,  8, 1, (const uint8_t[]){0x55, 0x50, 0x61, 0x86, 0x18, 0x61, 0x80}}, /* / */
+    {  0,   0,  7, 10,  8, 0, (const uint8_t[]){0x7D, 0x8F, 0x1E, 0x7D, 0xFE, 0xF9, 0xE3, 0xC6, 0xF8}}, /* 0 */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x07, 0x8C, 0x73, 0xCB, 0x0C, 0xFC}}, /* 1 */
+    {  0,   0,  7, 10,  8, 0, (const uint8_t[]){0x7D, 0x8C, 0x18, 0x30, 0xC3, 0x0C, 0x30, 0xC7, 0xFC}}, /* 2 */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x13, 0x1F, 0x63, 0x06, 0x78, 0x1E, 0x37, 0xC0}}, /* 3 */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x5C, 0xF0, 0x66, 0xFE, 0x18}}, /* 4 */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x13, 0x3F, 0xE3, 0xC1, 0xF8, 0x1E, 0x37, 0xC0}}, /* 5 */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x13, 0x9F, 0x63, 0xC1, 0xFB, 0x1B, 0xE0}}, /* 6 */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x11, 0xFF, 0xE3, 0x06, 0x18, 0x61, 0x80}}, /* 7 */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x33, 0x9F, 0x63, 0x7D, 0x8D, 0xF0}}, /* 8 */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x39, 0x1F, 0x63, 0x7E, 0x0F, 0x1B, 0xE0}}, /* 9 */
+    {  3,   0,  2,  7,  8, 0, (const uint8_t[]){0xF0, 0x3C}}, /* : */
+    {  2,  -1,  3,  8,  8, 0, (const uint8_t[]){0x6C, 0x00, 0xDE}}, /* ; */
+    {  1,   0,  6, 10,  8, 0, (const uint8_t[]){0x0C, 0x63, 0x18, 0xC3, 0x06, 0x0C, 0x18, 0x30}}, /* < */
+    {  1,   3,  6,  4,  8, 0, (const uint8_t[]){0xFC, 0x00, 0x3F}}, /* = */
+    {  1,   0,  6, 10,  8, 0, (const uint8_t[]){0xC1, 0x83, 0x06, 0x0C, 0x31, 0x8C, 0x63, 0x00}}, /* > */
+    {  0,   0,  7, 10,  8, 0, (const uint8_t[]){0x7D, 0x8C, 0x18, 0x61, 0x86, 0x0C, 0x00, 0x30, 0x60}}, /* ? */
+    {  0,   0,  7,  9,  8, 1, (const uint8_t[]){0x1C, 0x3E, 0xC3, 0xB7, 0x7E, 0x07, 0xC0}}, /* @ */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x33, 0xDF, 0x63, 0xFF, 0x8C}}, /* A */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x33, 0xBF, 0x63, 0xFD, 0x8F, 0xF0}}, /* B */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x3F, 0x9F, 0xE0, 0x7E}}, /* C */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x3F, 0xBF, 0x63, 0xFC}}, /* D */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x33, 0x9F, 0xE0, 0xF9, 0x81, 0xF8}}, /* E */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x33, 0xDF, 0xE0, 0xF9, 0x80}}, /* F */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x33, 0x9F, 0xE0, 0xDF, 0x8D, 0xF8}}, /* G */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x73, 0xF1, 0xFF, 0xC6}}, /* H */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x3F, 0xBF, 0x33, 0xF0}}, /* I */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x3F, 0x9F, 0x8C, 0xF0}}, /* J */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x61, 0xF1, 0xE6, 0xF9, 0x9B, 0x18}}, /* K */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x7F, 0xB0, 0x3F}}, /* L */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x07, 0xF1, 0xF7, 0xFF, 0xAF, 0x18}}, /* M */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x55, 0x71, 0xF3, 0xD7, 0x9F, 0x18}}, /* N */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x3F, 0x9F, 0x63, 0x7C}}, /* O */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x33, 0xFF, 0x63, 0xFD, 0x80}}, /* P */
+    {  0,  -2,  7, 12,  8, 1, (const uint8_t[]){0x3E, 0x87, 0xD8, 0xF5, 0xBE, 0x18, 0x18}}, /* Q */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x33, 0xFF, 0x63, 0xFD, 0x8C}}, /* R */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x33, 0x9F, 0xE0, 0x7C, 0x0F, 0xF0}}, /* S */
+    {  0,   0,  8, 10,  8, 1, (const uint8_t[]){0x3F, 0xFF, 0xC6, 0x00}}, /* T */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x7F, 0xB1, 0xBF}}, /* U */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x7E, 0x31, 0xB6, 0x38, 0x20}}, /* V */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x7C, 0x31, 0xEB, 0xFF, 0xDF, 0x18}}, /* W */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x61, 0xF1, 0xB6, 0x38, 0xDB, 0x18}}, /* X */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x73, 0xB1, 0xBF, 0x07, 0xF8}}, /* Y */
+    {  0,   0,  7, 10,  8, 0, (const uint8_t[]){0xFE, 0x0C, 0x18, 0x61, 0x86, 0x18, 0x60, 0xC1, 0xFC}}, /* Z */
+    {  2,  -1,  5, 12,  8, 1, (const uint8_t[]){0x3F, 0xEF, 0xE3, 0xE0}}, /* [ */
+    {  0,  -1,  7, 12,  8, 1, (const uint8_t[]){0x55, 0x5C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C}}, /* \ */
+    {  1,  -1,  5, 12,  8, 1, (const uint8_t[]){0x3F, 0xEF, 0x8F, 0xE0}}, /* ] */
+    {  0,   7,  7,  4,  8, 0, (const uint8_t[]){0x10, 0x71, 0xB6, 0x30}}, /* ^ */
+    {  0,  -3,  7,  1,  8, 0, (const uint8_t[]){0xFE}}, /* _ */
+    {  2,   8,  4,  3,  8, 0, (const uint8_t[]){0xC6, 0x30}}, /* ` */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x0C, 0xF8, 0x1B, 0xFC, 0x6F, 0xC0}}, /* a */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x67, 0xB0, 0x7E, 0xC7, 0xF8}}, /* b */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x3C, 0xFF, 0x03, 0xF0}}, /* c */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x67, 0x81, 0xBF, 0xC6, 0xFC}}, /* d */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x24, 0xFF, 0x1F, 0xFC, 0x0F, 0xC0}}, /* e */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x33, 0xCF, 0x63, 0xE6, 0x00}}, /* f */
+    {  0,  -3,  7, 10,  8, 1, (const uint8_t[]){0x3C, 0x9F, 0xE3, 0x7C, 0x0F, 0xF0}}, /* g */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x67, 0xF0, 0x7E, 0xC6}}, /* h */
+    {  2,   0,  4, 10,  8, 1, (const uint8_t[]){0x47, 0x98, 0x39, 0x9C}}, /* i */
+    {  1,  -3,  4, 13,  8, 1, (const uint8_t[]){0x4F, 0xF1, 0x81, 0xF0}}, /* j */
+    {  0,   0,  7, 10,  8, 1, (const uint8_t[]){0x62, 0x30, 0x66, 0xD9, 0xE3, 0x66, 0x6C, 0x60}}, /* k */
+    {  2,   0,  4, 10,  8, 1, (const uint8_t[]){0x7F, 0xB1, 0xC0}}, /* l */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x3B, 0xDB, 0x5E, 0x30}}, /* m */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x3F, 0xFB, 0x18}}, /* n */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x3C, 0xFB, 0x1B, 0xE0}}, /* o */
+    {  0,  -3,  7, 10,  8, 1, (const uint8_t[]){0x3C, 0xFF, 0x63, 0xFD, 0x80}}, /* p */
+    {  0,  -3,  7, 10,  8, 1, (const uint8_t[]){0x3C, 0xDF, 0xE3, 0x7E, 0x0C}}, /* q */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x1E, 0xFF, 0x1E, 0x00}}, /* r */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x24, 0xFF, 0x03, 0xE0, 0x7F, 0x80}}, /* s */
+    {  1,   0,  6, 10,  8, 1, (const uint8_t[]){0x67, 0x98, 0xF9, 0x83, 0xC0}}, /* t */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x7D, 0x8D, 0xF8}}, /* u */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x71, 0x8D, 0xB1, 0xC1, 0x00}}, /* v */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x5D, 0x8F, 0x5B, 0x70}}, /* w */
+    {  0,   0,  7,  7,  8, 1, (const uint8_t[]){0x13, 0x8D, 0xB1, 0xC6, 0xD8, 0xC0}}, /* x */
+    {  0,  -3,  7, 10,  8, 1, (const uint8_t[]){0x7C, 0xB1, 0xBF, 0x07, 0xF8}}, /* y */
+    {  0,   0,  7,  7,  8, 0, (const uint8_t[]){0xFE, 0x0C, 0x30, 0xC3, 0x0C, 0x3F, 0x80}}, /* z */
+    {  1,  -1,  6, 12,  8, 1, (const uint8_t[]){0x3A, 0xE1, 0xCC, 0xE0, 0xC1, 0xC0}}, /* { */
+    {  3,  -1,  2, 12,  8, 1, (const uint8_t[]){0x7F, 0xFC}}, /* | */
+    {  1,  -1,  6, 12,  8, 1, (const uint8_t[]){0x3A, 0xEE, 0x0C, 0x1C, 0xCE, 0x00}}, /* } */
+    {  1,   3,  6,  3,  8, 0, (const uint8_t[]){0x67, 0xF9, 0x80}}, /* ~ */
+    {  0,   0,  0,  0,  8, 0, NULL}, /* � */
 };
-const ILI9341_FontDef ILI9341_Font_Spleen8x16 = { 0x20, 0x7F, 80, 12, 4, ILI9341_Font_Spleen8x16_Glyphs };
+static const ILI9341_FontRangeDef ILI9341_Font_Spleen8x16_Ranges[] = {{0x20, 0x7F, 0x00}};
+const ILI9341_FontDef ILI9341_Font_Spleen8x16 = { ILI9341_Font_Spleen8x16_Ranges, 1, 80, 12, 4, ILI9341_Font_Spleen8x16_Glyphs, NULL, 0, NULL };
 
 static const ILI9341_GlyphDef ILI9341_Font_Spleen12x24_Glyphs[] = {
-    {  0,   0,  0,  0, 12, NULL}, /*   */
-    {  5,   0,  2, 15, 12, (const uint8_t[]){0xFF, 0xFF, 0xFC, 0x3C}}, /* ! */
-    {  2,  10,  8,  7, 12, (const uint8_t[]){0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3}}, /* " */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x61, 0x98, 0x66, 0x1B, 0xFF, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xFF, 0x61, 0x98, 0x66, 0x18}}, /* # */
-    {  1,  -2, 10, 19, 12, (const uint8_t[]){0x0C, 0x03, 0x03, 0xFD, 0xB0, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0x6C, 0x0F, 0xC0, 0xD8, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x36, 0xFF, 0x03, 0x00, 0xC0}}, /* $ */
-    {  1,   0, 10, 14, 12, (const uint8_t[]){0x01, 0x9C, 0x6D, 0xB3, 0x6C, 0x76, 0x01, 0x80, 0xC0, 0x30, 0x18, 0x06, 0xE3, 0x6C, 0xDB, 0x63, 0x98, 0x00}}, /* % */
-    {  1,   0, 11, 15, 12, (const uint8_t[]){0x1E, 0x06, 0x61, 0x86, 0x30, 0xC6, 0x18, 0xC3, 0x0C, 0xC0, 0xF0, 0x66, 0x18, 0x6B, 0x07, 0x60, 0xCC, 0x18, 0xC7, 0x8F, 0x98}}, /* & */
-    {  5,  10,  2,  7, 12, (const uint8_t[]){0xFF, 0xFC}}, /* ' */
-    {  3,  -3,  8, 20, 12, (const uint8_t[]){0x07, 0x0C, 0x18, 0x30, 0x60, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x07}}, /* ( */
-    {  1,  -3,  8, 20, 12, (const uint8_t[]){0xE0, 0x30, 0x18, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0x06, 0x0C, 0x18, 0x30, 0xE0}}, /* ) */
-    {  1,   2, 10,  9, 12, (const uint8_t[]){0x61, 0x8C, 0xC1, 0xE0, 0x30, 0xFF, 0xC3, 0x01, 0xE0, 0xCC, 0x61, 0x80}}, /* * */
-    {  2,   3,  8,  7, 12, (const uint8_t[]){0x18, 0x18, 0x18, 0xFF, 0x18, 0x18, 0x18}}, /* + */
-    {  3,  -2,  4,  5, 12, (const uint8_t[]){0x33, 0x36, 0xC0}}, /* , */
-    {  2,   6,  8,  1, 12, (const uint8_t[]){0xFF}}, /* - */
-    {  5,   0,  2,  2, 12, (const uint8_t[]){0xF0}}, /* . */
-    {  1,  -3, 11, 20, 12, (const uint8_t[]){0x00, 0x60, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0C, 0x01, 0x80, 0x60, 0x0C, 0x03, 0x00, 0x60, 0x00}}, /* / */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0F, 0x03, 0xC1, 0xF0, 0xFC, 0x6F, 0x33, 0xD8, 0xFC, 0x3E, 0x0F, 0x03, 0xC0, 0xD8, 0x63, 0xF0}}, /* 0 */
-    {  2,   0,  8, 15, 12, (const uint8_t[]){0x38, 0x78, 0xD8, 0x98, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF}}, /* 1 */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x3F, 0xFC}}, /* 2 */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0C, 0x03, 0x00, 0xC0, 0x61, 0xF0, 0x06, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xC0, 0xD8, 0x63, 0xF0}}, /* 3 */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0x30, 0x0C, 0x03, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCF, 0xFC, 0x0C, 0x03, 0x00, 0xC0, 0x30}}, /* 4 */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xFF, 0xF0, 0x3C, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xF0, 0x06, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xC0, 0xD8, 0x63, 0xF0}}, /* 5 */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0x98, 0x3C, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xF3, 0x06, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x63, 0xF0}}, /* 6 */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xFF, 0xF0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80}}, /* 7 */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0F, 0x03, 0xC0, 0xD8, 0x63, 0xF1, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x63, 0xF0}}, /* 8 */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x83, 0x3F, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xF0, 0x67, 0xF0}}, /* 9 */
-    {  5,   0,  2,  9, 12, (const uint8_t[]){0xF0, 0x03, 0xC0}}, /* : */
-    {  3,  -2,  4, 11, 12, (const uint8_t[]){0x33, 0x00, 0x00, 0x33, 0x36, 0xC0}}, /* ; */
-    {  2,   0,  9, 15, 12, (const uint8_t[]){0x01, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06}}, /* < */
-    {  1,   4, 10,  6, 12, (const uint8_t[]){0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0}}, /* = */
-    {  2,   0,  9, 15, 12, (const uint8_t[]){0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00}}, /* > */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0C, 0x03, 0x00, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x03, 0x00, 0xC0}}, /* ? */
-    {  1,   0, 10, 14, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0F, 0x03, 0xCE, 0xF3, 0xBC, 0xEF, 0x3B, 0xCE, 0xF3, 0xBC, 0xFF, 0x00, 0x60, 0x0F, 0xE0}}, /* @ */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0xFF, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0C}}, /* A */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xFF, 0x30, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1B, 0xFC, 0xC1, 0xB0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x6F, 0xF0}}, /* B */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0xD8, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x18, 0x03, 0xFC}}, /* C */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xFF, 0x30, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x6F, 0xF0}}, /* D */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0xD8, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x18, 0x03, 0xFC}}, /* E */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0xD8, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00}}, /* F */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0xD8, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x1F, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x33, 0xFC}}, /* G */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0xFF, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0C}}, /* H */
-    {  2,   0,  8, 15, 12, (const uint8_t[]){0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF}}, /* I */
-    {  1,   0,  9, 15, 12, (const uint8_t[]){0x7F, 0x86, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0xE3, 0xE0}}, /* J */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x6C, 0x33, 0xF8, 0xC3, 0x30, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0C}}, /* K */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x18, 0x03, 0xFC}}, /* L */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0xF8, 0x7F, 0x3F, 0x7B, 0xCC, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0C}}, /* M */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0xF8, 0x3E, 0x0F, 0xC3, 0xF0, 0xF6, 0x3D, 0x8F, 0x33, 0xCC, 0xF1, 0xBC, 0x6F, 0x0F, 0xC3, 0xF0, 0x7C, 0x1C}}, /* N */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x63, 0xF0}}, /* O */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xFF, 0x30, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1B, 0xFC, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00}}, /* P */
-    {  1,  -3, 10, 18, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0xCF, 0x33, 0xC6, 0xD9, 0xE3, 0xF0, 0x0C, 0x01, 0x80, 0x60}}, /* Q */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xFF, 0x30, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x1B, 0xFC, 0xC1, 0xB0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0C}}, /* R */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x3F, 0xD8, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x06, 0x00, 0xFC, 0x01, 0x80, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x6F, 0xF0}}, /* S */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xFF, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0}}, /* T */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x33, 0xFC}}, /* U */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0x86, 0x33, 0x07, 0x80, 0xC0}}, /* V */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0xCF, 0x7B, 0xF3, 0xF8, 0x7C, 0x0C}}, /* W */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x36, 0x18, 0xFC, 0x61, 0xB0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0C}}, /* X */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x36, 0x0C, 0xFF, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x7F, 0xF8}}, /* Y */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xFF, 0xC0, 0x30, 0x0C, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xFC}}, /* Z */
-    {  3,  -4,  8, 22, 12, (const uint8_t[]){0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF}}, /* [ */
-    {  0,  -3, 11, 20, 12, (const uint8_t[]){0xC0, 0x18, 0x01, 0x80, 0x30, 0x03, 0x00, 0x60, 0x06, 0x00, 0xC0, 0x0C, 0x01, 0x80, 0x18, 0x03, 0x00, 0x30, 0x06, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x30}}, /* \ */
-    {  1,  -4,  8, 22, 12, (const uint8_t[]){0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF}}, /* ] */
-    {  0,  11, 11,  6, 12, (const uint8_t[]){0x04, 0x01, 0xC0, 0x6C, 0x18, 0xC6, 0x0D, 0x80, 0xC0}}, /* ^ */
-    {  1,  -4, 10,  1, 12, (const uint8_t[]){0xFF, 0xC0}}, /* _ */
-    {  3,  13,  5,  4, 12, (const uint8_t[]){0xC3, 0x0C, 0x30}}, /* ` */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0x7F, 0x00, 0x60, 0x0C, 0x03, 0x3F, 0xD8, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x33, 0xFC}}, /* a */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0x30, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x6F, 0xF0}}, /* b */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0x3F, 0xD8, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x18, 0x03, 0xFC}}, /* c */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0x00, 0xC0, 0x30, 0x0C, 0x03, 0x3F, 0xD8, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x33, 0xFC}}, /* d */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0x3F, 0xD8, 0x3C, 0x0F, 0x03, 0xC0, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x18, 0x03, 0xFC}}, /* e */
-    {  2,   0,  8, 15, 12, (const uint8_t[]){0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30}}, /* f */
-    {  1,  -5, 10, 16, 12, (const uint8_t[]){0x3F, 0xD8, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x33, 0xF8, 0x06, 0x00, 0xC0, 0x30, 0x19, 0xFC}}, /* g */
-    {  1,   0, 10, 15, 12, (const uint8_t[]){0xC0, 0x30, 0x0C, 0x03, 0x00, 0xFF, 0x30, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0C}}, /* h */
-    {  3,   0,  6, 15, 12, (const uint8_t[]){0x30, 0xC0, 0x00, 0xF0, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xC0}}, /* i */
-    {  1,  -5,  6, 20, 12, (const uint8_t[]){0x0C, 0x30, 0x00, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x31, 0xBC}}, /* j */
-    {  2,   0,  9, 15, 12, (const uint8_t[]){0xC0, 0x60, 0x30, 0x18, 0x0C, 0x36, 0x1B, 0x19, 0x98, 0xF8, 0x6C, 0x33, 0x18, 0xCC, 0x36, 0x0F, 0x06}}, /* k */
-    {  4,   0,  6, 15, 12, (const uint8_t[]){0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x87, 0xC0}}, /* l */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0xF3, 0x33, 0x6C, 0xCF, 0x33, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0xC0, 0xF0, 0x3C, 0x0C}}, /* m */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0xFF, 0x30, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0C}}, /* n */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x63, 0xF0}}, /* o */
-    {  1,  -5, 10, 16, 12, (const uint8_t[]){0xFF, 0x30, 0x6C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x6F, 0xF3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00}}, /* p */
-    {  1,  -5, 10, 16, 12, (const uint8_t[]){0x3F, 0xD8, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x33, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03}}, /* q */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0x3F, 0xD8, 0x3C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x00}}, /* r */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0x7F, 0xF0, 0x0C, 0x03, 0x00, 0xC0, 0x1F, 0xE0, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 0xF8}}, /* s */
-    {  2,   0,  8, 15, 12, (const uint8_t[]){0x30, 0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F}}, /* t */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x33, 0xFC}}, /* u */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0x86, 0x33, 0x07, 0x80, 0xC0}}, /* v */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x33, 0xCC, 0xF3, 0x3C, 0xCF, 0x33, 0xCC, 0xDB, 0x33, 0x3C}}, /* w */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0xC0, 0xF0, 0x36, 0x18, 0xCC, 0x1E, 0x07, 0x83, 0x31, 0x86, 0x61, 0xB0, 0x3C, 0x0C}}, /* x */
-    {  1,  -5, 10, 16, 12, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xD8, 0x33, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x1B, 0xFC}}, /* y */
-    {  1,   0, 10, 11, 12, (const uint8_t[]){0xFF, 0xC0, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x0F, 0xFC}}, /* z */
-    {  2,  -4,  9, 22, 12, (const uint8_t[]){0x07, 0x86, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x18, 0x38, 0x1C, 0x03, 0x00, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x00, 0xC0, 0x3C}}, /* { */
-    {  5,  -2,  2, 18, 12, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xF0}}, /* | */
-    {  2,  -4,  9, 22, 12, (const uint8_t[]){0xF0, 0x0C, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x03, 0x00, 0xE0, 0x70, 0x60, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x81, 0x87, 0x80}}, /* } */
-    {  0,   5, 11,  4, 12, (const uint8_t[]){0x38, 0x6D, 0x8F, 0x1B, 0x61, 0xC0}}, /* ~ */
-    {  0,   0,  0,  0, 12, NULL}, /* � */
+    {  0,   0,  0,  0, 12, 0, NULL}, /*   */
+    {  5,   0,  2, 15, 12, 1, (const uint8_t[]){0x7F, 0xEB, 0x98}}, /* ! */
+    {  2,  10,  8,  7, 12, 1, (const uint8_t[]){0x7F, 0x86}}, /* " */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x67, 0xE6, 0xC3, 0x7F, 0xEC, 0x37, 0xFE, 0xC3, 0x00}}, /* # */
+    {  1,  -2, 10, 19, 12, 1, (const uint8_t[]){0x47, 0x0E, 0x21, 0x81, 0xFE, 0xD8, 0x66, 0x0D, 0x81, 0xF8, 0x1B, 0x06, 0x61, 0xB7, 0xF8, 0x18, 0x00}}, /* $ */
+    {  1,   0, 10, 14, 12, 1, (const uint8_t[]){0x11, 0x10, 0x06, 0x71, 0xB6, 0xC7, 0x60, 0x18, 0x0C, 0x06, 0x01, 0xB8, 0xDB, 0x63, 0x98, 0x00}}, /* % */
+    {  1,   0, 11, 15, 12, 1, (const uint8_t[]){0x1C, 0x08, 0x3C, 0x0C, 0xC3, 0x0C, 0x33, 0x03, 0xC1, 0x98, 0x61, 0xAC, 0x1D, 0x83, 0x18, 0xF1, 0xF3}}, /* & */
+    {  5,  10,  2,  7, 12, 0, (const uint8_t[]){0xFF, 0xFC}}, /* ' */
+    {  3,  -3,  8, 20, 12, 1, (const uint8_t[]){0x05, 0xFD, 0x00, 0x70, 0xC1, 0x83, 0x06, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x70}}, /* ( */
+    {  1,  -3,  8, 20, 12, 1, (const uint8_t[]){0x05, 0xFD, 0x0E, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x60, 0xC1, 0x83, 0x0E, 0x00}}, /* ) */
+    {  1,   2, 10,  9, 12, 0, (const uint8_t[]){0x61, 0x8C, 0xC1, 0xE0, 0x30, 0xFF, 0xC3, 0x01, 0xE0, 0xCC, 0x61, 0x80}}, /* * */
+    {  2,   3,  8,  7, 12, 1, (const uint8_t[]){0x66, 0x31, 0xFE, 0x30}}, /* + */
+    {  3,  -2,  4,  5, 12, 0, (const uint8_t[]){0x33, 0x36, 0xC0}}, /* , */
+    {  2,   6,  8,  1, 12, 0, (const uint8_t[]){0xFF}}, /* - */
+    {  5,   0,  2,  2, 12, 0, (const uint8_t[]){0xF0}}, /* . */
+    {  1,  -3, 11, 20, 12, 1, (const uint8_t[]){0x55, 0x55, 0x50, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x00}}, /* / */
+    {  1,   0, 10, 15, 12, 0, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0F, 0x03, 0xC1, 0xF0, 0xFC, 0x6F, 0x33, 0xD8, 0xFC, 0x3E, 0x0F, 0x03, 0xC0, 0xD8, 0x63, 0xF0}}, /* 0 */
+    {  2,   0,  8, 15, 12, 1, (const uint8_t[]){0x07, 0xFC, 0x70, 0xF1, 0xB1, 0x30, 0x31, 0xFE}}, /* 1 */
+    {  1,   0, 10, 15, 12, 0, (const uint8_t[]){0x3F, 0x18, 0x6C, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x3F, 0xFC}}, /* 2 */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x08, 0x70, 0x7E, 0x30, 0xD8, 0x18, 0x06, 0x03, 0x0F, 0x80, 0x30, 0x07, 0x81, 0xB0, 0xC7, 0xE0}}, /* 3 */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x6F, 0xCF, 0x80, 0x61, 0x9F, 0xF8, 0x18}}, /* 4 */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1C, 0x71, 0xFF, 0xE0, 0x78, 0x07, 0xF8, 0x03, 0x00, 0x78, 0x1B, 0x0C, 0x7E, 0x00}}, /* 5 */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1C, 0x78, 0x7F, 0x30, 0x78, 0x07, 0xF9, 0x83, 0x60, 0x6C, 0x31, 0xF8}}, /* 6 */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x18, 0x3F, 0xFF, 0xE0, 0x60, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0}}, /* 7 */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x18, 0x78, 0x7E, 0x30, 0xD8, 0x1B, 0x0C, 0x7E, 0x30, 0xD8, 0x1B, 0x0C, 0x7E, 0x00}}, /* 8 */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1E, 0x38, 0x7E, 0x30, 0xD8, 0x1B, 0x06, 0x7F, 0x80, 0x78, 0x33, 0xF8}}, /* 9 */
+    {  5,   0,  2,  9, 12, 1, (const uint8_t[]){0x5E, 0xE6}}, /* : */
+    {  3,  -2,  4, 11, 12, 1, (const uint8_t[]){0x5D, 0x86, 0x06, 0xD8}}, /* ; */
+    {  2,   0,  9, 15, 12, 0, (const uint8_t[]){0x01, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06}}, /* < */
+    {  1,   4, 10,  6, 12, 1, (const uint8_t[]){0x3B, 0xFF, 0x00, 0x3F, 0xF0}}, /* = */
+    {  2,   0,  9, 15, 12, 0, (const uint8_t[]){0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00}}, /* > */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x08, 0x6A, 0x7E, 0x30, 0xD8, 0x18, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x00, 0x06, 0x00}}, /* ? */
+    {  1,   0, 10, 14, 12, 1, (const uint8_t[]){0x17, 0xC0, 0xFC, 0x61, 0xB0, 0x3C, 0xEF, 0x3F, 0xC0, 0x18, 0x03, 0xF8}}, /* @ */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1E, 0x7E, 0x7E, 0x30, 0xD8, 0x1F, 0xFF, 0x81, 0x80}}, /* A */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1C, 0x39, 0xFE, 0x60, 0xD8, 0x1E, 0x0D, 0xFE, 0x60, 0xD8, 0x1E, 0x0D, 0xFE, 0x00}}, /* B */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1F, 0xF8, 0x7F, 0xB0, 0x18, 0x03, 0x00, 0x7F, 0x80}}, /* C */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1F, 0xF9, 0xFE, 0x60, 0xD8, 0x1E, 0x0D, 0xFE, 0x00}}, /* D */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1E, 0x78, 0x7F, 0xB0, 0x18, 0x07, 0xF9, 0x80, 0x30, 0x07, 0xF8}}, /* E */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1E, 0x7E, 0x7F, 0xB0, 0x18, 0x07, 0xF9, 0x80, 0x00}}, /* F */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1E, 0x78, 0x7F, 0xB0, 0x18, 0x06, 0x3F, 0x81, 0xB0, 0x67, 0xF8}}, /* G */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x7E, 0x7F, 0x81, 0xFF, 0xF8, 0x18}}, /* H */
+    {  2,   0,  8, 15, 12, 1, (const uint8_t[]){0x3F, 0xFD, 0xFE, 0x31, 0xFE}}, /* I */
+    {  1,   0,  9, 15, 12, 1, (const uint8_t[]){0x3F, 0xF8, 0xFF, 0x0C, 0x0E, 0x3E, 0x00}}, /* J */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x78, 0x1F, 0x81, 0xE0, 0xD8, 0x67, 0xF1, 0x86, 0x60, 0xD8, 0x18}}, /* K */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x7F, 0xF9, 0x80, 0x30, 0x07, 0xF8}}, /* L */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x03, 0xFF, 0x81, 0xF0, 0xFE, 0x7E, 0xF7, 0x99, 0xE0, 0x60}}, /* M */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x2A, 0xAB, 0x81, 0xF0, 0x7E, 0x1E, 0xC7, 0x99, 0xE3, 0x78, 0x7E, 0x0E}}, /* N */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1F, 0xF8, 0x7E, 0x30, 0xD8, 0x1B, 0x0C, 0x7E, 0x00}}, /* O */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1C, 0x7F, 0xFE, 0x60, 0xD8, 0x1E, 0x0D, 0xFE, 0x60, 0x00}}, /* P */
+    {  1,  -3, 10, 18, 12, 1, (const uint8_t[]){0x1F, 0xD0, 0x4F, 0xC6, 0x1B, 0x03, 0xCC, 0xF1, 0xB6, 0x78, 0xFC, 0x03, 0x00, 0x60}}, /* Q */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1C, 0x3F, 0xFE, 0x60, 0xD8, 0x1E, 0x0D, 0xFE, 0x60, 0xD8, 0x18}}, /* R */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x1C, 0x38, 0x7F, 0xB0, 0x18, 0x03, 0x00, 0x7E, 0x00, 0xC0, 0x18, 0x0D, 0xFE, 0x00}}, /* S */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x3F, 0xFF, 0xFF, 0x86, 0x00}}, /* T */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x7F, 0xF9, 0x81, 0xB0, 0x67, 0xF8}}, /* U */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x7F, 0xD1, 0x81, 0xB0, 0xC6, 0x60, 0xF0, 0x18, 0x00}}, /* V */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x7F, 0xC1, 0x81, 0xE6, 0x7B, 0xDF, 0x9F, 0xC3, 0xE0, 0x60}}, /* W */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x7C, 0x3F, 0x81, 0xB0, 0xC7, 0xE3, 0x0D, 0x81, 0x80}}, /* X */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x7C, 0x79, 0x81, 0xB0, 0x67, 0xF8, 0x06, 0x03, 0xFF, 0xC0}}, /* Y */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x30, 0x0D, 0xFF, 0x80, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x1F, 0xF8}}, /* Z */
+    {  3,  -4,  8, 22, 12, 1, (const uint8_t[]){0x3F, 0xFF, 0xFB, 0xFF, 0x03, 0xFC}}, /* [ */
+    {  0,  -3, 11, 20, 12, 1, (const uint8_t[]){0x55, 0x55, 0x5C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0}}, /* \ */
+    {  1,  -4,  8, 22, 12, 1, (const uint8_t[]){0x3F, 0xFF, 0xFB, 0xFC, 0x0F, 0xFC}}, /* ] */
+    {  0,  11, 11,  6, 12, 0, (const uint8_t[]){0x04, 0x01, 0xC0, 0x6C, 0x18, 0xC6, 0x0D, 0x80, 0xC0}}, /* ^ */
+    {  1,  -4, 10,  1, 12, 0, (const uint8_t[]){0xFF, 0xC0}}, /* _ */
+    {  3,  13,  5,  4, 12, 0, (const uint8_t[]){0xC3, 0x0C, 0x30}}, /* ` */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x11, 0x8F, 0xE0, 0x0C, 0x01, 0x9F, 0xEC, 0x1E, 0x06, 0xC1, 0x9F, 0xE0}}, /* a */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x71, 0xF9, 0x80, 0x7F, 0x98, 0x36, 0x07, 0x83, 0x7F, 0x80}}, /* b */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x1F, 0x87, 0xFB, 0x01, 0x80, 0x30, 0x07, 0xF8}}, /* c */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x71, 0xF8, 0x01, 0x9F, 0xEC, 0x1E, 0x06, 0xC1, 0x9F, 0xE0}}, /* d */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x19, 0x87, 0xFB, 0x07, 0x81, 0xFF, 0xF8, 0x03, 0x00, 0x7F, 0x80}}, /* e */
+    {  2,   0,  8, 15, 12, 1, (const uint8_t[]){0x1C, 0xFE, 0x3E, 0x70, 0x61, 0xFC, 0x60}}, /* f */
+    {  1,  -5, 10, 16, 12, 1, (const uint8_t[]){0x1F, 0x84, 0x3F, 0xD8, 0x3C, 0x0D, 0x83, 0x3F, 0x80, 0x60, 0x0C, 0x06, 0x7F, 0x00}}, /* g */
+    {  1,   0, 10, 15, 12, 1, (const uint8_t[]){0x71, 0xFF, 0x80, 0x7F, 0x98, 0x36, 0x06}}, /* h */
+    {  3,   0,  6, 15, 12, 1, (const uint8_t[]){0x53, 0xFC, 0x60, 0x1E, 0x18, 0x78}}, /* i */
+    {  1,  -5,  6, 20, 12, 1, (const uint8_t[]){0x57, 0xFF, 0xC0, 0xC0, 0x0C, 0x6F, 0x00}}, /* j */
+    {  2,   0,  9, 15, 12, 1, (const uint8_t[]){0x74, 0x03, 0x80, 0xC3, 0x63, 0x33, 0x1F, 0x0D, 0x86, 0x63, 0x19, 0x86, 0xC1, 0x80}}, /* k */
+    {  4,   0,  6, 15, 12, 1, (const uint8_t[]){0x7F, 0xF9, 0x87, 0x0F, 0x80}}, /* l */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x1F, 0x7E, 0x66, 0x6D, 0x99, 0xE0, 0x60}}, /* m */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x1F, 0xFF, 0xE6, 0x0D, 0x81, 0x80}}, /* n */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x1F, 0x87, 0xE3, 0x0D, 0x81, 0xB0, 0xC7, 0xE0}}, /* o */
+    {  1,  -5, 10, 16, 12, 1, (const uint8_t[]){0x1F, 0x8F, 0xFF, 0x30, 0x6C, 0x0F, 0x06, 0xFF, 0x30, 0x00}}, /* p */
+    {  1,  -5, 10, 16, 12, 1, (const uint8_t[]){0x1F, 0x8F, 0x3F, 0xD8, 0x3C, 0x0D, 0x83, 0x3F, 0xC0, 0x30}}, /* q */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x1F, 0xE7, 0xFB, 0x07, 0x80, 0x00}}, /* r */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x39, 0xCF, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0xF0}}, /* s */
+    {  2,   0,  8, 15, 12, 1, (const uint8_t[]){0x73, 0xF8, 0x61, 0xFC, 0x60, 0x70, 0x3E}}, /* t */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x7F, 0x98, 0x1B, 0x06, 0x7F, 0x80}}, /* u */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x7D, 0x18, 0x1B, 0x0C, 0x66, 0x0F, 0x01, 0x80}}, /* v */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x6F, 0x98, 0x1E, 0x66, 0xD9, 0x99, 0xE0}}, /* w */
+    {  1,   0, 10, 11, 12, 1, (const uint8_t[]){0x44, 0xB8, 0x1B, 0x0C, 0x66, 0x0F, 0x06, 0x63, 0x0D, 0x81, 0x80}}, /* x */
+    {  1,  -5, 10, 16, 12, 1, (const uint8_t[]){0x7F, 0x8C, 0xC0, 0xD8, 0x33, 0xFC, 0x03, 0x01, 0xBF, 0xC0}}, /* y */
+    {  1,   0, 10, 11, 12, 0, (const uint8_t[]){0xFF, 0xC0, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x0F, 0xFC}}, /* z */
+    {  2,  -4,  9, 22, 12, 1, (const uint8_t[]){0x1F, 0x93, 0xF0, 0x1E, 0x18, 0x18, 0x18, 0x38, 0x06, 0x01, 0x80, 0x60, 0x1E}}, /* { */
+    {  5,  -2,  2, 18, 12, 1, (const uint8_t[]){0x7F, 0xFF, 0xF0}}, /* | */
+    {  2,  -4,  9, 22, 12, 1, (const uint8_t[]){0x1F, 0x93, 0xF3, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xC0, 0xC0, 0xC3, 0xC0}}, /* } */
+    {  0,   5, 11,  4, 12, 0, (const uint8_t[]){0x38, 0x6D, 0x8F, 0x1B, 0x61, 0xC0}}, /* ~ */
+    {  0,   0,  0,  0, 12, 0, NULL}, /* � */
 };
-const ILI9341_FontDef ILI9341_Font_Spleen12x24 = { 0x20, 0x7F, 120, 19, 5, ILI9341_Font_Spleen12x24_Glyphs };
+static const ILI9341_FontRangeDef ILI9341_Font_Spleen12x24_Ranges[] = {{0x20, 0x7F, 0x00}};
+const ILI9341_FontDef ILI9341_Font_Spleen12x24 = { ILI9341_Font_Spleen12x24_Ranges, 1, 120, 19, 5, ILI9341_Font_Spleen12x24_Glyphs, NULL, 0, NULL };
 
 static const ILI9341_GlyphDef ILI9341_Font_Spleen16x32_Glyphs[] = {
-    {  0,   0,  0,  0, 16, NULL}, /*   */
-    {  7,   0,  2, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xF0, 0x3F}}, /* ! */
-    {  3,  14, 10,  8, 16, (const uint8_t[]){0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03}}, /* " */
-    {  1,   0, 14, 20, 16, (const uint8_t[]){0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0xFF, 0xFF, 0xFF, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xCF, 0xFF, 0xFF, 0xFF, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C}}, /* # */
-    {  2,  -2, 12, 24, 16, (const uint8_t[]){0x06, 0x00, 0x60, 0x3F, 0xF7, 0xFF, 0xE6, 0x0C, 0x60, 0xC6, 0x0C, 0x60, 0xC6, 0x0E, 0x60, 0x7F, 0xC3, 0xFE, 0x06, 0x70, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x63, 0x06, 0x30, 0x67, 0xFF, 0xEF, 0xFC, 0x06, 0x00, 0x60}}, /* $ */
-    {  3,   0, 11, 20, 16, (const uint8_t[]){0x00, 0x6E, 0x0F, 0x63, 0x6C, 0x6D, 0x98, 0xE3, 0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0C, 0x71, 0x9B, 0x63, 0x6C, 0x6F, 0x07, 0x60, 0x00}}, /* % */
-    {  1,   0, 14, 20, 16, (const uint8_t[]){0x0F, 0xC0, 0x7F, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0E, 0x1C, 0x1F, 0xE0, 0x3F, 0x03, 0xF0, 0x1F, 0xE0, 0xE1, 0xDB, 0x03, 0xEC, 0x07, 0x30, 0x18, 0xC0, 0x73, 0x83, 0xE7, 0xFD, 0xCF, 0xE3}}, /* & */
-    {  7,  14,  2,  8, 16, (const uint8_t[]){0xFF, 0xFF}}, /* ' */
-    {  3,  -3, 11, 26, 16, (const uint8_t[]){0x01, 0xE0, 0xFC, 0x3C, 0x0E, 0x03, 0x80, 0x60, 0x1C, 0x03, 0x00, 0xE0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x1C, 0x01, 0x80, 0x38, 0x03, 0x00, 0x70, 0x07, 0x00, 0x78, 0x07, 0xE0, 0x3C}}, /* ( */
-    {  2,  -3, 11, 26, 16, (const uint8_t[]){0xF0, 0x1F, 0x80, 0x78, 0x03, 0x80, 0x38, 0x03, 0x00, 0x70, 0x06, 0x00, 0xE0, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x1C, 0x03, 0x00, 0xE0, 0x18, 0x07, 0x01, 0xC0, 0xF0, 0xFC, 0x1E, 0x00}}, /* ) */
-    {  1,   2, 14, 14, 16, (const uint8_t[]){0x30, 0x30, 0xE1, 0xC1, 0xCE, 0x03, 0xF0, 0x07, 0x80, 0x1E, 0x0F, 0xFF, 0xFF, 0xFF, 0x07, 0x80, 0x1E, 0x00, 0xFC, 0x07, 0x38, 0x38, 0x70, 0xC0, 0xC0}}, /* * */
-    {  3,   4, 10, 10, 16, (const uint8_t[]){0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00}}, /* + */
-    {  5,  -2,  4,  6, 16, (const uint8_t[]){0x33, 0x37, 0xEC}}, /* , */
-    {  2,   8, 12,  2, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF}}, /* - */
-    {  7,   0,  2,  3, 16, (const uint8_t[]){0xFC}}, /* . */
-    {  1,  -3, 14, 26, 16, (const uint8_t[]){0x00, 0x0C, 0x00, 0x30, 0x01, 0x80, 0x06, 0x00, 0x30, 0x00, 0xC0, 0x06, 0x00, 0x18, 0x00, 0xC0, 0x03, 0x00, 0x18, 0x00, 0x60, 0x03, 0x00, 0x0C, 0x00, 0x60, 0x01, 0x80, 0x0C, 0x00, 0x30, 0x01, 0x80, 0x06, 0x00, 0x30, 0x00, 0xC0, 0x06, 0x00, 0x18, 0x00, 0xC0, 0x03, 0x00, 0x00}}, /* / */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x07, 0xC0, 0xFC, 0x1F, 0xC3, 0xBC, 0x73, 0xCE, 0x3D, 0xC3, 0xF8, 0x3F, 0x03, 0xE0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* 0 */
-    {  3,   0, 10, 20, 16, (const uint8_t[]){0x1C, 0x0F, 0x06, 0xC3, 0x30, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x0F, 0xFF, 0xFF}}, /* 1 */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x3C, 0x03, 0xFF, 0xFF, 0xFF}}, /* 2 */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x06, 0x1F, 0xC1, 0xFC, 0x00, 0x60, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* 3 */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0xCC, 0x0C, 0xC0, 0xCC, 0x0C, 0xC0, 0xCC, 0x0C, 0xC0, 0xCC, 0x0C, 0xFF, 0xFF, 0xFF, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C}}, /* 4 */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xC0, 0x3C, 0x03, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x70, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* 5 */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* 6 */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xC0, 0x3C, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0}}, /* 7 */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x36, 0x06, 0x3F, 0xC3, 0xFC, 0x60, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* 8 */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* 9 */
-    {  7,   0,  2, 13, 16, (const uint8_t[]){0xFC, 0x00, 0x0F, 0xC0}}, /* : */
-    {  5,  -2,  4, 15, 16, (const uint8_t[]){0x33, 0x30, 0x00, 0x00, 0x03, 0x33, 0x7E, 0xC0}}, /* ; */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x00, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07}}, /* < */
-    {  2,   6, 12,  8, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF}}, /* = */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x00}}, /* > */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0x00, 0x30, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x03, 0x00, 0x60, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x00, 0x60}}, /* ? */
-    {  2,   0, 12, 18, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x73, 0xC7, 0x3C, 0x73, 0xC7, 0x3C, 0x73, 0xC7, 0x3C, 0x7F, 0xC7, 0xFC, 0x00, 0xC0, 0x0E, 0x00, 0x7F, 0xE3, 0xFE}}, /* @ */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03}}, /* A */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x06, 0xFF, 0xCF, 0xFC, 0xC0, 0x6C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x07, 0xFF, 0xEF, 0xFC}}, /* B */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x00, 0x7F, 0xF3, 0xFF}}, /* C */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x07, 0xFF, 0xEF, 0xFC}}, /* D */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xF8, 0xFF, 0x8C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x00, 0x7F, 0xF3, 0xFF}}, /* E */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0F, 0xF8, 0xFF, 0x8C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00}}, /* F */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x3F, 0xC3, 0xFC, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF}}, /* G */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3F, 0xFF, 0xFF, 0xFC, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03}}, /* H */
-    {  3,   0, 10, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x0F, 0xFF, 0xFF}}, /* I */
-    {  1,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xF3, 0xFF, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x70, 0xFE, 0x0F, 0xC0}}, /* J */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x6C, 0x0C, 0xC1, 0x8F, 0xF0, 0xFF, 0x0C, 0x18, 0xC0, 0xCC, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03}}, /* K */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x00, 0x7F, 0xF3, 0xFF}}, /* L */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x3E, 0x07, 0xF0, 0xFF, 0x9F, 0xDF, 0xBC, 0xF3, 0xC6, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03}}, /* M */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xE0, 0x3E, 0x03, 0xF0, 0x3F, 0x03, 0xD8, 0x3D, 0x83, 0xCC, 0x3C, 0xC3, 0xC6, 0x3C, 0x63, 0xC3, 0x3C, 0x33, 0xC1, 0xBC, 0x1B, 0xC0, 0xFC, 0x0F, 0xC0, 0x7C, 0x07}}, /* N */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* O */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x7F, 0xFE, 0xFF, 0xCC, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00}}, /* P */
-    {  2,  -4, 12, 24, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC6, 0x3C, 0x63, 0xC3, 0x3E, 0x37, 0x7F, 0xE3, 0xFC, 0x00, 0xC0, 0x0C, 0x00, 0x60, 0x06}}, /* Q */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x6F, 0xFC, 0xFF, 0xCC, 0x06, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03}}, /* R */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x07, 0xFC, 0x3F, 0xE0, 0x07, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x07, 0xFF, 0xEF, 0xFC}}, /* S */
-    {  1,   0, 14, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xF0, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0}}, /* T */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF}}, /* U */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x77, 0x0E, 0x39, 0xC1, 0xF8, 0x0F, 0x00, 0x60}}, /* V */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x63, 0xCF, 0x3D, 0xFB, 0xF9, 0xFF, 0x0F, 0xE0, 0x7C, 0x03}}, /* W */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x77, 0x0E, 0x39, 0xC1, 0xF8, 0x1F, 0x83, 0x9C, 0x70, 0xEE, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03}}, /* X */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x37, 0xFF, 0x3F, 0xF0, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x07, 0xFF, 0xEF, 0xFC}}, /* Y */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xFF, 0xFF, 0xFF}}, /* Z */
-    {  4,  -4, 10, 28, 16, (const uint8_t[]){0xFF, 0xFF, 0xFC, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0F, 0xFF, 0xFF}}, /* [ */
-    {  1,  -3, 14, 26, 16, (const uint8_t[]){0xC0, 0x03, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x01, 0x80, 0x06, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x60, 0x01, 0x80, 0x03, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x60, 0x00, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x01, 0x80, 0x06, 0x00, 0x0C, 0x00, 0x30}}, /* \ */
-    {  2,  -4, 10, 28, 16, (const uint8_t[]){0xFF, 0xFF, 0xF0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x3F, 0xFF, 0xFF}}, /* ] */
-    {  1,  14, 14,  8, 16, (const uint8_t[]){0x03, 0x00, 0x1E, 0x00, 0xFC, 0x07, 0x38, 0x38, 0x71, 0xC0, 0xEE, 0x01, 0xF0, 0x03}}, /* ^ */
-    {  1,  -4, 14,  2, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xF0}}, /* _ */
-    {  5,  16,  6,  6, 16, (const uint8_t[]){0xC3, 0x87, 0x0E, 0x1C, 0x30}}, /* ` */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0x7F, 0xC7, 0xFE, 0x00, 0x70, 0x03, 0x00, 0x33, 0xFF, 0x7F, 0xFE, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF}}, /* a */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x07, 0xFF, 0xEF, 0xFC}}, /* b */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x00, 0x7F, 0xF3, 0xFF}}, /* c */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x3F, 0xF7, 0xFF, 0xE0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF}}, /* d */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0xC0, 0x0E, 0x00, 0x7F, 0xF3, 0xFF}}, /* e */
-    {  3,   0, 10, 20, 16, (const uint8_t[]){0x0F, 0xC7, 0xF3, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0xFF, 0x3F, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0}}, /* f */
-    {  2,  -6, 12, 20, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC, 0x00, 0x60, 0x03, 0x00, 0x30, 0x07, 0xFF, 0xEF, 0xFC}}, /* g */
-    {  2,   0, 12, 20, 16, (const uint8_t[]){0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03}}, /* h */
-    {  5,   0,  6, 20, 16, (const uint8_t[]){0x30, 0xC3, 0x00, 0x00, 0x0F, 0x3C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xCF}}, /* i */
-    {  3,  -6,  6, 26, 16, (const uint8_t[]){0x0C, 0x30, 0xC0, 0x00, 0x00, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC7, 0xFB, 0xC0}}, /* j */
-    {  3,   0, 11, 20, 16, (const uint8_t[]){0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x66, 0x1C, 0xC7, 0x19, 0xC3, 0x70, 0x7C, 0x0F, 0x81, 0xB8, 0x33, 0x86, 0x38, 0xC3, 0x98, 0x3B, 0x03, 0xE0, 0x30}}, /* k */
-    {  5,   0,  8, 20, 16, (const uint8_t[]){0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE0, 0x7F, 0x3F}}, /* l */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0xF9, 0xCF, 0x9E, 0xC6, 0x7C, 0x63, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03}}, /* m */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03}}, /* n */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* o */
-    {  2,  -6, 12, 20, 16, (const uint8_t[]){0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x07, 0xFF, 0xEF, 0xFC, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00}}, /* p */
-    {  2,  -6, 12, 20, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03}}, /* q */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x3C, 0x03, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00}}, /* r */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0x3F, 0xF7, 0xFF, 0xE0, 0x0C, 0x00, 0xC0, 0x0E, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x70, 0x03, 0x00, 0x30, 0x07, 0xFF, 0xEF, 0xFC}}, /* s */
-    {  3,   0, 10, 20, 16, (const uint8_t[]){0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x0F, 0xF3, 0xFC, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0xFC, 0x3F}}, /* t */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF}}, /* u */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xE0, 0x77, 0x0E, 0x39, 0xC1, 0xF8, 0x0F, 0x00, 0x60}}, /* v */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0xC6, 0x3E, 0x63, 0x79, 0xF3, 0x9F}}, /* w */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0xC0, 0x3E, 0x07, 0x70, 0xE3, 0x9C, 0x1F, 0x80, 0xF0, 0x0F, 0x01, 0xF8, 0x39, 0xC7, 0x0E, 0x60, 0x6E, 0x07, 0xC0, 0x3C, 0x03}}, /* x */
-    {  2,  -6, 12, 20, 16, (const uint8_t[]){0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF, 0x00, 0x30, 0x03, 0x00, 0x30, 0x07, 0xFF, 0xEF, 0xFC}}, /* y */
-    {  2,   0, 12, 14, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0x00, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xFF, 0xFF, 0xFF}}, /* z */
-    {  2,  -4, 12, 28, 16, (const uint8_t[]){0x03, 0xF0, 0x7F, 0x0E, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x01, 0xC0, 0xF8, 0x0F, 0x00, 0xF0, 0x0F, 0x80, 0x1C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xE0, 0x07, 0xF0, 0x3F}}, /* { */
-    {  7,  -2,  2, 24, 16, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* | */
-    {  2,  -4, 12, 28, 16, (const uint8_t[]){0xFC, 0x0F, 0xE0, 0x07, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x38, 0x01, 0xF0, 0x0F, 0x00, 0xF0, 0x1F, 0x03, 0x80, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x70, 0xFE, 0x0F, 0xC0}}, /* } */
-    {  2,   7, 12,  5, 16, (const uint8_t[]){0x38, 0x37, 0xC3, 0xEE, 0x7C, 0x7E, 0xC3, 0xC0}}, /* ~ */
-    {  0,   0,  0,  0, 16, NULL}, /* � */
+    {  0,   0,  0,  0, 16, 0, NULL}, /*   */
+    {  7,   0,  2, 20, 16, 1, (const uint8_t[]){0x7F, 0xFD, 0xBC, 0xC0}}, /* ! */
+    {  3,  14, 10,  8, 16, 1, (const uint8_t[]){0x7F, 0xC0, 0xC0}}, /* " */
+    {  1,   0, 14, 20, 16, 1, (const uint8_t[]){0x75, 0xFD, 0x73, 0x03, 0x3F, 0xFF, 0x30, 0x33, 0xFF, 0xF3, 0x03, 0x00}}, /* # */
+    {  2,  -2, 12, 24, 16, 1, (const uint8_t[]){0x43, 0x83, 0xE1, 0x06, 0x03, 0xFF, 0x7F, 0xFE, 0x60, 0xC6, 0x0E, 0x60, 0x7F, 0xC3, 0xFE, 0x06, 0x70, 0x63, 0x06, 0x7F, 0xFE, 0xFF, 0xC0, 0x60}}, /* $ */
+    {  3,   0, 11, 20, 16, 1, (const uint8_t[]){0x11, 0x54, 0x40, 0x06, 0xE0, 0xF6, 0x36, 0xCC, 0x71, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x63, 0x8C, 0xDB, 0x1B, 0xC1, 0xD8, 0x00}}, /* % */
+    {  1,   0, 14, 20, 16, 1, (const uint8_t[]){0x0E, 0x00, 0x00, 0xFC, 0x07, 0xF8, 0x38, 0x70, 0xC0, 0xC3, 0x87, 0x07, 0xF8, 0x0F, 0xC0, 0xFC, 0x07, 0xF8, 0x38, 0x76, 0xC0, 0xFB, 0x01, 0xCC, 0x06, 0x30, 0x1C, 0xE0, 0xF9, 0xFF, 0x73, 0xF8, 0xC0}}, /* & */
+    {  7,  14,  2,  8, 16, 0, (const uint8_t[]){0xFF, 0xFF}}, /* ' */
+    {  3,  -3, 11, 26, 16, 1, (const uint8_t[]){0x00, 0x3F, 0x80, 0x00, 0x78, 0x3F, 0x0F, 0x03, 0x80, 0xE0, 0x18, 0x07, 0x00, 0xC0, 0x38, 0x06, 0x00, 0xE0, 0x0C, 0x01, 0xC0, 0x18, 0x03, 0x80, 0x38, 0x03, 0xC0, 0x3F, 0x01, 0xE0}}, /* ( */
+    {  2,  -3, 11, 26, 16, 1, (const uint8_t[]){0x00, 0x3F, 0x80, 0x3C, 0x07, 0xE0, 0x1E, 0x00, 0xE0, 0x0E, 0x00, 0xC0, 0x1C, 0x01, 0x80, 0x38, 0x03, 0x00, 0xE0, 0x18, 0x07, 0x00, 0xC0, 0x38, 0x0E, 0x07, 0x87, 0xE0, 0xF0, 0x00}}, /* ) */
+    {  1,   2, 14, 14, 16, 1, (const uint8_t[]){0x05, 0x40, 0xC0, 0xC3, 0x87, 0x07, 0x38, 0x0F, 0xC0, 0x1E, 0x0F, 0xFF, 0xC1, 0xE0, 0x0F, 0xC0, 0x73, 0x83, 0x87, 0x0C, 0x0C}}, /* * */
+    {  3,   4, 10, 10, 16, 1, (const uint8_t[]){0x75, 0xC3, 0x0F, 0xFC, 0x30}}, /* + */
+    {  5,  -2,  4,  6, 16, 0, (const uint8_t[]){0x33, 0x37, 0xEC}}, /* , */
+    {  2,   8, 12,  2, 16, 1, (const uint8_t[]){0x7F, 0xFC}}, /* - */
+    {  7,   0,  2,  3, 16, 0, (const uint8_t[]){0xFC}}, /* . */
+    {  1,  -3, 14, 26, 16, 1, (const uint8_t[]){0x55, 0x55, 0x55, 0x40, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x00}}, /* / */
+    {  2,   0, 12, 20, 16, 0, (const uint8_t[]){0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x07, 0xC0, 0xFC, 0x1F, 0xC3, 0xBC, 0x73, 0xCE, 0x3D, 0xC3, 0xF8, 0x3F, 0x03, 0xE0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* 0 */
+    {  3,   0, 10, 20, 16, 1, (const uint8_t[]){0x03, 0xFF, 0xD1, 0xC0, 0xF0, 0x6C, 0x33, 0x08, 0xC0, 0x30, 0xFF, 0xC0}}, /* 1 */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x06, 0x00, 0x53, 0xFC, 0x7F, 0xEE, 0x07, 0xC0, 0x30, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x03, 0xFF, 0xF0}}, /* 2 */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x06, 0x4F, 0x03, 0xFC, 0x7F, 0xEE, 0x07, 0xC0, 0x30, 0x03, 0x00, 0x61, 0xFC, 0x00, 0x60, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* 3 */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x77, 0xF5, 0xFC, 0x00, 0xC0, 0xCF, 0xFF, 0x00, 0xC0}}, /* 4 */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x57, 0x0F, 0x0F, 0xFF, 0xC0, 0x3C, 0x00, 0xFF, 0xCF, 0xFE, 0x00, 0x70, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* 5 */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x07, 0x0F, 0x83, 0xFC, 0x7F, 0xEE, 0x07, 0xC0, 0x3C, 0x00, 0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xE0, 0x77, 0xFE, 0x3F, 0xC0}}, /* 6 */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x56, 0x07, 0xFF, 0xFF, 0xC0, 0x30, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0}}, /* 7 */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0E, 0x4F, 0x83, 0xFC, 0x7F, 0xEE, 0x07, 0xC0, 0x36, 0x06, 0x3F, 0xC6, 0x06, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* 8 */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0x87, 0x03, 0xFC, 0x7F, 0xEE, 0x07, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF, 0x00, 0x3C, 0x03, 0xE0, 0x77, 0xFE, 0x3F, 0xC0}}, /* 9 */
+    {  7,   0,  2, 13, 16, 1, (const uint8_t[]){0x6F, 0xDE, 0x60}}, /* : */
+    {  5,  -2,  4, 15, 16, 1, (const uint8_t[]){0x6F, 0xB0, 0x60, 0x6F, 0xD8}}, /* ; */
+    {  2,   0, 12, 20, 16, 0, (const uint8_t[]){0x00, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x00, 0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07}}, /* < */
+    {  2,   6, 12,  8, 16, 1, (const uint8_t[]){0x5D, 0xFF, 0xF0, 0x00, 0xFF, 0xF0}}, /* = */
+    {  2,   0, 12, 20, 16, 0, (const uint8_t[]){0xE0, 0x07, 0x00, 0x38, 0x01, 0xC0, 0x0E, 0x00, 0x70, 0x03, 0x80, 0x1C, 0x00, 0xE0, 0x07, 0x00, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x00}}, /* > */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x04, 0x2D, 0xB3, 0xFC, 0x7F, 0xEE, 0x07, 0xC0, 0x30, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0x00, 0x06, 0x00}}, /* ? */
+    {  2,   0, 12, 18, 16, 1, (const uint8_t[]){0x0B, 0xEA, 0x0F, 0xF1, 0xFF, 0xB8, 0x1F, 0x00, 0xF1, 0xCF, 0x1F, 0xF0, 0x03, 0x80, 0x1F, 0xF8, 0xFF, 0x80}}, /* @ */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0xAF, 0xF3, 0xFC, 0x7F, 0xEE, 0x07, 0xC0, 0x3F, 0xFF, 0xC0, 0x30}}, /* A */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0E, 0x4F, 0x8F, 0xFC, 0xFF, 0xEC, 0x07, 0xC0, 0x3C, 0x06, 0xFF, 0xCC, 0x06, 0xC0, 0x3C, 0x07, 0xFF, 0xEF, 0xFC}}, /* B */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0xFF, 0x83, 0xFF, 0x7F, 0xFE, 0x00, 0xC0, 0x0E, 0x00, 0x7F, 0xF3, 0xFF}}, /* C */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0xFF, 0x8F, 0xFC, 0xFF, 0xEC, 0x07, 0xC0, 0x3C, 0x07, 0xFF, 0xEF, 0xFC}}, /* D */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0xAF, 0x83, 0xFF, 0x7F, 0xFE, 0x00, 0xC0, 0x0F, 0xF8, 0xC0, 0x0E, 0x00, 0x7F, 0xF3, 0xFF}}, /* E */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0xAF, 0xF3, 0xFF, 0x7F, 0xFE, 0x00, 0xC0, 0x0F, 0xF8, 0xC0, 0x00}}, /* F */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0xAF, 0x83, 0xFF, 0x7F, 0xFE, 0x00, 0xC0, 0x0C, 0x3F, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF}}, /* G */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7F, 0xAF, 0xFC, 0x03, 0xFF, 0xFC, 0x03}}, /* H */
+    {  3,   0, 10, 20, 16, 1, (const uint8_t[]){0x5F, 0xFF, 0xDF, 0xFC, 0x30, 0xFF, 0xC0}}, /* I */
+    {  1,   0, 12, 20, 16, 1, (const uint8_t[]){0x5F, 0xFF, 0x83, 0xFF, 0x03, 0x00, 0x70, 0xFE, 0x0F, 0xC0}}, /* J */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7C, 0x21, 0xFC, 0x03, 0xC0, 0x6C, 0x0C, 0xC1, 0x8F, 0xF0, 0xC1, 0x8C, 0x0C, 0xC0, 0x6C, 0x03}}, /* K */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7F, 0xFF, 0x8C, 0x00, 0xE0, 0x07, 0xFF, 0x3F, 0xF0}}, /* L */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x00, 0xFF, 0xFC, 0x03, 0xE0, 0x7F, 0x0F, 0xF9, 0xFD, 0xFB, 0xCF, 0x3C, 0x63, 0xC0, 0x30}}, /* M */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x55, 0x55, 0x5C, 0x03, 0xE0, 0x3F, 0x03, 0xD8, 0x3C, 0xC3, 0xC6, 0x3C, 0x33, 0xC1, 0xBC, 0x0F, 0xC0, 0x70}}, /* N */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0xFF, 0x83, 0xFC, 0x7F, 0xEE, 0x07, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC}}, /* O */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0x0F, 0xFF, 0xFC, 0xFF, 0xEC, 0x07, 0xC0, 0x3C, 0x07, 0xFF, 0xEF, 0xFC, 0xC0, 0x00}}, /* P */
+    {  2,  -4, 12, 24, 16, 1, (const uint8_t[]){0x0F, 0xFD, 0x05, 0x3F, 0xC7, 0xFE, 0xE0, 0x7C, 0x03, 0xC6, 0x3C, 0x33, 0xE3, 0x77, 0xFE, 0x3F, 0xC0, 0x0C, 0x00, 0x60}}, /* Q */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0x27, 0xFF, 0xFC, 0xFF, 0xEC, 0x07, 0xC0, 0x3C, 0x06, 0xFF, 0xCC, 0x06, 0xC0, 0x30}}, /* R */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0x07, 0x83, 0xFF, 0x7F, 0xFE, 0x00, 0xC0, 0x0E, 0x00, 0x7F, 0xC3, 0xFE, 0x00, 0x70, 0x03, 0x00, 0x7F, 0xFE, 0xFF, 0xC0}}, /* S */
+    {  1,   0, 14, 20, 16, 1, (const uint8_t[]){0x5F, 0xFF, 0xFF, 0xFF, 0xC0, 0xC0}}, /* T */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7F, 0xFF, 0x8C, 0x03, 0xE0, 0x37, 0xFF, 0x3F, 0xF0}}, /* U */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7F, 0xFC, 0x0C, 0x03, 0xE0, 0x77, 0x0E, 0x39, 0xC1, 0xF8, 0x0F, 0x00, 0x60}}, /* V */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7F, 0xF8, 0x0C, 0x03, 0xC6, 0x3C, 0xF3, 0xDF, 0xBF, 0x9F, 0xF0, 0xFE, 0x07, 0xC0, 0x30}}, /* W */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7C, 0x21, 0xFC, 0x03, 0xE0, 0x77, 0x0E, 0x39, 0xC1, 0xF8, 0x39, 0xC7, 0x0E, 0xE0, 0x7C, 0x03}}, /* X */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7F, 0x0F, 0x8C, 0x03, 0xE0, 0x37, 0xFF, 0x3F, 0xF0, 0x03, 0x00, 0x7F, 0xFE, 0xFF, 0xC0}}, /* Y */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x5C, 0x00, 0xDF, 0xFF, 0x00, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x0F, 0xFF}}, /* Z */
+    {  4,  -4, 10, 28, 16, 1, (const uint8_t[]){0x5F, 0xFF, 0xFF, 0xDF, 0xFF, 0x00, 0xFF, 0xC0}}, /* [ */
+    {  1,  -3, 14, 26, 16, 1, (const uint8_t[]){0x55, 0x55, 0x55, 0x70, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x01, 0x80, 0x03}}, /* \ */
+    {  2,  -4, 10, 28, 16, 1, (const uint8_t[]){0x5F, 0xFF, 0xFF, 0xDF, 0xFC, 0x03, 0xFF, 0xC0}}, /* ] */
+    {  1,  14, 14,  8, 16, 0, (const uint8_t[]){0x03, 0x00, 0x1E, 0x00, 0xFC, 0x07, 0x38, 0x38, 0x71, 0xC0, 0xEE, 0x01, 0xF0, 0x03}}, /* ^ */
+    {  1,  -4, 14,  2, 16, 1, (const uint8_t[]){0x7F, 0xFF}}, /* _ */
+    {  5,  16,  6,  6, 16, 0, (const uint8_t[]){0xC3, 0x87, 0x0E, 0x1C, 0x30}}, /* ` */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x08, 0x61, 0xFF, 0x1F, 0xF8, 0x01, 0xC0, 0x0C, 0xFF, 0xDF, 0xFF, 0x80, 0xF0, 0x0F, 0x80, 0xDF, 0xFC, 0xFF, 0xC0}}, /* a */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7C, 0x3F, 0x8C, 0x00, 0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03, 0xC0, 0x7F, 0xFE, 0xFF, 0xC0}}, /* b */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x0F, 0xE0, 0xFF, 0xDF, 0xFF, 0x80, 0x30, 0x03, 0x80, 0x1F, 0xFC, 0xFF, 0xC0}}, /* c */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7C, 0x3F, 0x80, 0x03, 0x3F, 0xF7, 0xFF, 0xE0, 0x3C, 0x03, 0xE0, 0x37, 0xFF, 0x3F, 0xF0}}, /* d */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x0D, 0x60, 0xFF, 0xDF, 0xFF, 0x80, 0xF0, 0x0F, 0xFF, 0xF0, 0x03, 0x80, 0x1F, 0xFC, 0xFF, 0xC0}}, /* e */
+    {  3,   0, 10, 20, 16, 1, (const uint8_t[]){0x0F, 0x5F, 0xF0, 0xFC, 0x7F, 0x38, 0x0C, 0x0F, 0xF0, 0xC0}}, /* f */
+    {  2,  -6, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0xE0, 0x83, 0xFF, 0x7F, 0xFE, 0x03, 0xC0, 0x3E, 0x07, 0x7F, 0xE3, 0xFC, 0x00, 0x60, 0x03, 0x00, 0x7F, 0xFE, 0xFF, 0xC0}}, /* g */
+    {  2,   0, 12, 20, 16, 1, (const uint8_t[]){0x7C, 0x3F, 0xFC, 0x00, 0xFF, 0xCF, 0xFE, 0xC0, 0x7C, 0x03}}, /* h */
+    {  5,   0,  6, 20, 16, 1, (const uint8_t[]){0x6D, 0x7F, 0xD3, 0x00, 0xF0, 0xC3, 0xC0}}, /* i */
+    {  3,  -6,  6, 26, 16, 1, (const uint8_t[]){0x6D, 0xFF, 0xFE, 0x03, 0x00, 0x31, 0xFE, 0xF0}}, /* j */
+    {  3,   0, 11, 20, 16, 1, (const uint8_t[]){0x7C, 0x08, 0x0C, 0x01, 0x83, 0x30, 0xE6, 0x38, 0xCE, 0x1B, 0x83, 0xE0, 0x6E, 0x0C, 0xE1, 0x8E, 0x30, 0xE6, 0x0E, 0xC0, 0xF8, 0x0C}}, /* k */
+    {  5,   0,  8, 20, 16, 1, (const uint8_t[]){0x7F, 0xFF, 0x8C, 0x0E, 0x07, 0xF3, 0xF0}}, /* l */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x0F, 0xDF, 0xE7, 0x3E, 0x7B, 0x19, 0xF1, 0x8F, 0x00, 0xC0}}, /* m */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x0F, 0xFF, 0xFF, 0x3F, 0xFB, 0x01, 0xF0, 0x0C}}, /* n */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x0F, 0xE0, 0xFF, 0x1F, 0xFB, 0x81, 0xF0, 0x0F, 0x81, 0xDF, 0xF8, 0xFF, 0x00}}, /* o */
+    {  2,  -6, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0xE1, 0xFF, 0xFC, 0xFF, 0xEC, 0x07, 0xC0, 0x3C, 0x07, 0xFF, 0xEF, 0xFC, 0xC0, 0x00}}, /* p */
+    {  2,  -6, 12, 20, 16, 1, (const uint8_t[]){0x0F, 0xE1, 0xF3, 0xFF, 0x7F, 0xFE, 0x03, 0xC0, 0x3E, 0x03, 0x7F, 0xF3, 0xFF, 0x00, 0x30}}, /* q */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x07, 0xFC, 0xFF, 0xDF, 0xFF, 0x80, 0xF0, 0x0F, 0x00, 0x00}}, /* r */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x08, 0x20, 0xFF, 0xDF, 0xFF, 0x80, 0x30, 0x03, 0x80, 0x1F, 0xF0, 0xFF, 0x80, 0x1C, 0x00, 0xC0, 0x1F, 0xFF, 0xBF, 0xF0}}, /* s */
+    {  3,   0, 10, 20, 16, 1, (const uint8_t[]){0x7D, 0x7F, 0x83, 0x03, 0xFC, 0x30, 0x0E, 0x01, 0xFC, 0x3F}}, /* t */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x7F, 0xE3, 0x00, 0xF8, 0x0D, 0xFF, 0xCF, 0xFC}}, /* u */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x7F, 0x03, 0x00, 0xF8, 0x1D, 0xC3, 0x8E, 0x70, 0x7E, 0x03, 0xC0, 0x18, 0x00}}, /* v */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x77, 0xE3, 0x00, 0xF1, 0x8F, 0x98, 0xDE, 0x7C, 0xE7, 0xC0}}, /* w */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x02, 0x07, 0x00, 0xF8, 0x1D, 0xC3, 0x8E, 0x70, 0x7E, 0x03, 0xC0, 0x7E, 0x0E, 0x71, 0xC3, 0x98, 0x1B, 0x81, 0xF0, 0x0C}}, /* x */
+    {  2,  -6, 12, 20, 16, 1, (const uint8_t[]){0x7F, 0xE1, 0x8C, 0x03, 0xE0, 0x37, 0xFF, 0x3F, 0xF0, 0x03, 0x00, 0x7F, 0xFE, 0xFF, 0xC0}}, /* y */
+    {  2,   0, 12, 14, 16, 1, (const uint8_t[]){0x40, 0x07, 0xFF, 0xC0, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x3F, 0xFC}}, /* z */
+    {  2,  -4, 12, 28, 16, 1, (const uint8_t[]){0x0F, 0xE2, 0x3F, 0x80, 0x3F, 0x07, 0xF0, 0xE0, 0x0C, 0x01, 0xC0, 0xF8, 0x0F, 0x00, 0xF8, 0x01, 0xC0, 0x0C, 0x00, 0xE0, 0x07, 0xF0, 0x3F}}, /* { */
+    {  7,  -2,  2, 24, 16, 1, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xC0}}, /* | */
+    {  2,  -4, 12, 28, 16, 1, (const uint8_t[]){0x0F, 0xE2, 0x3F, 0x8F, 0xC0, 0xFE, 0x00, 0x70, 0x03, 0x00, 0x38, 0x01, 0xF0, 0x0F, 0x01, 0xF0, 0x38, 0x03, 0x00, 0x70, 0xFE, 0x0F, 0xC0}}, /* } */
+    {  2,   7, 12,  5, 16, 0, (const uint8_t[]){0x38, 0x37, 0xC3, 0xEE, 0x7C, 0x7E, 0xC3, 0xC0}}, /* ~ */
+    {  0,   0,  0,  0, 16, 0, NULL}, /* � */
 };
-const ILI9341_FontDef ILI9341_Font_Spleen16x32 = { 0x20, 0x7F, 160, 26, 6, ILI9341_Font_Spleen16x32_Glyphs };
+static const ILI9341_FontRangeDef ILI9341_Font_Spleen16x32_Ranges[] = {{0x20, 0x7F, 0x00}};
+const ILI9341_FontDef ILI9341_Font_Spleen16x32 = { ILI9341_Font_Spleen16x32_Ranges, 1, 160, 26, 6, ILI9341_Font_Spleen16x32_Glyphs, NULL, 0, NULL };
 
 static const ILI9341_GlyphDef ILI9341_Font_Spleen32x64_Glyphs[] = {
-    {  0,   0,  0,  0, 32, NULL}, /*   */
-    { 14,   0,  4, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF}}, /* ! */
-    {  6,  28, 20, 16, 32, (const uint8_t[]){0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F}}, /* " */
-    {  2,   0, 28, 40, 32, (const uint8_t[]){0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0}}, /* # */
-    {  4,  -4, 24, 48, 32, (const uint8_t[]){0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x3C, 0x00, 0xF8, 0x3C, 0x00, 0xF0, 0x3C, 0x00, 0xF0, 0x3C, 0x00, 0xF0, 0x3C, 0x00, 0xF0, 0x3C, 0x00, 0xF0, 0x3C, 0x00, 0xF0, 0x3C, 0x00, 0xF0, 0x3C, 0x00, 0xF0, 0x3C, 0x00, 0xF8, 0x3C, 0x00, 0x7C, 0x3C, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0x3C, 0x3E, 0x00, 0x3C, 0x1F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x1F, 0x00, 0x3C, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00}}, /* $ */
-    {  5,   0, 22, 40, 32, (const uint8_t[]){0x00, 0x00, 0x3C, 0x00, 0x00, 0xF3, 0xF0, 0x07, 0xDF, 0xE0, 0x1F, 0xF3, 0xC0, 0xFB, 0xCF, 0x03, 0xEF, 0x3C, 0x1F, 0x3C, 0xF0, 0x7C, 0xF3, 0xC3, 0xE3, 0xCF, 0x0F, 0x87, 0xF8, 0x7C, 0x0F, 0xC1, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x83, 0xF0, 0x3E, 0x1F, 0xE1, 0xF0, 0xF3, 0xC7, 0xC3, 0xCF, 0x3E, 0x0F, 0x3C, 0xF8, 0x3C, 0xF7, 0xC0, 0xF3, 0xDF, 0x03, 0xCF, 0xF8, 0x07, 0xFB, 0xE0, 0x0F, 0xCF, 0x00, 0x00, 0x3C, 0x00, 0x00}}, /* % */
-    {  2,   0, 28, 40, 32, (const uint8_t[]){0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x80, 0x1F, 0x00, 0x7C, 0x03, 0xE0, 0x07, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xC0, 0x01, 0xFF, 0xF8, 0x00, 0x0F, 0xFE, 0x00, 0x07, 0xFF, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x80, 0x07, 0xFF, 0xFC, 0x00, 0x7C, 0x03, 0xE1, 0xCF, 0x80, 0x1F, 0x3C, 0xF0, 0x00, 0xFF, 0xCF, 0x00, 0x07, 0xF8, 0xF0, 0x00, 0x3F, 0x0F, 0x00, 0x03, 0xE0, 0xF0, 0x00, 0x3C, 0x0F, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x3E, 0x0F, 0x00, 0x03, 0xF0, 0xF8, 0x00, 0x7F, 0x87, 0xC0, 0x0F, 0xFC, 0x7F, 0xFF, 0xF3, 0xE3, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 0xE0, 0xF0, 0x7F, 0xF8, 0x07}}, /* & */
-    { 14,  28,  4, 16, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* ' */
-    {  5,  -8, 23, 56, 32, (const uint8_t[]){0x00, 0x01, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xF8, 0x00, 0x03, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF}}, /* ( */
-    {  5,  -8, 23, 56, 32, (const uint8_t[]){0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x01, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7E, 0x00, 0x03, 0xF8, 0x00, 0x1F, 0xE0, 0x0F, 0xFF, 0x80, 0x1F, 0xFE, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0x80, 0x00}}, /* ) */
-    {  2,   4, 28, 28, 32, (const uint8_t[]){0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0, 0x0F, 0x80, 0x1F, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xE0, 0x7E, 0x00, 0x3F, 0x0F, 0xC0, 0x01, 0xF9, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0x9F, 0x80, 0x03, 0xF0, 0xFC, 0x00, 0x7E, 0x07, 0xE0, 0x0F, 0xC0, 0x3F, 0x00, 0xF8, 0x01, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xF0}}, /* * */
-    {  6,   8, 20, 20, 32, (const uint8_t[]){0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00}}, /* + */
-    { 10,  -4,  8, 12, 32, (const uint8_t[]){0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x3E, 0xFE, 0xFC, 0xF8, 0xE0}}, /* , */
-    {  4,  16, 24,  4, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* - */
-    { 14,   0,  4,  6, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF}}, /* . */
-    {  2,  -6, 28, 52, 32, (const uint8_t[]){0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00}}, /* / */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x07, 0xEF, 0xF0, 0x0F, 0xCF, 0xF0, 0x1F, 0x8F, 0xF0, 0x3F, 0x0F, 0xF0, 0x7E, 0x0F, 0xF0, 0xFC, 0x0F, 0xF1, 0xF8, 0x0F, 0xF3, 0xF0, 0x0F, 0xF7, 0xE0, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 0 */
-    {  6,   0, 20, 40, 32, (const uint8_t[]){0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x3E, 0xF0, 0x07, 0xCF, 0x00, 0xF8, 0xF0, 0x0F, 0x0F, 0x00, 0xE0, 0xF0, 0x0C, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* 1 */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* 2 */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 3 */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xF0, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0}}, /* 4 */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 5 */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 6 */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00}}, /* 7 */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x78, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 8 */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 9 */
-    { 14,   0,  4, 26, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF}}, /* : */
-    { 10,  -4,  8, 30, 32, (const uint8_t[]){0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x0F, 0x1F, 0x3E, 0xFE, 0xFC, 0xF8, 0xE0}}, /* ; */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F}}, /* < */
-    {  4,  12, 24, 16, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* = */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x00}}, /* > */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00}}, /* ? */
-    {  4,   0, 24, 36, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0x0F, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFC}}, /* @ */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F}}, /* A */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x3C, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* B */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* C */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* D */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* E */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00}}, /* F */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* G */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F}}, /* H */
-    {  6,   0, 20, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* I */
-    {  2,   0, 24, 40, 32, (const uint8_t[]){0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00}}, /* J */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x7C, 0xF0, 0x00, 0xF8, 0xF0, 0x01, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xF0, 0x01, 0xF0, 0xF0, 0x00, 0xF8, 0xF0, 0x00, 0x7C, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F}}, /* K */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* L */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC3, 0xFF, 0xF7, 0xE7, 0xEF, 0xF3, 0xFF, 0xCF, 0xF1, 0xFF, 0x8F, 0xF0, 0xFF, 0x0F, 0xF0, 0x7E, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x18, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F}}, /* M */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x80, 0x0F, 0xF7, 0xC0, 0x0F, 0xF7, 0xC0, 0x0F, 0xF3, 0xE0, 0x0F, 0xF3, 0xE0, 0x0F, 0xF1, 0xF0, 0x0F, 0xF1, 0xF0, 0x0F, 0xF0, 0xF8, 0x0F, 0xF0, 0xF8, 0x0F, 0xF0, 0x7C, 0x0F, 0xF0, 0x7C, 0x0F, 0xF0, 0x3E, 0x0F, 0xF0, 0x3E, 0x0F, 0xF0, 0x1F, 0x0F, 0xF0, 0x1F, 0x0F, 0xF0, 0x0F, 0x8F, 0xF0, 0x0F, 0x8F, 0xF0, 0x07, 0xCF, 0xF0, 0x07, 0xCF, 0xF0, 0x03, 0xEF, 0xF0, 0x03, 0xEF, 0xF0, 0x01, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x3F}}, /* N */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* O */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00}}, /* P */
-    {  4,  -8, 24, 48, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3E, 0x0F, 0xF0, 0x3E, 0x0F, 0xF0, 0x1F, 0x0F, 0xF0, 0x1F, 0x0F, 0xF8, 0x0F, 0x9F, 0x7C, 0x0F, 0xBE, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C}}, /* Q */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x7C, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xF0, 0x00, 0x7C, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F}}, /* R */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* S */
-    {  2,   0, 28, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF0, 0x00}}, /* T */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* U */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0x81, 0xF8, 0x0F, 0xC3, 0xF0, 0x07, 0xE7, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3C, 0x00}}, /* V */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x18, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x7E, 0x0F, 0xF0, 0xFF, 0x0F, 0xF1, 0xFF, 0x8F, 0xF3, 0xFF, 0xCF, 0xF7, 0xE7, 0xEF, 0xFF, 0xC3, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F}}, /* W */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81, 0xF8, 0x3F, 0x00, 0xFC, 0x7E, 0x00, 0x7E, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F}}, /* X */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* Y */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* Z */
-    {  8,  -8, 20, 56, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* [ */
-    {  2,  -6, 28, 52, 32, (const uint8_t[]){0xF0, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x0F}}, /* \ */
-    {  4,  -8, 20, 56, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* ] */
-    {  2,  28, 28, 16, 32, (const uint8_t[]){0x00, 0x0F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xF0, 0xFC, 0x00, 0x7E, 0x07, 0xE0, 0x0F, 0xC0, 0x3F, 0x01, 0xF8, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x7E, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07}}, /* ^ */
-    {  2,  -8, 28,  4, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* _ */
-    { 10,  32, 12, 12, 32, (const uint8_t[]){0xE0, 0x0F, 0x00, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF0, 0x0F}}, /* ` */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0x3F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x3F, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* a */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* b */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* c */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* d */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* e */
-    {  6,   0, 20, 40, 32, (const uint8_t[]){0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0x03, 0xFF, 0xF0, 0x7F, 0xFF, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00}}, /* f */
-    {  4, -12, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* g */
-    {  4,   0, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F}}, /* h */
-    { 10,   0, 12, 40, 32, (const uint8_t[]){0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF}}, /* i */
-    {  6, -12, 12, 52, 32, (const uint8_t[]){0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x01, 0xF0, 0x3E, 0xFF, 0xEF, 0xFC, 0xFF, 0x8F, 0xE0}}, /* j */
-    {  6,   0, 22, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x01, 0xC3, 0xC0, 0x0F, 0x0F, 0x00, 0x7C, 0x3C, 0x03, 0xE0, 0xF0, 0x1F, 0x03, 0xC0, 0xF8, 0x0F, 0x07, 0xC0, 0x3C, 0x3E, 0x00, 0xF1, 0xF0, 0x03, 0xCF, 0x80, 0x0F, 0xFC, 0x00, 0x3F, 0xF0, 0x00, 0xFF, 0xC0, 0x03, 0xFF, 0x00, 0x0F, 0x3E, 0x00, 0x3C, 0x7C, 0x00, 0xF0, 0xF8, 0x03, 0xC1, 0xF0, 0x0F, 0x03, 0xE0, 0x3C, 0x07, 0xC0, 0xF0, 0x0F, 0x83, 0xC0, 0x1F, 0x0F, 0x00, 0x3E, 0x3C, 0x00, 0x7C, 0xF0, 0x00, 0xFB, 0xC0, 0x01, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x07}}, /* k */
-    { 10,   0, 16, 40, 32, (const uint8_t[]){0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0xFF, 0x3F, 0xFF, 0x1F, 0xFF, 0x07, 0xFF}}, /* l */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0xFF, 0xC3, 0xE0, 0xFF, 0xC3, 0xF8, 0xFF, 0xC3, 0xFC, 0xFF, 0xC3, 0xFE, 0xF0, 0x3C, 0x3E, 0xF0, 0x3C, 0x1F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F}}, /* m */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F}}, /* n */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* o */
-    {  4, -12, 24, 40, 32, (const uint8_t[]){0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00}}, /* p */
-    {  4, -12, 24, 40, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F}}, /* q */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00}}, /* r */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* s */
-    {  6,   0, 20, 40, 32, (const uint8_t[]){0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x07, 0xFF, 0xF0, 0x3F, 0xFF, 0x01, 0xFF, 0xF0, 0x07, 0xFF}}, /* t */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* u */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x0F, 0x81, 0xF0, 0x07, 0xC3, 0xE0, 0x03, 0xE7, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3C, 0x00}}, /* v */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF8, 0x3C, 0x0F, 0x7C, 0x3C, 0x0F, 0x7F, 0xC3, 0xFF, 0x3F, 0xC3, 0xFF, 0x1F, 0xC3, 0xFF, 0x07, 0xC3, 0xFF}}, /* w */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x3E, 0x00, 0x7C, 0x1F, 0x00, 0xF8, 0x0F, 0x81, 0xF0, 0x07, 0xC3, 0xE0, 0x03, 0xE7, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xE7, 0xC0, 0x07, 0xC3, 0xE0, 0x0F, 0x81, 0xF0, 0x1F, 0x00, 0xF8, 0x3E, 0x00, 0x7C, 0x3C, 0x00, 0x3C, 0x7C, 0x00, 0x3E, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F}}, /* x */
-    {  4, -12, 24, 40, 32, (const uint8_t[]){0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* y */
-    {  4,   0, 24, 28, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* z */
-    {  4,  -8, 24, 56, 32, (const uint8_t[]){0x00, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF}}, /* { */
-    { 14,  -4,  4, 48, 32, (const uint8_t[]){0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}}, /* | */
-    {  4,  -8, 24, 56, 32, (const uint8_t[]){0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00}}, /* } */
-    {  4,  14, 24, 10, 32, (const uint8_t[]){0x07, 0x80, 0x0F, 0x1F, 0xE0, 0x0F, 0x3F, 0xF0, 0x0F, 0x7F, 0xF8, 0x0F, 0xFC, 0xFC, 0x1F, 0xF8, 0x7E, 0x3F, 0xF0, 0x3F, 0xFE, 0xF0, 0x1F, 0xFC, 0xF0, 0x0F, 0xF8, 0xF0, 0x03, 0xE0}}, /* ~ */
-    {  0,   0,  0,  0, 32, NULL}, /* � */
+    {  0,   0,  0,  0, 32, 0, NULL}, /*   */
+    { 14,   0,  4, 40, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xF7, 0xDF, 0xF0, 0xF0}}, /* ! */
+    {  6,  28, 20, 16, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xF0, 0x00, 0xF0}}, /* " */
+    {  2,   0, 28, 40, 32, 1, (const uint8_t[]){0x7F, 0x77, 0xFF, 0xF7, 0x7F, 0x0F, 0x00, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x0F, 0x00}}, /* # */
+    {  4,  -4, 24, 48, 32, 1, (const uint8_t[]){0x70, 0x1F, 0xC0, 0x1F, 0xFC, 0x07, 0x00, 0x3C, 0x00, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x3C, 0x00, 0xF8, 0x3C, 0x00, 0xF0, 0x3C, 0x00, 0xF8, 0x3C, 0x00, 0x7C, 0x3C, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0x3C, 0x3E, 0x00, 0x3C, 0x1F, 0x00, 0x3C, 0x0F, 0x00, 0x3C, 0x1F, 0x00, 0x3C, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0x00, 0x3C, 0x00}}, /* $ */
+    {  5,   0, 22, 40, 32, 1, (const uint8_t[]){0x45, 0x45, 0x55, 0x51, 0x51, 0x00, 0x00, 0x3C, 0xFC, 0x01, 0xF7, 0xF8, 0x07, 0xFC, 0xF0, 0x3E, 0xF3, 0xC1, 0xF3, 0xCF, 0x0F, 0x87, 0xF8, 0x7C, 0x0F, 0xC1, 0xF0, 0x00, 0x0F, 0x80, 0x00, 0x7C, 0x00, 0x03, 0xE0, 0x00, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x3E, 0x00, 0x01, 0xF0, 0x00, 0x0F, 0x83, 0xF0, 0x3E, 0x1F, 0xE1, 0xF0, 0xF3, 0xCF, 0x83, 0xCF, 0x7C, 0x0F, 0x3F, 0xE0, 0x1F, 0xEF, 0x80, 0x3F, 0x3C, 0x00, 0x00}}, /* % */
+    {  2,   0, 28, 40, 32, 1, (const uint8_t[]){0x01, 0xFC, 0x00, 0x01, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xE0, 0x07, 0xC0, 0x3E, 0x00, 0xF8, 0x01, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0xF8, 0x01, 0xF0, 0x07, 0xC0, 0x3E, 0x00, 0x7F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0xFF, 0xE0, 0x00, 0x7F, 0xF0, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC0, 0x07, 0xC0, 0x3E, 0x1C, 0xF8, 0x01, 0xF3, 0xCF, 0x00, 0x0F, 0xFC, 0xF0, 0x00, 0x7F, 0x8F, 0x00, 0x03, 0xF0, 0xF0, 0x00, 0x3E, 0x0F, 0x00, 0x03, 0xC0, 0xF0, 0x00, 0x3E, 0x0F, 0x00, 0x03, 0xF0, 0xF8, 0x00, 0x7F, 0x87, 0xC0, 0x0F, 0xFC, 0x7F, 0xFF, 0xF3, 0xE3, 0xFF, 0xFF, 0x1F, 0x1F, 0xFF, 0xE0, 0xF0, 0x7F, 0xF8, 0x07}}, /* & */
+    { 14,  28,  4, 16, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xF0}}, /* ' */
+    {  5,  -8, 23, 56, 32, 1, (const uint8_t[]){0x00, 0x15, 0x55, 0xFF, 0xD5, 0x54, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x7F, 0xF8, 0x01, 0xFF, 0xF0, 0x07, 0xF8, 0x00, 0x1F, 0xC0, 0x00, 0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xF0, 0x00, 0x07, 0xF8, 0x00, 0x07, 0xFF, 0xC0, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0x00, 0x01, 0xFE}}, /* ( */
+    {  5,  -8, 23, 56, 32, 1, (const uint8_t[]){0x00, 0x15, 0x55, 0xFF, 0xD5, 0x54, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x80, 0x03, 0xFF, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0x3F, 0xC0, 0x00, 0x1F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x3E, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x3F, 0x00, 0x00, 0xFC, 0x00, 0x07, 0xF0, 0x00, 0x3F, 0xC0, 0x1F, 0xFF, 0x00, 0x3F, 0xFC, 0x00, 0x7F, 0xE0, 0x00, 0xFF, 0x00, 0x00}}, /* ) */
+    {  2,   4, 28, 28, 32, 1, (const uint8_t[]){0x40, 0x37, 0x60, 0x10, 0xF0, 0x00, 0xF0, 0x0F, 0x80, 0x1F, 0x00, 0xFC, 0x03, 0xF0, 0x07, 0xE0, 0x7E, 0x00, 0x3F, 0x0F, 0xC0, 0x01, 0xF9, 0xF8, 0x00, 0x0F, 0xFF, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xFF, 0x00, 0x01, 0xF9, 0xF8, 0x00, 0x3F, 0x0F, 0xC0, 0x07, 0xE0, 0x7E, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0x80, 0x1F, 0x00, 0xF0, 0x00, 0xF0}}, /* * */
+    {  6,   8, 20, 20, 32, 1, (const uint8_t[]){0x7F, 0x77, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 0xF0, 0x0F, 0x00}}, /* + */
+    { 10,  -4,  8, 12, 32, 1, (const uint8_t[]){0x7C, 0x00, 0xF1, 0xF3, 0xEF, 0xEF, 0xCF, 0x8E, 0x00}}, /* , */
+    {  4,  16, 24,  4, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xF0}}, /* - */
+    { 14,   0,  4,  6, 32, 1, (const uint8_t[]){0x7F, 0xC0}}, /* . */
+    {  2,  -6, 28, 52, 32, 1, (const uint8_t[]){0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00}}, /* / */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0x80, 0x00, 0x01, 0xC0, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0xFF, 0xF0, 0x01, 0xFF, 0xF0, 0x03, 0xFF, 0xF0, 0x07, 0xEF, 0xF0, 0x0F, 0xCF, 0xF0, 0x1F, 0x8F, 0xF0, 0x3F, 0x0F, 0xF0, 0x7E, 0x0F, 0xF0, 0xFC, 0x0F, 0xF1, 0xF8, 0x0F, 0xF3, 0xF0, 0x0F, 0xF7, 0xE0, 0x0F, 0xFF, 0xC0, 0x0F, 0xFF, 0x80, 0x0F, 0xFF, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 0 */
+    {  6,   0, 20, 40, 32, 1, (const uint8_t[]){0x00, 0x1F, 0xFF, 0xFF, 0xF7, 0x03, 0xF0, 0x00, 0x7F, 0x00, 0x0F, 0xF0, 0x01, 0xFF, 0x00, 0x3E, 0xF0, 0x07, 0xCF, 0x00, 0xF8, 0xF0, 0x0F, 0x0F, 0x00, 0xE0, 0xF0, 0x0C, 0x0F, 0x00, 0x00, 0xF0, 0x0F, 0xFF, 0xFF}}, /* 1 */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0x78, 0x00, 0x00, 0x37, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF}}, /* 2 */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0x7C, 0x21, 0xFF, 0x40, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x03, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 3 */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0x7F, 0xFF, 0x77, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xF0}}, /* 4 */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x77, 0x7F, 0x01, 0xFF, 0x40, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 5 */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0x7F, 0x01, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 6 */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x77, 0x78, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00}}, /* 7 */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFC, 0x21, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0x78, 0x00, 0x1E, 0x3C, 0x00, 0x3C, 0x1F, 0xFF, 0xF8, 0x0F, 0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x3C, 0x00, 0x3C, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 8 */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xC0, 0x7F, 0x40, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* 9 */
+    { 14,   0,  4, 26, 32, 1, (const uint8_t[]){0x7D, 0xFF, 0xF7, 0xFC, 0x3C}}, /* : */
+    { 10,  -4,  8, 30, 32, 1, (const uint8_t[]){0x7D, 0xFF, 0xDF, 0x00, 0x3C, 0x00, 0x3C, 0x7C, 0xFB, 0xFB, 0xF3, 0xE3, 0x80}}, /* ; */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F}}, /* < */
+    {  4,  12, 24, 16, 32, 1, (const uint8_t[]){0x77, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF}}, /* = */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x00, 0x00, 0x1C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xF8, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFC, 0x00, 0x00}}, /* > */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0x70, 0x15, 0x77, 0xDF, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xE0, 0x00, 0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00}}, /* ? */
+    {  4,   0, 24, 36, 32, 1, (const uint8_t[]){0x01, 0xDF, 0xFD, 0xDC, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE7, 0xC0, 0x03, 0xEF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x03, 0xF0, 0xFF, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xC0}}, /* @ */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xDD, 0xFF, 0xFF, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F}}, /* A */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFC, 0x21, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x3C, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xF0, 0x00, 0x3C, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* B */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* C */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* D */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xDD, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* E */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xDD, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0x00}}, /* F */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xDD, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* G */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xDD, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F}}, /* H */
+    {  6,   0, 20, 40, 32, 1, (const uint8_t[]){0x77, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 0xF0}}, /* I */
+    {  2,   0, 24, 40, 32, 1, (const uint8_t[]){0x77, 0xFF, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00}}, /* J */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xF8, 0x08, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x7C, 0xF0, 0x00, 0xF8, 0xF0, 0x01, 0xF0, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF, 0xE0, 0xF0, 0x01, 0xF0, 0xF0, 0x00, 0xF8, 0xF0, 0x00, 0x7C, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F}}, /* K */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* L */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFF, 0x00, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC3, 0xFF, 0xF7, 0xE7, 0xEF, 0xF3, 0xFF, 0xCF, 0xF1, 0xFF, 0x8F, 0xF0, 0xFF, 0x0F, 0xF0, 0x7E, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x18, 0x0F, 0xF0, 0x00, 0x0F}}, /* M */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x55, 0x55, 0x55, 0x55, 0x55, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xFC, 0x00, 0x0F, 0xFE, 0x00, 0x0F, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xF7, 0xC0, 0x0F, 0xF3, 0xE0, 0x0F, 0xF1, 0xF0, 0x0F, 0xF0, 0xF8, 0x0F, 0xF0, 0x7C, 0x0F, 0xF0, 0x3E, 0x0F, 0xF0, 0x1F, 0x0F, 0xF0, 0x0F, 0x8F, 0xF0, 0x07, 0xCF, 0xF0, 0x03, 0xEF, 0xF0, 0x01, 0xFF, 0xF0, 0x00, 0xFF, 0xF0, 0x00, 0x7F, 0xF0, 0x00, 0x3F}}, /* N */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0}}, /* O */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x00}}, /* P */
+    {  4,  -8, 24, 48, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xFF, 0xF5, 0x40, 0x55, 0x07, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xFC, 0x7F, 0xFF, 0xFE, 0x7C, 0x00, 0x3E, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x3E, 0x0F, 0xF0, 0x1F, 0x0F, 0xF8, 0x0F, 0x9F, 0x7C, 0x0F, 0xBE, 0x7F, 0xFF, 0xFE, 0x3F, 0xFF, 0xFC, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x3C}}, /* Q */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFE, 0x08, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x7C, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF8, 0xF0, 0x00, 0x7C, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F}}, /* R */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0x00, 0x7F, 0xC0, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFC, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* S */
+    {  2,   0, 28, 40, 32, 1, (const uint8_t[]){0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00}}, /* T */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* U */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0x81, 0xF8, 0x0F, 0xC3, 0xF0, 0x07, 0xE7, 0xE0, 0x03, 0xFF, 0xC0, 0x01, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3C, 0x00}}, /* V */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0xF0, 0x00, 0x0F, 0xF0, 0x18, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x7E, 0x0F, 0xF0, 0xFF, 0x0F, 0xF1, 0xFF, 0x8F, 0xF3, 0xFF, 0xCF, 0xF7, 0xE7, 0xEF, 0xFF, 0xC3, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0x00, 0xFF, 0xFE, 0x00, 0x7F, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F}}, /* W */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xF8, 0x08, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0xFC, 0x00, 0x3F, 0x7E, 0x00, 0x7E, 0x3F, 0x00, 0xFC, 0x1F, 0x81, 0xF8, 0x0F, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x1F, 0x81, 0xF8, 0x3F, 0x00, 0xFC, 0x7E, 0x00, 0x7E, 0xFC, 0x00, 0x3F, 0xF8, 0x00, 0x1F, 0xF0, 0x00, 0x0F}}, /* X */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0x01, 0xFF, 0xC0, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* Y */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x77, 0xE0, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xFF}}, /* Z */
+    {  8,  -8, 20, 56, 32, 1, (const uint8_t[]){0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xF0}}, /* [ */
+    {  2,  -6, 28, 52, 32, 1, (const uint8_t[]){0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00, 0xF0}}, /* \ */
+    {  4,  -8, 20, 56, 32, 1, (const uint8_t[]){0x77, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0}}, /* ] */
+    {  2,  28, 28, 16, 32, 0, (const uint8_t[]){0x00, 0x0F, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0x80, 0x03, 0xF0, 0xFC, 0x00, 0x7E, 0x07, 0xE0, 0x0F, 0xC0, 0x3F, 0x01, 0xF8, 0x01, 0xF8, 0x3F, 0x00, 0x0F, 0xC7, 0xE0, 0x00, 0x7E, 0xFC, 0x00, 0x03, 0xFF, 0x80, 0x00, 0x1F, 0xF0, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x07}}, /* ^ */
+    {  2,  -8, 28,  4, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xFF}}, /* _ */
+    { 10,  32, 12, 12, 32, 0, (const uint8_t[]){0xE0, 0x0F, 0x00, 0xF8, 0x0F, 0xC0, 0x7E, 0x03, 0xF0, 0x1F, 0x80, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF0, 0x0F}}, /* ` */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x01, 0xC0, 0x7C, 0x03, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xF7, 0xC0, 0x00, 0xF7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0}}, /* a */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xF0, 0x1F, 0xFF, 0xC0, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* b */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0}}, /* c */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xF0, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF}}, /* d */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x01, 0xF7, 0x7C, 0x00, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0}}, /* e */
+    {  6,   0, 20, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0x77, 0xFF, 0xFF, 0x00, 0x7F, 0xF0, 0x1F, 0xFF, 0x03, 0xFF, 0xF0, 0x7F, 0xFF, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0x00, 0x00}}, /* f */
+    {  4, -12, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xFC, 0x01, 0xC0, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x1F, 0x7C, 0x00, 0x3E, 0x7F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xF8, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* g */
+    {  4,   0, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xF0, 0x1F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F}}, /* h */
+    { 10,   0, 12, 40, 32, 1, (const uint8_t[]){0x7D, 0xF7, 0x7F, 0xFF, 0xF7, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0xF0}}, /* i */
+    {  6, -12, 12, 52, 32, 1, (const uint8_t[]){0x7D, 0xF7, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x01, 0xF0, 0x3E, 0xFF, 0xEF, 0xFC, 0xFF, 0x8F, 0xE0}}, /* j */
+    {  6,   0, 22, 40, 32, 1, (const uint8_t[]){0x7F, 0xF0, 0x01, 0xC0, 0x00, 0xF0, 0x00, 0x03, 0xC0, 0x07, 0x0F, 0x00, 0x3C, 0x3C, 0x01, 0xF0, 0xF0, 0x0F, 0x83, 0xC0, 0x7C, 0x0F, 0x03, 0xE0, 0x3C, 0x1F, 0x00, 0xF0, 0xF8, 0x03, 0xC7, 0xC0, 0x0F, 0x3E, 0x00, 0x3F, 0xF0, 0x00, 0xF3, 0xE0, 0x03, 0xC7, 0xC0, 0x0F, 0x0F, 0x80, 0x3C, 0x1F, 0x00, 0xF0, 0x3E, 0x03, 0xC0, 0x7C, 0x0F, 0x00, 0xF8, 0x3C, 0x01, 0xF0, 0xF0, 0x03, 0xE3, 0xC0, 0x07, 0xCF, 0x00, 0x0F, 0xBC, 0x00, 0x1F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x70}}, /* k */
+    { 10,   0, 16, 40, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0xFF, 0x3F, 0xFF, 0x1F, 0xFF, 0x07, 0xFF}}, /* l */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xF7, 0xFF, 0xFC, 0x3E, 0x0F, 0xFC, 0x3F, 0x8F, 0xFC, 0x3F, 0xCF, 0xFC, 0x3F, 0xEF, 0x03, 0xC3, 0xEF, 0x03, 0xC1, 0xFF, 0x03, 0xC0, 0xFF, 0x00, 0x00, 0xF0}}, /* m */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xEF, 0x00, 0x03, 0xEF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xF0}}, /* n */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xFC, 0x00, 0x7F, 0xFE, 0x01, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE7, 0xC0, 0x03, 0xEF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xF7, 0xC0, 0x03, 0xE7, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x80, 0x7F, 0xFE, 0x00}}, /* o */
+    {  4, -12, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFE, 0xF0, 0x00, 0x3E, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF0, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0, 0xF0, 0x00, 0x00}}, /* p */
+    {  4, -12, 24, 40, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xFC, 0x07, 0xFF, 0x07, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x7F, 0xFF, 0xFF, 0x7C, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0F}}, /* q */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x01, 0x7F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00}}, /* r */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x01, 0xC0, 0x1C, 0x00, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xF7, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x07, 0xC0, 0x00, 0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xE0, 0x00, 0x03, 0xE0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFE, 0x00}}, /* s */
+    {  6,   0, 20, 40, 32, 1, (const uint8_t[]){0x7F, 0xF7, 0x7F, 0xFF, 0xC0, 0x0F, 0x00, 0x0F, 0xFF, 0xF0, 0x0F, 0x00, 0x00, 0xF8, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0x03, 0xFF, 0xF0, 0x1F, 0xFF, 0x00, 0x7F, 0xF0}}, /* t */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFC, 0x0F, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xF7, 0xC0, 0x00, 0xF7, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF1, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xF0}}, /* u */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0x80, 0x0F, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xF7, 0xC0, 0x03, 0xE3, 0xE0, 0x07, 0xC1, 0xF0, 0x0F, 0x80, 0xF8, 0x1F, 0x00, 0x7C, 0x3E, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xC0, 0x00}}, /* v */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x7F, 0x7F, 0xFC, 0x0F, 0x00, 0x00, 0xFF, 0x03, 0xC0, 0xFF, 0x83, 0xC0, 0xF7, 0xC3, 0xC0, 0xF7, 0xFC, 0x3F, 0xF3, 0xFC, 0x3F, 0xF1, 0xFC, 0x3F, 0xF0, 0x7C, 0x3F, 0xF0}}, /* w */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x60, 0x08, 0x05, 0x7F, 0x00, 0x00, 0xFF, 0x80, 0x01, 0xF7, 0xC0, 0x03, 0xE3, 0xE0, 0x07, 0xC1, 0xF0, 0x0F, 0x80, 0xF8, 0x1F, 0x00, 0x7C, 0x3E, 0x00, 0x3E, 0x7C, 0x00, 0x1F, 0xF8, 0x00, 0x0F, 0xF0, 0x00, 0x1F, 0xF8, 0x00, 0x3E, 0x7C, 0x00, 0x7C, 0x3E, 0x00, 0xF8, 0x1F, 0x01, 0xF0, 0x0F, 0x83, 0xE0, 0x07, 0xC3, 0xC0, 0x03, 0xC7, 0xC0, 0x03, 0xEF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0xF0}}, /* x */
+    {  4, -12, 24, 40, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFC, 0x07, 0xC0, 0xF0, 0x00, 0x0F, 0xF8, 0x00, 0x0F, 0x7C, 0x00, 0x0F, 0x7F, 0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x1F, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xE0}}, /* y */
+    {  4,   0, 24, 28, 32, 1, (const uint8_t[]){0x70, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xF0}}, /* z */
+    {  4,  -8, 24, 56, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xF8, 0x1C, 0x0F, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x7F, 0xFF, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xF0, 0x00, 0x07, 0xE0, 0x00, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xFF, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xF0, 0x00, 0x01, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x3F, 0xFF, 0x00, 0x1F, 0xFF, 0x00, 0x07, 0xFF}}, /* { */
+    { 14,  -4,  4, 48, 32, 1, (const uint8_t[]){0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0}}, /* | */
+    {  4,  -8, 24, 56, 32, 1, (const uint8_t[]){0x01, 0xFF, 0xF8, 0x1C, 0x0F, 0xFF, 0xC0, 0xFF, 0xE0, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0xC0, 0x00, 0x07, 0xE0, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x01, 0xFF, 0x00, 0x03, 0xFF, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0xC0, 0x00, 0x0F, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x3E, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0xFF, 0xF8, 0x00, 0xFF, 0xE0, 0x00}}, /* } */
+    {  4,  14, 24, 10, 32, 0, (const uint8_t[]){0x07, 0x80, 0x0F, 0x1F, 0xE0, 0x0F, 0x3F, 0xF0, 0x0F, 0x7F, 0xF8, 0x0F, 0xFC, 0xFC, 0x1F, 0xF8, 0x7E, 0x3F, 0xF0, 0x3F, 0xFE, 0xF0, 0x1F, 0xFC, 0xF0, 0x0F, 0xF8, 0xF0, 0x03, 0xE0}}, /* ~ */
+    {  0,   0,  0,  0, 32, 0, NULL}, /* � */
 };
-const ILI9341_FontDef ILI9341_Font_Spleen32x64 = { 0x20, 0x7F, 320, 52, 12, ILI9341_Font_Spleen32x64_Glyphs };
+static const ILI9341_FontRangeDef ILI9341_Font_Spleen32x64_Ranges[] = {{0x20, 0x7F, 0x00}};
+const ILI9341_FontDef ILI9341_Font_Spleen32x64 = { ILI9341_Font_Spleen32x64_Ranges, 1, 320, 52, 12, ILI9341_Font_Spleen32x64_Glyphs, NULL, 0, NULL };
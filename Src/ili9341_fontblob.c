@@ -0,0 +1,344 @@
+#include "ili9341_fontblob.h"
+
+#include "string.h"
+
+/**
+ * @brief Read a little-endian 16-bit integer
+ * @param bytes Pointer to the integer
+ * @return Value of the integer
+ */
+static uint_fast16_t ILI9341_FontBlob_U16(const uint8_t* bytes) {
+    return bytes[0] | (bytes[1] << 8);
+}
+
+/**
+ * @brief Read a little-endian 32-bit integer
+ * @param bytes Pointer to the integer
+ * @return Value of the integer
+ */
+static uint32_t ILI9341_FontBlob_U32(const uint8_t* bytes) {
+    return bytes[0] | (bytes[1] << 8) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[3] << 24);
+}
+
+/**
+ * @brief Check whether a part of a memory-mapped blob is inside the blob
+ * @param blob Pointer to font blob handle structure
+ * @param offset Offset of the part in the blob
+ * @param length Length of the part in bytes
+ * @return true if the part ends at or before the end of the blob
+ */
+static bool ILI9341_FontBlob_Fits(const ILI9341_FontBlob_HandleTypeDef* blob, uint32_t offset, uint_fast32_t length) {
+    return offset <= blob->mapped_size && length <= blob->mapped_size - offset;
+}
+
+/**
+ * @brief Read bytes of a blob, from memory or through the read function
+ * @param blob Pointer to font blob handle structure
+ * @param offset Offset in the blob
+ * @param buffer Where to store the bytes
+ * @param length Number of bytes to read
+ * @return true if all bytes were read, false if they are past the end of a memory-mapped blob
+ */
+static bool ILI9341_FontBlob_Read(ILI9341_FontBlob_HandleTypeDef* blob, uint32_t offset, void* buffer, size_t length) {
+    if (blob->mapped != NULL) {
+        if (!ILI9341_FontBlob_Fits(blob, offset, length)) return false;
+        memcpy(buffer, blob->mapped + offset, length);
+        return true;
+    }
+    return blob->read(blob->read_context, offset, buffer, length);
+}
+
+/**
+ * @brief Read the header and the codepoint ranges of a blob
+ * @param blob Pointer to font blob handle structure
+ * @return true if the blob is a font blob that fits in the handle, with ranges that only map to its glyphs and, when
+ * memory-mapped, tables that are inside the blob
+ */
+static bool ILI9341_FontBlob_ReadHeader(ILI9341_FontBlob_HandleTypeDef* blob) {
+    uint8_t header[ILI9341_FONT_BLOB_HEADER_SIZE];
+    if (!ILI9341_FontBlob_Read(blob, 0, header, sizeof(header))) return false;
+    if (memcmp(header, "ILIF", 4) != 0 || header[4] != ILI9341_FONT_BLOB_VERSION) return false;
+
+    uint_fast16_t rangeCount = ILI9341_FontBlob_U16(&header[10]);
+    uint_fast16_t glyphCount = ILI9341_FontBlob_U16(&header[12]);
+    uint_fast16_t kerningCount = ILI9341_FontBlob_U16(&header[14]);
+    uint32_t rangesOffset = ILI9341_FontBlob_U32(&header[20]);
+    uint32_t glyphsOffset = ILI9341_FontBlob_U32(&header[24]);
+    uint32_t kerningOffset = ILI9341_FontBlob_U32(&header[28]);
+    if (rangeCount > ILI9341_FONT_BLOB_MAX_RANGES) return false;
+
+    // A streamed blob has no known size, reads past its end fail in the read function instead
+    uint_fast32_t rangesSize = (uint_fast32_t)rangeCount * ILI9341_FONT_BLOB_RANGE_SIZE;
+    uint_fast32_t glyphsSize = (uint_fast32_t)glyphCount * ILI9341_FONT_BLOB_GLYPH_SIZE;
+    uint_fast32_t kerningSize = (uint_fast32_t)kerningCount * ILI9341_FONT_BLOB_KERNING_PAIR_SIZE;
+    if (blob->mapped != NULL &&
+        (!ILI9341_FontBlob_Fits(blob, rangesOffset, rangesSize) ||
+         !ILI9341_FontBlob_Fits(blob, glyphsOffset, glyphsSize) ||
+         !ILI9341_FontBlob_Fits(blob, kerningOffset, kerningSize))) {
+        return false;
+    }
+
+    for (uint_fast16_t i = 0; i < rangeCount; i++) {
+        uint8_t range[ILI9341_FONT_BLOB_RANGE_SIZE];
+        if (!ILI9341_FontBlob_Read(blob, rangesOffset + i * ILI9341_FONT_BLOB_RANGE_SIZE, range, sizeof(range))) {
+            return false;
+        }
+
+        uint32_t start = ILI9341_FontBlob_U32(&range[0]);
+        uint32_t end = ILI9341_FontBlob_U32(&range[4]);
+        uint_fast16_t glyphIndex = ILI9341_FontBlob_U16(&range[8]);
+
+        // Every codepoint of the range must have a glyph
+        if (end < start || glyphIndex >= glyphCount || end - start >= glyphCount - glyphIndex) return false;
+
+        blob->ranges[i].start_codepoint = start;
+        blob->ranges[i].end_codepoint = end;
+        blob->ranges[i].glyph_index = glyphIndex;
+    }
+
+    blob->ascent = (int8_t)header[5];
+    blob->descent = (int8_t)header[6];
+    blob->average_width = (int16_t)ILI9341_FontBlob_U16(&header[8]);
+    blob->range_count = rangeCount;
+    blob->glyph_count = glyphCount;
+    blob->kerning_count = kerningCount;
+    blob->slot_size = ILI9341_FontBlob_U16(&header[16]);
+    blob->glyphs_offset = glyphsOffset;
+    blob->kerning_offset = kerningOffset;
+    return true;
+}
+
+/**
+ * @brief Find the glyph index of a codepoint with a binary search of the ranges of a blob, see ILI9341_FontLoaderDef
+ * @param context Pointer to font blob handle structure
+ * @param codepoint Unicode codepoint
+ * @param index Where to store the index of the glyph
+ * @return true if the codepoint is covered by the font
+ */
+static bool ILI9341_FontBlob_FindGlyph(void* context, uint32_t codepoint, uint_fast16_t* index) {
+    ILI9341_FontBlob_HandleTypeDef* blob = context;
+    uint_fast16_t low = 0;
+    uint_fast16_t high = blob->range_count;
+
+    while (low < high) {
+        uint_fast16_t middle = low + (high - low) / 2;
+        const ILI9341_FontBlob_RangeTypeDef* range = &blob->ranges[middle];
+
+        if (codepoint < range->start_codepoint) {
+            high = middle;
+        } else if (codepoint > range->end_codepoint) {
+            low = middle + 1;
+        } else {
+            *index = range->glyph_index + (codepoint - range->start_codepoint);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Make a glyph from its metrics in the blob
+ * @param metrics First bytes of the glyph entry, from bbX to encoding
+ * @param data Glyph data, NULL to draw the glyph empty
+ * @return Glyph definition
+ */
+static ILI9341_GlyphDef ILI9341_FontBlob_Glyph(const uint8_t* metrics, const uint8_t* data) {
+    ILI9341_GlyphDef glyph = {
+        .bbX = (int8_t)metrics[0],
+        .bbY = (int8_t)metrics[1],
+        .bbW = data != NULL ? (int8_t)metrics[2] : 0,
+        .bbH = data != NULL ? (int8_t)metrics[3] : 0,
+        .advance = (int8_t)metrics[4],
+        .encoding = metrics[5],
+        .data = data
+    };
+    return glyph;
+}
+
+/**
+ * @brief Check whether glyph data holds the whole bitmap of its metrics
+ * @param metrics First bytes of the glyph entry, from bbX to encoding
+ * @param data Glyph data
+ * @param size Size of the glyph data in bytes
+ * @return true if the glyph can be drawn from the data, false for a short bitmap or an unknown encoding
+ */
+static bool ILI9341_FontBlob_DataFits(const uint8_t* metrics, const uint8_t* data, uint_fast16_t size) {
+    uint_fast32_t width = metrics[2];
+    uint_fast32_t height = metrics[3];
+    uint_fast32_t bits;
+
+    switch (metrics[5]) {
+        case ILI9341_GLYPH_ENCODING_BITMAP:
+            bits = width * height;
+            break;
+        case ILI9341_GLYPH_ENCODING_ROW_REPEAT:
+            // The flags come first, only the rows that are not flagged are stored
+            if (size < (height + 7) / 8) return false;
+            bits = height;
+            for (uint_fast32_t row = 0; row < height; row++) {
+                if (row == 0 || !(data[row / 8] & (0x80 >> (row % 8)))) bits += width;
+            }
+            break;
+        case ILI9341_GLYPH_ENCODING_COVERAGE_2BPP:
+            bits = width * height * 2;
+            break;
+        case ILI9341_GLYPH_ENCODING_COVERAGE_4BPP:
+            bits = width * height * 4;
+            break;
+        default:
+            return false;
+    }
+
+    return (bits + 7) / 8 <= size;
+}
+
+/**
+ * @brief Get a glyph of a blob, see ILI9341_FontLoaderDef
+ * @param context Pointer to font blob handle structure
+ * @param index Index of the glyph
+ * @return Glyph definition, empty if it could not be read or its data is not inside the blob
+ * @note A streamed glyph is loaded into the least recently used slot, so its data stays valid until slot_count other
+ * glyphs are loaded.
+ */
+static ILI9341_GlyphDef ILI9341_FontBlob_LoadGlyph(void* context, uint_fast16_t index) {
+    ILI9341_FontBlob_HandleTypeDef* blob = context;
+    const uint8_t none[6] = {0};
+
+    if (index >= blob->glyph_count) return ILI9341_FontBlob_Glyph(none, NULL);
+
+    if (blob->mapped == NULL) {
+        for (uint_fast16_t i = 0; i < blob->slot_count; i++) {
+            ILI9341_FontBlob_SlotTypeDef* slot = &blob->slots[i];
+            if (slot->index == index) {
+                slot->last_used = ++blob->clock;
+                blob->hits++;
+                return ILI9341_FontBlob_Glyph(slot->metrics, blob->cache + i * blob->slot_size);
+            }
+        }
+        blob->misses++;
+    }
+
+    uint8_t entry[ILI9341_FONT_BLOB_GLYPH_SIZE];
+    uint32_t entryOffset = blob->glyphs_offset + (uint32_t)index * ILI9341_FONT_BLOB_GLYPH_SIZE;
+    if (!ILI9341_FontBlob_Read(blob, entryOffset, entry, sizeof(entry))) return ILI9341_FontBlob_Glyph(none, NULL);
+
+    uint_fast16_t size = ILI9341_FontBlob_U16(&entry[6]);
+    uint32_t dataOffset = ILI9341_FontBlob_U32(&entry[8]);
+
+    // Memory-mapped glyph data is used in place
+    if (size == 0) return ILI9341_FontBlob_Glyph(entry, NULL);
+    if (blob->mapped != NULL) {
+        const uint8_t* data = blob->mapped + dataOffset;
+        if (!ILI9341_FontBlob_Fits(blob, dataOffset, size) || !ILI9341_FontBlob_DataFits(entry, data, size)) {
+            return ILI9341_FontBlob_Glyph(entry, NULL);
+        }
+        return ILI9341_FontBlob_Glyph(entry, data);
+    }
+
+    // Glyphs that do not fit in a slot keep their advance, so text is still laid out the same
+    if (blob->slot_count == 0 || size > blob->slot_size) return ILI9341_FontBlob_Glyph(entry, NULL);
+
+    uint_fast16_t victim = 0;
+    for (uint_fast16_t i = 1; i < blob->slot_count; i++) {
+        if (blob->slots[victim].index == UINT16_MAX) break;
+        if (blob->slots[i].index == UINT16_MAX || blob->slots[i].last_used < blob->slots[victim].last_used) victim = i;
+    }
+
+    ILI9341_FontBlob_SlotTypeDef* slot = &blob->slots[victim];
+    uint8_t* data = blob->cache + victim * blob->slot_size;
+    if (!ILI9341_FontBlob_Read(blob, dataOffset, data, size) || !ILI9341_FontBlob_DataFits(entry, data, size)) {
+        slot->index = UINT16_MAX;
+        return ILI9341_FontBlob_Glyph(entry, NULL);
+    }
+
+    slot->index = index;
+    memcpy(slot->metrics, entry, sizeof(slot->metrics));
+    slot->last_used = ++blob->clock;
+    return ILI9341_FontBlob_Glyph(entry, data);
+}
+
+/**
+ * @brief Get the kerning of a pair of codepoints with a binary search of the pairs of a blob, see
+ * ILI9341_FontLoaderDef
+ * @param context Pointer to font blob handle structure
+ * @param left Unicode codepoint of the left character
+ * @param right Unicode codepoint of the right character
+ * @return Kerning of the pair in pixels before scaling, 0 if the pair is not kerned or could not be read
+ */
+static int_fast8_t ILI9341_FontBlob_Kerning(void* context, uint32_t left, uint32_t right) {
+    ILI9341_FontBlob_HandleTypeDef* blob = context;
+    uint_fast32_t key = (left << 16) | right;
+    uint_fast16_t low = 0;
+    uint_fast16_t high = blob->kerning_count;
+
+    while (low < high) {
+        uint_fast16_t middle = low + (high - low) / 2;
+        uint8_t pair[ILI9341_FONT_BLOB_KERNING_PAIR_SIZE];
+        uint32_t offset = blob->kerning_offset + (uint32_t)middle * ILI9341_FONT_BLOB_KERNING_PAIR_SIZE;
+        if (!ILI9341_FontBlob_Read(blob, offset, pair, sizeof(pair))) return 0;
+
+        uint_fast32_t pairKey = ((uint_fast32_t)ILI9341_FontBlob_U16(&pair[0]) << 16) | ILI9341_FontBlob_U16(&pair[2]);
+
+        if (key < pairKey) {
+            high = middle;
+        } else if (key > pairKey) {
+            low = middle + 1;
+        } else {
+            return (int8_t)pair[4];
+        }
+    }
+
+    return 0;
+}
+
+ILI9341_FontBlob_HandleTypeDef ILI9341_FontBlob_InitMapped(const void* blob, size_t blobSize) {
+    ILI9341_FontBlob_HandleTypeDef blob_instance = {.mapped = blob, .mapped_size = blobSize};
+
+    blob_instance.valid = ILI9341_FontBlob_ReadHeader(&blob_instance);
+
+    return blob_instance;
+}
+
+ILI9341_FontBlob_HandleTypeDef ILI9341_FontBlob_InitStream(
+    ILI9341_FontBlob_ReadTypeDef read,
+    void* readContext,
+    uint8_t* cache,
+    size_t cacheSize
+) {
+    ILI9341_FontBlob_HandleTypeDef blob_instance = {.read = read, .read_context = readContext, .cache = cache};
+
+    blob_instance.valid = ILI9341_FontBlob_ReadHeader(&blob_instance);
+
+    if (blob_instance.valid && blob_instance.slot_size > 0) {
+        size_t slotCount = cacheSize / blob_instance.slot_size;
+        blob_instance.slot_count = slotCount < ILI9341_FONT_BLOB_MAX_SLOTS ? slotCount : ILI9341_FONT_BLOB_MAX_SLOTS;
+    }
+    for (uint_fast16_t i = 0; i < ILI9341_FONT_BLOB_MAX_SLOTS; i++) { blob_instance.slots[i].index = UINT16_MAX; }
+
+    return blob_instance;
+}
+
+ILI9341_FontDef ILI9341_FontBlob_GetFont(ILI9341_FontBlob_HandleTypeDef* blob) {
+    blob->loader = (ILI9341_FontLoaderDef){
+        .find_glyph = ILI9341_FontBlob_FindGlyph,
+        .load_glyph = ILI9341_FontBlob_LoadGlyph,
+        .kerning = ILI9341_FontBlob_Kerning,
+        .context = blob,
+        .reuses_data = blob->mapped == NULL
+    };
+
+    ILI9341_FontDef font = {
+        .ranges = NULL,
+        .rangeCount = blob->range_count,
+        .averageWidth = blob->average_width,
+        .ascent = blob->ascent,
+        .descent = blob->descent,
+        .glyphs = NULL,
+        .kerning = NULL,
+        .kerningCount = blob->kerning_count,
+        .loader = &blob->loader
+    };
+
+    return font;
+}
@@ -0,0 +1,374 @@
+#include "ili9341_gesture.h"
+
+#include "stdlib.h"
+
+/**
+ * @brief Check whether two samples are close to each other
+ * @param a Pointer to the first sample
+ * @param b Pointer to the second sample
+ * @param distance Largest distance in pixels on each axis
+ * @return true if the samples are at most distance apart on both axes
+ */
+static bool ILI9341_Gesture_Near(
+    const ILI9341_Gesture_SampleTypeDef* a,
+    const ILI9341_Gesture_SampleTypeDef* b,
+    uint_fast16_t distance
+) {
+    return abs(a->x - b->x) <= (int)distance && abs(a->y - b->y) <= (int)distance;
+}
+
+/**
+ * @brief Get the latest sample of the touch in progress
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @return Pointer to the sample
+ */
+static const ILI9341_Gesture_SampleTypeDef* ILI9341_Gesture_Latest(const ILI9341_Gesture_HandleTypeDef* gesture) {
+    uint_fast8_t index = (gesture->history_next + ILI9341_GESTURE_HISTORY_SIZE - 1) % ILI9341_GESTURE_HISTORY_SIZE;
+    return &gesture->history[index];
+}
+
+/**
+ * @brief Add a sample to the history of the touch in progress, replacing the oldest one when it is full
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param sample Pointer to the sample
+ */
+static void ILI9341_Gesture_AddSample(
+    ILI9341_Gesture_HandleTypeDef* gesture,
+    const ILI9341_Gesture_SampleTypeDef* sample
+) {
+    gesture->history[gesture->history_next] = *sample;
+    gesture->history_next = (gesture->history_next + 1) % ILI9341_GESTURE_HISTORY_SIZE;
+    if (gesture->history_count < ILI9341_GESTURE_HISTORY_SIZE) gesture->history_count++;
+}
+
+/**
+ * @brief Compute the velocity of the touch in progress over the last velocity_time of its history
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param velocityX Pointer to store the X velocity in pixels per second
+ * @param velocityY Pointer to store the Y velocity in pixels per second
+ * @note When the samples are further apart than velocity_time, the velocity is measured from the sample before the
+ * latest one.
+ */
+static void ILI9341_Gesture_Velocity(
+    const ILI9341_Gesture_HandleTypeDef* gesture,
+    int16_t* velocityX,
+    int16_t* velocityY
+) {
+    const ILI9341_Gesture_SampleTypeDef* latest = ILI9341_Gesture_Latest(gesture);
+    const ILI9341_Gesture_SampleTypeDef* oldest = latest;
+
+    for (uint_fast8_t i = 2; i <= gesture->history_count; i++) {
+        uint_fast8_t index =
+            (gesture->history_next + ILI9341_GESTURE_HISTORY_SIZE - i) % ILI9341_GESTURE_HISTORY_SIZE;
+        const ILI9341_Gesture_SampleTypeDef* sample = &gesture->history[index];
+        if (oldest != latest && latest->timestamp - sample->timestamp > gesture->config.velocity_time) break;
+        oldest = sample;
+    }
+
+    int32_t duration = latest->timestamp - oldest->timestamp;
+    int32_t vx = duration > 0 ? (latest->x - oldest->x) * 1000 / duration : 0;
+    int32_t vy = duration > 0 ? (latest->y - oldest->y) * 1000 / duration : 0;
+    *velocityX = vx < INT16_MIN ? INT16_MIN : (vx > INT16_MAX ? INT16_MAX : vx);
+    *velocityY = vy < INT16_MIN ? INT16_MIN : (vy > INT16_MAX ? INT16_MAX : vy);
+}
+
+/**
+ * @brief Queue a gesture event, a move of a drag replaces the previous move if it was not read yet
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param event Pointer to the event
+ */
+static void ILI9341_Gesture_Push(ILI9341_Gesture_HandleTypeDef* gesture, const ILI9341_Gesture_EventTypeDef* event) {
+    if (gesture->event_count > 0 && event->kind == ILI9341_GESTURE_DRAG_MOVE) {
+        uint_fast8_t newest = (gesture->event_head + gesture->event_count - 1) % ILI9341_GESTURE_EVENT_QUEUE_SIZE;
+        if (gesture->events[newest].kind == ILI9341_GESTURE_DRAG_MOVE) {
+            gesture->events[newest] = *event;
+            return;
+        }
+    }
+
+    if (gesture->event_count == ILI9341_GESTURE_EVENT_QUEUE_SIZE) {
+        gesture->dropped_events++;
+        return;
+    }
+
+    uint_fast8_t index = (gesture->event_head + gesture->event_count) % ILI9341_GESTURE_EVENT_QUEUE_SIZE;
+    gesture->events[index] = *event;
+    gesture->event_count++;
+}
+
+/**
+ * @brief Queue a gesture event of the touch in progress
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param kind Event type
+ * @param sample Pointer to the sample the gesture was recognized on
+ * @param timestamp Timestamp of the event
+ */
+static void ILI9341_Gesture_Report(
+    ILI9341_Gesture_HandleTypeDef* gesture,
+    ILI9341_Gesture_KindTypeDef kind,
+    const ILI9341_Gesture_SampleTypeDef* sample,
+    uint32_t timestamp
+) {
+    ILI9341_Gesture_EventTypeDef event = {
+        .kind = kind,
+        .x = sample->x,
+        .y = sample->y,
+        .start_x = gesture->start.x,
+        .start_y = gesture->start.y,
+        .velocity_x = 0,
+        .velocity_y = 0,
+        .direction = ILI9341_GESTURE_DIRECTION_NONE,
+        .timestamp = timestamp
+    };
+    if (kind == ILI9341_GESTURE_DRAG_START || kind == ILI9341_GESTURE_DRAG_MOVE) {
+        ILI9341_Gesture_Velocity(gesture, &event.velocity_x, &event.velocity_y);
+    }
+    ILI9341_Gesture_Push(gesture, &event);
+}
+
+/**
+ * @brief Report the tap waiting for a second tap as a single tap
+ * @param gesture Pointer to gesture recognizer handle structure
+ */
+static void ILI9341_Gesture_FlushTap(ILI9341_Gesture_HandleTypeDef* gesture) {
+    if (!gesture->tap_pending) return;
+    gesture->tap_pending = false;
+    gesture->second_tap = false;
+
+    ILI9341_Gesture_EventTypeDef event = {
+        .kind = ILI9341_GESTURE_TAP,
+        .x = gesture->tap.x,
+        .y = gesture->tap.y,
+        .start_x = gesture->tap.x,
+        .start_y = gesture->tap.y,
+        .velocity_x = 0,
+        .velocity_y = 0,
+        .direction = ILI9341_GESTURE_DIRECTION_NONE,
+        .timestamp = gesture->tap.timestamp
+    };
+    ILI9341_Gesture_Push(gesture, &event);
+}
+
+/**
+ * @brief Recognize the gestures that are due at a given time
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param now Current time in milliseconds
+ */
+static void ILI9341_Gesture_CheckTime(ILI9341_Gesture_HandleTypeDef* gesture, uint32_t now) {
+    const ILI9341_Gesture_ConfigTypeDef* config = &gesture->config;
+
+    if (gesture->tap_pending && gesture->state == ILI9341_GESTURE_STATE_IDLE &&
+        now - gesture->tap.timestamp > config->double_tap_time) {
+        ILI9341_Gesture_FlushTap(gesture);
+    }
+
+    if (gesture->state == ILI9341_GESTURE_STATE_PRESSED && config->long_press_time > 0 &&
+        now - gesture->start.timestamp >= config->long_press_time) {
+        ILI9341_Gesture_FlushTap(gesture);
+        ILI9341_Gesture_Report(gesture, ILI9341_GESTURE_LONG_PRESS, ILI9341_Gesture_Latest(gesture), now);
+        gesture->state = ILI9341_GESTURE_STATE_LONG_PRESSED;
+    }
+}
+
+/**
+ * @brief Report the end of a drag, and a swipe if it was released while moving fast enough
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param sample Pointer to the release sample
+ */
+static void ILI9341_Gesture_EndDrag(
+    ILI9341_Gesture_HandleTypeDef* gesture,
+    const ILI9341_Gesture_SampleTypeDef* sample
+) {
+    const ILI9341_Gesture_ConfigTypeDef* config = &gesture->config;
+    ILI9341_Gesture_EventTypeDef event = {
+        .kind = ILI9341_GESTURE_DRAG_END,
+        .x = sample->x,
+        .y = sample->y,
+        .start_x = gesture->start.x,
+        .start_y = gesture->start.y,
+        .velocity_x = 0,
+        .velocity_y = 0,
+        .direction = ILI9341_GESTURE_DIRECTION_NONE,
+        .timestamp = sample->timestamp
+    };
+
+    // A touch that stayed still before it was released has no velocity left
+    if (sample->timestamp - ILI9341_Gesture_Latest(gesture)->timestamp <= config->velocity_time) {
+        ILI9341_Gesture_Velocity(gesture, &event.velocity_x, &event.velocity_y);
+    }
+    ILI9341_Gesture_Push(gesture, &event);
+
+    // The direction of a swipe is the axis it moved the most along
+    int_fast16_t dx = sample->x - gesture->start.x;
+    int_fast16_t dy = sample->y - gesture->start.y;
+    int_fast32_t distance;
+    int_fast32_t velocity;
+    if (abs(dx) >= abs(dy)) {
+        event.direction = dx < 0 ? ILI9341_GESTURE_DIRECTION_LEFT : ILI9341_GESTURE_DIRECTION_RIGHT;
+        distance = abs(dx);
+        velocity = dx < 0 ? -event.velocity_x : event.velocity_x;
+    } else {
+        event.direction = dy < 0 ? ILI9341_GESTURE_DIRECTION_UP : ILI9341_GESTURE_DIRECTION_DOWN;
+        distance = abs(dy);
+        velocity = dy < 0 ? -event.velocity_y : event.velocity_y;
+    }
+
+    if (distance >= (int_fast32_t)config->swipe_distance && velocity >= (int_fast32_t)config->swipe_velocity) {
+        event.kind = ILI9341_GESTURE_SWIPE;
+        ILI9341_Gesture_Push(gesture, &event);
+    }
+}
+
+/**
+ * @brief Start a touch
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param sample Pointer to the first sample of the touch
+ */
+static void ILI9341_Gesture_Press(
+    ILI9341_Gesture_HandleTypeDef* gesture,
+    const ILI9341_Gesture_SampleTypeDef* sample
+) {
+    // The release of the previous touch was lost, it ends where it was last seen. It is not known when, so it is taken
+    // as released now and is never a swipe
+    if (gesture->state == ILI9341_GESTURE_STATE_DRAGGING) {
+        ILI9341_Gesture_SampleTypeDef last = *ILI9341_Gesture_Latest(gesture);
+        last.timestamp = sample->timestamp;
+        ILI9341_Gesture_EndDrag(gesture, &last);
+    }
+
+    if (gesture->tap_pending) {
+        gesture->second_tap = ILI9341_Gesture_Near(sample, &gesture->tap, gesture->config.double_tap_slop);
+        if (!gesture->second_tap) ILI9341_Gesture_FlushTap(gesture);
+    }
+
+    gesture->state = ILI9341_GESTURE_STATE_PRESSED;
+    gesture->start = *sample;
+    gesture->history_count = 0;
+    gesture->history_next = 0;
+    ILI9341_Gesture_AddSample(gesture, sample);
+}
+
+/**
+ * @brief Move the touch in progress, it becomes a drag once it moved further than tap_slop
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param sample Pointer to the new sample of the touch
+ */
+static void ILI9341_Gesture_Move(
+    ILI9341_Gesture_HandleTypeDef* gesture,
+    const ILI9341_Gesture_SampleTypeDef* sample
+) {
+    // The press of the touch was lost, it starts here
+    if (gesture->state == ILI9341_GESTURE_STATE_IDLE) {
+        ILI9341_Gesture_Press(gesture, sample);
+        return;
+    }
+
+    ILI9341_Gesture_AddSample(gesture, sample);
+
+    if (gesture->state == ILI9341_GESTURE_STATE_DRAGGING) {
+        ILI9341_Gesture_Report(gesture, ILI9341_GESTURE_DRAG_MOVE, sample, sample->timestamp);
+    } else if (!ILI9341_Gesture_Near(sample, &gesture->start, gesture->config.tap_slop)) {
+        ILI9341_Gesture_FlushTap(gesture);
+        ILI9341_Gesture_Report(gesture, ILI9341_GESTURE_DRAG_START, sample, sample->timestamp);
+        gesture->state = ILI9341_GESTURE_STATE_DRAGGING;
+    }
+}
+
+/**
+ * @brief End the touch in progress
+ * @param gesture Pointer to gesture recognizer handle structure
+ * @param sample Pointer to the release sample
+ */
+static void ILI9341_Gesture_Release(
+    ILI9341_Gesture_HandleTypeDef* gesture,
+    const ILI9341_Gesture_SampleTypeDef* sample
+) {
+    if (gesture->state == ILI9341_GESTURE_STATE_IDLE) return;
+
+    // Moves that were not queued still count, e.g. for a swipe faster than the sampling
+    const ILI9341_Gesture_SampleTypeDef* latest = ILI9341_Gesture_Latest(gesture);
+    if (sample->x != latest->x || sample->y != latest->y) ILI9341_Gesture_Move(gesture, sample);
+
+    if (gesture->state == ILI9341_GESTURE_STATE_DRAGGING) {
+        ILI9341_Gesture_EndDrag(gesture, sample);
+    } else if (gesture->state == ILI9341_GESTURE_STATE_PRESSED) {
+        if (sample->timestamp - gesture->start.timestamp > gesture->config.tap_time) {
+            ILI9341_Gesture_FlushTap(gesture);
+        } else if (gesture->second_tap) {
+            ILI9341_Gesture_EventTypeDef event = {
+                .kind = ILI9341_GESTURE_DOUBLE_TAP,
+                .x = sample->x,
+                .y = sample->y,
+                .start_x = gesture->tap.x,
+                .start_y = gesture->tap.y,
+                .velocity_x = 0,
+                .velocity_y = 0,
+                .direction = ILI9341_GESTURE_DIRECTION_NONE,
+                .timestamp = sample->timestamp
+            };
+            ILI9341_Gesture_Push(gesture, &event);
+            gesture->tap_pending = false;
+        } else if (gesture->config.double_tap_time > 0) {
+            gesture->tap_pending = true;
+            gesture->tap = *sample;
+        } else {
+            ILI9341_Gesture_Report(gesture, ILI9341_GESTURE_TAP, sample, sample->timestamp);
+        }
+    }
+
+    gesture->state = ILI9341_GESTURE_STATE_IDLE;
+    gesture->second_tap = false;
+}
+
+ILI9341_Gesture_HandleTypeDef ILI9341_Gesture_Init(void) {
+    ILI9341_Gesture_HandleTypeDef gesture_instance = {.state = ILI9341_GESTURE_STATE_IDLE};
+
+    ILI9341_Gesture_ConfigTypeDef config = {
+        .tap_slop = 10,
+        .tap_time = 300,
+        .double_tap_time = 300,
+        .double_tap_slop = 30,
+        .long_press_time = 600,
+        .velocity_time = 100,
+        .swipe_distance = 40,
+        .swipe_velocity = 300
+    };
+    ILI9341_Gesture_SetConfig(&gesture_instance, config);
+
+    return gesture_instance;
+}
+
+void ILI9341_Gesture_SetConfig(ILI9341_Gesture_HandleTypeDef* gesture, ILI9341_Gesture_ConfigTypeDef config) {
+    gesture->config = config;
+}
+
+void ILI9341_Gesture_Process(ILI9341_Gesture_HandleTypeDef* gesture, const ILI9341_Touch_EventTypeDef* event) {
+    ILI9341_Gesture_CheckTime(gesture, event->timestamp);
+
+    ILI9341_Gesture_SampleTypeDef sample = {.x = event->x, .y = event->y, .timestamp = event->timestamp};
+
+    switch (event->kind) {
+        case ILI9341_TOUCH_EVENT_PRESS:
+            ILI9341_Gesture_Press(gesture, &sample);
+            break;
+        case ILI9341_TOUCH_EVENT_MOVE:
+            ILI9341_Gesture_Move(gesture, &sample);
+            break;
+        case ILI9341_TOUCH_EVENT_RELEASE:
+            ILI9341_Gesture_Release(gesture, &sample);
+            break;
+    }
+}
+
+void ILI9341_Gesture_Update(ILI9341_Gesture_HandleTypeDef* gesture, uint32_t now) {
+    ILI9341_Gesture_CheckTime(gesture, now);
+}
+
+bool ILI9341_Gesture_GetEvent(ILI9341_Gesture_HandleTypeDef* gesture, ILI9341_Gesture_EventTypeDef* event) {
+    if (gesture->event_count == 0) return false;
+
+    *event = gesture->events[gesture->event_head];
+    gesture->event_head = (gesture->event_head + 1) % ILI9341_GESTURE_EVENT_QUEUE_SIZE;
+    gesture->event_count--;
+    return true;
+}
@@ -0,0 +1,452 @@
+#include "ili9341_text.h"
+
+#include "string.h"
+
+/**
+ * @brief Check whether a string is at the end of a line
+ * @param c Position in the string
+ * @return true at '\0', '\n' and "\r\n", a lone '\r' only returns to the start of the same line
+ */
+static bool ILI9341_Text_IsLineEnd(const char* c) {
+    return c[0] == '\0' || c[0] == '\n' || (c[0] == '\r' && c[1] == '\n');
+}
+
+/**
+ * @brief Measure the line at the start of a string
+ * @param str Start of the line
+ * @param font Font definition
+ * @param scale Integer scaling factor
+ * @param tracking Additional space in pixels between characters
+ * @param maxWidth Width available for the line in pixels, 0 to only break at '\n', see ILI9341_Text_Layout
+ * @param line Pointer to the line to fill, its start is not set
+ * @param inkTop Set to the top of the glyphs relative to the baseline, > inkBottom for an empty line
+ * @param inkBottom Set to the bottom of the glyphs relative to the baseline
+ * @return Start of the next line, NULL if the string ends with this line
+ */
+static const char* ILI9341_Text_MeasureLine(
+    const char* str,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t maxWidth,
+    ILI9341_Text_LineTypeDef* line,
+    int_fast16_t* inkTop,
+    int_fast16_t* inkBottom
+) {
+    int_fast16_t pen = 0;
+    int_fast16_t widest = 0;
+
+    line->width = 0;
+    line->ink_left = INT16_MAX;
+    line->ink_right = INT16_MIN;
+    *inkTop = INT16_MAX;
+    *inkBottom = INT16_MIN;
+
+    for (const char* c = str;;) {
+        if (ILI9341_Text_IsLineEnd(c)) {
+            line->length = c - str;
+            if (*c == '\0') return NULL;
+            return *c == '\r' ? c + 2 : c + 1;
+        }
+
+        // Same as ILI9341_WriteString, a carriage return moves the pen back to the start of the line
+        if (*c == '\r') {
+            widest = line->width;
+            pen = 0;
+            c++;
+            continue;
+        }
+
+        const char* next = c;
+        uint32_t codepoint = ILI9341_DecodeUTF8(&next);
+        ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, codepoint);
+
+        // Same rule as ILI9341_WriteString, zero-width glyphs never wrap and a space is dropped after the break
+        if (maxWidth > 0 && c > str && glyph.advance > 0 && pen + (glyph.bbX + glyph.bbW) * scale + 1 >= maxWidth) {
+            line->length = c - str;
+            return codepoint == 0x20 || codepoint == 0xA0 ? next : c;
+        }
+
+        if (glyph.bbW > 0 && glyph.bbH > 0) {
+            int_fast16_t left = pen + glyph.bbX * scale;
+            int_fast16_t right = left + glyph.bbW * scale - 1;
+            int_fast16_t top = -(glyph.bbY + glyph.bbH) * scale + 1;
+            int_fast16_t bottom = -glyph.bbY * scale;
+
+            if (left < line->ink_left) line->ink_left = left;
+            if (right > line->ink_right) line->ink_right = right;
+            if (top < *inkTop) *inkTop = top;
+            if (bottom > *inkBottom) *inkBottom = bottom;
+        }
+
+        pen += glyph.advance * scale;
+        line->width = pen > widest ? pen : widest;
+
+        // Same kerning and tracking rules as ILI9341_WriteString
+        c = next;
+        if ((tracking || font.kerningCount) && *next != '\r' && !ILI9341_Text_IsLineEnd(next)) {
+            uint32_t nextCodepoint = ILI9341_DecodeUTF8(&next);
+            pen += ILI9341_GetKerning(font, codepoint, nextCodepoint) * scale;
+            if (tracking && ILI9341_GetGlyph(font, nextCodepoint).advance > 0) pen += tracking;
+        }
+    }
+}
+
+int_fast16_t ILI9341_Text_GetWidth(const char* str, ILI9341_FontDef font, int_fast16_t scale, int_fast16_t tracking) {
+    if (scale < 1) return 0;
+
+    ILI9341_Text_LineTypeDef line;
+    int_fast16_t inkTop, inkBottom;
+    ILI9341_Text_MeasureLine(str, font, scale, tracking, 0, &line, &inkTop, &inkBottom);
+    return line.width;
+}
+
+ILI9341_RectTypeDef ILI9341_Text_GetBounds(
+    int_fast16_t x,
+    int_fast16_t y,
+    const char* str,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading
+) {
+    ILI9341_RectTypeDef bounds = {0, 0, -1, -1};
+    if (scale < 1) return bounds;
+
+    bool empty = true;
+
+    while (str != NULL) {
+        ILI9341_Text_LineTypeDef line;
+        int_fast16_t inkTop, inkBottom;
+        str = ILI9341_Text_MeasureLine(str, font, scale, tracking, 0, &line, &inkTop, &inkBottom);
+
+        if (line.ink_left <= line.ink_right) {
+            if (empty || x + line.ink_left < bounds.x0) bounds.x0 = x + line.ink_left;
+            if (empty || y + inkTop < bounds.y0) bounds.y0 = y + inkTop;
+            if (empty || x + line.ink_right > bounds.x1) bounds.x1 = x + line.ink_right;
+            if (empty || y + inkBottom > bounds.y1) bounds.y1 = y + inkBottom;
+            empty = false;
+        }
+
+        y += (font.ascent + font.descent) * scale + leading;
+    }
+
+    return bounds;
+}
+
+ILI9341_Text_LayoutTypeDef ILI9341_Text_Layout(
+    const char* str,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    int_fast16_t leading,
+    int_fast16_t maxWidth,
+    ILI9341_Text_LineTypeDef* lines,
+    size_t maxLines
+) {
+    ILI9341_Text_LayoutTypeDef layout_instance = {
+        .str = str,
+        .font = font,
+        .scale = scale,
+        .tracking = tracking,
+        .leading = leading,
+        .lines = lines,
+        .max_lines = maxLines,
+        .line_height = (font.ascent + font.descent) * scale + leading
+    };
+
+    if (scale < 1) return layout_instance;
+
+    for (const char* start = str; start != NULL;) {
+        if (layout_instance.line_count >= maxLines) {
+            layout_instance.truncated = true;
+            break;
+        }
+
+        ILI9341_Text_LineTypeDef* line = &lines[layout_instance.line_count++];
+        int_fast16_t inkTop, inkBottom;
+
+        line->start = start - str;
+        start = ILI9341_Text_MeasureLine(start, font, scale, tracking, maxWidth, line, &inkTop, &inkBottom);
+
+        if (line->width > layout_instance.width) layout_instance.width = line->width;
+    }
+
+    if (layout_instance.line_count > 0) {
+        layout_instance.height =
+            (font.ascent + font.descent) * scale + (layout_instance.line_count - 1) * layout_instance.line_height;
+    }
+
+    return layout_instance;
+}
+
+int_fast16_t ILI9341_Text_AlignX(
+    int_fast16_t x,
+    int_fast16_t w,
+    int_fast16_t lineWidth,
+    ILI9341_Text_AlignTypeDef align
+) {
+    switch (align) {
+        case ILI9341_TEXT_ALIGN_CENTER:
+            return x + (w - lineWidth) / 2;
+        case ILI9341_TEXT_ALIGN_RIGHT:
+            return x + w - lineWidth;
+        default:
+            return x;
+    }
+}
+
+int_fast16_t ILI9341_Text_AlignY(
+    const ILI9341_Text_LayoutTypeDef* layout,
+    int_fast16_t y,
+    int_fast16_t h,
+    ILI9341_Text_VAlignTypeDef valign
+) {
+    // The first line box starts ascent * scale - 1 pixels above the baseline
+    int_fast16_t ascent = layout->font.ascent * layout->scale - 1;
+
+    switch (valign) {
+        case ILI9341_TEXT_VALIGN_TOP:
+            return y + ascent;
+        case ILI9341_TEXT_VALIGN_MIDDLE:
+            return y + (h - layout->height) / 2 + ascent;
+        case ILI9341_TEXT_VALIGN_BOTTOM:
+            return y + h - layout->height + ascent;
+        default:
+            return y;
+    }
+}
+
+void ILI9341_Text_Draw(
+    ILI9341_HandleTypeDef* ili9341,
+    const ILI9341_Text_LayoutTypeDef* layout,
+    int_fast16_t x,
+    int_fast16_t y,
+    int_fast16_t w,
+    int_fast16_t h,
+    ILI9341_Text_AlignTypeDef align,
+    ILI9341_Text_VAlignTypeDef valign,
+    uint16_t color,
+    uint16_t bgColor
+) {
+    int_fast16_t baseline = ILI9341_Text_AlignY(layout, y, h, valign);
+
+    for (size_t i = 0; i < layout->line_count; i++, baseline += layout->line_height) {
+        const ILI9341_Text_LineTypeDef* line = &layout->lines[i];
+        int_fast16_t lineX = ILI9341_Text_AlignX(x, w, line->width, align);
+        const char* part = layout->str + line->start;
+        const char* end = part + line->length;
+
+        // Each carriage return draws the rest of the line from its start again, as ILI9341_WriteString does
+        while (true) {
+            const char* carriageReturn = memchr(part, '\r', end - part);
+
+            ILI9341_WriteStringLine(
+                ili9341,
+                lineX,
+                baseline,
+                part,
+                (carriageReturn != NULL ? carriageReturn : end) - part,
+                layout->font,
+                color,
+                bgColor,
+                layout->scale,
+                layout->tracking
+            );
+
+            if (carriageReturn == NULL) break;
+            part = carriageReturn + 1;
+        }
+    }
+}
+
+/**
+ * @brief Compute the pen positions of the characters of a text field string
+ * @param field Pointer to text field structure
+ * @param text Codepoints of the characters, at most ILI9341_TEXT_FIELD_MAX_LENGTH
+ * @param length Number of characters
+ * @param pens Set to the pen start of each character relative to the field, pens[length] is the pen end
+ * @param left Set to the left of the pixels the string covers relative to the field
+ * @param right Set to the right of the pixels the string covers relative to the field, plus one
+ */
+static void ILI9341_Text_FieldPositions(
+    const ILI9341_Text_FieldTypeDef* field,
+    const uint32_t* text,
+    size_t length,
+    int_fast16_t* pens,
+    int_fast16_t* left,
+    int_fast16_t* right
+) {
+    int_fast16_t pen = 0;
+    *left = 0;
+    *right = 0;
+
+    for (size_t i = 0; i < length; i++) {
+        ILI9341_GlyphDef glyph = ILI9341_GetGlyph(field->font, text[i]);
+        pens[i] = pen;
+
+        if (glyph.bbW > 0 && glyph.bbH > 0) {
+            int_fast16_t inkLeft = pen + glyph.bbX * field->scale;
+            int_fast16_t inkRight = inkLeft + glyph.bbW * field->scale;
+            if (inkLeft < *left) *left = inkLeft;
+            if (inkRight > *right) *right = inkRight;
+        }
+
+        pen += glyph.advance * field->scale;
+        if (pen > *right) *right = pen;
+
+        // Same kerning and tracking rules as ILI9341_WriteStringLine
+        if (i + 1 < length) {
+            pen += ILI9341_GetKerning(field->font, text[i], text[i + 1]) * field->scale;
+            if (field->tracking && ILI9341_GetGlyph(field->font, text[i + 1]).advance > 0) pen += field->tracking;
+        }
+    }
+
+    pens[length] = pen;
+}
+
+/**
+ * @brief Check whether the glyph of a character sticks out of its cell
+ * @param field Pointer to text field structure
+ * @param codepoint Codepoint of the character
+ * @return true if the glyph covers pixels left of its pen start or right of its advance, always true with negative
+ * tracking as the cells overlap
+ */
+static bool ILI9341_Text_FieldOverhangs(const ILI9341_Text_FieldTypeDef* field, uint32_t codepoint) {
+    ILI9341_GlyphDef glyph = ILI9341_GetGlyph(field->font, codepoint);
+    if (field->tracking < 0) return true;
+    return glyph.bbW > 0 && glyph.bbH > 0 && (glyph.bbX < 0 || glyph.bbX + glyph.bbW > glyph.advance);
+}
+
+/**
+ * @brief Check whether drawing one of two neighbouring characters of a text can touch the cell of the other one
+ * @param field Pointer to text field structure
+ * @param text Codepoints of the text
+ * @param length Number of characters of the text
+ * @param i Index of the left character of the pair
+ * @return true if a glyph of the pair sticks out of its cell or the pair is kerned closer together
+ */
+static bool ILI9341_Text_FieldPairOverlaps(
+    const ILI9341_Text_FieldTypeDef* field,
+    const uint32_t* text,
+    size_t length,
+    size_t i
+) {
+    if (i < length && ILI9341_Text_FieldOverhangs(field, text[i])) return true;
+    if (i + 1 >= length) return false;
+    return ILI9341_Text_FieldOverhangs(field, text[i + 1]) || ILI9341_GetKerning(field->font, text[i], text[i + 1]) < 0;
+}
+
+ILI9341_Text_FieldTypeDef ILI9341_Text_FieldInit(
+    ILI9341_HandleTypeDef* ili9341,
+    int_fast16_t x,
+    int_fast16_t y,
+    ILI9341_FontDef font,
+    int_fast16_t scale,
+    int_fast16_t tracking,
+    uint16_t color,
+    uint16_t bgColor
+) {
+    ILI9341_Text_FieldTypeDef field_instance = {
+        .ili9341 = ili9341,
+        .x = x,
+        .y = y,
+        .font = font,
+        .scale = scale < 1 ? 1 : scale,
+        .tracking = tracking,
+        .color = color,
+        .bg_color = bgColor
+    };
+
+    return field_instance;
+}
+
+void ILI9341_Text_FieldSetColors(ILI9341_Text_FieldTypeDef* field, uint16_t color, uint16_t bgColor) {
+    field->color = color;
+    field->bg_color = bgColor;
+    field->valid = false;
+}
+
+void ILI9341_Text_FieldInvalidate(ILI9341_Text_FieldTypeDef* field) {
+    field->valid = false;
+}
+
+void ILI9341_Text_FieldUpdate(ILI9341_Text_FieldTypeDef* field, const char* str) {
+    size_t oldLength = 0;
+    while (field->text[oldLength] != 0) { oldLength++; }
+
+    // Decode the new text, the offsets of the characters in the string are kept to draw parts of it
+    uint32_t text[ILI9341_TEXT_FIELD_MAX_LENGTH];
+    size_t offsets[ILI9341_TEXT_FIELD_MAX_LENGTH + 1];
+    size_t length = 0;
+    offsets[0] = 0;
+    for (const char* c = str; length < ILI9341_TEXT_FIELD_MAX_LENGTH && *c != '\r' && !ILI9341_Text_IsLineEnd(c);
+         length++) {
+        text[length] = ILI9341_DecodeUTF8(&c);
+        offsets[length + 1] = c - str;
+    }
+
+    int_fast16_t oldPens[ILI9341_TEXT_FIELD_MAX_LENGTH + 1];
+    int_fast16_t pens[ILI9341_TEXT_FIELD_MAX_LENGTH + 1];
+    int_fast16_t oldLeft, oldRight, left, right;
+    ILI9341_Text_FieldPositions(field, field->text, oldLength, oldPens, &oldLeft, &oldRight);
+    ILI9341_Text_FieldPositions(field, text, length, pens, &left, &right);
+
+    // A character is kept if the same character is already drawn in the same cell
+    bool changed[ILI9341_TEXT_FIELD_MAX_LENGTH];
+    for (size_t i = 0; i < length; i++) {
+        changed[i] = !field->valid || i >= oldLength || text[i] != field->text[i] || pens[i] != oldPens[i] ||
+                     pens[i + 1] != oldPens[i + 1];
+    }
+
+    // Drawing a cell fills the pixels of glyphs sticking into it with the background, so their cells are drawn too
+    for (size_t i = 0; i + 1 < length; i++) {
+        bool overhang = ILI9341_Text_FieldPairOverlaps(field, text, length, i) ||
+                        ILI9341_Text_FieldPairOverlaps(field, field->text, oldLength, i);
+        if (overhang && changed[i]) changed[i + 1] = true;
+    }
+    for (size_t i = length; i-- > 1;) {
+        bool overhang = ILI9341_Text_FieldPairOverlaps(field, text, length, i - 1) ||
+                        ILI9341_Text_FieldPairOverlaps(field, field->text, oldLength, i - 1);
+        if (overhang && changed[i]) changed[i - 1] = true;
+    }
+
+    for (size_t start = 0; start < length;) {
+        if (!changed[start]) {
+            start++;
+            continue;
+        }
+
+        size_t end = start + 1;
+        while (end < length && changed[end]) { end++; }
+
+        ILI9341_WriteStringLine(
+            field->ili9341,
+            field->x + pens[start],
+            field->y,
+            str + offsets[start],
+            offsets[end] - offsets[start],
+            field->font,
+            field->color,
+            field->bg_color,
+            field->scale,
+            field->tracking
+        );
+        start = end;
+    }
+
+    // Clear what the old text covered outside of the new one
+    int_fast16_t top = field->y - field->font.ascent * field->scale + 1;
+    int_fast16_t height = (field->font.ascent + field->font.descent) * field->scale;
+
+    if (oldRight > right) {
+        ILI9341_FillRectangle(field->ili9341, field->x + right, top, oldRight - right, height, field->bg_color);
+    }
+    if (oldLeft < left) {
+        ILI9341_FillRectangle(field->ili9341, field->x + oldLeft, top, left - oldLeft, height, field->bg_color);
+    }
+
+    memcpy(field->text, text, length * sizeof(text[0]));
+    field->text[length] = 0;
+    field->valid = true;
+}
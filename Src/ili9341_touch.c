@@ -2,11 +2,34 @@
 
 #include "stm32f7xx_hal.h"
 
+// XPT2046 control bytes, 12-bit conversions. The touch channels are differential, the aux channels single-ended
+#define ILI9341_TOUCH_CONVERT_X 0xD0
+#define ILI9341_TOUCH_CONVERT_Y 0x90
+#define ILI9341_TOUCH_CONVERT_Z1 0xB0
+#define ILI9341_TOUCH_CONVERT_Z2 0xC0
+#define ILI9341_TOUCH_CONVERT_TEMP0 0x84
+#define ILI9341_TOUCH_CONVERT_TEMP1 0xF4
+#define ILI9341_TOUCH_CONVERT_VBAT 0xA4
+
+// XPT2046 power-down bits of the control byte. Without any, the converter powers down after the conversion and
+// PENIRQ is enabled again
+#define ILI9341_TOUCH_POWER_ADC 0x01        // converter stays on and PENIRQ is disabled
+#define ILI9341_TOUCH_POWER_REFERENCE 0x03  // converter and internal reference stay on, PENIRQ is disabled
+
+#define ILI9341_TOUCH_AUX_SAMPLES 4  // conversions averaged for an aux measurement
+
+// Longest chain of conversions, enough for a touch reading with pressure or an aux measurement
+#define ILI9341_TOUCH_MAX_CHAIN \
+    (2 * ILI9341_TOUCH_MAX_SAMPLES + 2 + ILI9341_TOUCH_AUX_SETTLE + ILI9341_TOUCH_AUX_SAMPLES)
+
 /**
  * @brief Select the ILI9341 touch controller
  * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
  */
 static void ILI9341_Touch_Select(const ILI9341_Touch_HandleTypeDef* ili9341_touch) {
+    // A display on the same bus may still be sending from DMA after its drawing function returned
+    if (ili9341_touch->shared_display != NULL) ILI9341_WaitForTransfer(ili9341_touch->shared_display);
+
     HAL_GPIO_WritePin(ili9341_touch->cs_port, ili9341_touch->cs_pin, GPIO_PIN_RESET);
 }
 
@@ -27,7 +50,7 @@ ILI9341_Touch_HandleTypeDef ILI9341_Touch_Init(
     width = abs(width);
     height = abs(height);
 
-    const ILI9341_Touch_HandleTypeDef ili9341_touch_instance = {
+    ILI9341_Touch_HandleTypeDef ili9341_touch_instance = {
         .spi_handle = spi_handle,
         .cs_port = cs_port,
         .cs_pin = cs_pin,
@@ -35,14 +58,111 @@ ILI9341_Touch_HandleTypeDef ILI9341_Touch_Init(
         .irq_pin = irq_pin,
         .rotation = rotation,
         .width = width,
-        .height = height
+        .height = height,
+        .filter = {
+            .settle = 1,
+            .samples = 2,
+            .trim = 0,
+            .max_spread = 320,
+            .max_delta = 4096,
+            .smoothing = 8,
+            .debounce = 3,
+            .max_jitter = 128,
+            .max_resistance = 0
+        }
+    };
+
+    // Until calibrated, the raw range is stretched over the display as in the ILI9341_ROTATION_VERTICAL_1 orientation
+    bool vertical = rotation == ILI9341_ROTATION_VERTICAL_1 || rotation == ILI9341_ROTATION_VERTICAL_2;
+    int32_t nativeWidth = vertical ? width : height;
+    int32_t nativeHeight = vertical ? height : width;
+    int32_t scaleX = (nativeWidth << 16) / (ILI9341_TOUCH_MAX_RAW_X - ILI9341_TOUCH_MIN_RAW_X);
+    int32_t scaleY = (nativeHeight << 16) / (ILI9341_TOUCH_MAX_RAW_Y - ILI9341_TOUCH_MIN_RAW_Y);
+    ILI9341_Touch_CalibrationTypeDef calibration = {
+        .a = scaleX,
+        .b = 0,
+        .c = -ILI9341_TOUCH_MIN_RAW_X * scaleX,
+        .d = 0,
+        .e = -scaleY,
+        .f = (nativeHeight << 16) + ILI9341_TOUCH_MIN_RAW_Y * scaleY
     };
+    ILI9341_Touch_SetCalibration(&ili9341_touch_instance, calibration);
 
     ILI9341_Touch_Deselect(&ili9341_touch_instance);
 
     return ili9341_touch_instance;
 }
 
+/**
+ * @brief Turn the calibration to the current orientation of the touchscreen
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @note The calibration maps to continuous coordinates, pixel x covers x to x + 1, so mirroring a coordinate is
+ * width - x rather than width - 1 - x.
+ */
+static void ILI9341_Touch_UpdateMatrix(ILI9341_Touch_HandleTypeDef* ili9341_touch) {
+    const ILI9341_Touch_CalibrationTypeDef* cal = &ili9341_touch->calibration;
+    int32_t width = ili9341_touch->width << 16;
+    int32_t height = ili9341_touch->height << 16;
+
+    switch (ili9341_touch->rotation) {
+        case ILI9341_ROTATION_HORIZONTAL_1:  // x = nativeHeight - nativeY, y = nativeX
+            ili9341_touch->matrix =
+                (ILI9341_Touch_CalibrationTypeDef){-cal->d, -cal->e, width - cal->f, cal->a, cal->b, cal->c};
+            break;
+        case ILI9341_ROTATION_VERTICAL_2:  // x = nativeWidth - nativeX, y = nativeHeight - nativeY
+            ili9341_touch->matrix = (ILI9341_Touch_CalibrationTypeDef){
+                -cal->a, -cal->b, width - cal->c, -cal->d, -cal->e, height - cal->f
+            };
+            break;
+        case ILI9341_ROTATION_HORIZONTAL_2:  // x = nativeY, y = nativeWidth - nativeX
+            ili9341_touch->matrix =
+                (ILI9341_Touch_CalibrationTypeDef){cal->d, cal->e, cal->f, -cal->a, -cal->b, height - cal->c};
+            break;
+        default:
+            ili9341_touch->matrix = *cal;
+            break;
+    }
+}
+
+/**
+ * @brief Turn continuous display coordinates in the current orientation to the ILI9341_ROTATION_VERTICAL_1 orientation,
+ * the reverse of ILI9341_Touch_UpdateMatrix
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param x X coordinate in the current orientation
+ * @param y Y coordinate in the current orientation
+ * @param nativeX Pointer to store the X coordinate in the ILI9341_ROTATION_VERTICAL_1 orientation
+ * @param nativeY Pointer to store the Y coordinate in the ILI9341_ROTATION_VERTICAL_1 orientation
+ */
+static void ILI9341_Touch_ToNative(
+    const ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    float x,
+    float y,
+    float* nativeX,
+    float* nativeY
+) {
+    float width = ili9341_touch->width;
+    float height = ili9341_touch->height;
+
+    switch (ili9341_touch->rotation) {
+        case ILI9341_ROTATION_HORIZONTAL_1:
+            *nativeX = y;
+            *nativeY = width - x;
+            break;
+        case ILI9341_ROTATION_VERTICAL_2:
+            *nativeX = width - x;
+            *nativeY = height - y;
+            break;
+        case ILI9341_ROTATION_HORIZONTAL_2:
+            *nativeX = height - y;
+            *nativeY = x;
+            break;
+        default:
+            *nativeX = x;
+            *nativeY = y;
+            break;
+    }
+}
+
 void ILI9341_Touch_SetOrientation(ILI9341_Touch_HandleTypeDef* ili9341_touch, int_fast8_t rotation) {
     if ((ili9341_touch->rotation == ILI9341_ROTATION_HORIZONTAL_1 ||
          ili9341_touch->rotation == ILI9341_ROTATION_HORIZONTAL_2) &&
@@ -59,96 +179,599 @@ void ILI9341_Touch_SetOrientation(ILI9341_Touch_HandleTypeDef* ili9341_touch, in
     }
 
     ili9341_touch->rotation = rotation;
+    ILI9341_Touch_UpdateMatrix(ili9341_touch);
+}
+
+void ILI9341_Touch_SetCalibration(
+    ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    ILI9341_Touch_CalibrationTypeDef calibration
+) {
+    ili9341_touch->calibration = calibration;
+    ILI9341_Touch_UpdateMatrix(ili9341_touch);
+}
+
+/**
+ * @brief Forget the readings of the last touch, the next reading starts a new touch
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ */
+static void ILI9341_Touch_ResetFilter(ILI9341_Touch_HandleTypeDef* ili9341_touch) {
+    ili9341_touch->filter_valid = false;
+    ili9341_touch->candidate_valid = false;
+    ili9341_touch->filter_readings = 0;
+}
+
+void ILI9341_Touch_SetFilter(ILI9341_Touch_HandleTypeDef* ili9341_touch, ILI9341_Touch_FilterTypeDef filter) {
+    if (filter.settle >= ILI9341_TOUCH_MAX_SAMPLES) filter.settle = ILI9341_TOUCH_MAX_SAMPLES - 1;
+    if (filter.samples < 1) filter.samples = 1;
+    if (filter.settle + filter.samples > ILI9341_TOUCH_MAX_SAMPLES) {
+        filter.samples = ILI9341_TOUCH_MAX_SAMPLES - filter.settle;
+    }
+    if (filter.trim * 2 >= filter.samples) filter.trim = (filter.samples - 1) / 2;
+    if (filter.smoothing < 1) filter.smoothing = 1;
+
+    ili9341_touch->filter = filter;
+    ILI9341_Touch_ResetFilter(ili9341_touch);
 }
 
 bool ILI9341_Touch_IsPressed(const ILI9341_Touch_HandleTypeDef* ili9341_touch) {
     return HAL_GPIO_ReadPin(ili9341_touch->irq_port, ili9341_touch->irq_pin) == GPIO_PIN_RESET;
 }
 
-bool ILI9341_Touch_GetCoordinates(const ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t* x, uint16_t* y) {
-    static const uint8_t cmdReadX[] = {0xD0};
-    static const uint8_t cmdReadY[] = {0x90};
-    static const uint8_t zeroes[] = {0x00, 0x00};
+/**
+ * @brief Run a chain of conversions of the touch controller in a single transfer, the controller must be selected
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param commands Control bytes of the conversions, without power-down bits
+ * @param results Where to store the raw conversion results, the 12-bit values are in the upper bits
+ * @param count Number of conversions, up to ILI9341_TOUCH_MAX_CHAIN
+ * @param power Power-down bits of all conversions but the last one, the controller is powered down with PENIRQ enabled
+ * after the last one
+ * @return true if the conversions were read, false if the SPI transfer failed, e.g. with HAL_BUSY while another
+ * transfer is running on the bus
+ * @note The control byte of each conversion is sent while the last bits of the previous result are read, so a
+ * conversion takes 16 clocks instead of 24.
+ */
+static bool ILI9341_Touch_ConvertChain(
+    const ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    const uint8_t* commands,
+    uint16_t* results,
+    uint_fast8_t count,
+    uint8_t power
+) {
+    uint8_t tx[2 * ILI9341_TOUCH_MAX_CHAIN + 1] = {0};
+    uint8_t rx[2 * ILI9341_TOUCH_MAX_CHAIN + 1] = {0};
+
+    for (uint_fast8_t i = 0; i < count; i++) { tx[2 * i] = commands[i] | (i + 1 < count ? power : 0); }
+
+    if (HAL_SPI_TransmitReceive(ili9341_touch->spi_handle, tx, rx, 2 * count + 1, HAL_MAX_DELAY) != HAL_OK) {
+        return false;
+    }
+
+    for (uint_fast8_t i = 0; i < count; i++) { results[i] = (rx[2 * i + 1] << 8) | rx[2 * i + 2]; }
+    return true;
+}
+
+/**
+ * @brief Average the conversions of one axis that are left after trimming, as set by the filter
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param samples Conversions of the axis after the settling ones, filter.samples of them, sorted in place
+ * @param value Where to store the raw value of the axis
+ * @return true if the kept conversions agree within max_spread
+ */
+static bool ILI9341_Touch_AverageAxis(
+    const ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    uint16_t* samples,
+    uint16_t* value
+) {
+    const ILI9341_Touch_FilterTypeDef* filter = &ili9341_touch->filter;
+
+    // Insertion sort, there are only a few conversions
+    for (uint_fast8_t i = 1; i < filter->samples; i++) {
+        uint16_t sample = samples[i];
+        uint_fast8_t j = i;
+        for (; j > 0 && samples[j - 1] > sample; j--) samples[j] = samples[j - 1];
+        samples[j] = sample;
+    }
+
+    uint_fast8_t first = filter->trim;
+    uint_fast8_t last = filter->samples - 1 - filter->trim;
+    if (filter->max_spread > 0 && (uint_fast16_t)(samples[last] - samples[first]) > filter->max_spread) return false;
+
+    uint_fast32_t sum = 0;
+    for (uint_fast8_t i = first; i <= last; i++) sum += samples[i];
+    *value = sum / (last - first + 1);
+    return true;
+}
+
+/**
+ * @brief Average a reading with the previous readings of the touch while it stays within max_jitter of them, up to
+ * the last filter.smoothing readings. A larger move is held for one reading and only followed once the next reading
+ * moved away as well, then every reading until the touch is still again
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param rawX Raw X value of the reading
+ * @param rawY Raw Y value of the reading
+ * @return true if the reading is accepted
+ */
+static bool ILI9341_Touch_Smooth(ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t rawX, uint16_t rawY) {
+    int_fast32_t maxJitter = ili9341_touch->filter.max_jitter;
+    int_fast32_t deltaX = rawX - ili9341_touch->filter_x;
+    int_fast32_t deltaY = rawY - ili9341_touch->filter_y;
+    bool still = abs(deltaX) <= maxJitter && abs(deltaY) <= maxJitter;
+
+    if (!ili9341_touch->filter_valid) {
+        ili9341_touch->filter_count = 0;
+        ili9341_touch->filter_moving = false;
+    } else if (still) {
+        ili9341_touch->filter_moving = false;
+    } else if (!ili9341_touch->filter_moving) {
+        // A spike that got through the spread check lands back on the average at the next reading
+        ili9341_touch->filter_moving = true;
+        return false;
+    } else {
+        ili9341_touch->filter_count = 0;
+    }
+    if (ili9341_touch->filter_count < ili9341_touch->filter.smoothing) ili9341_touch->filter_count++;
+
+    // Running average, weighted as a moving average of the last filter.smoothing readings once it is full. Rounded
+    // to the nearest, so the average does not stick a few units away from a still touch
+    int_fast32_t count = ili9341_touch->filter_count;
+    ili9341_touch->filter_x += (deltaX * 2 + (deltaX < 0 ? -count : count)) / (2 * count);
+    ili9341_touch->filter_y += (deltaY * 2 + (deltaY < 0 ? -count : count)) / (2 * count);
+    ili9341_touch->filter_valid = true;
+    return true;
+}
+
+/**
+ * @brief Check a reading against the previous one, a jump larger than max_delta is only accepted when the next reading
+ * lands close to it, so a single spike is never reported. An accepted reading is averaged into the coordinates of the
+ * touch
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param rawX Raw X value of the reading
+ * @param rawY Raw Y value of the reading
+ * @return true if the reading is accepted
+ */
+static bool ILI9341_Touch_Confirm(ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t rawX, uint16_t rawY) {
+    int_fast32_t maxDelta = ili9341_touch->filter.max_delta;
+    bool nearPrevious =
+        abs(rawX - ili9341_touch->filter_x) <= maxDelta && abs(rawY - ili9341_touch->filter_y) <= maxDelta;
+    bool nearCandidate = ili9341_touch->candidate_valid && abs(rawX - ili9341_touch->candidate_x) <= maxDelta &&
+                         abs(rawY - ili9341_touch->candidate_y) <= maxDelta;
+
+    bool accepted = maxDelta == 0 || !ili9341_touch->filter_valid || nearPrevious || nearCandidate;
+
+    if (!accepted) {
+        ili9341_touch->candidate_x = rawX;
+        ili9341_touch->candidate_y = rawY;
+        ili9341_touch->candidate_valid = true;
+        return false;
+    }
+
+    // A confirmed jump was already held for a reading, it is followed at once
+    if (!nearPrevious) ili9341_touch->filter_moving = true;
+    ili9341_touch->candidate_valid = false;
+    return ILI9341_Touch_Smooth(ili9341_touch, rawX, rawY);
+}
+
+bool ILI9341_Touch_GetRawCoordinates(ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t* rawX, uint16_t* rawY) {
+    // A new touch is not compared with the previous one
+    if (!ILI9341_Touch_IsPressed(ili9341_touch)) {
+        ILI9341_Touch_ResetFilter(ili9341_touch);
+        return false;
+    }
+
+    // Pressure, then all conversions of X and Y in one chain. The converter stays on until the last one, which powers
+    // it down and enables PENIRQ again
+    const ILI9341_Touch_FilterTypeDef* filter = &ili9341_touch->filter;
+    uint8_t commands[ILI9341_TOUCH_MAX_CHAIN];
+    uint16_t results[ILI9341_TOUCH_MAX_CHAIN];
+    uint_fast8_t count = 0;
+    if (filter->max_resistance > 0) {
+        commands[count++] = ILI9341_TOUCH_CONVERT_Z1;
+        commands[count++] = ILI9341_TOUCH_CONVERT_Z2;
+    }
+    uint_fast8_t samplesX = count + filter->settle;
+    for (uint_fast8_t i = 0; i < filter->settle + filter->samples; i++) commands[count++] = ILI9341_TOUCH_CONVERT_X;
+    uint_fast8_t samplesY = count + filter->settle;
+    for (uint_fast8_t i = 0; i < filter->settle + filter->samples; i++) commands[count++] = ILI9341_TOUCH_CONVERT_Y;
 
     ILI9341_Touch_Select(ili9341_touch);
+    bool converted = ILI9341_Touch_ConvertChain(ili9341_touch, commands, results, count, ILI9341_TOUCH_POWER_ADC);
+    ILI9341_Touch_Deselect(ili9341_touch);
+
+    // The bus was busy, nothing was sent and the touch goes on
+    if (!converted) return false;
 
-    int_fast32_t avgX = 0;
-    int_fast32_t avgY = 0;
-    int_fast8_t nsamples = 0;
-    for (int_fast8_t i = 0; i < 16; i++) {
-        if (!ILI9341_Touch_IsPressed(ili9341_touch)) break;
+    uint16_t valueX;
+    uint16_t valueY;
+    bool agree = ILI9341_Touch_AverageAxis(ili9341_touch, &results[samplesX], &valueX) &&
+                 ILI9341_Touch_AverageAxis(ili9341_touch, &results[samplesY], &valueY);
 
-        nsamples++;
+    // The conversions are only valid if the screen was touched until the last one
+    if (!ILI9341_Touch_IsPressed(ili9341_touch)) {
+        ILI9341_Touch_ResetFilter(ili9341_touch);
+        return false;
+    }
 
-        HAL_SPI_Transmit(ili9341_touch->spi_handle, (uint8_t*)cmdReadY, sizeof(cmdReadY), HAL_MAX_DELAY);
-        uint8_t yRaw[2];
-        HAL_SPI_TransmitReceive(ili9341_touch->spi_handle, (uint8_t*)zeroes, yRaw, sizeof(yRaw), HAL_MAX_DELAY);
+    if (agree && filter->max_resistance > 0) {
+        // Touch resistance of the XPT2046 datasheet, in units of the X plate resistance / 4096
+        uint_fast32_t z1 = results[0] >> 3;
+        uint_fast32_t z2 = results[1] >> 3;
+        uint_fast32_t resistance = UINT16_MAX;
+        if (z1 > 0) resistance = z2 > z1 ? (valueX >> 3) * (z2 - z1) / z1 : 0;
+        ili9341_touch->resistance = resistance < UINT16_MAX ? resistance : UINT16_MAX;
+        if (ili9341_touch->resistance > filter->max_resistance) return false;
+    }
 
-        HAL_SPI_Transmit(ili9341_touch->spi_handle, (uint8_t*)cmdReadX, sizeof(cmdReadX), HAL_MAX_DELAY);
-        uint8_t xRaw[2];
-        HAL_SPI_TransmitReceive(ili9341_touch->spi_handle, (uint8_t*)zeroes, xRaw, sizeof(xRaw), HAL_MAX_DELAY);
+    // A noisy reading or an unconfirmed move keeps the coordinates of the touch, only the first reading of a touch has
+    // none to keep
+    if (!(agree && ILI9341_Touch_Confirm(ili9341_touch, valueX, valueY)) && !ili9341_touch->filter_valid) return false;
 
-        avgX += (((int_fast16_t)xRaw[0]) << 8) | ((int_fast16_t)xRaw[1]);
-        avgY += (((int_fast16_t)yRaw[0]) << 8) | ((int_fast16_t)yRaw[1]);
+    // A new touch is reported once the following readings are averaged into its first one
+    if (ili9341_touch->filter_readings < filter->debounce) {
+        ili9341_touch->filter_readings++;
+        return false;
     }
 
+    *rawX = ili9341_touch->filter_x;
+    *rawY = ili9341_touch->filter_y;
+    return true;
+}
+
+bool ILI9341_Touch_GetCoordinates(ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t* x, uint16_t* y) {
+    uint16_t rawX;
+    uint16_t rawY;
+    if (!ILI9341_Touch_GetRawCoordinates(ili9341_touch, &rawX, &rawY)) return false;
+
+    const ILI9341_Touch_CalibrationTypeDef* matrix = &ili9341_touch->matrix;
+    int32_t screenX = (matrix->a * rawX + matrix->b * rawY + matrix->c) >> 16;
+    int32_t screenY = (matrix->d * rawX + matrix->e * rawY + matrix->f) >> 16;
+
+    // Touches beyond the calibrated area are kept on the edges of the display
+    *x = screenX < 0 ? 0 : (screenX >= ili9341_touch->width ? ili9341_touch->width - 1 : screenX);
+    *y = screenY < 0 ? 0 : (screenY >= ili9341_touch->height ? ili9341_touch->height - 1 : screenY);
+    return true;
+}
+
+/**
+ * @brief Measure an aux channel with the internal reference, the reference is powered down after
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param command Control byte of the channel
+ * @param sum Where to store the sum of the 12-bit values of ILI9341_TOUCH_AUX_SAMPLES conversions
+ * @return true if the channel was measured, false if the SPI transfer failed
+ */
+static bool ILI9341_Touch_ConvertAux(
+    const ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    uint8_t command,
+    uint_fast32_t* sum
+) {
+    uint8_t commands[ILI9341_TOUCH_AUX_SETTLE + ILI9341_TOUCH_AUX_SAMPLES];
+    uint16_t results[ILI9341_TOUCH_AUX_SETTLE + ILI9341_TOUCH_AUX_SAMPLES];
+    for (uint_fast8_t i = 0; i < sizeof(commands); i++) commands[i] = command;
+
+    // The conversions that come while the reference powers up are left out
+    ILI9341_Touch_Select(ili9341_touch);
+    bool converted = ILI9341_Touch_ConvertChain(
+        ili9341_touch,
+        commands,
+        results,
+        sizeof(commands),
+        ILI9341_TOUCH_POWER_REFERENCE
+    );
     ILI9341_Touch_Deselect(ili9341_touch);
+    if (!converted) return false;
 
-    if (nsamples < 16) return false;
+    *sum = 0;
+    for (uint_fast8_t i = ILI9341_TOUCH_AUX_SETTLE; i < sizeof(commands); i++) *sum += results[i] >> 3;
+    return true;
+}
 
-    int_fast32_t rawX = (avgX / 16);
-    int_fast32_t rawY = (avgY / 16);
+bool ILI9341_Touch_ReadBattery(const ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t* millivolts) {
+    uint_fast32_t sum;
+    if (!ILI9341_Touch_ConvertAux(ili9341_touch, ILI9341_TOUCH_CONVERT_VBAT, &sum)) return false;
 
-    // Uncomment this line and implement/change UART_Printf to calibrate touchscreen:
-    // UART_Printf("rawX = %d, rawY = %d\r\n", rawX, rawY);
+    // VBAT is divided by 4 before the converter, so the full scale of the 2.5 V reference is 10 V
+    *millivolts = sum * 10000 / (4096 * ILI9341_TOUCH_AUX_SAMPLES);
+    return true;
+}
 
-    if (rawX < ILI9341_TOUCH_MIN_RAW_X) rawX = ILI9341_TOUCH_MIN_RAW_X;
-    if (rawX > ILI9341_TOUCH_MAX_RAW_X) rawX = ILI9341_TOUCH_MAX_RAW_X;
+bool ILI9341_Touch_ReadTemperature(const ILI9341_Touch_HandleTypeDef* ili9341_touch, int16_t* temperature) {
+    uint_fast32_t temp0;
+    uint_fast32_t temp1;
+    if (!ILI9341_Touch_ConvertAux(ili9341_touch, ILI9341_TOUCH_CONVERT_TEMP0, &temp0) ||
+        !ILI9341_Touch_ConvertAux(ili9341_touch, ILI9341_TOUCH_CONVERT_TEMP1, &temp1)) {
+        return false;
+    }
 
-    if (rawY < ILI9341_TOUCH_MIN_RAW_Y) rawY = ILI9341_TOUCH_MIN_RAW_Y;
-    if (rawY > ILI9341_TOUCH_MAX_RAW_Y) rawY = ILI9341_TOUCH_MAX_RAW_Y;
+    // T = 2.573 K/mV * (V(TEMP1) - V(TEMP0)) from the XPT2046 datasheet, with 2500 / 4096 mV per step
+    *temperature = ((int32_t)temp1 - (int32_t)temp0) * 64325 / (4096 * ILI9341_TOUCH_AUX_SAMPLES) - 2732;
+    return true;
+}
 
-    // x = (rawX - ILI9341_TOUCH_MIN_RAW_X) * ili9341_touch->width /
-    // (ILI9341_TOUCH_MAX_RAW_X - ILI9341_TOUCH_MIN_RAW_X);
-    // y = (rawY - ILI9341_TOUCH_MIN_RAW_Y) * ili9341_touch->height /
-    // (ILI9341_TOUCH_MAX_RAW_Y - ILI9341_TOUCH_MIN_RAW_Y);
+/**
+ * @brief Draw a calibration target
+ * @param ili9341 Pointer to ILI9341 handle structure
+ * @param x X coordinate of the center of the target
+ * @param y Y coordinate of the center of the target
+ * @param color 16-bit target color in RGB565 format
+ */
+static void ILI9341_Touch_DrawTarget(ILI9341_HandleTypeDef* ili9341, int_fast16_t x, int_fast16_t y, uint16_t color) {
+    ILI9341_DrawLine(ili9341, x - 10, y, x + 10, y, color);
+    ILI9341_DrawLine(ili9341, x, y - 10, x, y + 10, color);
+    ILI9341_DrawCircle(ili9341, x, y, 5, color);
+}
 
-    switch (ili9341_touch->rotation) {
-        case ILI9341_ROTATION_HORIZONTAL_1:
-            *y = (rawX - ILI9341_TOUCH_MIN_RAW_X) * ili9341_touch->height /
-                 (ILI9341_TOUCH_MAX_RAW_X - ILI9341_TOUCH_MIN_RAW_X);
-            *x = (rawY - ILI9341_TOUCH_MIN_RAW_Y) * ili9341_touch->width /
-                 (ILI9341_TOUCH_MAX_RAW_Y - ILI9341_TOUCH_MIN_RAW_Y);
-            break;
-        case ILI9341_ROTATION_VERTICAL_1:
-            *x = (rawX - ILI9341_TOUCH_MIN_RAW_X) * ili9341_touch->width /
-                 (ILI9341_TOUCH_MAX_RAW_X - ILI9341_TOUCH_MIN_RAW_X);
-            *y = ili9341_touch->height - 1 -
-                 (rawY - ILI9341_TOUCH_MIN_RAW_Y) * ili9341_touch->height /
-                     (ILI9341_TOUCH_MAX_RAW_Y - ILI9341_TOUCH_MIN_RAW_Y);
-            break;
-        case ILI9341_ROTATION_HORIZONTAL_2:
-            *y = ili9341_touch->height - 1 -
-                 (rawX - ILI9341_TOUCH_MIN_RAW_X) * ili9341_touch->height /
-                     (ILI9341_TOUCH_MAX_RAW_X - ILI9341_TOUCH_MIN_RAW_X);
-            *x = ili9341_touch->width - 1 -
-                 (rawY - ILI9341_TOUCH_MIN_RAW_Y) * ili9341_touch->width /
-                     (ILI9341_TOUCH_MAX_RAW_Y - ILI9341_TOUCH_MIN_RAW_Y);
-            break;
-        case ILI9341_ROTATION_VERTICAL_2:
-            *x = ili9341_touch->width - 1 -
-                 (rawX - ILI9341_TOUCH_MIN_RAW_X) * ili9341_touch->width /
-                     (ILI9341_TOUCH_MAX_RAW_X - ILI9341_TOUCH_MIN_RAW_X);
-            *y = (rawY - ILI9341_TOUCH_MIN_RAW_Y) * ili9341_touch->height /
-                 (ILI9341_TOUCH_MAX_RAW_Y - ILI9341_TOUCH_MIN_RAW_Y);
-            break;
-        default:
-            *x = (rawX - ILI9341_TOUCH_MIN_RAW_X) * ili9341_touch->width /
-                 (ILI9341_TOUCH_MAX_RAW_X - ILI9341_TOUCH_MIN_RAW_X);
-            *y = (rawY - ILI9341_TOUCH_MIN_RAW_Y) * ili9341_touch->height /
-                 (ILI9341_TOUCH_MAX_RAW_Y - ILI9341_TOUCH_MIN_RAW_Y);
-            break;
+/**
+ * @brief Wait for a calibration target to be touched and released
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param timeout Time to touch the target in milliseconds
+ * @param rawX Pointer to store the average raw X value of the touch
+ * @param rawY Pointer to store the average raw Y value of the touch
+ * @return true if the target was touched, false on timeout
+ */
+static bool ILI9341_Touch_ReadTarget(
+    ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    uint32_t timeout,
+    float* rawX,
+    float* rawY
+) {
+    uint32_t start = HAL_GetTick();
+    uint_fast32_t sumX = 0;
+    uint_fast32_t sumY = 0;
+    uint_fast8_t readings = 0;
+
+    // A touch lifted before enough readings is not used, the target has to be touched again
+    while (readings < ILI9341_TOUCH_CALIBRATION_READINGS) {
+        if (HAL_GetTick() - start > timeout) return false;
+
+        uint16_t x;
+        uint16_t y;
+        if (ILI9341_Touch_GetRawCoordinates(ili9341_touch, &x, &y)) {
+            sumX += x;
+            sumY += y;
+            readings++;
+        } else if (!ILI9341_Touch_IsPressed(ili9341_touch)) {
+            sumX = 0;
+            sumY = 0;
+            readings = 0;
+        }
+    }
+
+    while (ILI9341_Touch_IsPressed(ili9341_touch)) {
+        if (HAL_GetTick() - start > timeout) return false;
+    }
+
+    *rawX = (float)sumX / ILI9341_TOUCH_CALIBRATION_READINGS;
+    *rawY = (float)sumY / ILI9341_TOUCH_CALIBRATION_READINGS;
+    return true;
+}
+
+bool ILI9341_Touch_Calibrate(
+    ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    ILI9341_HandleTypeDef* ili9341,
+    uint_fast8_t points,
+    uint32_t timeout
+) {
+    // Target positions in eighths of the display, spread so that the fit does not depend on a small area
+    static const uint8_t targets3[][2] = {{1, 1}, {7, 4}, {4, 7}};
+    static const uint8_t targets5[][2] = {{1, 1}, {7, 1}, {7, 7}, {1, 7}, {4, 4}};
+
+    if ((points != 3 && points != 5) || ili9341_touch->sampling) return false;
+    const uint8_t(*targets)[2] = points == 3 ? targets3 : targets5;
+
+    float rawX[5];
+    float rawY[5];
+    float nativeX[5];
+    float nativeY[5];
+
+    ILI9341_FillScreen(ili9341, ILI9341_COLOR_BLACK);
+
+    for (uint_fast8_t i = 0; i < points; i++) {
+        int_fast16_t x = ili9341_touch->width * targets[i][0] / 8;
+        int_fast16_t y = ili9341_touch->height * targets[i][1] / 8;
+
+        ILI9341_Touch_DrawTarget(ili9341, x, y, ILI9341_COLOR_WHITE);
+        ILI9341_WaitForTransfer(ili9341);  // the touch controller may be on the same SPI bus
+        bool touched = ILI9341_Touch_ReadTarget(ili9341_touch, timeout, &rawX[i], &rawY[i]);
+        ILI9341_Touch_DrawTarget(ili9341, x, y, ILI9341_COLOR_BLACK);
+        if (!touched) return false;
+
+        // The center of the target pixel, in the orientation the calibration is stored in
+        ILI9341_Touch_ToNative(ili9341_touch, x + 0.5f, y + 0.5f, &nativeX[i], &nativeY[i]);
+    }
+
+    // Least squares fit of nativeX and nativeY as affine functions of the raw values, exact for 3 points. Centering on
+    // the means leaves a 2x2 system for the raw coefficients
+    float meanRawX = 0, meanRawY = 0, meanX = 0, meanY = 0;
+    for (uint_fast8_t i = 0; i < points; i++) {
+        meanRawX += rawX[i] / points;
+        meanRawY += rawY[i] / points;
+        meanX += nativeX[i] / points;
+        meanY += nativeY[i] / points;
+    }
+
+    float xx = 0, xy = 0, yy = 0, xu = 0, yu = 0, xv = 0, yv = 0;
+    for (uint_fast8_t i = 0; i < points; i++) {
+        float dx = rawX[i] - meanRawX;
+        float dy = rawY[i] - meanRawY;
+        float du = nativeX[i] - meanX;
+        float dv = nativeY[i] - meanY;
+        xx += dx * dx;
+        xy += dx * dy;
+        yy += dy * dy;
+        xu += dx * du;
+        yu += dy * du;
+        xv += dx * dv;
+        yv += dy * dv;
+    }
+
+    // Targets touched in a line (or all at the same place) do not make a calibration
+    float det = xx * yy - xy * xy;
+    if (det <= 0.01f * xx * yy) {
+        ILI9341_FillScreen(ili9341, ILI9341_COLOR_BLACK);
+        return false;
+    }
+
+    float a = (xu * yy - yu * xy) / det;
+    float b = (yu * xx - xu * xy) / det;
+    float d = (xv * yy - yv * xy) / det;
+    float e = (yv * xx - xv * xy) / det;
+
+    ILI9341_Touch_CalibrationTypeDef calibration = {
+        .a = lroundf(a * 65536.0f),
+        .b = lroundf(b * 65536.0f),
+        .c = lroundf((meanX - a * meanRawX - b * meanRawY) * 65536.0f),
+        .d = lroundf(d * 65536.0f),
+        .e = lroundf(e * 65536.0f),
+        .f = lroundf((meanY - d * meanRawX - e * meanRawY) * 65536.0f)
+    };
+    ILI9341_Touch_SetCalibration(ili9341_touch, calibration);
+
+    ILI9341_FillScreen(ili9341, ILI9341_COLOR_BLACK);
+    return true;
+}
+
+/**
+ * @brief Check if the sampling interrupts can use the SPI bus, i.e. they did not interrupt another transfer
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @return true if the bus is free
+ */
+static bool ILI9341_Touch_BusFree(const ILI9341_Touch_HandleTypeDef* ili9341_touch) {
+    if (HAL_SPI_GetState(ili9341_touch->spi_handle) != HAL_SPI_STATE_READY) return false;
+
+    // The touch controller is selected from the main loop for an aux measurement
+    if (HAL_GPIO_ReadPin(ili9341_touch->cs_port, ili9341_touch->cs_pin) == GPIO_PIN_RESET) return false;
+
+    // The display stays selected from the start of a drawing function until its last transfer is completed
+    const ILI9341_HandleTypeDef* display = ili9341_touch->shared_display;
+    return display == NULL || HAL_GPIO_ReadPin(display->cs_port, display->cs_pin) == GPIO_PIN_SET;
+}
+
+/**
+ * @brief Queue a touch event at the last sampled coordinates, called from the sampling interrupts only
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ * @param kind Event type
+ * @param timestamp HAL_GetTick value of the sample
+ * @return true if the event was queued, false if the queue is full
+ */
+static bool ILI9341_Touch_PushEvent(
+    ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    ILI9341_Touch_EventKindTypeDef kind,
+    uint32_t timestamp
+) {
+    uint_fast16_t head = ili9341_touch->event_head;
+    uint_fast16_t used = head - ili9341_touch->event_tail;
+
+    // The last slot is kept for a release, so a touch that got its press event also gets its release event
+    uint_fast16_t size = ILI9341_TOUCH_EVENT_QUEUE_SIZE - (kind == ILI9341_TOUCH_EVENT_MOVE ? 1 : 0);
+    if (used >= size) return false;
+
+    ILI9341_Touch_EventTypeDef* event = &ili9341_touch->events[head % ILI9341_TOUCH_EVENT_QUEUE_SIZE];
+    event->kind = kind;
+    event->x = ili9341_touch->last_x;
+    event->y = ili9341_touch->last_y;
+    event->timestamp = timestamp;
+
+    // The event must be written before the consumer can see it
+    __DMB();
+    ili9341_touch->event_head = head + 1;
+    return true;
+}
+
+/**
+ * @brief Sample the touch controller and queue the events of what changed since the last sample
+ * @param ili9341_touch Pointer to the ILI9341_Touch_HandleTypeDef structure
+ */
+static void ILI9341_Touch_Sample(ILI9341_Touch_HandleTypeDef* ili9341_touch) {
+    if (!ili9341_touch->pressed && !ILI9341_Touch_IsPressed(ili9341_touch)) return;
+    if (!ILI9341_Touch_BusFree(ili9341_touch)) return;
+
+    uint32_t timestamp = HAL_GetTick();
+    uint16_t x;
+    uint16_t y;
+
+    bool touched = ILI9341_Touch_GetCoordinates(ili9341_touch, &x, &y);
+
+    // The last conversion enabled PENIRQ again, with the pen down its falling edge is pending on the EXTI line
+    __HAL_GPIO_EXTI_CLEAR_IT(ili9341_touch->irq_pin);
+
+    if (touched) {
+        if (!ili9341_touch->pressed) {
+            ili9341_touch->last_x = x;
+            ili9341_touch->last_y = y;
+            ili9341_touch->pressed = ILI9341_Touch_PushEvent(ili9341_touch, ILI9341_TOUCH_EVENT_PRESS, timestamp);
+        } else if (x != ili9341_touch->last_x || y != ili9341_touch->last_y) {
+            ili9341_touch->last_x = x;
+            ili9341_touch->last_y = y;
+            if (!ILI9341_Touch_PushEvent(ili9341_touch, ILI9341_TOUCH_EVENT_MOVE, timestamp)) {
+                ili9341_touch->dropped_events++;
+            }
+        }
+    } else if (ili9341_touch->pressed && !ILI9341_Touch_IsPressed(ili9341_touch)) {
+        // A release that does not fit in the queue is tried again on the next tick
+        ili9341_touch->pressed = !ILI9341_Touch_PushEvent(ili9341_touch, ILI9341_TOUCH_EVENT_RELEASE, timestamp);
+    }
+}
+
+void ILI9341_Touch_SetSharedDisplay(
+    ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    const ILI9341_HandleTypeDef* sharedDisplay
+) {
+    ili9341_touch->shared_display = sharedDisplay;
+}
+
+void ILI9341_Touch_StartSampling(
+    ILI9341_Touch_HandleTypeDef* ili9341_touch,
+    const ILI9341_HandleTypeDef* sharedDisplay
+) {
+    ili9341_touch->sampling = false;
+
+    ili9341_touch->shared_display = sharedDisplay;
+    ili9341_touch->pressed = false;
+    ili9341_touch->pen_sampled = false;
+    ili9341_touch->event_tail = ili9341_touch->event_head;
+    ili9341_touch->dropped_events = 0;
+
+    __DMB();
+    ili9341_touch->sampling = true;
+}
+
+void ILI9341_Touch_StopSampling(ILI9341_Touch_HandleTypeDef* ili9341_touch) {
+    ili9341_touch->sampling = false;
+    __DMB();
+
+    // The sampling interrupts are stopped, so the touch in progress can be released from here
+    if (ili9341_touch->pressed) {
+        ILI9341_Touch_PushEvent(ili9341_touch, ILI9341_TOUCH_EVENT_RELEASE, HAL_GetTick());
+        ili9341_touch->pressed = false;
     }
+}
+
+void ILI9341_Touch_EXTI_Callback(ILI9341_Touch_HandleTypeDef* ili9341_touch, uint16_t pin) {
+    // The IRQ pin also toggles during conversions. Only the first reading of a new touch is taken here, a rejected or
+    // debounced one is tried again at the timer ticks rather than from the next edge
+    if (pin != ili9341_touch->irq_pin || !ili9341_touch->sampling || ili9341_touch->pressed) return;
+    if (ili9341_touch->pen_sampled) return;
+
+    ili9341_touch->pen_sampled = true;
+    ILI9341_Touch_Sample(ili9341_touch);
+}
+
+void ILI9341_Touch_TimerCallback(ILI9341_Touch_HandleTypeDef* ili9341_touch) {
+    if (!ili9341_touch->sampling) return;
+
+    // Once the pen is lifted, the next touch is sampled from the IRQ pin again
+    if (!ILI9341_Touch_IsPressed(ili9341_touch)) ili9341_touch->pen_sampled = false;
+
+    ILI9341_Touch_Sample(ili9341_touch);
+}
+
+bool ILI9341_Touch_GetEvent(ILI9341_Touch_HandleTypeDef* ili9341_touch, ILI9341_Touch_EventTypeDef* event) {
+    uint_fast16_t tail = ili9341_touch->event_tail;
+    if (tail == ili9341_touch->event_head) return false;
 
+    // Read the event only after seeing the head that published it, and free its slot only after reading it
+    __DMB();
+    *event = ili9341_touch->events[tail % ILI9341_TOUCH_EVENT_QUEUE_SIZE];
+    __DMB();
+    ili9341_touch->event_tail = tail + 1;
     return true;
 }
@@ -275,9 +275,18 @@ int main(void) {
         HAL_Delay(250);
         waitForButtonPress();
         for (int i = 1; i < 8; i++) {
-            char str[33];
-            for (int j = i * 32; j < (i * 32) + 32; j++) { str[j - (i * 32)] = (char)j; }
-            str[32] = '\0';
+            // Strings are UTF-8, codepoints from 0x80 take 2 bytes
+            char str[65];
+            char* p = str;
+            for (int j = i * 32; j < (i * 32) + 32; j++) {
+                if (j < 0x80) {
+                    *(p++) = (char)j;
+                } else {
+                    *(p++) = (char)(0xC0 | (j >> 6));
+                    *(p++) = (char)(0x80 | (j & 0x3F));
+                }
+            }
+            *p = '\0';
             ILI9341_WriteString(
                 &ili9341,
                 10,
@@ -295,15 +304,22 @@ int main(void) {
         HAL_Delay(250);
         waitForButtonPress();
         ILI9341_FillScreen(&ili9341, ILI9341_COLOR_WHITE);
-        for (int i = 1; i < 8; i++) {
+        const char* thai[] = {
+            "กขฃคฅฆงจฉชซฌญฎฏฐฑฒณดตถทธนบปผฝพฟภ",
+            "มยรฤลฦวศษสหฬอฮฯะัาำิีึืฺุู",
+            "฿เแโใไๅๆ็่้๊๋์ํ๎๏๐๑๒๓๔๕๖๗๘๙๚๛"
+        };
+        for (int i = 1; i < 7; i++) {
             char str[33];
-            for (int j = i * 32; j < (i * 32) + 32; j++) { str[j - (i * 32)] = (char)j; }
-            str[32] = '\0';
+            if (i < 4) {
+                for (int j = i * 32; j < (i * 32) + 32; j++) { str[j - (i * 32)] = (char)j; }
+                str[32] = '\0';
+            }
             ILI9341_WriteString(
                 &ili9341,
                 10,
                 35 + (i * 20),
-                str,
+                i < 4 ? str : thai[i - 4],
                 ILI9341_Font_Manop8x20,
                 ILI9341_COLOR_BLACK,
                 ILI9341_COLOR_WHITE,
@@ -1,13 +1,123 @@
 import os
+import struct
 
 from bdflib import reader
 from natsort import natsorted
+from PIL import Image, ImageDraw, ImageFont
 
-# Codepoint range must contain 0x7F (fallback codepoint in the renderer)
-CODEPOINT_START = 0x20  # Inclusive
-CODEPOINT_END = 0xFF  # Inclusive
-CODEPOINTS = [i for i in range(CODEPOINT_START, CODEPOINT_END + 1)]
-ENCODING = "ISO-8859-1"  # Latin 1
+# Unicode codepoint ranges to export (inclusive), codepoints missing from the font are left out and drawn with the
+# 0x7F (del) glyph, which is always exported as the fallback for the renderer
+RANGES = [
+    (0x20, 0xFF),  # Latin 1
+    # (0x0E01, 0x0E5B),  # Thai
+]
+# Store the rows that repeat the row above only once (ILI9341_GLYPH_ENCODING_ROW_REPEAT), for glyphs where it is smaller
+COMPRESS = True
+# Bits per pixel of the exported glyphs, 2 or 4 for anti-aliased glyphs (ILI9341_GLYPH_ENCODING_COVERAGE_2BPP/4BPP)
+BITS_PER_PIXEL = 1
+# With anti-aliasing, .bdf fonts are drawn SUPERSAMPLE times larger than the exported font, e.g. a 64 pixels high font
+# for 16 pixels with 4. Each SUPERSAMPLE x SUPERSAMPLE box becomes one pixel with its coverage
+SUPERSAMPLE = 4
+# Pixel size of the .ttf and .otf outline fonts, rendered with Pillow
+OUTLINE_SIZE = 16
+# Export the kerning pairs of outline fonts. .bdf fonts have no kerning, pairs can be listed in a .kern file next to the
+# .bdf file, one "left right offset" line per pair with the codepoints in hex (eg. "0x41 0x56 -1")
+KERNING = True
+# Also write each font to a <font name>.bin blob, to be loaded from external flash or an SD card (ili9341_fontblob.h)
+BLOB = False
+
+
+def encode_row_repeat(rows: list[int], width: int) -> list[int]:
+    flags = [i > 0 and rows[i] == rows[i - 1] for i in range(len(rows))]
+
+    long = 0
+    for flag in flags:
+        long = (long << 1) | flag
+    bits = len(rows)
+    for row, flag in zip(rows, flags):
+        if not flag:
+            long = (long << width) | row
+            bits += width
+    long <<= (-bits) % 8
+
+    return list(long.to_bytes((bits + 7) // 8, "big"))
+
+
+def encode_coverage(rows: list[list[float]]) -> tuple[int, list[int]]:
+    maximum = (1 << BITS_PER_PIXEL) - 1
+    long = 0
+    bits = 0
+    for row in rows:
+        for coverage in row:
+            long = (long << BITS_PER_PIXEL) | int(coverage * maximum + 0.5)
+            bits += BITS_PER_PIXEL
+    long <<= (-bits) % 8
+
+    encoding = {1: 0, 2: 2, 4: 3}[BITS_PER_PIXEL]
+    return encoding, list(long.to_bytes((bits + 7) // 8, "big"))
+
+
+def crop_coverage(rows: list[list[float]], bbX: int, bbY: int) -> tuple[list[list[float]], int, int]:
+    # Coverage that rounds to the background is not stored
+    threshold = 0.5 / ((1 << BITS_PER_PIXEL) - 1)
+    rows = [[coverage if coverage >= threshold else 0.0 for coverage in row] for row in rows]
+
+    while rows and not any(rows[0]):
+        rows.pop(0)
+    while rows and not any(rows[-1]):
+        rows.pop(-1)
+        bbY += 1
+    if not rows:
+        return [], 0, 0
+
+    while not any(row[0] for row in rows):
+        rows = [row[1:] for row in rows]
+        bbX += 1
+    while not any(row[-1] for row in rows):
+        rows = [row[:-1] for row in rows]
+
+    return rows, bbX, bbY
+
+
+def downsample_glyph(glyph) -> tuple[list[list[float]], int, int]:
+    # Pixels are grouped by their position relative to the origin, so every glyph lands on the same grid
+    counts: dict[tuple[int, int], int] = {}
+    for row_index, row in enumerate(reversed(glyph.data)):
+        y = glyph.bbY + glyph.bbH - 1 - row_index
+        for col in range(glyph.bbW):
+            if row & (1 << (glyph.bbW - 1 - col)):
+                key = ((glyph.bbX + col) // SUPERSAMPLE, y // SUPERSAMPLE)
+                counts[key] = counts.get(key, 0) + 1
+
+    if not counts:
+        return [], 0, 0
+
+    x0 = min(x for x, _ in counts)
+    x1 = max(x for x, _ in counts)
+    y0 = min(y for _, y in counts)
+    y1 = max(y for _, y in counts)
+    rows = [
+        [counts.get((x, y), 0) / (SUPERSAMPLE * SUPERSAMPLE) for x in range(x0, x1 + 1)]
+        for y in range(y1, y0 - 1, -1)
+    ]
+    return crop_coverage(rows, x0, y0)
+
+
+def render_outline_glyph(font: ImageFont.FreeTypeFont, codepoint: int) -> tuple[list[list[float]], int, int]:
+    left, top, right, bottom = font.getbbox(chr(codepoint), anchor="ls")
+    if right <= left or bottom <= top:
+        return [], 0, 0
+
+    image = Image.new("L", (right - left, bottom - top), 0)
+    ImageDraw.Draw(image).text((-left, -top), chr(codepoint), font=font, fill=255, anchor="ls")
+    rows = [[image.getpixel((x, y)) / 255 for x in range(image.width)] for y in range(image.height)]
+
+    # The Y offset of the bounding box is the offset of its bottom row from the baseline, positive is up
+    return crop_coverage(rows, left, -bottom)
+
+
+def hex_codepoint(codepoint: int) -> str:
+    return f"0x{codepoint:02X}" if codepoint <= 0xFF else f"0x{codepoint:04X}"
 
 
 def convert_file(file_path: str) -> str:
@@ -18,20 +128,37 @@ def convert_file(file_path: str) -> str:
 
     output: str = f"\nstatic const ILI9341_GlyphDef ILI9341_Font_{font_name}_Glyphs[] = {{\n"
     print(f"extern ILI9341_FontDef ILI9341_Font_{font_name};")
+    glyphs: list[tuple] = []
 
     default_char = int(font.properties.get(b"DEFAULT_CHAR") or 32)
 
-    for codepoint in CODEPOINTS:
+    codepoints = sorted(
+        {codepoint for start, end in RANGES for codepoint in range(start, end + 1) if font.get(codepoint)} | {0x7F}
+    )
+
+    # Consecutive codepoints are merged into ranges, each range starts at the index of its first glyph
+    ranges: list[list[int]] = []
+    for index, codepoint in enumerate(codepoints):
+        if ranges and ranges[-1][1] == codepoint - 1:
+            ranges[-1][1] = codepoint
+        else:
+            ranges.append([codepoint, codepoint, index])
+
+    for codepoint in codepoints:
         # Override 0x7F (del) to use the default char, since 0x7F is the fallback codepoint for the renderer
         if codepoint == 0x7F:
             glyph = font.get(default_char)
         else:
-            glyph = font.get(codepoint) or font.get(default_char)
+            glyph = font.get(codepoint)
 
         if glyph is None:
-            raise ValueError(
-                f"Glyph for codepoint {codepoint} not found in font {file_path} and no default char is available."
-            )
+            raise ValueError(f"Default char {default_char} not found in font {file_path}.")
+
+        if BITS_PER_PIXEL > 1:
+            rows, bbX, bbY = downsample_glyph(glyph)
+            glyphs.append(coverage_glyph(rows, bbX, bbY, round(glyph.advance / SUPERSAMPLE)))
+            output += glyph_line(codepoint, glyphs[-1])
+            continue
 
         bbX = glyph.bbX
         bbY = glyph.bbY
@@ -90,31 +217,231 @@ def convert_file(file_path: str) -> str:
         longBytes = long.to_bytes((bbW * bbH + 7) // 8, "big")
         int_array = list(longBytes)
 
-        try:
-            c = bytes([codepoint]).decode(ENCODING)
-        except UnicodeDecodeError:
-            c = "�"
+        encoding = 0
+        if COMPRESS and len(data) > 0:
+            compressed = encode_row_repeat(data, bbW)
+            if len(compressed) < len(int_array):
+                encoding = 1
+                int_array = compressed
 
-        if not c.isprintable() and c not in ("\u00a0", "\u00ad"):
-            c = "�"
+        glyphs.append((bbX, bbY, bbW, bbH, glyph.advance, encoding, int_array))
+        output += glyph_line(codepoint, glyphs[-1])
+
+    average_width = int(font.properties.get(b"AVERAGE_WIDTH") or font[65].bbW)
+    ascent = int(font.properties.get(b"FONT_ASCENT") or font[65].bbH)
+    descent = int(font.properties.get(b"FONT_DESCENT") or 0)
+    kerning = read_kerning_file(file_path, codepoints)
+    if BITS_PER_PIXEL > 1:
+        average_width = round(average_width / SUPERSAMPLE)
+        ascent = -(-ascent // SUPERSAMPLE)
+        descent = -(-descent // SUPERSAMPLE)
+        kerning = {pair: round(offset / SUPERSAMPLE) for pair, offset in kerning.items()}
+
+    output += "};\n"
+    output += font_definition(font_name, ranges, average_width, ascent, descent, kerning)
+    if BLOB:
+        write_font_blob(font_name, ranges, glyphs, average_width, ascent, descent, kerning)
+
+    return output
+
+
+def coverage_glyph(rows: list[list[float]], bbX: int, bbY: int, advance: int) -> tuple:
+    encoding, int_array = encode_coverage(rows)
+    bbW = len(rows[0]) if rows else 0
+    return (bbX, bbY, bbW, len(rows), advance, encoding if rows else 0, int_array)
+
+
+def glyph_line(codepoint: int, glyph: tuple) -> str:
+    bbX, bbY, bbW, bbH, advance, encoding, int_array = glyph
+
+    c = chr(codepoint)
+    if not c.isprintable() and c not in ("\u00a0", "\u00ad"):
+        c = "�"
+
+    output = " " * 4
+    output += f"{{{bbX:3d}, {bbY:3d}, {bbW:2d}, {bbH:2d}, {advance:2d}, {encoding}, "
+    if len(int_array) > 0:
+        output += "(const uint8_t[]){"
+        output += ", ".join([f"0x{i:02X}" for i in int_array])
+        output += "}"
+    else:
+        output += "NULL"
+    output += f"}}, /* {c} */\n"
+    return output
 
-        output += " " * 4
-        output += f"{{{bbX:3d}, {bbY:3d}, {bbW:2d}, {bbH:2d}, {glyph.advance:2d}, "
-        if len(int_array) > 0:
-            output += "(const uint8_t[]){"
-            output += ", ".join([f"0x{i:02X}" for i in int_array])
-            output += "}"
-        else:
-            output += "NULL"
-        output += f"}}, /* {c} */\n"
 
+def font_definition(
+    font_name: str,
+    ranges: list[list[int]],
+    average_width: int,
+    ascent: int,
+    descent: int,
+    kerning: dict[tuple[int, int], int],
+) -> str:
+    output = f"static const ILI9341_FontRangeDef ILI9341_Font_{font_name}_Ranges[] = {{"
+    output += ", ".join(
+        [f"{{{hex_codepoint(start)}, {hex_codepoint(end)}, 0x{index:02X}}}" for start, end, index in ranges]
+    )
     output += "};\n"
+
+    pairs = kerning_pairs(kerning)
+    if pairs:
+        output += f"static const ILI9341_KerningPairDef ILI9341_Font_{font_name}_Kerning[] = {{\n"
+        for left, right, offset in pairs:
+            text = (chr(left) + chr(right)).replace("*/", "* /")
+            output += f"    {{{hex_codepoint(left)}, {hex_codepoint(right)}, {offset:2d}}}, /* {text} */\n"
+        output += "};\n"
+
     output += f"const ILI9341_FontDef ILI9341_Font_{font_name} = "
-    output += f"{{ 0x{CODEPOINT_START:02X}, 0x{CODEPOINT_END:02X}, "
-    output += f"{int(font.properties.get(b'AVERAGE_WIDTH') or font[65].bbW)}, "
-    output += f"{int(font.properties.get(b'FONT_ASCENT') or font[65].bbH)}, "
-    output += f"{int(font.properties.get(b'FONT_DESCENT') or 0)}, "
-    output += f"ILI9341_Font_{font_name}_Glyphs }};\n"
+    output += f"{{ ILI9341_Font_{font_name}_Ranges, {len(ranges)}, "
+    output += f"{average_width}, {ascent}, {descent}, "
+    output += f"ILI9341_Font_{font_name}_Glyphs, "
+    output += f"ILI9341_Font_{font_name}_Kerning, {len(pairs)}, NULL }};\n" if pairs else "NULL, 0, NULL };\n"
+    return output
+
+
+def kerning_pairs(kerning: dict[tuple[int, int], int]) -> list[tuple[int, int, int]]:
+    # The renderer binary searches the pairs, sorted by left then right codepoint
+    return sorted((left, right, offset) for (left, right), offset in kerning.items() if offset != 0)
+
+
+def write_font_blob(
+    font_name: str,
+    ranges: list[list[int]],
+    glyphs: list[tuple],
+    average_width: int,
+    ascent: int,
+    descent: int,
+    kerning: dict[tuple[int, int], int],
+) -> None:
+    # Layout described in ili9341_fontblob.h: header, ranges, glyphs, kerning pairs, then the data of all glyphs
+    pairs = kerning_pairs(kerning)
+    ranges_offset = 32
+    glyphs_offset = ranges_offset + 12 * len(ranges)
+    kerning_offset = glyphs_offset + 12 * len(glyphs)
+    data_offset = kerning_offset + 6 * len(pairs)
+
+    entries = b""
+    data = b""
+    for bbX, bbY, bbW, bbH, advance, encoding, int_array in glyphs:
+        data_size = len(int_array)
+        entries += struct.pack("<bbBBbBHI", bbX, bbY, bbW, bbH, advance, encoding, data_size, data_offset + len(data))
+        data += bytes(int_array)
+
+    header = struct.pack(
+        "<4sBbbBhHHHHHIII",
+        b"ILIF",
+        1,
+        ascent,
+        descent,
+        0,
+        average_width,
+        len(ranges),
+        len(glyphs),
+        len(pairs),
+        max((len(glyph[6]) for glyph in glyphs), default=0),
+        0,
+        ranges_offset,
+        glyphs_offset,
+        kerning_offset,
+    )
+
+    with open(f"{font_name}.bin", "wb") as file:
+        file.write(header)
+        file.write(b"".join(struct.pack("<IIHH", start, end, index, 0) for start, end, index in ranges))
+        file.write(entries)
+        file.write(b"".join(struct.pack("<HHbB", left, right, offset, 0) for left, right, offset in pairs))
+        file.write(data)
+
+
+def read_kerning_file(file_path: str, codepoints: list[int]) -> dict[tuple[int, int], int]:
+    kerning: dict[tuple[int, int], int] = {}
+    kerning_path = os.path.splitext(file_path)[0] + ".kern"
+    if not KERNING or not os.path.exists(kerning_path):
+        return kerning
+
+    with open(kerning_path, encoding="utf-8") as file:
+        for line in file:
+            fields = line.split("#")[0].split()
+            if not fields:
+                continue
+            left, right, offset = int(fields[0], 0), int(fields[1], 0), int(fields[2])
+            if left in codepoints and right in codepoints and left <= 0xFFFF and right <= 0xFFFF:
+                kerning[(left, right)] = offset
+
+    return kerning
+
+
+def outline_kerning(font: ImageFont.FreeTypeFont, codepoints: list[int]) -> dict[tuple[int, int], int]:
+    kerning: dict[tuple[int, int], int] = {}
+    if not KERNING:
+        return kerning
+
+    # Pillow applies the kerning of the font when laying out a pair, so the kerning is what the pair is longer than its
+    # two characters
+    characters = [chr(codepoint) for codepoint in codepoints if codepoint != 0x7F and codepoint <= 0xFFFF]
+    lengths = {c: font.getlength(c) for c in characters}
+    for left in characters:
+        for right in characters:
+            offset = round(font.getlength(left + right) - lengths[left] - lengths[right])
+            if offset != 0:
+                kerning[(ord(left), ord(right))] = offset
+
+    return kerning
+
+
+def convert_outline_file(file_path: str) -> str:
+    font = ImageFont.truetype(file_path, OUTLINE_SIZE)
+
+    font_name = os.path.splitext(file_path)[0].replace("/", "").replace(".", "").replace("-", "") + str(OUTLINE_SIZE)
+
+    output: str = f"\nstatic const ILI9341_GlyphDef ILI9341_Font_{font_name}_Glyphs[] = {{\n"
+    print(f"extern ILI9341_FontDef ILI9341_Font_{font_name};")
+    glyphs: list[tuple] = []
+
+    # Outline fonts draw their own replacement glyph for the codepoints they miss, the 0x7F (del) fallback is a box
+    codepoints = sorted(
+        {codepoint for start, end in RANGES for codepoint in range(start, end + 1) if chr(codepoint).isprintable()}
+        | {0x7F}
+    )
+
+    ranges: list[list[int]] = []
+    for index, codepoint in enumerate(codepoints):
+        if ranges and ranges[-1][1] == codepoint - 1:
+            ranges[-1][1] = codepoint
+        else:
+            ranges.append([codepoint, codepoint, index])
+
+    ascent, descent = font.getmetrics()
+    advances = []
+
+    for codepoint in codepoints:
+        if codepoint == 0x7F:
+            width = max(round(font.getlength("0")) - 2, 1)
+            _, top, _, bottom = font.getbbox("0", anchor="ls")
+            height = max(bottom - top, 1)
+            rows = [
+                [1.0 if x in (0, width - 1) or y in (0, height - 1) else 0.0 for x in range(width)]
+                for y in range(height)
+            ]
+            glyphs.append(coverage_glyph(rows, 1, 0, width + 2))
+            output += glyph_line(codepoint, glyphs[-1])
+            continue
+
+        rows, bbX, bbY = render_outline_glyph(font, codepoint)
+        advance = round(font.getlength(chr(codepoint)))
+        if 0x20 <= codepoint < 0x7F:
+            advances.append(advance)
+        glyphs.append(coverage_glyph(rows, bbX, bbY, advance))
+        output += glyph_line(codepoint, glyphs[-1])
+
+    average_width = round(sum(advances) * 10 / len(advances))
+    kerning = outline_kerning(font, codepoints)
+
+    output += "};\n"
+    output += font_definition(font_name, ranges, average_width, ascent, descent, kerning)
+    if BLOB:
+        write_font_blob(font_name, ranges, glyphs, average_width, ascent, descent, kerning)
 
     return output
 
@@ -124,9 +451,10 @@ def main() -> None:
         print("// Header declarations")
         file.write('#include "ili9341_fonts.h"\n')
         for file_path in natsorted(os.listdir(".")):
-            if not file_path.endswith(".bdf"):
-                continue
-            file.write(convert_file(file_path))
+            if file_path.endswith(".bdf"):
+                file.write(convert_file(file_path))
+            elif file_path.endswith((".ttf", ".otf")):
+                file.write(convert_outline_file(file_path))
 
 
 if __name__ == "__main__":
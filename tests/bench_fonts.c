@@ -0,0 +1,270 @@
+// Flash size and render throughput of every bundled font: the glyph data as stored, with the repeated rows of
+// ILI9341_GLYPH_ENCODING_ROW_REPEAT glyphs kept once, against the same glyphs decoded to plain bitmaps. Every glyph
+// is drawn opaque at scale 1 and 2 and transparent at scale 1, the SPI bytes are only counted. Both must draw the
+// same pixels.
+
+#include "ili9341_fonts.h"
+#include "panel.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "time.h"
+
+#define BENCH_PIXELS 5000000.0
+#define BENCH_X 40
+#define BENCH_REFERENCE_X 160
+
+#define BENCH_FONT(name) {#name, &ILI9341_Font_##name}
+
+typedef struct {
+    const char* name;
+    const ILI9341_FontDef* font;
+} BenchFontTypeDef;
+
+typedef enum { BENCH_OPAQUE, BENCH_OPAQUE_X2, BENCH_TRANSPARENT, BENCH_MODE_COUNT } BenchModeTypeDef;
+
+static const BenchFontTypeDef fonts[] = {
+    BENCH_FONT(Terminus6x12b),  BENCH_FONT(Terminus6x12),   BENCH_FONT(Terminus8x14b),  BENCH_FONT(Terminus8x14),
+    BENCH_FONT(Terminus8x14v),  BENCH_FONT(Terminus8x16b),  BENCH_FONT(Terminus8x16),   BENCH_FONT(Terminus8x16v),
+    BENCH_FONT(Terminus10x18b), BENCH_FONT(Terminus10x18),  BENCH_FONT(Terminus10x20b), BENCH_FONT(Terminus10x20),
+    BENCH_FONT(Terminus11x22b), BENCH_FONT(Terminus11x22),  BENCH_FONT(Terminus12x24b), BENCH_FONT(Terminus12x24),
+    BENCH_FONT(Terminus14x28b), BENCH_FONT(Terminus14x28),  BENCH_FONT(Terminus16x32b), BENCH_FONT(Terminus16x32),
+    BENCH_FONT(Spleen5x8),      BENCH_FONT(Spleen6x12),     BENCH_FONT(Spleen8x16),     BENCH_FONT(Spleen12x24),
+    BENCH_FONT(Spleen16x32),    BENCH_FONT(Spleen32x64),    BENCH_FONT(Manop6x14),      BENCH_FONT(Manop7x18),
+    BENCH_FONT(Manop8x20),
+};
+
+static ILI9341_HandleTypeDef display;
+
+static double Now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static bool GetBit(const uint8_t* data, uint_fast32_t index) {
+    return data[index / 8] & (0x80 >> (index % 8));
+}
+
+static size_t GlyphCount(ILI9341_FontDef font) {
+    size_t count = 0;
+    for (uint_fast16_t i = 0; i < font.rangeCount; i++) {
+        const ILI9341_FontRangeDef* range = &font.ranges[i];
+        size_t end = range->glyphIndex + (range->endCodepoint - range->startCodepoint) + 1;
+        if (end > count) count = end;
+    }
+    return count;
+}
+
+// Bytes of glyph data as stored in the font
+static size_t StoredBytes(ILI9341_GlyphDef glyph) {
+    uint_fast32_t bits = (uint_fast32_t)glyph.bbW * glyph.bbH;
+    if (glyph.encoding == ILI9341_GLYPH_ENCODING_ROW_REPEAT) {
+        bits = glyph.bbH;
+        for (int row = 0; row < glyph.bbH; row++) {
+            if (!GetBit(glyph.data, row)) bits += glyph.bbW;
+        }
+    }
+    return (bits + 7) / 8;
+}
+
+// Decode the glyph to ILI9341_GLYPH_ENCODING_BITMAP into data, return the bytes of the plain bitmap
+static size_t DecodeGlyph(ILI9341_GlyphDef glyph, uint8_t* data) {
+    size_t bytes = ((uint_fast32_t)glyph.bbW * glyph.bbH + 7) / 8;
+    uint_fast32_t source = glyph.encoding == ILI9341_GLYPH_ENCODING_ROW_REPEAT ? glyph.bbH : 0;
+    uint_fast32_t rowStart = source;
+
+    memset(data, 0, bytes);
+    for (int row = 0; row < glyph.bbH; row++) {
+        bool repeated = glyph.encoding == ILI9341_GLYPH_ENCODING_ROW_REPEAT && GetBit(glyph.data, row);
+        if (repeated) {
+            source = rowStart;
+        } else {
+            rowStart = source;
+        }
+        for (int col = 0; col < glyph.bbW; col++, source++) {
+            uint_fast32_t index = (uint_fast32_t)row * glyph.bbW + col;
+            if (GetBit(glyph.data, source)) data[index / 8] |= 0x80 >> (index % 8);
+        }
+    }
+    return bytes;
+}
+
+// Same font with every glyph decoded to a plain bitmap, the glyphs and bitmaps are allocated in glyphs and bitmaps
+static ILI9341_FontDef DecodeFont(
+    ILI9341_FontDef font,
+    ILI9341_GlyphDef** glyphs,
+    uint8_t** bitmaps,
+    size_t* storedBytes,
+    size_t* rawBytes
+) {
+    size_t count = GlyphCount(font);
+    size_t bitmapBytes = 0;
+    for (size_t i = 0; i < count; i++) {
+        bitmapBytes += ((uint_fast32_t)font.glyphs[i].bbW * font.glyphs[i].bbH + 7) / 8;
+    }
+
+    *glyphs = malloc(count * sizeof(ILI9341_GlyphDef));
+    *bitmaps = malloc(bitmapBytes > 0 ? bitmapBytes : 1);
+    *storedBytes = 0;
+    *rawBytes = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        ILI9341_GlyphDef glyph = font.glyphs[i];
+        uint8_t* data = *bitmaps + *rawBytes;
+
+        *storedBytes += StoredBytes(glyph);
+        *rawBytes += DecodeGlyph(glyph, data);
+
+        ILI9341_GlyphDef decoded = {
+            glyph.bbX, glyph.bbY, glyph.bbW, glyph.bbH, glyph.advance, ILI9341_GLYPH_ENCODING_BITMAP, data
+        };
+        memcpy(&(*glyphs)[i], &decoded, sizeof(decoded));
+    }
+
+    ILI9341_FontDef decoded = {
+        font.ranges, font.rangeCount, font.averageWidth, font.ascent, font.descent, *glyphs, NULL, 0, NULL
+    };
+    return decoded;
+}
+
+static void EncodeUTF8(uint32_t codepoint, char* str) {
+    if (codepoint < 0x80) {
+        *str++ = codepoint;
+    } else if (codepoint < 0x800) {
+        *str++ = 0xC0 | (codepoint >> 6);
+        *str++ = 0x80 | (codepoint & 0x3F);
+    } else {
+        *str++ = 0xE0 | (codepoint >> 12);
+        *str++ = 0x80 | ((codepoint >> 6) & 0x3F);
+        *str++ = 0x80 | (codepoint & 0x3F);
+    }
+    *str = '\0';
+}
+
+static void DrawGlyph(ILI9341_FontDef font, int_fast16_t x, uint32_t codepoint, BenchModeTypeDef mode) {
+    char str[4];
+    EncodeUTF8(codepoint, str);
+    int_fast16_t scale = mode == BENCH_OPAQUE_X2 ? 2 : 1;
+
+    if (mode == BENCH_TRANSPARENT) {
+        ILI9341_WriteStringTransparent(
+            &display,
+            x,
+            font.ascent * scale,
+            str,
+            font,
+            ILI9341_COLOR_WHITE,
+            false,
+            scale,
+            0,
+            0
+        );
+    } else {
+        ILI9341_WriteString(
+            &display,
+            x,
+            font.ascent * scale,
+            str,
+            font,
+            ILI9341_COLOR_WHITE,
+            ILI9341_COLOR_BLUE,
+            false,
+            scale,
+            0,
+            0
+        );
+    }
+}
+
+// Mega pixels of glyph boxes per second
+static double Bench(ILI9341_FontDef font, BenchModeTypeDef mode) {
+    int_fast16_t scale = mode == BENCH_OPAQUE_X2 ? 2 : 1;
+    double fontPixels = 0;
+    for (uint_fast16_t i = 0; i < font.rangeCount; i++) {
+        for (uint32_t c = font.ranges[i].startCodepoint; c <= font.ranges[i].endCodepoint; c++) {
+            ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, c);
+            fontPixels += glyph.bbW * glyph.bbH * scale * scale;
+        }
+    }
+    long iterations = BENCH_PIXELS / fontPixels + 1;
+
+    Panel_CountOnly = true;
+    double start = Now();
+    for (long iteration = 0; iteration < iterations; iteration++) {
+        for (uint_fast16_t i = 0; i < font.rangeCount; i++) {
+            for (uint32_t c = font.ranges[i].startCodepoint; c <= font.ranges[i].endCodepoint; c++) {
+                DrawGlyph(font, BENCH_X, c, mode);
+            }
+        }
+    }
+    double time = Now() - start;
+    Panel_CountOnly = false;
+
+    return fontPixels * iterations / time / 1e6;
+}
+
+// Draw every glyph of both fonts side by side and compare the glyph boxes
+static bool SamePixels(ILI9341_FontDef font, ILI9341_FontDef reference) {
+    for (uint_fast16_t i = 0; i < font.rangeCount; i++) {
+        for (uint32_t c = font.ranges[i].startCodepoint; c <= font.ranges[i].endCodepoint; c++) {
+            ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, c);
+            DrawGlyph(font, BENCH_X, c, BENCH_OPAQUE);
+            DrawGlyph(reference, BENCH_REFERENCE_X, c, BENCH_OPAQUE);
+
+            int top = font.ascent - (glyph.bbY + glyph.bbH) + 1;
+            for (int y = top; y < top + glyph.bbH; y++) {
+                for (int x = glyph.bbX; x < glyph.bbX + glyph.bbW; x++) {
+                    if (Panel_GetPixel(BENCH_X + x, y) != Panel_GetPixel(BENCH_REFERENCE_X + x, y)) return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+int main(void) {
+    Panel_Reset();
+    display = Panel_InitDisplay(ILI9341_ROTATION_VERTICAL_1);
+    size_t totalStored = 0, totalRaw = 0;
+    int failures = 0;
+
+    printf("Glyph data bytes and Mpx/s, plain bitmaps -> as stored\n");
+    printf("%-15s %15s %7s %15s %15s %15s\n", "", "bytes", "saved", "opaque x1", "opaque x2", "transparent x1");
+
+    for (int i = 0; i < (int)(sizeof(fonts) / sizeof(fonts[0])); i++) {
+        ILI9341_GlyphDef* glyphs;
+        uint8_t* bitmaps;
+        size_t storedBytes, rawBytes;
+        ILI9341_FontDef font = *fonts[i].font;
+        ILI9341_FontDef decoded = DecodeFont(font, &glyphs, &bitmaps, &storedBytes, &rawBytes);
+        totalStored += storedBytes;
+        totalRaw += rawBytes;
+
+        printf(
+            "%-15s %6zu -> %5zu %6.1f%%",
+            fonts[i].name,
+            rawBytes,
+            storedBytes,
+            100.0 - 100.0 * storedBytes / rawBytes
+        );
+        for (BenchModeTypeDef mode = BENCH_OPAQUE; mode < BENCH_MODE_COUNT; mode++) {
+            double before = Bench(decoded, mode);
+            double after = Bench(font, mode);
+            printf("  %5.0f -> %5.0f", before, after);
+        }
+        printf("\n");
+
+        if (!SamePixels(font, decoded)) {
+            printf("%-15s draws other pixels than the plain bitmaps\n", fonts[i].name);
+            failures++;
+        }
+
+        free(glyphs);
+        free(bitmaps);
+    }
+
+    printf("%-15s %6zu -> %5zu %6.1f%%\n", "total", totalRaw, totalStored, 100.0 - 100.0 * totalStored / totalRaw);
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,168 @@
+// Throughput of opaque glyph rendering at scale 1, 2 and 4: the bit expansion kernel of the driver against the
+// per-pixel loop it replaced, which computed a bit index, a division and a mask for every destination pixel. The
+// reference loop is kept here and sends its pixels with ILI9341_DrawImage. The SPI bytes are only counted, so the
+// time is spent expanding the glyphs. Both must draw the same pixels.
+
+#include "ili9341_fonts.h"
+#include "panel.h"
+#include "stdio.h"
+#include "string.h"
+#include "time.h"
+
+#define BENCH_FIRST_CHAR 'A'
+#define BENCH_CHAR_COUNT 26
+#define BENCH_MAX_SCALE 4
+#define BENCH_PIXELS 200000000.0
+
+static ILI9341_HandleTypeDef display;
+static uint8_t bitmaps[BENCH_CHAR_COUNT][32 * 64 / 8];
+static ILI9341_GlyphDef glyphs[BENCH_CHAR_COUNT];
+static uint16_t pixels[32 * BENCH_MAX_SCALE * 64 * BENCH_MAX_SCALE];
+
+static double Now(void) {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static bool GetBit(const uint8_t* data, uint_fast32_t index) {
+    return data[index / 8] & (0x80 >> (index % 8));
+}
+
+// Decode the glyphs to ILI9341_GLYPH_ENCODING_BITMAP, the only encoding of the reference loop
+static ILI9341_FontDef DecodeFont(ILI9341_FontDef font) {
+    static const ILI9341_FontRangeDef range = {BENCH_FIRST_CHAR, BENCH_FIRST_CHAR + BENCH_CHAR_COUNT - 1, 0};
+
+    for (int i = 0; i < BENCH_CHAR_COUNT; i++) {
+        ILI9341_GlyphDef glyph = ILI9341_GetGlyph(font, BENCH_FIRST_CHAR + i);
+        uint_fast32_t source = glyph.encoding == ILI9341_GLYPH_ENCODING_ROW_REPEAT ? glyph.bbH : 0;
+        uint_fast32_t rowStart = source;
+
+        memset(bitmaps[i], 0, sizeof(bitmaps[i]));
+        for (int row = 0; row < glyph.bbH; row++) {
+            bool repeated = glyph.encoding == ILI9341_GLYPH_ENCODING_ROW_REPEAT && GetBit(glyph.data, row);
+            if (repeated) {
+                source = rowStart;
+            } else {
+                rowStart = source;
+            }
+            for (int col = 0; col < glyph.bbW; col++, source++) {
+                uint_fast32_t index = (uint_fast32_t)row * glyph.bbW + col;
+                if (GetBit(glyph.data, source)) bitmaps[i][index / 8] |= 0x80 >> (index % 8);
+            }
+        }
+
+        ILI9341_GlyphDef decoded = {
+            glyph.bbX, glyph.bbY, glyph.bbW, glyph.bbH, glyph.advance, ILI9341_GLYPH_ENCODING_BITMAP, bitmaps[i]
+        };
+        memcpy(&glyphs[i], &decoded, sizeof(decoded));
+    }
+
+    ILI9341_FontDef decoded = {&range, 1, font.averageWidth, font.ascent, font.descent, glyphs, NULL, 0, NULL};
+    return decoded;
+}
+
+static void ReferenceGlyph(
+    int_fast16_t x,
+    int_fast16_t y,
+    ILI9341_GlyphDef glyph,
+    uint16_t color,
+    uint16_t bgColor,
+    int_fast16_t scale
+) {
+    color = (color >> 8) | (color << 8);
+    bgColor = (bgColor >> 8) | (bgColor << 8);
+
+    uint16_t* pixel = pixels;
+    for (int_fast16_t row = 0; row < glyph.bbH * scale; row++) {
+        for (int_fast16_t col = 0; col < glyph.bbW * scale; col++) {
+            int_fast32_t bitIndex = row / scale * glyph.bbW + col / scale;
+            uint8_t mask = 0x80 >> (bitIndex % 8);
+            int_fast16_t index = bitIndex / 8;
+
+            *pixel++ = glyph.data[index] & mask ? color : bgColor;
+        }
+    }
+
+    ILI9341_DrawImage(
+        &display,
+        x + glyph.bbX * scale,
+        y - (glyph.bbY + glyph.bbH) * scale + 1,
+        glyph.bbW * scale,
+        glyph.bbH * scale,
+        pixels
+    );
+}
+
+static void DrawGlyph(ILI9341_FontDef font, int i, int_fast16_t scale, bool reference) {
+    if (reference) {
+        ReferenceGlyph(0, font.ascent * scale, glyphs[i], ILI9341_COLOR_WHITE, ILI9341_COLOR_BLUE, scale);
+    } else {
+        char str[] = {BENCH_FIRST_CHAR + i, '\0'};
+        ILI9341_WriteString(
+            &display,
+            0,
+            font.ascent * scale,
+            str,
+            font,
+            ILI9341_COLOR_WHITE,
+            ILI9341_COLOR_BLUE,
+            false,
+            scale,
+            0,
+            0
+        );
+    }
+}
+
+// Mega pixels per second
+static double Bench(ILI9341_FontDef font, int_fast16_t scale, bool reference) {
+    long iterations = BENCH_PIXELS / (glyphs[0].bbW * glyphs[0].bbH * scale * scale * BENCH_CHAR_COUNT);
+    double pixelCount = 0;
+
+    Panel_CountOnly = true;
+    double start = Now();
+    for (long iteration = 0; iteration < iterations; iteration++) {
+        for (int i = 0; i < BENCH_CHAR_COUNT; i++) {
+            DrawGlyph(font, i, scale, reference);
+            pixelCount += glyphs[i].bbW * glyphs[i].bbH * scale * scale;
+        }
+    }
+    double time = Now() - start;
+    Panel_CountOnly = false;
+
+    return pixelCount / time / 1e6;
+}
+
+static bool SamePixels(ILI9341_FontDef font, int_fast16_t scale) {
+    for (int i = 0; i < BENCH_CHAR_COUNT; i++) {
+        ILI9341_FillScreen(&display, ILI9341_COLOR_BLACK);
+        DrawGlyph(font, i, scale, true);
+        uint64_t referenceHash = Panel_GramHash();
+        ILI9341_FillScreen(&display, ILI9341_COLOR_BLACK);
+        DrawGlyph(font, i, scale, false);
+        if (Panel_GramHash() != referenceHash) return false;
+    }
+    return true;
+}
+
+int main(void) {
+    Panel_Reset();
+    display = Panel_InitDisplay(ILI9341_ROTATION_VERTICAL_1);
+    ILI9341_FontDef font = DecodeFont(ILI9341_Font_Spleen32x64);
+    int failures = 0;
+
+    printf("Opaque Spleen32x64 glyphs, per-pixel reference -> driver\n");
+    for (int_fast16_t scale = 1; scale <= BENCH_MAX_SCALE; scale *= 2) {
+        if (!SamePixels(font, scale) || !SamePixels(ILI9341_Font_Spleen32x64, scale)) {
+            printf("scale %ld draws other pixels than the reference\n", (long)scale);
+            failures++;
+        }
+
+        double before = Bench(font, scale, true);
+        double after = Bench(font, scale, false);
+        printf("scale %ld: %6.0f -> %6.0f Mpx/s (x%.1f)\n", (long)scale, before, after, after / before);
+    }
+
+    return failures ? 1 : 0;
+}
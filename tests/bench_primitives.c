@@ -0,0 +1,222 @@
+// SPI bytes of the outline primitives across radii and slopes: the span rasterizers of the driver against the per-pixel
+// rasterizers they replaced, kept here as the reference. Both must draw the same pixels.
+
+#include "panel.h"
+#include "stdio.h"
+#include "stdlib.h"
+
+// One pixel with a full address window, what every pixel cost before the address window cache
+#define BENCH_UNCACHED_PIXEL_BYTES 13
+
+typedef enum { BENCH_CIRCLE, BENCH_ELLIPSE, BENCH_LINE } BenchKindTypeDef;
+
+typedef struct {
+    BenchKindTypeDef kind;
+    int_fast16_t a, b, c, d;
+} BenchPrimitiveTypeDef;
+
+static ILI9341_HandleTypeDef display;
+static unsigned long plotted;
+static int failures = 0;
+
+static void Plot(int_fast16_t x, int_fast16_t y, uint16_t color) {
+    plotted++;
+    ILI9341_DrawPixel(&display, x, y, color);
+}
+
+static void ReferenceCircle(int_fast16_t xc, int_fast16_t yc, int_fast16_t r, uint16_t color) {
+    int_fast16_t f = 1 - r;
+    int_fast16_t dfx = -2 * r;
+    int_fast16_t dfy = 1;
+    int_fast16_t x = r;
+    int_fast16_t y = 0;
+
+    Plot(xc, yc + r, color);
+    Plot(xc, yc - r, color);
+    Plot(xc + r, yc, color);
+    Plot(xc - r, yc, color);
+
+    while (x >= y) {
+        if (f >= 0) {
+            x--;
+            dfx += 2;
+            f += dfx;
+        }
+        y++;
+        dfy += 2;
+        f += dfy;
+
+        Plot(xc + x, yc + y, color);
+        Plot(xc - x, yc + y, color);
+        Plot(xc + x, yc - y, color);
+        Plot(xc - x, yc - y, color);
+        Plot(xc + y, yc + x, color);
+        Plot(xc - y, yc + x, color);
+        Plot(xc + y, yc - x, color);
+        Plot(xc - y, yc - x, color);
+    }
+}
+
+static void ReferenceEllipse(int_fast16_t xc, int_fast16_t yc, int_fast16_t rx, int_fast16_t ry, uint16_t color) {
+    int_fast32_t rx2 = rx * rx;
+    int_fast32_t ry2 = ry * ry;
+    int_fast32_t twoRx2 = 2 * rx2;
+    int_fast32_t twoRy2 = 2 * ry2;
+    int_fast32_t p;
+    int_fast32_t x = 0;
+    int_fast32_t y = ry;
+    int_fast32_t px = 0;
+    int_fast32_t py = twoRx2 * y;
+
+    Plot(xc, yc + ry, color);
+    Plot(xc, yc - ry, color);
+
+    p = ry2 - (rx2 * ry) + (rx2 / 4);
+    while (px < py) {
+        x++;
+        px += twoRy2;
+        if (p < 0) {
+            p += ry2 + px;
+        } else {
+            y--;
+            py -= twoRx2;
+            p += ry2 + px - py;
+        }
+
+        Plot(xc + x, yc + y, color);
+        Plot(xc - x, yc + y, color);
+        Plot(xc + x, yc - y, color);
+        Plot(xc - x, yc - y, color);
+    }
+
+    p = ry2 * (x + 1) * (x + 1) + rx2 * (y - 1) * (y - 1) - rx2 * ry2;
+    while (y > 0) {
+        y--;
+        py -= twoRx2;
+        if (p > 0) {
+            p += rx2 - py;
+        } else {
+            x++;
+            px += twoRy2;
+            p += rx2 - py + px;
+        }
+
+        Plot(xc + x, yc + y, color);
+        Plot(xc - x, yc + y, color);
+        Plot(xc + x, yc - y, color);
+        Plot(xc - x, yc - y, color);
+    }
+}
+
+static void ReferenceLine(int_fast16_t x1, int_fast16_t y1, int_fast16_t x2, int_fast16_t y2, uint16_t color) {
+    int_fast16_t dx = labs(x2 - x1), sx = x1 < x2 ? 1 : -1;
+    int_fast16_t dy = -labs(y2 - y1), sy = y1 < y2 ? 1 : -1;
+    int_fast16_t err = dx + dy, e2;
+
+    while (true) {
+        Plot(x1, y1, color);
+        if (x1 == x2 && y1 == y2) break;
+        e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x1 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y1 += sy;
+        }
+    }
+}
+
+// Bytes sent to draw the primitive on a cleared screen, from the same starting window state
+static unsigned long Draw(BenchPrimitiveTypeDef primitive, bool reference, uint64_t* gramHash) {
+    ILI9341_FillScreen(&display, ILI9341_COLOR_BLACK);
+    unsigned long bytes = Panel_Stats.bytes;
+
+    switch (primitive.kind) {
+        case BENCH_CIRCLE:
+            if (reference) {
+                ReferenceCircle(primitive.a, primitive.b, primitive.c, ILI9341_COLOR_WHITE);
+            } else {
+                ILI9341_DrawCircle(&display, primitive.a, primitive.b, primitive.c, ILI9341_COLOR_WHITE);
+            }
+            break;
+        case BENCH_ELLIPSE:
+            if (reference) {
+                ReferenceEllipse(primitive.a, primitive.b, primitive.c, primitive.d, ILI9341_COLOR_WHITE);
+            } else {
+                ILI9341_DrawEllipse(&display, primitive.a, primitive.b, primitive.c, primitive.d, ILI9341_COLOR_WHITE);
+            }
+            break;
+        case BENCH_LINE:
+            if (reference) {
+                ReferenceLine(primitive.a, primitive.b, primitive.c, primitive.d, ILI9341_COLOR_WHITE);
+            } else {
+                ILI9341_DrawLine(&display, primitive.a, primitive.b, primitive.c, primitive.d, ILI9341_COLOR_WHITE);
+            }
+            break;
+    }
+
+    *gramHash = Panel_GramHash();
+    return Panel_Stats.bytes - bytes;
+}
+
+static void Bench(const char* name, BenchPrimitiveTypeDef primitive) {
+    uint64_t referenceHash, hash;
+    plotted = 0;
+    unsigned long before = Draw(primitive, true, &referenceHash);
+    unsigned long after = Draw(primitive, false, &hash);
+    printf(
+        "%-18s %8lu %6lu -> %5lu bytes (%4.1f%%)\n",
+        name,
+        plotted * BENCH_UNCACHED_PIXEL_BYTES,
+        before,
+        after,
+        100.0 * after / before
+    );
+
+    if (hash != referenceHash) {
+        printf("%-18s draws other pixels than the reference\n", name);
+        failures++;
+    }
+}
+
+int main(void) {
+    Panel_Reset();
+    display = Panel_InitDisplay(ILI9341_ROTATION_HORIZONTAL_1);
+
+    printf("SPI bytes per primitive, per-pixel reference without and with the address window cache -> driver\n");
+    printf("%-18s %8s %6s    %5s\n", "", "no cache", "cache", "spans");
+
+    const int_fast16_t radii[] = {3, 10, 25, 50, 100, 119};
+    for (int i = 0; i < (int)(sizeof(radii) / sizeof(radii[0])); i++) {
+        char name[40];
+        snprintf(name, sizeof(name), "circle r=%ld", (long)radii[i]);
+        Bench(name, (BenchPrimitiveTypeDef){BENCH_CIRCLE, 160, 120, radii[i], 0});
+    }
+
+    const int_fast16_t ellipses[][2] = {{10, 5}, {75, 50}, {150, 100}, {40, 110}, {159, 20}};
+    for (int i = 0; i < (int)(sizeof(ellipses) / sizeof(ellipses[0])); i++) {
+        char name[40];
+        snprintf(name, sizeof(name), "ellipse %ldx%ld", (long)ellipses[i][0], (long)ellipses[i][1]);
+        Bench(name, (BenchPrimitiveTypeDef){BENCH_ELLIPSE, 160, 120, ellipses[i][0], ellipses[i][1]});
+    }
+
+    // Slopes from nearly horizontal to nearly vertical, drawn in both directions
+    const int_fast16_t rises[] = {1, 6, 30, 66, 120, 163, 239};
+    for (int i = 0; i < (int)(sizeof(rises) / sizeof(rises[0])); i++) {
+        char name[40];
+        snprintf(name, sizeof(name), "line 300x%ld", (long)rises[i] + 1);
+        Bench(name, (BenchPrimitiveTypeDef){BENCH_LINE, 10, 0, 309, rises[i]});
+        snprintf(name, sizeof(name), "line 300x%ld rev", (long)rises[i] + 1);
+        Bench(name, (BenchPrimitiveTypeDef){BENCH_LINE, 309, rises[i], 10, 0});
+    }
+    const int_fast16_t runs[] = {1, 20, 80, 160};
+    for (int i = 0; i < (int)(sizeof(runs) / sizeof(runs[0])); i++) {
+        char name[40];
+        snprintf(name, sizeof(name), "line %ldx240", (long)runs[i] + 1);
+        Bench(name, (BenchPrimitiveTypeDef){BENCH_LINE, 100, 0, 100 + runs[i], 239});
+    }
+
+    return failures ? 1 : 0;
+}
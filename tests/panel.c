@@ -0,0 +1,316 @@
+#include "panel.h"
+
+#include "pthread.h"
+#include "semaphore.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "unistd.h"
+
+#define PANEL_CMD_CASET 0x2A
+#define PANEL_CMD_RASET 0x2B
+#define PANEL_CMD_RAMWR 0x2C
+#define PANEL_CMD_VSCRDEF 0x33
+#define PANEL_CMD_MADCTL 0x36
+#define PANEL_CMD_VSCRSAD 0x37
+#define PANEL_CMD_RAMWRC 0x3C
+
+#define PANEL_MADCTL_MY 0x80
+#define PANEL_MADCTL_MX 0x40
+#define PANEL_MADCTL_MV 0x20
+
+GPIO_TypeDef Panel_CsPort = {1}, Panel_DcPort = {2}, Panel_RstPort = {3};
+SPI_HandleTypeDef Panel_Spi = {1, 0};
+
+Panel_StatsTypeDef Panel_Stats;
+uint16_t Panel_Gram[PANEL_HEIGHT][PANEL_WIDTH];
+bool Panel_CountOnly = false;
+
+// Pin levels
+static volatile GPIO_PinState cs = GPIO_PIN_SET;
+static volatile GPIO_PinState dc = GPIO_PIN_RESET;
+
+// Controller state
+static uint8_t command;
+static uint8_t params[8];
+static int paramCount;
+static bool memoryWrite;
+static int highByte;
+static int madctl;
+static int startColumn, endColumn, startPage, endPage, column, page;
+static int topFixedArea, scrollArea, scrollStart;
+
+// DMA transfer in progress
+static uint8_t* dmaData;
+static uint16_t dmaSize;
+
+// DMA controller, a thread that raises the transfer complete interrupt once a transfer is started and not held
+static pthread_t dmaThread;
+static sem_t dmaStarted;
+static ILI9341_HandleTypeDef* dmaDisplay;
+static volatile bool dmaStop;
+static volatile bool dmaHold;
+
+static void Panel_Fail(const char* message) {
+    fprintf(stderr, "panel: %s\n", message);
+    abort();
+}
+
+void Panel_Reset(void) {
+    memset(&Panel_Stats, 0, sizeof(Panel_Stats));
+    memset(Panel_Gram, 0, sizeof(Panel_Gram));
+    Panel_Stats.stream_hash = 1469598103934665603ULL;
+
+    command = 0;
+    paramCount = 0;
+    memoryWrite = false;
+    highByte = -1;
+    madctl = 0;
+    startColumn = column = 0;
+    endColumn = PANEL_WIDTH - 1;
+    startPage = page = 0;
+    endPage = PANEL_HEIGHT - 1;
+    topFixedArea = 0;
+    scrollArea = PANEL_HEIGHT;
+    scrollStart = 0;
+}
+
+ILI9341_HandleTypeDef Panel_InitDisplay(int_fast8_t rotation) {
+    bool horizontal = rotation == ILI9341_ROTATION_HORIZONTAL_1 || rotation == ILI9341_ROTATION_HORIZONTAL_2;
+    return ILI9341_Init(
+        &Panel_Spi,
+        &Panel_CsPort,
+        0,
+        &Panel_DcPort,
+        0,
+        &Panel_RstPort,
+        0,
+        rotation,
+        horizontal ? PANEL_HEIGHT : PANEL_WIDTH,
+        horizontal ? PANEL_WIDTH : PANEL_HEIGHT
+    );
+}
+
+bool Panel_IsSelected(void) {
+    return cs == GPIO_PIN_RESET;
+}
+
+static uint64_t Panel_HashRow(uint64_t hash, const uint16_t* row) {
+    for (int x = 0; x < PANEL_WIDTH; x++) {
+        hash ^= row[x];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint64_t Panel_GramHash(void) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (int y = 0; y < PANEL_HEIGHT; y++) hash = Panel_HashRow(hash, Panel_Gram[y]);
+    return hash;
+}
+
+uint64_t Panel_VisibleHash(void) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (int line = 0; line < PANEL_HEIGHT; line++) {
+        int y = line;
+        if (line >= topFixedArea && line < topFixedArea + scrollArea) {
+            y = topFixedArea + (scrollStart - topFixedArea + line - topFixedArea) % scrollArea;
+        }
+        hash = Panel_HashRow(hash, Panel_Gram[y]);
+    }
+    return hash;
+}
+
+// Map a column and a page of the current memory access order to native coordinates, false if out of the GRAM
+static bool Panel_MapAddress(int c, int p, int* x, int* y) {
+    *x = c;
+    *y = p;
+    if (madctl & PANEL_MADCTL_MV) {
+        *x = p;
+        *y = c;
+    }
+    if (madctl & PANEL_MADCTL_MX) *x = PANEL_WIDTH - 1 - *x;
+    if (madctl & PANEL_MADCTL_MY) *y = PANEL_HEIGHT - 1 - *y;
+    return *x >= 0 && *x < PANEL_WIDTH && *y >= 0 && *y < PANEL_HEIGHT;
+}
+
+uint16_t Panel_GetPixel(int x, int y) {
+    int nativeX, nativeY;
+    return Panel_MapAddress(x, y, &nativeX, &nativeY) ? Panel_Gram[nativeY][nativeX] : 0;
+}
+
+static void Panel_WritePixel(uint16_t color) {
+    int x, y;
+    if (Panel_MapAddress(column, page, &x, &y)) Panel_Gram[y][x] = color;
+
+    if (++column > endColumn) {
+        column = startColumn;
+        if (++page > endPage) page = startPage;
+    }
+}
+
+static void Panel_Command(uint8_t byte) {
+    command = byte;
+    paramCount = 0;
+    memoryWrite = byte == PANEL_CMD_RAMWR || byte == PANEL_CMD_RAMWRC;
+    highByte = -1;
+    if (byte == PANEL_CMD_RAMWR) {
+        column = startColumn;
+        page = startPage;
+    }
+}
+
+static void Panel_Parameter(uint8_t byte) {
+    if (paramCount < (int)sizeof(params)) params[paramCount++] = byte;
+
+    if (command == PANEL_CMD_CASET && paramCount == 4) {
+        startColumn = params[0] << 8 | params[1];
+        endColumn = params[2] << 8 | params[3];
+    } else if (command == PANEL_CMD_RASET && paramCount == 4) {
+        startPage = params[0] << 8 | params[1];
+        endPage = params[2] << 8 | params[3];
+    } else if (command == PANEL_CMD_MADCTL && paramCount == 1) {
+        madctl = params[0];
+    } else if (command == PANEL_CMD_VSCRDEF && paramCount == 6) {
+        topFixedArea = params[0] << 8 | params[1];
+        scrollArea = params[2] << 8 | params[3];
+        if (topFixedArea + scrollArea + (params[4] << 8 | params[5]) != PANEL_HEIGHT) Panel_Fail("invalid VSCRDEF");
+    } else if (command == PANEL_CMD_VSCRSAD && paramCount == 2) {
+        scrollStart = params[0] << 8 | params[1];
+        if (scrollStart < topFixedArea || scrollStart >= topFixedArea + scrollArea) Panel_Fail("invalid VSCRSAD");
+    }
+}
+
+static void Panel_Byte(uint8_t byte) {
+    if (cs != GPIO_PIN_RESET) Panel_Fail("byte sent while CS is high");
+
+    Panel_Stats.bytes++;
+    Panel_Stats.stream_hash = (Panel_Stats.stream_hash ^ (byte | (unsigned)dc << 8)) * 1099511628211ULL;
+    if (dc == GPIO_PIN_RESET) {
+        Panel_Stats.commands++;
+        Panel_Stats.command_count[byte]++;
+    }
+    if (Panel_CountOnly) return;
+
+    if (dc == GPIO_PIN_RESET) {
+        Panel_Command(byte);
+    } else if (!memoryWrite) {
+        Panel_Parameter(byte);
+    } else if (highByte < 0) {
+        highByte = byte;
+    } else {
+        Panel_WritePixel((uint16_t)(highByte << 8 | byte));
+        highByte = -1;
+    }
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+    (void)GPIO_Pin;
+    if (GPIOx != &Panel_CsPort && GPIOx != &Panel_DcPort) return;
+
+    if (__atomic_load_n(&Panel_Spi.busy, __ATOMIC_ACQUIRE)) {
+        Panel_Fail(GPIOx == &Panel_CsPort ? "CS changed during a DMA transfer" : "DC changed during a DMA transfer");
+    }
+
+    if (GPIOx == &Panel_CsPort) {
+        if (PinState == GPIO_PIN_SET && cs == GPIO_PIN_RESET) {
+            Panel_Stats.deselects++;
+            if (Stub_InInterrupt()) Panel_Stats.interrupt_deselects++;
+        }
+        cs = PinState;
+    } else {
+        dc = PinState;
+    }
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin) {
+    (void)GPIO_Pin;
+    if (GPIOx == &Panel_CsPort) return cs;
+    return GPIO_PIN_SET;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size, uint32_t Timeout) {
+    (void)Timeout;
+    if (hspi != &Panel_Spi) return HAL_ERROR;
+    if (__atomic_load_n(&hspi->busy, __ATOMIC_ACQUIRE)) Panel_Fail("blocking transmit during a DMA transfer");
+
+    if (dc == GPIO_PIN_SET) Panel_Stats.data_transfers++;
+    if (Panel_CountOnly && dc == GPIO_PIN_SET) {
+        Panel_Stats.bytes += Size;
+        return HAL_OK;
+    }
+    for (uint16_t i = 0; i < Size; i++) Panel_Byte(pData[i]);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(
+    SPI_HandleTypeDef* hspi,
+    uint8_t* pTxData,
+    uint8_t* pRxData,
+    uint16_t Size,
+    uint32_t Timeout
+) {
+    (void)hspi;
+    (void)pTxData;
+    (void)Timeout;
+    memset(pRxData, 0, Size);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size) {
+    if (hspi != &Panel_Spi) return HAL_ERROR;
+    if (__atomic_load_n(&hspi->busy, __ATOMIC_ACQUIRE)) Panel_Fail("DMA transfer started during a DMA transfer");
+    if (dmaDisplay == NULL) Panel_Fail("DMA transfer started without Panel_StartDma");
+
+    Panel_Stats.data_transfers++;
+    Panel_Stats.dma_transfers++;
+    dmaData = pData;
+    dmaSize = Size;
+    __atomic_store_n(&hspi->busy, 1, __ATOMIC_RELEASE);
+    sem_post(&dmaStarted);
+    return HAL_OK;
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef* hspi) {
+    return __atomic_load_n(&hspi->busy, __ATOMIC_ACQUIRE) ? HAL_SPI_STATE_BUSY_TX : HAL_SPI_STATE_READY;
+}
+
+static void Panel_DmaInterrupt(void) {
+    for (uint16_t i = 0; i < dmaSize; i++) Panel_Byte(dmaData[i]);
+    __atomic_store_n(&Panel_Spi.busy, 0, __ATOMIC_RELEASE);
+    ILI9341_SPI_TxCpltCallback(dmaDisplay, &Panel_Spi);
+}
+
+static void* Panel_DmaThread(void* arg) {
+    (void)arg;
+    for (;;) {
+        sem_wait(&dmaStarted);
+        if (dmaStop) break;
+        while (dmaHold) usleep(100);
+        Stub_RaiseInterrupt();
+    }
+    return NULL;
+}
+
+void Panel_StartDma(ILI9341_HandleTypeDef* ili9341) {
+    dmaDisplay = ili9341;
+    dmaStop = false;
+    dmaHold = false;
+    sem_init(&dmaStarted, 0, 0);
+    Stub_SetInterruptHandler(Panel_DmaInterrupt);
+    if (pthread_create(&dmaThread, NULL, Panel_DmaThread, NULL) != 0) Panel_Fail("cannot start the DMA thread");
+}
+
+void Panel_StopDma(void) {
+    if (__atomic_load_n(&Panel_Spi.busy, __ATOMIC_ACQUIRE)) Panel_Fail("DMA stopped during a transfer");
+    dmaStop = true;
+    sem_post(&dmaStarted);
+    pthread_join(dmaThread, NULL);
+    sem_destroy(&dmaStarted);
+    Stub_SetInterruptHandler(NULL);
+    dmaDisplay = NULL;
+}
+
+void Panel_HoldDma(bool hold) {
+    dmaHold = hold;
+}
@@ -0,0 +1,97 @@
+#ifndef __PANEL_H__
+#define __PANEL_H__
+
+// Host simulator of the ILI9341 controller: interprets the command stream sent through the HAL stub into a GRAM image
+// and checks the bus protocol. Any violation prints a message and aborts the test.
+
+#include "ili9341.h"
+#include "stdbool.h"
+#include "stdint.h"
+
+#define PANEL_WIDTH 240
+#define PANEL_HEIGHT 320
+
+/**
+ * @brief Bus statistics, cleared by Panel_Reset
+ */
+typedef struct {
+    /** Bytes sent to the panel */
+    unsigned long bytes;
+    /** Command bytes, in total and for each command */
+    unsigned long commands;
+    unsigned long command_count[256];
+    /** Data transfers, blocking and DMA */
+    unsigned long data_transfers;
+    unsigned long dma_transfers;
+    /** Times the panel was deselected, in total and from the transfer complete interrupt */
+    unsigned long deselects;
+    unsigned long interrupt_deselects;
+    /** Hash of the bytes and of the DC level they were sent with */
+    uint64_t stream_hash;
+} Panel_StatsTypeDef;
+
+extern GPIO_TypeDef Panel_CsPort, Panel_DcPort, Panel_RstPort;
+extern SPI_HandleTypeDef Panel_Spi;
+
+extern Panel_StatsTypeDef Panel_Stats;
+extern uint16_t Panel_Gram[PANEL_HEIGHT][PANEL_WIDTH];
+/** Only count the data bytes instead of interpreting them and hashing them, for benchmarks */
+extern bool Panel_CountOnly;
+
+/**
+ * @brief Reset the controller state, the GRAM and the statistics
+ */
+void Panel_Reset(void);
+
+/**
+ * @brief Initialize a display on the simulated panel
+ * @param rotation Rotation of the display
+ * @return Initialized ILI9341_HandleTypeDef structure
+ */
+ILI9341_HandleTypeDef Panel_InitDisplay(int_fast8_t rotation);
+
+/**
+ * @brief Check if the panel is selected
+ * @return true if CS is low
+ */
+bool Panel_IsSelected(void);
+
+/**
+ * @brief Read a pixel of the GRAM
+ * @param x X coordinate in the orientation set by the last ILI9341_SetOrientation
+ * @param y Y coordinate in the orientation set by the last ILI9341_SetOrientation
+ * @return Color of the pixel, 0 if out of the GRAM
+ */
+uint16_t Panel_GetPixel(int x, int y);
+
+/**
+ * @brief Hash the GRAM
+ * @return Hash of the GRAM in native orientation
+ */
+uint64_t Panel_GramHash(void);
+
+/**
+ * @brief Hash the GRAM as shown, after the vertical scrolling
+ * @return Hash of the visible image in native orientation
+ */
+uint64_t Panel_VisibleHash(void);
+
+/**
+ * @brief Start a thread that completes DMA transfers from a simulated interrupt and calls ILI9341_SPI_TxCpltCallback
+ * @param ili9341 Pointer to ILI9341 handle structure of the display on Panel_Spi
+ * @note The interrupt runs on the calling thread, which must be the thread that draws
+ */
+void Panel_StartDma(ILI9341_HandleTypeDef* ili9341);
+
+/**
+ * @brief Stop the thread started by Panel_StartDma, the current transfer must be completed
+ */
+void Panel_StopDma(void);
+
+/**
+ * @brief Hold DMA transfers, they are completed once released
+ * @param hold true to hold the transfers, false to release them
+ */
+void Panel_HoldDma(bool hold);
+
+#endif  // __PANEL_H__
@@ -0,0 +1,105 @@
+#include "scene.h"
+
+#include "ili9341_fonts.h"
+
+#define SCENE_IMAGE_WIDTH 40
+#define SCENE_IMAGE_HEIGHT 30
+
+void Scene_Draw(ILI9341_HandleTypeDef* ili9341) {
+    static uint16_t image[SCENE_IMAGE_WIDTH * SCENE_IMAGE_HEIGHT];
+    for (int i = 0; i < SCENE_IMAGE_WIDTH * SCENE_IMAGE_HEIGHT; i++) image[i] = (uint16_t)(i * 37);
+
+    ILI9341_FillScreen(ili9341, ILI9341_COLOR_WHITE);
+    ILI9341_FillRectangle(ili9341, -10, 20, 50, 30, ILI9341_COLOR_RED);
+    ILI9341_DrawPixel(ili9341, 5, 5, ILI9341_COLOR_BLUE);
+
+    for (int i = 0; i < 8; i++) ILI9341_DrawLine(ili9341, 10, 200, 10 + i * 40, 60 + i * 7, ILI9341_COLOR_BLACK);
+    ILI9341_DrawLine(ili9341, 300, 10, 20, 230, ILI9341_COLOR_GREEN);
+    ILI9341_DrawLineThick(ili9341, 30, 30, 200, 100, ILI9341_COLOR_CYAN, 5, true);
+
+    ILI9341_DrawRectangle(ili9341, 100, 100, 50, 40, ILI9341_COLOR_MAGENTA);
+    ILI9341_DrawRectangleThick(ili9341, 110, 110, 30, 20, ILI9341_COLOR_BLUE, 3);
+
+    for (int r = 3; r < 120; r += 17) ILI9341_DrawCircle(ili9341, 160, 120, r, ILI9341_COLOR_RED);
+    ILI9341_DrawCircle(ili9341, 5, 5, 30, ILI9341_COLOR_RED);
+    ILI9341_DrawCircleThick(ili9341, 250, 60, 40, ILI9341_COLOR_BLACK, 6);
+    ILI9341_FillCircle(ili9341, 60, 180, 25, ILI9341_COLOR_YELLOW);
+
+    ILI9341_DrawEllipse(ili9341, 200, 180, 60, 30, ILI9341_COLOR_BLUE);
+    ILI9341_DrawEllipse(ili9341, 200, 180, 10, 50, ILI9341_COLOR_BLUE);
+    ILI9341_DrawEllipseThick(ili9341, 100, 60, 40, 20, ILI9341_COLOR_GREEN, 4);
+    ILI9341_FillEllipse(ili9341, 280, 200, 30, 15, ILI9341_COLOR_RED);
+
+    int16_t xs[] = {10, 80, 60, 20}, ys[] = {10, 20, 90, 70};
+    ILI9341_DrawPolygon(ili9341, xs, ys, 4, ILI9341_COLOR_BLACK);
+    ILI9341_FillPolygon(ili9341, xs, ys, 4, ILI9341_COLOR_CYAN);
+    ILI9341_DrawPolygonThick(ili9341, xs, ys, 4, ILI9341_COLOR_RED, 3, false);
+
+    ILI9341_DrawImage(ili9341, 250, 5, SCENE_IMAGE_WIDTH, SCENE_IMAGE_HEIGHT, image);
+    ILI9341_DrawImage(ili9341, 300, 220, SCENE_IMAGE_WIDTH, SCENE_IMAGE_HEIGHT, image);
+    ILI9341_DrawImage(ili9341, -5, -7, SCENE_IMAGE_WIDTH, SCENE_IMAGE_HEIGHT, image);
+
+    ILI9341_WriteString(
+        ili9341,
+        5,
+        15,
+        "Hello, World! 0123456789",
+        ILI9341_Font_Terminus8x16,
+        ILI9341_COLOR_BLACK,
+        ILI9341_COLOR_WHITE,
+        false,
+        1,
+        0,
+        0
+    );
+    ILI9341_WriteString(
+        ili9341,
+        5,
+        60,
+        "Wrap me around the screen please ok",
+        ILI9341_Font_Spleen12x24,
+        ILI9341_COLOR_RED,
+        ILI9341_COLOR_BLUE,
+        true,
+        2,
+        1,
+        2
+    );
+    ILI9341_WriteString(
+        ili9341,
+        -3,
+        239,
+        "Clip",
+        ILI9341_Font_Terminus16x32b,
+        ILI9341_COLOR_GREEN,
+        ILI9341_COLOR_BLACK,
+        false,
+        1,
+        0,
+        0
+    );
+    ILI9341_WriteStringTransparent(
+        ili9341,
+        5,
+        120,
+        "Transparent text!",
+        ILI9341_Font_Manop8x20,
+        ILI9341_COLOR_BLACK,
+        false,
+        2,
+        -1,
+        0
+    );
+    ILI9341_WriteStringTransparent(
+        ili9341,
+        5,
+        200,
+        "ABC",
+        ILI9341_Font_Terminus8x16,
+        ILI9341_COLOR_BLACK,
+        true,
+        1,
+        0,
+        0
+    );
+}
@@ -0,0 +1,12 @@
+#ifndef __SCENE_H__
+#define __SCENE_H__
+
+#include "ili9341.h"
+
+/**
+ * @brief Draw a scene using every kind of primitive, with clipped shapes, images and text
+ * @param ili9341 Pointer to ILI9341 handle structure, in a horizontal or vertical orientation
+ */
+void Scene_Draw(ILI9341_HandleTypeDef* ili9341);
+
+#endif  // __SCENE_H__
@@ -0,0 +1,70 @@
+#include "stm32f7xx_hal.h"
+
+#include "pthread.h"
+#include "signal.h"
+
+#define STUB_INTERRUPT_SIGNAL SIGUSR1
+
+static pthread_t interruptThread;
+static void (*interruptHandler)(void) = NULL;
+static volatile sig_atomic_t inInterrupt = 0;
+static volatile uint32_t primask = 0;
+
+void (*Stub_TickHook)(void) = NULL;
+volatile uint32_t Stub_Tick = 0;
+volatile uint32_t Stub_ExtiPending = 0;
+
+static void Stub_SignalHandler(int signal) {
+    (void)signal;
+    inInterrupt = 1;
+    if (interruptHandler) interruptHandler();
+    inInterrupt = 0;
+}
+
+static void Stub_MaskInterrupt(bool masked) {
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, STUB_INTERRUPT_SIGNAL);
+    pthread_sigmask(masked ? SIG_BLOCK : SIG_UNBLOCK, &set, NULL);
+}
+
+uint32_t __get_PRIMASK(void) {
+    return primask;
+}
+
+void __set_PRIMASK(uint32_t priMask) {
+    primask = priMask;
+    if (!inInterrupt) Stub_MaskInterrupt(priMask != 0);
+}
+
+void __disable_irq(void) {
+    __set_PRIMASK(1);
+}
+
+void Stub_SetInterruptHandler(void (*handler)(void)) {
+    struct sigaction action = {0};
+    action.sa_handler = Stub_SignalHandler;
+    action.sa_flags = SA_RESTART;
+    sigemptyset(&action.sa_mask);
+
+    interruptThread = pthread_self();
+    interruptHandler = handler;
+    sigaction(STUB_INTERRUPT_SIGNAL, &action, NULL);
+}
+
+void Stub_RaiseInterrupt(void) {
+    pthread_kill(interruptThread, STUB_INTERRUPT_SIGNAL);
+}
+
+bool Stub_InInterrupt(void) {
+    return inInterrupt;
+}
+
+void HAL_Delay(uint32_t Delay) {
+    Stub_Tick += Delay;
+}
+
+uint32_t HAL_GetTick(void) {
+    if (Stub_TickHook) Stub_TickHook();
+    return Stub_Tick;
+}
@@ -0,0 +1,90 @@
+#ifndef __STM32F7XX_HAL_H__
+#define __STM32F7XX_HAL_H__
+
+// Host stub of the STM32 HAL functions used by the driver. The GPIO and SPI functions are implemented by the simulator
+// linked with each test (panel.c or xpt2046.c), interrupts and time by stm32f7xx_hal.c.
+
+#include "stdbool.h"
+#include "stddef.h"
+#include "stdint.h"
+
+typedef enum { HAL_OK = 0x00, HAL_ERROR = 0x01, HAL_BUSY = 0x02, HAL_TIMEOUT = 0x03 } HAL_StatusTypeDef;
+
+typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
+
+typedef struct {
+    /** Identifies the pin for the simulator */
+    int id;
+} GPIO_TypeDef;
+
+typedef enum {
+    HAL_SPI_STATE_RESET = 0x00,
+    HAL_SPI_STATE_READY = 0x01,
+    HAL_SPI_STATE_BUSY = 0x02,
+    HAL_SPI_STATE_BUSY_TX = 0x03
+} HAL_SPI_StateTypeDef;
+
+typedef struct {
+    /** Identifies the bus for the simulator */
+    int id;
+    /** Set while a DMA transfer is in progress, cleared by the simulator when it is completed */
+    volatile int busy;
+} SPI_HandleTypeDef;
+
+#define HAL_MAX_DELAY 0xFFFFFFFFU
+
+#define __DMB() __sync_synchronize()
+
+/**
+ * Interrupts are simulated with a signal delivered to the thread that set the handler, so the handler preempts that
+ * thread as on the target. Masking interrupts blocks the signal until the mask is restored.
+ */
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t priMask);
+void __disable_irq(void);
+
+/**
+ * @brief Set the interrupt handler, it runs on the calling thread
+ * @param handler Function called for every Stub_RaiseInterrupt, NULL to remove it
+ */
+void Stub_SetInterruptHandler(void (*handler)(void));
+
+/**
+ * @brief Run the interrupt handler, from any thread, once interrupts are not masked
+ */
+void Stub_RaiseInterrupt(void);
+
+/**
+ * @brief Check if the caller is the interrupt handler
+ * @return true if called from the interrupt handler
+ */
+bool Stub_InInterrupt(void);
+
+/** Function called by HAL_GetTick before returning the tick, to change the simulated inputs over time */
+extern void (*Stub_TickHook)(void);
+/** Simulated time in milliseconds, advanced by HAL_Delay */
+extern volatile uint32_t Stub_Tick;
+
+/** EXTI lines with a pending interrupt, set by the simulators and cleared with __HAL_GPIO_EXTI_CLEAR_IT */
+extern volatile uint32_t Stub_ExtiPending;
+
+#define __HAL_GPIO_EXTI_CLEAR_IT(__EXTI_LINE__) (Stub_ExtiPending &= ~(uint32_t)(__EXTI_LINE__))
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState);
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin);
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size, uint32_t Timeout);
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(
+    SPI_HandleTypeDef* hspi,
+    uint8_t* pTxData,
+    uint8_t* pRxData,
+    uint16_t Size,
+    uint32_t Timeout
+);
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size);
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef* hspi);
+
+void HAL_Delay(uint32_t Delay);
+uint32_t HAL_GetTick(void);
+
+#endif  // __STM32F7XX_HAL_H__
@@ -0,0 +1,46 @@
+#ifndef __TEST_H__
+#define __TEST_H__
+
+// Minimal assertions for the host tests, a failed check is reported and the test carries on
+
+#include "stdio.h"
+
+static int test_failures = 0;
+
+#define TEST_ASSERT(condition)                                                            \
+    do {                                                                                  \
+        if (!(condition)) {                                                               \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            test_failures++;                                                              \
+        }                                                                                 \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL(expected, actual)                                \
+    do {                                                                   \
+        unsigned long long expectedValue = (unsigned long long)(expected); \
+        unsigned long long actualValue = (unsigned long long)(actual);     \
+        if (expectedValue != actualValue) {                                \
+            fprintf(                                                       \
+                stderr,                                                    \
+                "%s:%d: %s is %llu, expected %llu\n",                      \
+                __FILE__,                                                  \
+                __LINE__,                                                  \
+                #actual,                                                   \
+                actualValue,                                               \
+                expectedValue                                              \
+            );                                                             \
+            test_failures++;                                               \
+        }                                                                  \
+    } while (0)
+
+/**
+ * @brief Report the result of a test, return from main
+ * @param name Name of the test
+ * @return Exit status of the test
+ */
+static inline int Test_Result(const char* name) {
+    printf("%s: %s\n", name, test_failures ? "FAILED" : "OK");
+    return test_failures ? 1 : 0;
+}
+
+#endif  // __TEST_H__
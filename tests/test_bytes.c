@@ -0,0 +1,147 @@
+// Address window cache: CASET and RASET are only sent when the column or row range changes, and a pixel drawn where
+// the GRAM pointer already is continues the memory write with RAMWRC. The byte counts of the primitives are locked
+// here, a change to them must be deliberate.
+
+#include "panel.h"
+#include "stdio.h"
+#include "test.h"
+
+// CASET or RASET with its 4 parameter bytes
+#define TEST_RANGE_BYTES 5
+// RAMWR or RAMWRC
+#define TEST_WRITE_BYTES 1
+// One pixel with a full address window, what every pixel cost without the cache
+#define TEST_UNCACHED_PIXEL_BYTES (2 * TEST_RANGE_BYTES + TEST_WRITE_BYTES + 2)
+
+static ILI9341_HandleTypeDef display;
+static unsigned long mark;
+
+// Bytes sent since the last call
+static unsigned long Measure(void) {
+    unsigned long bytes = Panel_Stats.bytes - mark;
+    mark = Panel_Stats.bytes;
+    return bytes;
+}
+
+static unsigned long CountPixels(uint16_t color) {
+    unsigned long count = 0;
+    for (int y = 0; y < PANEL_HEIGHT; y++) {
+        for (int x = 0; x < PANEL_WIDTH; x++) count += Panel_Gram[y][x] == color;
+    }
+    return count;
+}
+
+static void Clear(void) {
+    ILI9341_FillScreen(&display, ILI9341_COLOR_BLACK);
+    Measure();
+}
+
+static void TestPixels(void) {
+    Clear();
+    unsigned long continues = Panel_Stats.command_count[0x3C];
+
+    // The fill left the window on the whole screen with the pointer wrapped, so the window is programmed again
+    ILI9341_DrawPixel(&display, 10, 10, ILI9341_COLOR_RED);
+    TEST_ASSERT_EQUAL(2 * TEST_RANGE_BYTES + TEST_WRITE_BYTES + 2, Measure());
+
+    // The pointer is on the right of the previous pixel, continue the memory write
+    for (int x = 11; x < 20; x++) {
+        ILI9341_DrawPixel(&display, x, 10, ILI9341_COLOR_RED);
+        TEST_ASSERT_EQUAL(TEST_WRITE_BYTES + 2, Measure());
+    }
+    TEST_ASSERT_EQUAL(continues + 9, Panel_Stats.command_count[0x3C]);
+
+    // Same columns, next row: only RASET
+    ILI9341_DrawPixel(&display, 10, 11, ILI9341_COLOR_RED);
+    TEST_ASSERT_EQUAL(TEST_RANGE_BYTES + TEST_WRITE_BYTES + 2, Measure());
+
+    // Same row, other columns: only CASET
+    ILI9341_DrawPixel(&display, 30, 11, ILI9341_COLOR_RED);
+    TEST_ASSERT_EQUAL(TEST_RANGE_BYTES + TEST_WRITE_BYTES + 2, Measure());
+
+    // Going back to the left restarts the memory write in the same window
+    ILI9341_DrawPixel(&display, 30, 11, ILI9341_COLOR_GREEN);
+    TEST_ASSERT_EQUAL(TEST_WRITE_BYTES + 2, Measure());
+    TEST_ASSERT_EQUAL(continues + 9, Panel_Stats.command_count[0x3C]);
+
+    TEST_ASSERT_EQUAL(ILI9341_COLOR_RED, Panel_GetPixel(19, 10));
+    TEST_ASSERT_EQUAL(ILI9341_COLOR_GREEN, Panel_GetPixel(30, 11));
+    TEST_ASSERT_EQUAL(11, CountPixels(ILI9341_COLOR_RED));
+
+    // A command that changes the memory access order drops the cached window
+    ILI9341_SetOrientation(&display, ILI9341_ROTATION_VERTICAL_1);
+    Measure();
+    ILI9341_DrawPixel(&display, 31, 11, ILI9341_COLOR_RED);
+    TEST_ASSERT_EQUAL(2 * TEST_RANGE_BYTES + TEST_WRITE_BYTES + 2, Measure());
+    ILI9341_SetOrientation(&display, ILI9341_ROTATION_HORIZONTAL_1);
+}
+
+static void TestSpans(void) {
+    Clear();
+
+    ILI9341_FillRectangle(&display, 0, 0, 10, 5, ILI9341_COLOR_RED);
+    TEST_ASSERT_EQUAL(2 * TEST_RANGE_BYTES + TEST_WRITE_BYTES + 10 * 5 * 2, Measure());
+
+    // Same window
+    ILI9341_FillRectangle(&display, 0, 0, 10, 5, ILI9341_COLOR_GREEN);
+    TEST_ASSERT_EQUAL(TEST_WRITE_BYTES + 10 * 5 * 2, Measure());
+
+    // Horizontal and vertical lines are single spans
+    ILI9341_DrawLine(&display, 5, 50, 104, 50, ILI9341_COLOR_RED);
+    TEST_ASSERT_EQUAL(2 * TEST_RANGE_BYTES + TEST_WRITE_BYTES + 100 * 2, Measure());
+    ILI9341_DrawLine(&display, 5, 60, 104, 60, ILI9341_COLOR_RED);
+    TEST_ASSERT_EQUAL(TEST_RANGE_BYTES + TEST_WRITE_BYTES + 100 * 2, Measure());
+    ILI9341_DrawLine(&display, 200, 10, 200, 109, ILI9341_COLOR_RED);
+    TEST_ASSERT_EQUAL(2 * TEST_RANGE_BYTES + TEST_WRITE_BYTES + 100 * 2, Measure());
+    TEST_ASSERT_EQUAL(300, CountPixels(ILI9341_COLOR_RED));
+}
+
+static void TestPrimitive(const char* name, unsigned long expectedBytes) {
+    unsigned long bytes = Measure();
+    unsigned long pixels = CountPixels(ILI9341_COLOR_RED);
+    printf(
+        "%-22s %5lu pixels, %6lu bytes (%5.2f per pixel, %lu without the cache)\n",
+        name,
+        pixels,
+        bytes,
+        (double)bytes / pixels,
+        pixels * TEST_UNCACHED_PIXEL_BYTES
+    );
+    TEST_ASSERT_EQUAL(expectedBytes, bytes);
+    TEST_ASSERT(bytes < pixels * TEST_UNCACHED_PIXEL_BYTES);
+    Clear();
+}
+
+static void TestPrimitives(void) {
+    Clear();
+
+    ILI9341_DrawCircle(&display, 160, 120, 10, ILI9341_COLOR_RED);
+    TestPrimitive("circle r=10", 484);
+    ILI9341_DrawCircle(&display, 160, 120, 50, ILI9341_COLOR_RED);
+    TestPrimitive("circle r=50", 1680);
+    ILI9341_DrawCircle(&display, 160, 120, 100, ILI9341_COLOR_RED);
+    TestPrimitive("circle r=100", 3260);
+    ILI9341_DrawEllipse(&display, 160, 120, 75, 50, ILI9341_COLOR_RED);
+    TestPrimitive("ellipse 75x50", 1952);
+    ILI9341_DrawEllipse(&display, 160, 120, 150, 100, ILI9341_COLOR_RED);
+    TestPrimitive("ellipse 150x100", 3862);
+    ILI9341_DrawLine(&display, 10, 10, 309, 15, ILI9341_COLOR_RED);
+    TestPrimitive("line 300x6", 666);
+    ILI9341_DrawLine(&display, 10, 10, 309, 75, ILI9341_COLOR_RED);
+    TestPrimitive("line 300x66", 1326);
+    ILI9341_DrawLine(&display, 10, 10, 309, 172, ILI9341_COLOR_RED);
+    TestPrimitive("line 300x163", 2393);
+    ILI9341_DrawLine(&display, 10, 10, 172, 229, ILI9341_COLOR_RED);
+    TestPrimitive("line 163x220", 2233);
+}
+
+int main(void) {
+    Panel_Reset();
+    display = Panel_InitDisplay(ILI9341_ROTATION_HORIZONTAL_1);
+
+    TestPixels();
+    TestSpans();
+    TestPrimitives();
+
+    return Test_Result("test_bytes");
+}
@@ -0,0 +1,128 @@
+// DMA transport: the bytes, their DC level and the resulting image must match the blocking transport, CS and DC must
+// not change while a transfer is running, and the display must be deselected by the transfer complete interrupt.
+
+#include "panel.h"
+#include "pthread.h"
+#include "scene.h"
+#include "test.h"
+#include "unistd.h"
+
+#define TEST_BUFFER_POOL_SIZE 1024
+
+typedef struct {
+    uint64_t stream_hash;
+    unsigned long bytes;
+    uint64_t gram_hash;
+} TestResultTypeDef;
+
+static ILI9341_HandleTypeDef display;
+static uint16_t bufferPool[TEST_BUFFER_POOL_SIZE];
+static volatile unsigned long completions;
+
+static void TransferComplete(ILI9341_HandleTypeDef* ili9341) {
+    TEST_ASSERT(ili9341 == &display);
+    completions++;
+}
+
+static TestResultTypeDef DrawScenes(void) {
+    Scene_Draw(&display);
+    ILI9341_SetOrientation(&display, ILI9341_ROTATION_VERTICAL_2);
+    Scene_Draw(&display);
+    ILI9341_WaitForTransfer(&display);
+
+    TestResultTypeDef result = {Panel_Stats.stream_hash, Panel_Stats.bytes, Panel_GramHash()};
+    return result;
+}
+
+static TestResultTypeDef DrawScenesBlocking(void) {
+    Panel_Reset();
+    display = Panel_InitDisplay(ILI9341_ROTATION_HORIZONTAL_1);
+    TestResultTypeDef result = DrawScenes();
+    TEST_ASSERT(!Panel_IsSelected());
+    return result;
+}
+
+static TestResultTypeDef DrawScenesDma(bool bufferPoolEnabled) {
+    Panel_Reset();
+    display = Panel_InitDisplay(ILI9341_ROTATION_HORIZONTAL_1);
+    Panel_StartDma(&display);
+    if (bufferPoolEnabled) ILI9341_SetBufferPool(&display, bufferPool, TEST_BUFFER_POOL_SIZE);
+    ILI9341_SetTransport(&display, ILI9341_TRANSPORT_DMA, TransferComplete);
+
+    completions = 0;
+    TestResultTypeDef result = DrawScenes();
+    TEST_ASSERT(Panel_Stats.dma_transfers > 0);
+    TEST_ASSERT(completions > 0 && completions <= Panel_Stats.dma_transfers);
+    TEST_ASSERT(!Panel_IsSelected());
+
+    Panel_StopDma();
+    return result;
+}
+
+static void* ReleaseDmaLater(void* arg) {
+    (void)arg;
+    usleep(50000);
+    Panel_HoldDma(false);
+    return NULL;
+}
+
+static void TestDeferredDeselect(void) {
+    Panel_Reset();
+    display = Panel_InitDisplay(ILI9341_ROTATION_VERTICAL_1);
+    Panel_StartDma(&display);
+    ILI9341_SetBufferPool(&display, bufferPool, TEST_BUFFER_POOL_SIZE);
+    ILI9341_SetTransport(&display, ILI9341_TRANSPORT_DMA, TransferComplete);
+    completions = 0;
+    unsigned long deselects = Panel_Stats.deselects;
+
+    // The fill fits in one DMA transfer, so it returns while the transfer is running with the deselect deferred to
+    // the transfer complete interrupt
+    Panel_HoldDma(true);
+    ILI9341_FillRectangle(&display, 10, 10, 10, 10, ILI9341_COLOR_RED);
+    TEST_ASSERT(ILI9341_IsBusy(&display));
+    TEST_ASSERT(Panel_IsSelected());
+    TEST_ASSERT_EQUAL(0, completions);
+
+    Panel_HoldDma(false);
+    ILI9341_WaitForTransfer(&display);
+    TEST_ASSERT(!Panel_IsSelected());
+    TEST_ASSERT_EQUAL(1, completions);
+    TEST_ASSERT_EQUAL(deselects + 1, Panel_Stats.deselects);
+    TEST_ASSERT_EQUAL(1, Panel_Stats.interrupt_deselects);
+
+    // A drawing function called during the transfer cancels the pending deselect, so the display stays selected
+    // between the two fills and is only deselected once, after the second fill
+    Panel_HoldDma(true);
+    ILI9341_FillRectangle(&display, 30, 10, 10, 10, ILI9341_COLOR_GREEN);
+    pthread_t releaseThread;
+    pthread_create(&releaseThread, NULL, ReleaseDmaLater, NULL);
+    ILI9341_FillRectangle(&display, 50, 10, 10, 10, ILI9341_COLOR_BLUE);
+    pthread_join(releaseThread, NULL);
+    ILI9341_WaitForTransfer(&display);
+    TEST_ASSERT(!Panel_IsSelected());
+    TEST_ASSERT_EQUAL(3, completions);
+    TEST_ASSERT_EQUAL(deselects + 2, Panel_Stats.deselects);
+
+    TEST_ASSERT_EQUAL(ILI9341_COLOR_RED, Panel_GetPixel(10, 10));
+    TEST_ASSERT_EQUAL(ILI9341_COLOR_GREEN, Panel_GetPixel(39, 19));
+    TEST_ASSERT_EQUAL(ILI9341_COLOR_BLUE, Panel_GetPixel(55, 15));
+
+    Panel_StopDma();
+}
+
+int main(void) {
+    TestResultTypeDef blocking = DrawScenesBlocking();
+    TestResultTypeDef dma = DrawScenesDma(false);
+    TestResultTypeDef dmaBufferPool = DrawScenesDma(true);
+
+    TEST_ASSERT_EQUAL(blocking.bytes, dma.bytes);
+    TEST_ASSERT_EQUAL(blocking.stream_hash, dma.stream_hash);
+    TEST_ASSERT_EQUAL(blocking.gram_hash, dma.gram_hash);
+    TEST_ASSERT_EQUAL(blocking.bytes, dmaBufferPool.bytes);
+    TEST_ASSERT_EQUAL(blocking.stream_hash, dmaBufferPool.stream_hash);
+    TEST_ASSERT_EQUAL(blocking.gram_hash, dmaBufferPool.gram_hash);
+
+    TestDeferredDeselect();
+
+    return Test_Result("test_dma");
+}
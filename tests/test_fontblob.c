@@ -0,0 +1,225 @@
+// Font blobs: a bundled font written to a blob in the layout of ili9341_fontblob.h must keep its metrics, including
+// average widths that do not fit in 8 bits, and draw the same pixels as the compiled font, mapped and streamed. A
+// blob cut short or with ranges past its glyphs must be rejected, and a glyph with data past the end of the blob or
+// shorter than its bitmap must be drawn empty.
+
+#include "ili9341_fontblob.h"
+#include "ili9341_fonts.h"
+#include "panel.h"
+#include "string.h"
+#include "test.h"
+
+#define TEST_MAX_BLOB_SIZE 16384
+#define TEST_CACHE_SIZE 4096
+
+static ILI9341_HandleTypeDef display;
+static uint8_t blob[TEST_MAX_BLOB_SIZE];
+static size_t blobSize;
+static uint8_t cache[TEST_CACHE_SIZE];
+
+static void PutU16(uint8_t* bytes, uint_fast16_t value) {
+    bytes[0] = value;
+    bytes[1] = value >> 8;
+}
+
+static void PutU32(uint8_t* bytes, uint32_t value) {
+    PutU16(&bytes[0], value);
+    PutU16(&bytes[2], value >> 16);
+}
+
+// Bytes of the glyph data, see ILI9341_GlyphEncodingTypeDef
+static size_t GlyphDataSize(ILI9341_GlyphDef glyph) {
+    uint_fast32_t bits = (uint_fast32_t)glyph.bbW * glyph.bbH;
+    if (glyph.encoding == ILI9341_GLYPH_ENCODING_ROW_REPEAT) {
+        bits = glyph.bbH;
+        for (int row = 0; row < glyph.bbH; row++) {
+            if (!(glyph.data[row / 8] & (0x80 >> (row % 8)))) bits += glyph.bbW;
+        }
+    }
+    return (bits + 7) / 8;
+}
+
+// Write a compiled font to blob, as export_font.py does with BLOB enabled
+static void WriteBlob(ILI9341_FontDef font) {
+    size_t glyphCount = 0;
+    for (uint_fast16_t i = 0; i < font.rangeCount; i++) {
+        size_t end = font.ranges[i].glyphIndex + (font.ranges[i].endCodepoint - font.ranges[i].startCodepoint) + 1;
+        if (end > glyphCount) glyphCount = end;
+    }
+
+    uint32_t rangesOffset = ILI9341_FONT_BLOB_HEADER_SIZE;
+    uint32_t glyphsOffset = rangesOffset + font.rangeCount * ILI9341_FONT_BLOB_RANGE_SIZE;
+    uint32_t kerningOffset = glyphsOffset + glyphCount * ILI9341_FONT_BLOB_GLYPH_SIZE;
+    uint32_t dataOffset = kerningOffset + font.kerningCount * ILI9341_FONT_BLOB_KERNING_PAIR_SIZE;
+
+    memset(blob, 0, sizeof(blob));
+    memcpy(blob, "ILIF", 4);
+    blob[4] = ILI9341_FONT_BLOB_VERSION;
+    blob[5] = font.ascent;
+    blob[6] = font.descent;
+    PutU16(&blob[8], font.averageWidth);
+    PutU16(&blob[10], font.rangeCount);
+    PutU16(&blob[12], glyphCount);
+    PutU16(&blob[14], font.kerningCount);
+    PutU32(&blob[20], rangesOffset);
+    PutU32(&blob[24], glyphsOffset);
+    PutU32(&blob[28], kerningOffset);
+
+    for (uint_fast16_t i = 0; i < font.rangeCount; i++) {
+        uint8_t* range = &blob[rangesOffset + i * ILI9341_FONT_BLOB_RANGE_SIZE];
+        PutU32(&range[0], font.ranges[i].startCodepoint);
+        PutU32(&range[4], font.ranges[i].endCodepoint);
+        PutU16(&range[8], font.ranges[i].glyphIndex);
+    }
+
+    for (uint_fast16_t i = 0; i < font.kerningCount; i++) {
+        uint8_t* pair = &blob[kerningOffset + i * ILI9341_FONT_BLOB_KERNING_PAIR_SIZE];
+        PutU16(&pair[0], font.kerning[i].left);
+        PutU16(&pair[2], font.kerning[i].right);
+        pair[4] = font.kerning[i].offset;
+    }
+
+    size_t largest = 0;
+    blobSize = dataOffset;
+    for (size_t i = 0; i < glyphCount; i++) {
+        ILI9341_GlyphDef glyph = font.glyphs[i];
+        uint8_t* entry = &blob[glyphsOffset + i * ILI9341_FONT_BLOB_GLYPH_SIZE];
+        size_t size = GlyphDataSize(glyph);
+
+        entry[0] = glyph.bbX;
+        entry[1] = glyph.bbY;
+        entry[2] = glyph.bbW;
+        entry[3] = glyph.bbH;
+        entry[4] = glyph.advance;
+        entry[5] = glyph.encoding;
+        PutU16(&entry[6], size);
+        PutU32(&entry[8], blobSize);
+
+        TEST_ASSERT(blobSize + size <= sizeof(blob));
+        if (blobSize + size > sizeof(blob)) return;
+        memcpy(&blob[blobSize], glyph.data, size);
+        blobSize += size;
+        if (size > largest) largest = size;
+    }
+    PutU16(&blob[16], largest);
+}
+
+static bool ReadBlob(void* context, uint32_t offset, void* buffer, size_t length) {
+    (void)context;
+    if (offset + length > blobSize) return false;
+    memcpy(buffer, &blob[offset], length);
+    return true;
+}
+
+static uint64_t Draw(ILI9341_FontDef font) {
+    const char* str = "AVAToL.\nWave 12:34";
+
+    ILI9341_FillScreen(&display, ILI9341_COLOR_BLACK);
+    ILI9341_WriteString(
+        &display,
+        4,
+        font.ascent,
+        str,
+        font,
+        ILI9341_COLOR_WHITE,
+        ILI9341_COLOR_BLUE,
+        true,
+        1,
+        1,
+        0
+    );
+    ILI9341_WriteStringLine(
+        &display,
+        4,
+        display.height - font.descent - 1,
+        "Tp",
+        SIZE_MAX,
+        font,
+        ILI9341_COLOR_RED,
+        ILI9341_COLOR_BLACK,
+        1,
+        0
+    );
+    return Panel_GramHash();
+}
+
+static void TestFont(ILI9341_FontDef font) {
+    WriteBlob(font);
+    uint64_t reference = Draw(font);
+
+    ILI9341_FontBlob_HandleTypeDef mapped = ILI9341_FontBlob_InitMapped(blob, blobSize);
+    ILI9341_FontBlob_HandleTypeDef streamed = ILI9341_FontBlob_InitStream(ReadBlob, NULL, cache, sizeof(cache));
+    TEST_ASSERT(mapped.valid);
+    TEST_ASSERT(streamed.valid);
+
+    ILI9341_FontBlob_HandleTypeDef* blobs[] = {&mapped, &streamed};
+    for (int i = 0; i < 2; i++) {
+        ILI9341_FontDef blobFont = ILI9341_FontBlob_GetFont(blobs[i]);
+        TEST_ASSERT_EQUAL(font.averageWidth, blobFont.averageWidth);
+        TEST_ASSERT_EQUAL(font.ascent, blobFont.ascent);
+        TEST_ASSERT_EQUAL(font.descent, blobFont.descent);
+        TEST_ASSERT_EQUAL(font.kerningCount, blobFont.kerningCount);
+        TEST_ASSERT_EQUAL(reference, Draw(blobFont));
+    }
+}
+
+// Glyph of a blob font through its loader, as the text functions get it
+static ILI9341_GlyphDef LoadGlyph(ILI9341_FontDef font, uint_fast16_t index) {
+    return font.loader->load_glyph(font.loader->context, index);
+}
+
+static void TestCorrupt(void) {
+    ILI9341_FontDef font = ILI9341_Font_Terminus8x14b;
+    WriteBlob(font);
+    uint32_t glyphsOffset = ILI9341_FONT_BLOB_HEADER_SIZE + font.rangeCount * ILI9341_FONT_BLOB_RANGE_SIZE;
+    size_t fullSize = blobSize;
+
+    // Cut inside the glyph table
+    TEST_ASSERT(!ILI9341_FontBlob_InitMapped(blob, glyphsOffset + ILI9341_FONT_BLOB_GLYPH_SIZE).valid);
+    TEST_ASSERT(!ILI9341_FontBlob_InitMapped(blob, ILI9341_FONT_BLOB_HEADER_SIZE - 1).valid);
+
+    // Cut inside the glyph data, the glyphs past the end are empty and keep their advance
+    uint_fast16_t index = 'A' - font.ranges[0].startCodepoint + font.ranges[0].glyphIndex;
+    uint8_t* entry = &blob[glyphsOffset + index * ILI9341_FONT_BLOB_GLYPH_SIZE];
+    uint32_t dataOffset = entry[8] | (entry[9] << 8) | ((uint32_t)entry[10] << 16) | ((uint32_t)entry[11] << 24);
+    ILI9341_FontBlob_HandleTypeDef mapped = ILI9341_FontBlob_InitMapped(blob, dataOffset);
+    TEST_ASSERT(mapped.valid);
+    ILI9341_GlyphDef glyph = LoadGlyph(ILI9341_FontBlob_GetFont(&mapped), index);
+    TEST_ASSERT(glyph.data == NULL && glyph.bbW == 0);
+    TEST_ASSERT_EQUAL(font.glyphs[index].advance, glyph.advance);
+
+    // Glyph data shorter than the bitmap, mapped and streamed
+    mapped = ILI9341_FontBlob_InitMapped(blob, fullSize);
+    ILI9341_FontBlob_HandleTypeDef streamed = ILI9341_FontBlob_InitStream(ReadBlob, NULL, cache, sizeof(cache));
+    TEST_ASSERT(LoadGlyph(ILI9341_FontBlob_GetFont(&mapped), index).data != NULL);
+    PutU16(&entry[6], 1);
+    TEST_ASSERT(LoadGlyph(ILI9341_FontBlob_GetFont(&mapped), index).data == NULL);
+    TEST_ASSERT(LoadGlyph(ILI9341_FontBlob_GetFont(&streamed), index).data == NULL);
+
+    // A range with more codepoints than glyphs from its first one
+    uint_fast16_t glyphCount = blob[12] | (blob[13] << 8);
+    PutU16(&blob[ILI9341_FONT_BLOB_HEADER_SIZE + 8], glyphCount - 1);
+    TEST_ASSERT(!ILI9341_FontBlob_InitMapped(blob, fullSize).valid);
+    TEST_ASSERT(!ILI9341_FontBlob_InitStream(ReadBlob, NULL, cache, sizeof(cache)).valid);
+}
+
+int main(void) {
+    Panel_Reset();
+    display = Panel_InitDisplay(ILI9341_ROTATION_VERTICAL_1);
+
+    // Average width 320, more than an 8-bit field holds
+    TestFont(ILI9341_Font_Spleen32x64);
+    TestFont(ILI9341_Font_Terminus8x14b);
+
+    // Kerned, with pairs on both sides of the ranges
+    static const ILI9341_KerningPairDef pairs[] = {{'A', 'V', -2}, {'L', 'T', 3}, {'T', 'o', -1}, {'V', 'A', -2}};
+    ILI9341_FontDef font = ILI9341_Font_Terminus12x24;
+    ILI9341_FontDef kerned = {
+        font.ranges, font.rangeCount, font.averageWidth, font.ascent, font.descent, font.glyphs, pairs, 4, NULL
+    };
+    TestFont(kerned);
+
+    TestCorrupt();
+
+    return Test_Result("test_fontblob");
+}
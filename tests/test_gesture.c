@@ -0,0 +1,158 @@
+// Gesture recognizer: timestamped touch events are fed to the state machine, and exactly the expected gesture events
+// must come out, in order. Covers a release or a press lost by the touch sampler, the double tap window counted from
+// the release of the first tap, a long press that turns into a drag and the swipe velocity of a drag after a pause.
+
+#include "ili9341_gesture.h"
+#include "test.h"
+
+static ILI9341_Gesture_HandleTypeDef gesture;
+
+static void Feed(ILI9341_Touch_EventKindTypeDef kind, uint16_t x, uint16_t y, uint32_t timestamp) {
+    ILI9341_Touch_EventTypeDef event = {.kind = kind, .x = x, .y = y, .timestamp = timestamp};
+    ILI9341_Gesture_Process(&gesture, &event);
+}
+
+// The next queued event must be this one, velocities included
+static void Expect(ILI9341_Gesture_EventTypeDef expected) {
+    ILI9341_Gesture_EventTypeDef event;
+    TEST_ASSERT(ILI9341_Gesture_GetEvent(&gesture, &event));
+
+    TEST_ASSERT_EQUAL(expected.kind, event.kind);
+    TEST_ASSERT_EQUAL(expected.x, event.x);
+    TEST_ASSERT_EQUAL(expected.y, event.y);
+    TEST_ASSERT_EQUAL(expected.start_x, event.start_x);
+    TEST_ASSERT_EQUAL(expected.start_y, event.start_y);
+    TEST_ASSERT_EQUAL(expected.velocity_x, event.velocity_x);
+    TEST_ASSERT_EQUAL(expected.velocity_y, event.velocity_y);
+    TEST_ASSERT_EQUAL(expected.direction, event.direction);
+    TEST_ASSERT_EQUAL(expected.timestamp, event.timestamp);
+}
+
+static void ExpectNone(void) {
+    ILI9341_Gesture_EventTypeDef event;
+    TEST_ASSERT(!ILI9341_Gesture_GetEvent(&gesture, &event));
+}
+
+// A press while dragging ends the drag where it was last seen, at the time of the press and without velocity
+static void TestLostRelease(void) {
+    gesture = ILI9341_Gesture_Init();
+
+    Feed(ILI9341_TOUCH_EVENT_PRESS, 100, 100, 0);
+    Feed(ILI9341_TOUCH_EVENT_MOVE, 150, 100, 50);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_START, 150, 100, 100, 100, 1000, 0, 0, 50});
+
+    Feed(ILI9341_TOUCH_EVENT_PRESS, 20, 20, 1000);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_END, 150, 100, 100, 100, 0, 0, 0, 1000});
+    ExpectNone();
+
+    Feed(ILI9341_TOUCH_EVENT_RELEASE, 20, 20, 1100);
+    ILI9341_Gesture_Update(&gesture, 1400);
+    ExpectNone();
+    ILI9341_Gesture_Update(&gesture, 1401);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_TAP, 20, 20, 20, 20, 0, 0, 0, 1100});
+    ExpectNone();
+}
+
+// A move while idle starts the touch there
+static void TestLostPress(void) {
+    gesture = ILI9341_Gesture_Init();
+
+    Feed(ILI9341_TOUCH_EVENT_MOVE, 50, 60, 0);
+    Feed(ILI9341_TOUCH_EVENT_RELEASE, 50, 60, 100);
+    ILI9341_Gesture_Update(&gesture, 401);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_TAP, 50, 60, 50, 60, 0, 0, 0, 100});
+    ExpectNone();
+
+    Feed(ILI9341_TOUCH_EVENT_MOVE, 50, 60, 1000);
+    Feed(ILI9341_TOUCH_EVENT_MOVE, 50, 120, 1050);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_START, 50, 120, 50, 60, 0, 1200, 0, 1050});
+    Feed(ILI9341_TOUCH_EVENT_RELEASE, 50, 120, 1300);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_END, 50, 120, 50, 60, 0, 0, 0, 1300});
+    ExpectNone();
+}
+
+// The second tap must come within double_tap_time of the release of the first one, not of its press
+static void TestDoubleTapWindow(void) {
+    gesture = ILI9341_Gesture_Init();
+
+    Feed(ILI9341_TOUCH_EVENT_PRESS, 100, 100, 0);
+    Feed(ILI9341_TOUCH_EVENT_RELEASE, 100, 100, 250);
+    Feed(ILI9341_TOUCH_EVENT_PRESS, 105, 100, 550);
+    ExpectNone();
+    Feed(ILI9341_TOUCH_EVENT_RELEASE, 105, 100, 600);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DOUBLE_TAP, 105, 100, 100, 100, 0, 0, 0, 600});
+    ILI9341_Gesture_Update(&gesture, 2000);
+    ExpectNone();
+
+    // One millisecond later the first tap is reported alone, and the second press starts a new tap
+    Feed(ILI9341_TOUCH_EVENT_PRESS, 100, 100, 3000);
+    Feed(ILI9341_TOUCH_EVENT_RELEASE, 100, 100, 3250);
+    Feed(ILI9341_TOUCH_EVENT_PRESS, 105, 100, 3551);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_TAP, 100, 100, 100, 100, 0, 0, 0, 3250});
+    Feed(ILI9341_TOUCH_EVENT_RELEASE, 105, 100, 3600);
+    ExpectNone();
+    ILI9341_Gesture_Update(&gesture, 3901);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_TAP, 105, 100, 105, 100, 0, 0, 0, 3600});
+    ExpectNone();
+}
+
+// A long press is reported while still touched, and a move past tap_slop afterwards is still a drag
+static void TestLongPressDrag(void) {
+    gesture = ILI9341_Gesture_Init();
+
+    Feed(ILI9341_TOUCH_EVENT_PRESS, 100, 100, 0);
+    ILI9341_Gesture_Update(&gesture, 599);
+    ExpectNone();
+    ILI9341_Gesture_Update(&gesture, 600);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_LONG_PRESS, 100, 100, 100, 100, 0, 0, 0, 600});
+
+    Feed(ILI9341_TOUCH_EVENT_MOVE, 105, 100, 700);
+    ExpectNone();
+
+    // The velocity only looks back velocity_time, not to the press 750 ms earlier
+    Feed(ILI9341_TOUCH_EVENT_MOVE, 130, 100, 750);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_START, 130, 100, 100, 100, 500, 0, 0, 750});
+    Feed(ILI9341_TOUCH_EVENT_RELEASE, 130, 100, 760);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_END, 130, 100, 100, 100, 500, 0, 0, 760});
+    ExpectNone();
+}
+
+// A drag held still before its release is not a swipe, and a flick after a pause is measured over the flick only
+static void TestSwipeAfterPause(void) {
+    gesture = ILI9341_Gesture_Init();
+
+    Feed(ILI9341_TOUCH_EVENT_PRESS, 20, 100, 0);
+    Feed(ILI9341_TOUCH_EVENT_MOVE, 80, 100, 50);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_START, 80, 100, 20, 100, 1200, 0, 0, 50});
+    Feed(ILI9341_TOUCH_EVENT_RELEASE, 80, 100, 500);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_END, 80, 100, 20, 100, 0, 0, 0, 500});
+    ExpectNone();
+
+    Feed(ILI9341_TOUCH_EVENT_PRESS, 20, 100, 1000);
+    Feed(ILI9341_TOUCH_EVENT_MOVE, 40, 100, 1050);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_START, 40, 100, 20, 100, 400, 0, 0, 1050});
+    Feed(ILI9341_TOUCH_EVENT_MOVE, 100, 100, 2050);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_MOVE, 100, 100, 20, 100, 60, 0, 0, 2050});
+    Feed(ILI9341_TOUCH_EVENT_MOVE, 140, 100, 2080);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_MOVE, 140, 100, 20, 100, 1333, 0, 0, 2080});
+    Feed(ILI9341_TOUCH_EVENT_RELEASE, 140, 100, 2090);
+    Expect((ILI9341_Gesture_EventTypeDef){ILI9341_GESTURE_DRAG_END, 140, 100, 20, 100, 1333, 0, 0, 2090});
+    Expect(
+        (ILI9341_Gesture_EventTypeDef){
+            ILI9341_GESTURE_SWIPE, 140, 100, 20, 100, 1333, 0, ILI9341_GESTURE_DIRECTION_RIGHT, 2090
+        }
+    );
+    ExpectNone();
+}
+
+int main(void) {
+    TestLostRelease();
+    TestLostPress();
+    TestDoubleTapWindow();
+    TestLongPressDrag();
+    TestSwipeAfterPause();
+
+    TEST_ASSERT_EQUAL(0, gesture.dropped_events);
+
+    return Test_Result("test_gesture");
+}
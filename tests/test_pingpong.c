@@ -0,0 +1,114 @@
+// Buffer pool: staging pixel data through pools of any size, with the blocking transport or as ping-pong buffers with
+// the DMA transport, must send the same bytes and draw the same image as the stack buffers with the blocking transport.
+
+#include "ili9341_fonts.h"
+#include "panel.h"
+#include "scene.h"
+#include "stdio.h"
+#include "test.h"
+
+#define TEST_MAX_BUFFER_POOL_SIZE 2048
+
+typedef struct {
+    uint64_t stream_hash;
+    unsigned long bytes;
+    unsigned long data_transfers;
+    uint64_t gram_hash;
+} TestResultTypeDef;
+
+static ILI9341_HandleTypeDef display;
+static uint16_t bufferPool[TEST_MAX_BUFFER_POOL_SIZE];
+
+// Text heavy screen: glyphs of every size and scale, clipped on every side, over fills and clipped images
+static void DrawDashboard(void) {
+    static uint16_t image[64 * 48];
+    for (int i = 0; i < 64 * 48; i++) image[i] = (uint16_t)(i * 2654435761u >> 16);
+
+    ILI9341_FillScreen(&display, ILI9341_COLOR_BLACK);
+    ILI9341_FillRectangle(&display, 0, 0, display.width, 40, ILI9341_COLOR_BLUE);
+    ILI9341_DrawImage(&display, -20, 50, 64, 48, image);
+    ILI9341_DrawImage(&display, display.width - 40, display.height - 30, 64, 48, image);
+
+    const ILI9341_FontDef* fonts[] = {
+        &ILI9341_Font_Spleen5x8,
+        &ILI9341_Font_Terminus8x16,
+        &ILI9341_Font_Manop8x20,
+        &ILI9341_Font_Terminus12x24b,
+        &ILI9341_Font_Spleen32x64,
+    };
+    for (int i = 0; i < (int)(sizeof(fonts) / sizeof(fonts[0])); i++) {
+        for (int scale = 1; scale <= 3; scale++) {
+            ILI9341_WriteString(
+                &display,
+                -7 + i * 13,
+                -5 + i * 41 + scale * 9,
+                "Temp 23.5C | Humidity 41% | 12:34:56",
+                *fonts[i],
+                (uint16_t)(0x1234 * (i + scale)),
+                ILI9341_COLOR_WHITE,
+                scale == 2,
+                scale,
+                1,
+                0
+            );
+        }
+    }
+    ILI9341_FillRectangle(&display, -30, display.height - 20, display.width + 60, 50, ILI9341_COLOR_GREEN);
+}
+
+static TestResultTypeDef Draw(size_t bufferPoolSize, bool dma) {
+    Panel_Reset();
+    display = Panel_InitDisplay(ILI9341_ROTATION_HORIZONTAL_1);
+    if (dma) Panel_StartDma(&display);
+    if (bufferPoolSize > 0) ILI9341_SetBufferPool(&display, bufferPool, bufferPoolSize);
+    if (dma) ILI9341_SetTransport(&display, ILI9341_TRANSPORT_DMA, NULL);
+
+    DrawDashboard();
+    Scene_Draw(&display);
+    ILI9341_SetOrientation(&display, ILI9341_ROTATION_VERTICAL_1);
+    DrawDashboard();
+    ILI9341_WaitForTransfer(&display);
+    if (dma) Panel_StopDma();
+
+    TestResultTypeDef result = {
+        Panel_Stats.stream_hash,
+        Panel_Stats.bytes,
+        Panel_Stats.data_transfers,
+        Panel_GramHash(),
+    };
+    return result;
+}
+
+int main(void) {
+    TestResultTypeDef reference = Draw(0, false);
+    printf(
+        "stack buffers, blocking:        %lu bytes in %lu data transfers\n",
+        reference.bytes,
+        reference.data_transfers
+    );
+
+    // Pools smaller and larger than the stack buffers, and odd sizes so ping-pong halves and chunks end mid-row
+    const size_t bufferPoolSizes[] = {2, 33, 256, 999, 1024, TEST_MAX_BUFFER_POOL_SIZE};
+    for (int i = 0; i < (int)(sizeof(bufferPoolSizes) / sizeof(bufferPoolSizes[0])); i++) {
+        for (int dma = 0; dma <= 1; dma++) {
+            TestResultTypeDef result = Draw(bufferPoolSizes[i], dma);
+            printf(
+                "pool of %4zu pixels, %-9s %lu bytes in %lu data transfers\n",
+                bufferPoolSizes[i],
+                dma ? "DMA:" : "blocking:",
+                result.bytes,
+                result.data_transfers
+            );
+            TEST_ASSERT_EQUAL(reference.bytes, result.bytes);
+            TEST_ASSERT_EQUAL(reference.stream_hash, result.stream_hash);
+            TEST_ASSERT_EQUAL(reference.gram_hash, result.gram_hash);
+        }
+    }
+
+    TestResultTypeDef dmaStackBuffers = Draw(0, true);
+    TEST_ASSERT_EQUAL(reference.bytes, dmaStackBuffers.bytes);
+    TEST_ASSERT_EQUAL(reference.stream_hash, dmaStackBuffers.stream_hash);
+    TEST_ASSERT_EQUAL(reference.gram_hash, dmaStackBuffers.gram_hash);
+
+    return Test_Result("test_pingpong");
+}
@@ -0,0 +1,150 @@
+// Text measurement: the bounds and layouts of ili9341_text must follow the line breaks of ILI9341_WriteString, where
+// '\n' and "\r\n" start a new line and a lone '\r' moves the pen back to the start of the same line. The glyph cache
+// must draw glyphs that share their data as they are drawn without it.
+
+#include "ili9341_fonts.h"
+#include "ili9341_text.h"
+#include "panel.h"
+#include "test.h"
+
+#define TEST_MAX_LINES 8
+
+static ILI9341_HandleTypeDef display;
+
+// Bounding box of the pixels that are not black, x0 > x1 if there are none
+static ILI9341_RectTypeDef DrawnBounds(void) {
+    ILI9341_RectTypeDef bounds = {display.width, display.height, -1, -1};
+    for (int y = 0; y < display.height; y++) {
+        for (int x = 0; x < display.width; x++) {
+            if (Panel_GetPixel(x, y) == ILI9341_COLOR_BLACK) continue;
+            if (x < bounds.x0) bounds.x0 = x;
+            if (y < bounds.y0) bounds.y0 = y;
+            if (x > bounds.x1) bounds.x1 = x;
+            if (y > bounds.y1) bounds.y1 = y;
+        }
+    }
+    return bounds;
+}
+
+// The glyph boxes are filled with the background, so the drawn pixels cover exactly the bounds of the glyphs
+static void TestBounds(const char* str, ILI9341_FontDef font, int_fast16_t scale, int_fast16_t tracking) {
+    ILI9341_FillScreen(&display, ILI9341_COLOR_BLACK);
+    ILI9341_WriteString(
+        &display,
+        20,
+        40,
+        str,
+        font,
+        ILI9341_COLOR_WHITE,
+        ILI9341_COLOR_BLUE,
+        false,
+        scale,
+        tracking,
+        3
+    );
+
+    ILI9341_RectTypeDef drawn = DrawnBounds();
+    ILI9341_RectTypeDef bounds = ILI9341_Text_GetBounds(20, 40, str, font, scale, tracking, 3);
+    TEST_ASSERT_EQUAL(drawn.x0, bounds.x0);
+    TEST_ASSERT_EQUAL(drawn.y0, bounds.y0);
+    TEST_ASSERT_EQUAL(drawn.x1, bounds.x1);
+    TEST_ASSERT_EQUAL(drawn.y1, bounds.y1);
+}
+
+static void TestLayout(void) {
+    ILI9341_FontDef font = ILI9341_Font_Terminus8x16;
+    ILI9341_Text_LineTypeDef lines[TEST_MAX_LINES];
+    int_fast16_t advance = ILI9341_GetGlyph(font, 'a').advance;
+
+    // The carriage return stays in the first line, "\r\n" and "\n" each end a line
+    ILI9341_Text_LayoutTypeDef layout =
+        ILI9341_Text_Layout("Hello\rab\r\nxyz\n", font, 1, 0, 0, 0, lines, TEST_MAX_LINES);
+    TEST_ASSERT_EQUAL(3, layout.line_count);
+    TEST_ASSERT_EQUAL(0, lines[0].start);
+    TEST_ASSERT_EQUAL(8, lines[0].length);
+    TEST_ASSERT_EQUAL(5 * advance, lines[0].width);
+    TEST_ASSERT_EQUAL(10, lines[1].start);
+    TEST_ASSERT_EQUAL(3, lines[1].length);
+    TEST_ASSERT_EQUAL(0, lines[2].length);
+    TEST_ASSERT_EQUAL(5 * advance, layout.width);
+
+    // The part after the carriage return is the wider one
+    TEST_ASSERT_EQUAL(6 * advance, ILI9341_Text_GetWidth("ab\rHello!\nabcdefgh", font, 1, 0));
+    TEST_ASSERT_EQUAL(2 * advance, ILI9341_Text_GetWidth("ab\r\nHello!", font, 1, 0));
+
+    // Drawn as two line boxes at the same pen start, the second part covers the first one
+    ILI9341_FillScreen(&display, ILI9341_COLOR_BLACK);
+    ILI9341_Text_LayoutTypeDef overprint =
+        ILI9341_Text_Layout("Hello\r   ", font, 1, 0, 0, 0, lines, TEST_MAX_LINES);
+    TEST_ASSERT_EQUAL(1, overprint.line_count);
+    ILI9341_Text_Draw(
+        &display,
+        &overprint,
+        20,
+        40,
+        0,
+        0,
+        ILI9341_TEXT_ALIGN_LEFT,
+        ILI9341_TEXT_VALIGN_BASELINE,
+        ILI9341_COLOR_WHITE,
+        ILI9341_COLOR_BLUE
+    );
+    ILI9341_RectTypeDef drawn = DrawnBounds();
+    TEST_ASSERT_EQUAL(20, drawn.x0);
+    TEST_ASSERT_EQUAL(20 + 5 * advance - 1, drawn.x1);
+    for (int y = drawn.y0; y <= drawn.y1; y++) {
+        for (int x = 20; x < 20 + 3 * advance; x++) TEST_ASSERT(Panel_GetPixel(x, y) == ILI9341_COLOR_BLUE);
+    }
+}
+
+// Two glyphs of a hand-built font pointing at the same array, with different sizes and encodings
+static void TestSharedGlyphData(void) {
+    static const uint8_t data[] = {0xF0, 0x0F, 0xAA, 0x55};
+    static const ILI9341_GlyphDef glyphs[] = {
+        {0, 0, 8, 2, 9, ILI9341_GLYPH_ENCODING_BITMAP, data},
+        {0, 0, 4, 4, 5, ILI9341_GLYPH_ENCODING_BITMAP, data},
+        {0, 0, 4, 4, 5, ILI9341_GLYPH_ENCODING_COVERAGE_2BPP, data},
+    };
+    static const ILI9341_FontRangeDef ranges[] = {{'A', 'C', 0}};
+    ILI9341_FontDef font = {ranges, 1, 60, 4, 0, glyphs, NULL, 0, NULL};
+
+    static ILI9341_GlyphCacheEntryTypeDef entries[4];
+    static uint16_t pixels[4 * 64];
+    ILI9341_GlyphCacheTypeDef cache = ILI9341_GlyphCache_Init(entries, 4, pixels, 4 * 64);
+
+    uint64_t hashes[2];
+    for (int cached = 0; cached < 2; cached++) {
+        ILI9341_SetGlyphCache(&display, cached ? &cache : NULL);
+        ILI9341_FillScreen(&display, ILI9341_COLOR_BLACK);
+        ILI9341_WriteString(&display, 4, 10, "ABCA", font, ILI9341_COLOR_WHITE, ILI9341_COLOR_BLUE, false, 1, 0, 0);
+        hashes[cached] = Panel_GramHash();
+    }
+    ILI9341_SetGlyphCache(&display, NULL);
+
+    TEST_ASSERT_EQUAL(hashes[0], hashes[1]);
+    TEST_ASSERT_EQUAL(3, cache.misses);
+    TEST_ASSERT_EQUAL(1, cache.hits);
+}
+
+int main(void) {
+    Panel_Reset();
+    display = Panel_InitDisplay(ILI9341_ROTATION_HORIZONTAL_1);
+
+    const char* strings[] = {
+        "Hello",
+        "Hello\nWorld",
+        "Hello\r\nWorld",
+        "Hello\rab",
+        "ab\rHello",
+        "Wide line\rx\r\nTwo\rThree\n\nj",
+    };
+    for (int i = 0; i < (int)(sizeof(strings) / sizeof(strings[0])); i++) {
+        TestBounds(strings[i], ILI9341_Font_Terminus8x16, 1, 0);
+        TestBounds(strings[i], ILI9341_Font_Spleen12x24, 2, 1);
+    }
+
+    TestLayout();
+    TestSharedGlyphData();
+
+    return Test_Result("test_text");
+}
@@ -0,0 +1,264 @@
+// Touch filter: replays the traces of traces/ through the default filter, the trimmed mean of 6 conversions per axis
+// it replaced and the 16 averaged conversions per axis of the old driver. The default filter must take at most 6
+// conversions per reading, jitter and stray no more than the old average, never drop a reading of a touch it reported
+// and report a new touch after no more conversions than the old driver. The traces are synthetic, made by
+// traces/generate.py, as no traces recorded on hardware are available. The background sampler must take one reading
+// per pen down from the IRQ pin, however the reading ends. A busy SPI bus must fail the reading instead of returning
+// whatever was in the receive buffer.
+
+#include "math.h"
+#include "stdio.h"
+#include "test.h"
+#include "xpt2046.h"
+
+#define TEST_OLD_SAMPLES 16
+
+typedef struct {
+    /** Standard deviation of the accepted readings around their mean at each position, RMS over the positions and
+     * axes, in 12-bit counts and in pixels */
+    double jitter;
+    double pixel_jitter;
+    /** Largest distance of an accepted reading from the true position on one axis, in 12-bit counts */
+    double max_error;
+    double conversions_per_reading;
+    /** Conversions from the pen going down to the first accepted reading, averaged over the touches */
+    double press_conversions;
+    unsigned long readings;
+    /** Readings rejected after the touch was reported, which a polling caller takes for a release */
+    unsigned long dropped;
+} TestResultTypeDef;
+
+// Sums of the accepted readings of one position
+typedef struct {
+    double sum[4];
+    double sum_squares[4];
+    unsigned long count;
+} TestPositionTypeDef;
+
+// Reading of the old driver: the plain average of 16 conversions per axis, nothing if the pen lifted
+static bool OldReading(const Xpt2046_SampleTypeDef* sample, uint16_t* rawX, uint16_t* rawY) {
+    if (!sample->pen) return false;
+
+    uint_fast32_t sumX = 0, sumY = 0;
+    for (int i = 0; i < TEST_OLD_SAMPLES; i++) {
+        sumX += sample->x[i] << 3;
+        sumY += sample->y[i] << 3;
+    }
+    Xpt2046_Conversions += 2 * TEST_OLD_SAMPLES;
+    *rawX = sumX / TEST_OLD_SAMPLES;
+    *rawY = sumY / TEST_OLD_SAMPLES;
+    return true;
+}
+
+// Add the variance of a position, for the counts and pixels of both axes
+static void AddPosition(const TestPositionTypeDef* position, double* variance, double* pixelVariance, int* count) {
+    if (position->count < 2) return;
+
+    for (int i = 0; i < 4; i++) {
+        double mean = position->sum[i] / position->count;
+        double value = position->sum_squares[i] / position->count - mean * mean;
+        if (i < 2) {
+            *variance += value;
+        } else {
+            *pixelVariance += value;
+        }
+    }
+    *count += 2;
+}
+
+// Replay the loaded trace, through the driver with filter or through the old average without
+static TestResultTypeDef Replay(size_t sampleCount, const ILI9341_Touch_FilterTypeDef* filter) {
+    ILI9341_Touch_HandleTypeDef touch = Xpt2046_InitTouch(ILI9341_ROTATION_VERTICAL_1);
+    if (filter != NULL) ILI9341_Touch_SetFilter(&touch, *filter);
+    const ILI9341_Touch_CalibrationTypeDef* matrix = &touch.matrix;
+
+    TestResultTypeDef result = {0};
+    TestPositionTypeDef position = {0};
+    double variance = 0, pixelVariance = 0;
+    int varianceCount = 0;
+    bool reported = false;
+    unsigned long touches = 0, pressConversions = 0, touchStart = 0;
+    Xpt2046_Conversions = 0;
+
+    for (size_t i = 0; i < sampleCount; i++) {
+        const Xpt2046_SampleTypeDef* sample = Xpt2046_GetSample(i);
+        if (!sample->pen) {
+            AddPosition(&position, &variance, &pixelVariance, &varianceCount);
+            position = (TestPositionTypeDef){0};
+            reported = false;
+            touchStart = Xpt2046_Conversions;
+        }
+
+        Xpt2046_SetSample(i);
+        uint16_t rawX, rawY;
+        bool accepted =
+            filter != NULL ? ILI9341_Touch_GetRawCoordinates(&touch, &rawX, &rawY) : OldReading(sample, &rawX, &rawY);
+        if (!sample->pen) continue;
+
+        result.readings++;
+        if (!accepted) {
+            if (reported) result.dropped++;
+            continue;
+        }
+        if (!reported) {
+            reported = true;
+            touches++;
+            pressConversions += Xpt2046_Conversions - touchStart;
+        }
+
+        // Counts and pixels, mapped as ILI9341_Touch_GetCoordinates does
+        double values[4] = {
+            rawX / 8.0,
+            rawY / 8.0,
+            (matrix->a * rawX + matrix->b * rawY + matrix->c) >> 16,
+            (matrix->d * rawX + matrix->e * rawY + matrix->f) >> 16,
+        };
+        for (int axis = 0; axis < 4; axis++) {
+            position.sum[axis] += values[axis];
+            position.sum_squares[axis] += values[axis] * values[axis];
+        }
+        position.count++;
+
+        double error = fmax(fabs(values[0] - sample->true_x), fabs(values[1] - sample->true_y));
+        if (error > result.max_error) result.max_error = error;
+    }
+    AddPosition(&position, &variance, &pixelVariance, &varianceCount);
+
+    result.jitter = varianceCount > 0 ? sqrt(variance / varianceCount) : 0;
+    result.pixel_jitter = varianceCount > 0 ? sqrt(pixelVariance / varianceCount) : 0;
+    result.conversions_per_reading = result.readings > 0 ? (double)Xpt2046_Conversions / result.readings : 0;
+    result.press_conversions = touches > 0 ? (double)pressConversions / touches : 0;
+    return result;
+}
+
+static void PrintResult(const char* name, TestResultTypeDef result) {
+    printf(
+        "  %-26s jitter %5.2f (%4.2f px), max error %5.1f, %4.1f conversions per reading, pressed after %4.1f, %lu of "
+        "%lu dropped\n",
+        name,
+        result.jitter,
+        result.pixel_jitter,
+        result.max_error,
+        result.conversions_per_reading,
+        result.press_conversions,
+        result.dropped,
+        result.readings
+    );
+}
+
+static void TestTrace(const char* path) {
+    size_t sampleCount = Xpt2046_LoadTrace(path);
+    TEST_ASSERT(sampleCount > 0);
+    if (sampleCount == 0) return;
+
+    ILI9341_Touch_FilterTypeDef filter = Xpt2046_InitTouch(ILI9341_ROTATION_VERTICAL_1).filter;
+    ILI9341_Touch_FilterTypeDef trimmedMean = {
+        .samples = 6, .trim = 2, .max_spread = 1024, .max_delta = 4096, .smoothing = 1, .debounce = 0
+    };
+
+    TestResultTypeDef old = Replay(sampleCount, NULL);
+    TestResultTypeDef previous = Replay(sampleCount, &trimmedMean);
+    TestResultTypeDef current = Replay(sampleCount, &filter);
+
+    printf("%s, in 12-bit counts and pixels:\n", path);
+    PrintResult("16 averaged (old driver)", old);
+    PrintResult("6, middle 2 averaged", previous);
+    PrintResult("default filter", current);
+
+    TEST_ASSERT(current.conversions_per_reading <= 6);
+    TEST_ASSERT(current.jitter <= old.jitter);
+    TEST_ASSERT(current.max_error <= old.max_error);
+    TEST_ASSERT(current.dropped == 0);
+    TEST_ASSERT(current.press_conversions <= old.press_conversions);
+}
+
+// A reading rejected at the pen down must not make the EXTI interrupt fire again and again: every light touch is
+// rejected by the pressure gate, the IRQ pin samples once per pen down and leaves the retries to the timer
+static void TestPenIrq(void) {
+    Stub_ExtiPending = 0;
+    size_t sampleCount = Xpt2046_LoadTrace("traces/quiet.txt");
+    TEST_ASSERT(sampleCount > 0 && Xpt2046_GetSample(0)->pen);
+    if (sampleCount == 0) return;
+
+    ILI9341_Touch_HandleTypeDef touch = Xpt2046_InitTouch(ILI9341_ROTATION_VERTICAL_1);
+    ILI9341_Touch_FilterTypeDef filter = touch.filter;
+    filter.max_resistance = 1;
+    ILI9341_Touch_SetFilter(&touch, filter);
+    ILI9341_Touch_StartSampling(&touch, NULL);
+
+    // The HAL clears the pending line before calling the handler, and the interrupt fires again while it is pending
+    int interrupts = 0;
+    while ((Stub_ExtiPending & touch.irq_pin) && interrupts < 10) {
+        __HAL_GPIO_EXTI_CLEAR_IT(touch.irq_pin);
+        ILI9341_Touch_EXTI_Callback(&touch, touch.irq_pin);
+        interrupts++;
+    }
+    unsigned long reading = Xpt2046_Conversions;
+    TEST_ASSERT_EQUAL(1, interrupts);
+    TEST_ASSERT(reading > 0);
+    TEST_ASSERT(!touch.pressed);
+
+    // The timer tries again, an edge does not
+    ILI9341_Touch_TimerCallback(&touch);
+    TEST_ASSERT_EQUAL(2 * reading, Xpt2046_Conversions);
+    ILI9341_Touch_EXTI_Callback(&touch, touch.irq_pin);
+    TEST_ASSERT_EQUAL(2 * reading, Xpt2046_Conversions);
+
+    // Once the pen is lifted, the next touch is sampled from the IRQ pin again
+    size_t up = 0;
+    while (up < sampleCount && Xpt2046_GetSample(up)->pen) up++;
+    size_t down = up;
+    while (down < sampleCount && !Xpt2046_GetSample(down)->pen) down++;
+    TEST_ASSERT(down < sampleCount);
+    if (down >= sampleCount) return;
+
+    Xpt2046_SetSample(up);
+    ILI9341_Touch_TimerCallback(&touch);
+    Xpt2046_SetSample(down);
+    TEST_ASSERT(Stub_ExtiPending & touch.irq_pin);
+    __HAL_GPIO_EXTI_CLEAR_IT(touch.irq_pin);
+    ILI9341_Touch_EXTI_Callback(&touch, touch.irq_pin);
+    TEST_ASSERT_EQUAL(3 * reading, Xpt2046_Conversions);
+    TEST_ASSERT(!(Stub_ExtiPending & touch.irq_pin));
+
+    ILI9341_Touch_StopSampling(&touch);
+}
+
+// A transfer refused with HAL_BUSY sends nothing, so it must fail the reading and the auxiliary measurements
+static void TestBusyBus(void) {
+    size_t sampleCount = Xpt2046_LoadTrace("traces/quiet.txt");
+    TEST_ASSERT(sampleCount > 0 && Xpt2046_GetSample(0)->pen);
+    if (sampleCount == 0) return;
+
+    ILI9341_Touch_HandleTypeDef touch = Xpt2046_InitTouch(ILI9341_ROTATION_VERTICAL_1);
+    uint16_t rawX = 0;
+    uint16_t rawY = 0;
+    uint16_t millivolts = 1;
+    int16_t temperature = 1;
+
+    Xpt2046_Spi.busy = 1;
+    unsigned long conversions = Xpt2046_Conversions;
+    TEST_ASSERT(!ILI9341_Touch_GetRawCoordinates(&touch, &rawX, &rawY));
+    TEST_ASSERT(!ILI9341_Touch_ReadBattery(&touch, &millivolts));
+    TEST_ASSERT(!ILI9341_Touch_ReadTemperature(&touch, &temperature));
+    TEST_ASSERT_EQUAL(conversions, Xpt2046_Conversions);
+    TEST_ASSERT_EQUAL(1, millivolts);
+    TEST_ASSERT_EQUAL(1, temperature);
+
+    Xpt2046_Spi.busy = 0;
+    TEST_ASSERT(ILI9341_Touch_ReadBattery(&touch, &millivolts));
+    TEST_ASSERT(ILI9341_Touch_ReadTemperature(&touch, &temperature));
+    TEST_ASSERT(Xpt2046_Conversions > conversions);
+    for (uint_fast8_t i = 0; i <= touch.filter.debounce; i++) ILI9341_Touch_GetRawCoordinates(&touch, &rawX, &rawY);
+    TEST_ASSERT(ILI9341_Touch_GetRawCoordinates(&touch, &rawX, &rawY));
+}
+
+int main(void) {
+    TestTrace("traces/quiet.txt");
+    TestTrace("traces/noisy.txt");
+    TestTrace("traces/spikes.txt");
+    TestPenIrq();
+    TestBusyBus();
+
+    return Test_Result("test_touch");
+}
@@ -0,0 +1,55 @@
+# Generate the synthetic XPT2046 traces replayed by test_touch, see xpt2046.h for the format. No traces recorded on
+# hardware are available yet, so these follow a noise model instead: Gaussian noise on every conversion, a settling
+# error on the first conversion after the channel changes and, depending on the trace, spikes of a few hundred counts.
+#   python3 generate.py
+
+import random
+
+CONVERSIONS = 16  # per axis and sample, as many as the 16-sample average of the old driver used
+POSITIONS = 8
+SAMPLES = 40  # per position
+LIFTS = 3  # pen-up samples between positions
+
+TRACES = {
+    # name: (noise sigma, settling error, spike probability, spike size), in 12-bit counts
+    "quiet": (2.0, 10.0, 0.0, (0, 0)),
+    "noisy": (6.0, 12.0, 0.02, (150, 500)),
+    "spikes": (3.0, 10.0, 0.08, (150, 500)),
+}
+
+
+def conversion(rng: random.Random, value: float, first: bool, sigma: float, settle: float, spike: tuple) -> int:
+    value += rng.gauss(0, sigma)
+    if first:
+        value += settle + rng.gauss(0, settle / 2)
+    if rng.random() < spike[0]:
+        value += rng.choice((-1, 1)) * rng.uniform(*spike[1])
+    return max(0, min(4095, round(value)))
+
+
+def main() -> None:
+    for index, (name, (sigma, settle, probability, size)) in enumerate(TRACES.items()):
+        rng = random.Random(index + 1)
+        lines = [
+            f"# Synthetic trace '{name}' made by generate.py: noise sigma {sigma}, settling error {settle},",
+            f"# spike probability {probability}, spike size {size[0]}..{size[1]} (12-bit counts)",
+        ]
+        for position in range(POSITIONS):
+            x = rng.uniform(400, 3700)
+            y = rng.uniform(400, 3700)
+            lines.append(f"at {round(x)} {round(y)}")
+            for _ in range(SAMPLES):
+                spike = (probability, size)
+                xs = [conversion(rng, x, i == 0, sigma, settle, spike) for i in range(CONVERSIONS)]
+                ys = [conversion(rng, y, i == 0, sigma, settle, spike) for i in range(CONVERSIONS)]
+                z1 = conversion(rng, 400, True, sigma, settle, (0, (0, 0)))
+                z2 = conversion(rng, 1600, True, sigma, settle, (0, (0, 0)))
+                lines.append(" ".join(str(value) for value in xs + ys + [z1, z2]))
+            lines += ["up"] * LIFTS
+
+        with open(f"{name}.txt", "w") as file:
+            file.write("\n".join(lines) + "\n")
+
+
+if __name__ == "__main__":
+    main()
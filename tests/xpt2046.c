@@ -0,0 +1,204 @@
+#include "xpt2046.h"
+
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+// Channel bits A2..A0 of the control byte
+#define XPT2046_CHANNEL_Y 1
+#define XPT2046_CHANNEL_Z1 3
+#define XPT2046_CHANNEL_Z2 4
+#define XPT2046_CHANNEL_X 5
+
+#define XPT2046_CS_PIN 1
+#define XPT2046_IRQ_PIN 2
+
+GPIO_TypeDef Xpt2046_CsPort = {10}, Xpt2046_IrqPort = {11};
+SPI_HandleTypeDef Xpt2046_Spi = {2, 0};
+
+unsigned long Xpt2046_Conversions;
+
+static Xpt2046_SampleTypeDef samples[XPT2046_MAX_SAMPLES];
+static size_t sampleCount;
+static const Xpt2046_SampleTypeDef* sample;
+static int conversionsX, conversionsY;
+
+// Pin level and the result being shifted out
+static GPIO_PinState cs = GPIO_PIN_SET;
+static int result = -1;
+static bool lowByte;
+
+static void Xpt2046_Fail(const char* message) {
+    fprintf(stderr, "xpt2046: %s\n", message);
+    abort();
+}
+
+size_t Xpt2046_LoadTrace(const char* path) {
+    FILE* file = fopen(path, "r");
+    if (file == NULL) return 0;
+
+    char line[512];
+    int_fast16_t trueX = 0, trueY = 0;
+    sampleCount = 0;
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        if (line[0] == '#' || line[0] == '\n') continue;
+
+        int x, y;
+        if (sscanf(line, "at %d %d", &x, &y) == 2) {
+            trueX = x;
+            trueY = y;
+            continue;
+        }
+
+        if (sampleCount >= XPT2046_MAX_SAMPLES) break;
+        Xpt2046_SampleTypeDef* next = &samples[sampleCount];
+        memset(next, 0, sizeof(*next));
+        next->true_x = trueX;
+        next->true_y = trueY;
+
+        if (strncmp(line, "up", 2) != 0) {
+            uint16_t values[2 * XPT2046_TRACE_CONVERSIONS + 2];
+            char* c = line;
+            for (int i = 0; i < (int)(sizeof(values) / sizeof(values[0])); i++) {
+                char* end;
+                long value = strtol(c, &end, 10);
+                if (end == c || value < 0 || value > 4095) {
+                    fclose(file);
+                    return sampleCount = 0;
+                }
+                values[i] = value;
+                c = end;
+            }
+
+            next->pen = true;
+            memcpy(next->x, &values[0], sizeof(next->x));
+            memcpy(next->y, &values[XPT2046_TRACE_CONVERSIONS], sizeof(next->y));
+            next->z1 = values[2 * XPT2046_TRACE_CONVERSIONS];
+            next->z2 = values[2 * XPT2046_TRACE_CONVERSIONS + 1];
+        }
+        sampleCount++;
+    }
+
+    fclose(file);
+    Xpt2046_Conversions = 0;
+    sample = NULL;
+    if (sampleCount > 0) Xpt2046_SetSample(0);
+    return sampleCount;
+}
+
+const Xpt2046_SampleTypeDef* Xpt2046_GetSample(size_t index) {
+    return &samples[index];
+}
+
+void Xpt2046_SetSample(size_t index) {
+    // PENIRQ falls when the pen goes down
+    if ((sample == NULL || !sample->pen) && samples[index].pen) Stub_ExtiPending |= XPT2046_IRQ_PIN;
+
+    sample = &samples[index];
+    conversionsX = 0;
+    conversionsY = 0;
+}
+
+ILI9341_Touch_HandleTypeDef Xpt2046_InitTouch(int_fast8_t rotation) {
+    return ILI9341_Touch_Init(
+        &Xpt2046_Spi,
+        &Xpt2046_CsPort,
+        XPT2046_CS_PIN,
+        &Xpt2046_IrqPort,
+        XPT2046_IRQ_PIN,
+        rotation,
+        240,
+        320
+    );
+}
+
+// 12-bit result of a conversion of a channel
+static uint16_t Xpt2046_Convert(int channel) {
+    Xpt2046_Conversions++;
+    if (sample == NULL || !sample->pen) return 0;
+
+    switch (channel) {
+        case XPT2046_CHANNEL_X:
+            return sample->x[conversionsX < XPT2046_TRACE_CONVERSIONS ? conversionsX++ : conversionsX - 1];
+        case XPT2046_CHANNEL_Y:
+            return sample->y[conversionsY < XPT2046_TRACE_CONVERSIONS ? conversionsY++ : conversionsY - 1];
+        case XPT2046_CHANNEL_Z1:
+            return sample->z1;
+        case XPT2046_CHANNEL_Z2:
+            return sample->z2;
+        default:
+            return 0;
+    }
+}
+
+// The result of a conversion is shifted out in the two bytes after its control byte, MSB first after a leading zero
+static uint8_t Xpt2046_Byte(uint8_t byte) {
+    uint8_t out = 0;
+    if (result >= 0) {
+        out = lowByte ? result & 0xFF : result >> 8;
+        if (lowByte) result = -1;
+        lowByte = !lowByte;
+    }
+
+    if (byte & 0x80) {
+        if (result >= 0) Xpt2046_Fail("control byte before the last result was read");
+        result = Xpt2046_Convert((byte >> 4) & 0x07) << 3;
+        lowByte = false;
+
+        // Without power-down bits PENIRQ is enabled again after the conversion, and falls if the pen is down
+        if ((byte & 0x03) == 0 && sample != NULL && sample->pen) Stub_ExtiPending |= XPT2046_IRQ_PIN;
+    }
+    return out;
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin, GPIO_PinState PinState) {
+    (void)GPIO_Pin;
+    if (GPIOx != &Xpt2046_CsPort) return;
+
+    if (PinState == GPIO_PIN_SET) result = -1;
+    cs = PinState;
+}
+
+GPIO_PinState HAL_GPIO_ReadPin(GPIO_TypeDef* GPIOx, uint16_t GPIO_Pin) {
+    (void)GPIO_Pin;
+    if (GPIOx == &Xpt2046_CsPort) return cs;
+    if (GPIOx == &Xpt2046_IrqPort) return sample != NULL && sample->pen ? GPIO_PIN_RESET : GPIO_PIN_SET;
+    return GPIO_PIN_SET;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size, uint32_t Timeout) {
+    (void)Timeout;
+    if (hspi != &Xpt2046_Spi) return HAL_ERROR;
+    if (cs != GPIO_PIN_RESET) Xpt2046_Fail("transfer while CS is high");
+
+    for (uint16_t i = 0; i < Size; i++) Xpt2046_Byte(pData[i]);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_TransmitReceive(
+    SPI_HandleTypeDef* hspi,
+    uint8_t* pTxData,
+    uint8_t* pRxData,
+    uint16_t Size,
+    uint32_t Timeout
+) {
+    (void)Timeout;
+    if (hspi != &Xpt2046_Spi) return HAL_ERROR;
+    if (hspi->busy) return HAL_BUSY;
+    if (cs != GPIO_PIN_RESET) Xpt2046_Fail("transfer while CS is high");
+
+    for (uint16_t i = 0; i < Size; i++) pRxData[i] = Xpt2046_Byte(pTxData[i]);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef* hspi, uint8_t* pData, uint16_t Size) {
+    (void)hspi;
+    (void)pData;
+    (void)Size;
+    return HAL_ERROR;
+}
+
+HAL_SPI_StateTypeDef HAL_SPI_GetState(SPI_HandleTypeDef* hspi) {
+    return hspi->busy ? HAL_SPI_STATE_BUSY_TX : HAL_SPI_STATE_READY;
+}
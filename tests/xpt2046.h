@@ -0,0 +1,71 @@
+#ifndef __XPT2046_H__
+#define __XPT2046_H__
+
+// Host simulator of the XPT2046 touch controller: replays the conversions of a trace through the HAL stub and checks
+// the bus protocol. Any violation prints a message and aborts the test. A falling edge of PENIRQ, when the pen goes
+// down or a conversion enables PENIRQ again with the pen down, sets the IRQ pin in Stub_ExtiPending.
+//
+// Trace format, one line per touch sample, '#' starts a comment line:
+//   at <x> <y>   true position of the pen for the samples that follow, in 12-bit counts
+//   up           the pen does not touch the panel
+//   <XPT2046_TRACE_CONVERSIONS X conversions> <XPT2046_TRACE_CONVERSIONS Y conversions> <Z1> <Z2>
+//                12-bit results, each axis chained from its first conversion after the channel changed
+// A reading takes its conversions from the current sample in order, an axis that needs more than the trace holds gets
+// the last one again.
+
+#include "ili9341_touch.h"
+#include "stdbool.h"
+#include "stddef.h"
+#include "stdint.h"
+
+#define XPT2046_TRACE_CONVERSIONS 16
+#define XPT2046_MAX_SAMPLES 1024
+
+/**
+ * @brief Touch sample of a trace
+ */
+typedef struct {
+    bool pen;
+    /** Position of the last "at" line */
+    int_fast16_t true_x;
+    int_fast16_t true_y;
+    uint16_t x[XPT2046_TRACE_CONVERSIONS];
+    uint16_t y[XPT2046_TRACE_CONVERSIONS];
+    uint16_t z1;
+    uint16_t z2;
+} Xpt2046_SampleTypeDef;
+
+extern GPIO_TypeDef Xpt2046_CsPort, Xpt2046_IrqPort;
+extern SPI_HandleTypeDef Xpt2046_Spi;
+
+/** Conversions run since the trace was loaded */
+extern unsigned long Xpt2046_Conversions;
+
+/**
+ * @brief Load a trace, the first sample is current
+ * @param path Path of the trace file
+ * @return Number of samples, 0 if the file could not be read or has a malformed line
+ */
+size_t Xpt2046_LoadTrace(const char* path);
+
+/**
+ * @brief Get a sample of the loaded trace
+ * @param index Index of the sample
+ * @return Pointer to the sample
+ */
+const Xpt2046_SampleTypeDef* Xpt2046_GetSample(size_t index);
+
+/**
+ * @brief Make a sample current, the next conversions of each channel start from its first one
+ * @param index Index of the sample
+ */
+void Xpt2046_SetSample(size_t index);
+
+/**
+ * @brief Initialize a touchscreen on the simulated controller
+ * @param rotation Rotation of the touchscreen
+ * @return Initialized ILI9341_Touch_HandleTypeDef structure
+ */
+ILI9341_Touch_HandleTypeDef Xpt2046_InitTouch(int_fast8_t rotation);
+
+#endif  // __XPT2046_H__